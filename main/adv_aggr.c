@@ -0,0 +1,212 @@
+/**
+ * @file adv_aggr.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_aggr.h"
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+#define ADV_AGGR_MS_PER_SECOND (1000U)
+
+_Static_assert(ADV_AGGR_MEAS_NUM <= (sizeof(((adv_aggr_stat_t*)NULL)->meas_mask) * CHAR_BIT), "meas_mask");
+
+void
+adv_aggr_init(adv_aggr_t* const p_aggr, const ruuvi_gw_cfg_adv_aggr_t* const p_cfg)
+{
+    memset(p_aggr, 0, sizeof(*p_aggr));
+    p_aggr->mode      = p_cfg->mode;
+    p_aggr->period_ms = p_cfg->period_seconds * ADV_AGGR_MS_PER_SECOND;
+
+    for (uint32_t i = 0; i < ADV_AGGR_HASH_SIZE; ++i)
+    {
+        STAILQ_INIT(&p_aggr->hash_table[i]);
+    }
+    TAILQ_INIT(&p_aggr->lru_list);
+    for (uint32_t i = 0; i < ADV_AGGR_MAX_NUM_TAGS; ++i)
+    {
+        TAILQ_INSERT_TAIL(&p_aggr->lru_list, &p_aggr->tags[i], lru_list);
+    }
+}
+
+bool
+adv_aggr_is_decoding_needed(const adv_aggr_t* const p_aggr)
+{
+    return GW_CFG_ADV_AGGR_MODE_WINDOW == p_aggr->mode;
+}
+
+static uint32_t
+adv_aggr_calc_hash_idx(const mac_address_bin_t* const p_mac)
+{
+    uint32_t     hash_val           = 0;
+    const size_t mac_addr_half_size = sizeof(p_mac->mac) / sizeof(p_mac->mac[0]) / 2;
+    for (uint32_t i = 0; i < mac_addr_half_size; ++i)
+    {
+        hash_val |= ((uint32_t)p_mac->mac[i] ^ (uint32_t)p_mac->mac[i + mac_addr_half_size]) << (i * CHAR_BIT);
+    }
+    return hash_val % ADV_AGGR_HASH_SIZE;
+}
+
+static void
+adv_aggr_reset_window(adv_aggr_tag_t* const p_tag, const adv_aggr_time_ms_t now)
+{
+    p_tag->window_start = now;
+    p_tag->num_samples  = 0;
+    for (uint32_t i = 0; i < ADV_AGGR_MEAS_NUM; ++i)
+    {
+        p_tag->meas_cnt[i] = 0;
+        p_tag->meas_min[i] = 0;
+        p_tag->meas_max[i] = 0;
+        p_tag->meas_sum[i] = 0;
+    }
+}
+
+static adv_aggr_tag_t*
+adv_aggr_find_or_add_tag(
+    adv_aggr_t* const              p_aggr,
+    const mac_address_bin_t* const p_mac,
+    const adv_aggr_time_ms_t       now,
+    bool* const                    p_flag_added)
+{
+    const uint32_t  hash_idx = adv_aggr_calc_hash_idx(p_mac);
+    adv_aggr_tag_t* p_tag    = NULL;
+    STAILQ_FOREACH(p_tag, &p_aggr->hash_table[hash_idx], hash_list)
+    {
+        if (0 == memcmp(p_mac->mac, p_tag->mac.mac, sizeof(p_mac->mac)))
+        {
+            *p_flag_added = false;
+            return p_tag;
+        }
+    }
+    // Reuse the least recently seen tag
+    p_tag = TAILQ_LAST(&p_aggr->lru_list, adv_aggr_lru_list_t);
+    if (p_tag->is_in_hash_table)
+    {
+        STAILQ_REMOVE(&p_aggr->hash_table[adv_aggr_calc_hash_idx(&p_tag->mac)], p_tag, adv_aggr_tag_t, hash_list);
+    }
+    p_tag->mac = *p_mac;
+    STAILQ_INSERT_TAIL(&p_aggr->hash_table[hash_idx], p_tag, hash_list);
+    p_tag->is_in_hash_table = true;
+    adv_aggr_reset_window(p_tag, now);
+    *p_flag_added = true;
+    return p_tag;
+}
+
+static void
+adv_aggr_get_meas(const adv_decoded_t* const p_decoded, float* const p_meas)
+{
+    for (uint32_t i = 0; i < ADV_AGGR_MEAS_NUM; ++i)
+    {
+        p_meas[i] = NAN;
+    }
+    switch (p_decoded->data_format)
+    {
+        case ADV_DECODED_DATA_FORMAT_5:
+            p_meas[ADV_AGGR_MEAS_TEMPERATURE] = p_decoded->data.df5.temperature_c;
+            p_meas[ADV_AGGR_MEAS_HUMIDITY]    = p_decoded->data.df5.humidity_rh;
+            p_meas[ADV_AGGR_MEAS_PRESSURE]    = p_decoded->data.df5.pressure_pa;
+            break;
+        case ADV_DECODED_DATA_FORMAT_6:
+            p_meas[ADV_AGGR_MEAS_TEMPERATURE] = p_decoded->data.df6.temperature_c;
+            p_meas[ADV_AGGR_MEAS_HUMIDITY]    = p_decoded->data.df6.humidity_rh;
+            break;
+        case ADV_DECODED_DATA_FORMAT_E0:
+            p_meas[ADV_AGGR_MEAS_TEMPERATURE] = p_decoded->data.dfe0.temperature_c;
+            p_meas[ADV_AGGR_MEAS_HUMIDITY]    = p_decoded->data.dfe0.humidity_rh;
+            p_meas[ADV_AGGR_MEAS_PRESSURE]    = p_decoded->data.dfe0.pressure_pa;
+            break;
+        case ADV_DECODED_DATA_FORMAT_F0:
+            p_meas[ADV_AGGR_MEAS_TEMPERATURE] = p_decoded->data.dff0.temperature_c;
+            p_meas[ADV_AGGR_MEAS_HUMIDITY]    = p_decoded->data.dff0.humidity_rh;
+            p_meas[ADV_AGGR_MEAS_PRESSURE]    = p_decoded->data.dff0.pressure_pa;
+            break;
+        default:
+            break;
+    }
+}
+
+static void
+adv_aggr_accumulate(adv_aggr_tag_t* const p_tag, const adv_decoded_t* const p_decoded)
+{
+    float meas[ADV_AGGR_MEAS_NUM];
+    adv_aggr_get_meas(p_decoded, meas);
+    if (p_tag->num_samples < UINT16_MAX)
+    {
+        p_tag->num_samples += 1;
+    }
+    for (uint32_t i = 0; i < ADV_AGGR_MEAS_NUM; ++i)
+    {
+        const float val = meas[i];
+        if (isnan(val) || (UINT16_MAX == p_tag->meas_cnt[i]))
+        {
+            continue;
+        }
+        if ((0 == p_tag->meas_cnt[i]) || (val < p_tag->meas_min[i]))
+        {
+            p_tag->meas_min[i] = val;
+        }
+        if ((0 == p_tag->meas_cnt[i]) || (val > p_tag->meas_max[i]))
+        {
+            p_tag->meas_max[i] = val;
+        }
+        p_tag->meas_sum[i] += val;
+        p_tag->meas_cnt[i] += 1;
+    }
+}
+
+static void
+adv_aggr_get_stat(const adv_aggr_tag_t* const p_tag, adv_aggr_stat_t* const p_stat)
+{
+    p_stat->num_samples = p_tag->num_samples;
+    p_stat->meas_mask   = 0;
+    for (uint32_t i = 0; i < ADV_AGGR_MEAS_NUM; ++i)
+    {
+        if (0 == p_tag->meas_cnt[i])
+        {
+            continue;
+        }
+        p_stat->meas_mask |= (uint16_t)(1U << i);
+
+        p_stat->meas[i].min  = p_tag->meas_min[i];
+        p_stat->meas[i].max  = p_tag->meas_max[i];
+        p_stat->meas[i].mean = p_tag->meas_sum[i] / (float)p_tag->meas_cnt[i];
+    }
+}
+
+bool
+adv_aggr_put(
+    adv_aggr_t* const              p_aggr,
+    const mac_address_bin_t* const p_mac,
+    const adv_decoded_t* const     p_decoded,
+    const adv_aggr_time_ms_t       now,
+    adv_aggr_stat_t* const         p_stat)
+{
+    memset(p_stat, 0, sizeof(*p_stat));
+    if (GW_CFG_ADV_AGGR_MODE_NONE == p_aggr->mode)
+    {
+        return true;
+    }
+    bool                  flag_added = false;
+    adv_aggr_tag_t* const p_tag      = adv_aggr_find_or_add_tag(p_aggr, p_mac, now, &flag_added);
+    TAILQ_REMOVE(&p_aggr->lru_list, p_tag, lru_list);
+    TAILQ_INSERT_HEAD(&p_aggr->lru_list, p_tag, lru_list);
+
+    if (adv_aggr_is_decoding_needed(p_aggr))
+    {
+        adv_aggr_accumulate(p_tag, p_decoded);
+    }
+    // The unsigned subtraction handles the wrap-around of the uptime
+    if ((!flag_added) && ((adv_aggr_time_ms_t)(now - p_tag->window_start) < p_aggr->period_ms))
+    {
+        return false;
+    }
+    if (adv_aggr_is_decoding_needed(p_aggr))
+    {
+        adv_aggr_get_stat(p_tag, p_stat);
+    }
+    adv_aggr_reset_window(p_tag, now);
+    return true;
+}
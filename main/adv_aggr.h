@@ -0,0 +1,125 @@
+/**
+ * @file adv_aggr.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_ADV_AGGR_H
+#define RUUVI_GATEWAY_ESP_ADV_AGGR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sys/queue.h"
+#include "gw_cfg.h"
+#include "adv_decoded.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADV_AGGR_MAX_NUM_TAGS (GW_CFG_MAX_NUM_SENSORS)
+#define ADV_AGGR_HASH_SIZE    (101)
+
+typedef uint32_t adv_aggr_time_ms_t;
+
+/**
+ * @brief The decoded measurements which are aggregated in GW_CFG_ADV_AGGR_MODE_WINDOW.
+ */
+typedef enum adv_aggr_meas_e
+{
+    ADV_AGGR_MEAS_TEMPERATURE = 0,
+    ADV_AGGR_MEAS_HUMIDITY,
+    ADV_AGGR_MEAS_PRESSURE,
+    ADV_AGGR_MEAS_NUM,
+} adv_aggr_meas_e;
+
+typedef struct adv_aggr_meas_stat_t
+{
+    float min;
+    float max;
+    float mean;
+} adv_aggr_meas_stat_t;
+
+/**
+ * @brief The statistics over the window which are attached to the forwarded advertisement.
+ */
+typedef struct adv_aggr_stat_t
+{
+    uint16_t             num_samples; // 0 - the advertisement is not aggregated
+    uint16_t             meas_mask;   // Bit per adv_aggr_meas_e, set if the measurement was in at least one sample
+    adv_aggr_meas_stat_t meas[ADV_AGGR_MEAS_NUM];
+} adv_aggr_stat_t;
+
+typedef struct adv_aggr_tag_t adv_aggr_tag_t;
+
+struct adv_aggr_tag_t
+{
+    STAILQ_ENTRY(adv_aggr_tag_t) hash_list;
+    TAILQ_ENTRY(adv_aggr_tag_t) lru_list;
+    bool               is_in_hash_table;
+    mac_address_bin_t  mac;
+    adv_aggr_time_ms_t window_start;
+    uint16_t           num_samples;
+    uint16_t           meas_cnt[ADV_AGGR_MEAS_NUM];
+    float              meas_min[ADV_AGGR_MEAS_NUM];
+    float              meas_max[ADV_AGGR_MEAS_NUM];
+    float              meas_sum[ADV_AGGR_MEAS_NUM];
+};
+
+typedef STAILQ_HEAD(adv_aggr_hash_list_t, adv_aggr_tag_t) adv_aggr_hash_list_t;
+typedef TAILQ_HEAD(adv_aggr_lru_list_t, adv_aggr_tag_t) adv_aggr_lru_list_t;
+
+/**
+ * @brief The per-tag state of the downsampling, the least recently seen tag is reused when the table is full.
+ */
+typedef struct adv_aggr_t
+{
+    gw_cfg_adv_aggr_mode_e mode;
+    adv_aggr_time_ms_t     period_ms;
+    adv_aggr_hash_list_t   hash_table[ADV_AGGR_HASH_SIZE];
+    adv_aggr_lru_list_t    lru_list;
+    adv_aggr_tag_t         tags[ADV_AGGR_MAX_NUM_TAGS];
+} adv_aggr_t;
+
+/**
+ * @brief Apply the settings from gw_cfg and forget the state of all the tags.
+ * @param[out] p_aggr - pointer to the aggregation state.
+ * @param p_cfg - pointer to the settings.
+ */
+void
+adv_aggr_init(adv_aggr_t* const p_aggr, const ruuvi_gw_cfg_adv_aggr_t* const p_cfg);
+
+/**
+ * @brief Check if the advertisement needs to be decoded before calling adv_aggr_put.
+ * @param p_aggr - pointer to the aggregation state.
+ * @return true if the decoded measurements are aggregated.
+ */
+bool
+adv_aggr_is_decoding_needed(const adv_aggr_t* const p_aggr);
+
+/**
+ * @brief Account the advertisement and check if it must be forwarded.
+ * @note The first advertisement of the tag is forwarded immediately, then at most one per period is forwarded.
+ *       In GW_CFG_ADV_AGGR_MODE_WINDOW the forwarded advertisement carries the statistics over all the advertisements
+ *       since the previous forwarded one, including itself, so the extremes are not lost.
+ * @param p_aggr - pointer to the aggregation state.
+ * @param p_mac - pointer to the MAC address of the tag.
+ * @param p_decoded - pointer to the decoded measurements (used only if adv_aggr_is_decoding_needed returns true).
+ * @param now - the current uptime in milliseconds.
+ * @param[out] p_stat - pointer to the statistics, num_samples is 0 if the measurements are not aggregated.
+ * @return true if the advertisement must be forwarded.
+ */
+bool
+adv_aggr_put(
+    adv_aggr_t* const              p_aggr,
+    const mac_address_bin_t* const p_mac,
+    const adv_decoded_t* const     p_decoded,
+    const adv_aggr_time_ms_t       now,
+    adv_aggr_stat_t* const         p_stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_ADV_AGGR_H
@@ -10,6 +10,7 @@
 
 #include "json_stream_gen.h"
 #include "adv_table.h"
+#include "adv_decoded.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -17,23 +18,31 @@ extern "C" {
 
 JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
     adv_decode_df5_cb_json_stream_gen,
-    json_stream_gen_t* const  p_gen,
-    const adv_report_t* const p_adv);
+    json_stream_gen_t* const p_gen,
+    const re_5_data_t* const p_data);
 
 JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
     adv_decode_df6_cb_json_stream_gen,
-    json_stream_gen_t* const  p_gen,
-    const adv_report_t* const p_adv);
+    json_stream_gen_t* const p_gen,
+    const re_6_data_t* const p_data);
 
 JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
     adv_decode_dfxf0_cb_json_stream_gen,
     json_stream_gen_t* const  p_gen,
-    const adv_report_t* const p_adv);
+    const re_f0_data_t* const p_data);
 
 JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
     adv_decode_dfxe0_cb_json_stream_gen,
     json_stream_gen_t* const  p_gen,
-    const adv_report_t* const p_adv);
+    const re_e0_data_t* const p_data);
+
+/**
+ * @brief Add the statistics of adv_aggr over the window (the caller checks that num_samples is not zero).
+ */
+JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    adv_decode_aggr_cb_json_stream_gen,
+    json_stream_gen_t* const     p_gen,
+    const adv_aggr_stat_t* const p_stat);
 
 #ifdef __cplusplus
 }
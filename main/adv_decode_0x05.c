@@ -4,6 +4,7 @@
  */
 
 #include "adv_decode.h"
+#include "fmt_fast.h"
 #include "ruuvi_endpoint_5.h"
 
 #define NUM_BITS_PER_BYTE (8U)
@@ -11,68 +12,63 @@
 
 JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
     adv_decode_df5_cb_json_stream_gen,
-    json_stream_gen_t* const  p_gen,
-    const adv_report_t* const p_adv)
+    json_stream_gen_t* const p_gen,
+    const re_5_data_t* const p_data)
 {
-    re_5_data_t       data          = { 0 };
-    const re_status_t decode_status = re_5_decode(p_adv->data_buf, &data);
-    if (RE_SUCCESS == decode_status)
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "dataFormat", RE_5_DESTINATION);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "temperature",
+        p_data->temperature_c,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "humidity",
+        p_data->humidity_rh,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_4);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "pressure",
+        p_data->pressure_pa,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_0);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "accelX",
+        p_data->accelerationx_g,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "accelY",
+        p_data->accelerationy_g,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "accelZ",
+        p_data->accelerationz_g,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "movementCounter",
+        p_data->movement_count,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_0);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "voltage",
+        p_data->battery_v,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "txPower",
+        p_data->tx_power,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_0);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "measurementSequenceNumber", p_data->measurement_count);
+    mac_address_bin_t tag_mac = { 0 };
+    for (uint32_t mac_idx = 0; mac_idx < MAC_ADDRESS_NUM_BYTES; ++mac_idx)
     {
-        JSON_STREAM_GEN_ADD_INT32(p_gen, "dataFormat", RE_5_DESTINATION);
-        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
-            p_gen,
-            "temperature",
-            data.temperature_c,
-            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
-        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
-            p_gen,
-            "humidity",
-            data.humidity_rh,
-            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_4);
-        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
-            p_gen,
-            "pressure",
-            data.pressure_pa,
-            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_0);
-        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
-            p_gen,
-            "accelX",
-            data.accelerationx_g,
-            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
-        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
-            p_gen,
-            "accelY",
-            data.accelerationy_g,
-            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
-        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
-            p_gen,
-            "accelZ",
-            data.accelerationz_g,
-            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
-        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
-            p_gen,
-            "movementCounter",
-            data.movement_count,
-            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_0);
-        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
-            p_gen,
-            "voltage",
-            data.battery_v,
-            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
-        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
-            p_gen,
-            "txPower",
-            data.tx_power,
-            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_0);
-        JSON_STREAM_GEN_ADD_INT32(p_gen, "measurementSequenceNumber", data.measurement_count);
-        mac_address_bin_t tag_mac = { 0 };
-        for (uint32_t mac_idx = 0; mac_idx < MAC_ADDRESS_NUM_BYTES; ++mac_idx)
-        {
-            tag_mac.mac[mac_idx] = (data.address >> ((MAC_ADDRESS_NUM_BYTES - mac_idx - 1U) * NUM_BITS_PER_BYTE))
-                                   & BYTE_MASK;
-        }
-        const mac_address_str_t tag_mac_str = mac_address_to_str(&tag_mac);
-        JSON_STREAM_GEN_ADD_STRING(p_gen, "id", tag_mac_str.str_buf);
+        tag_mac.mac[mac_idx] = (p_data->address >> ((MAC_ADDRESS_NUM_BYTES - mac_idx - 1U) * NUM_BITS_PER_BYTE))
+                               & BYTE_MASK;
     }
+    const mac_address_str_t tag_mac_str = fmt_fast_mac_to_str(&tag_mac);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "id", tag_mac_str.str_buf);
     JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
 }
@@ -0,0 +1,78 @@
+/**
+ * @author TheSomeMan
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_decode.h"
+
+static bool
+adv_decode_aggr_is_meas_valid(const adv_aggr_stat_t* const p_stat, const adv_aggr_meas_e meas)
+{
+    return 0 != (p_stat->meas_mask & (1U << (uint32_t)meas));
+}
+
+JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    adv_decode_aggr_cb_json_stream_gen,
+    json_stream_gen_t* const     p_gen,
+    const adv_aggr_stat_t* const p_stat)
+{
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "aggrSamples", p_stat->num_samples);
+    if (adv_decode_aggr_is_meas_valid(p_stat, ADV_AGGR_MEAS_TEMPERATURE))
+    {
+        const adv_aggr_meas_stat_t* const p_meas = &p_stat->meas[ADV_AGGR_MEAS_TEMPERATURE];
+        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+            p_gen,
+            "temperatureMin",
+            p_meas->min,
+            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
+        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+            p_gen,
+            "temperatureMax",
+            p_meas->max,
+            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
+        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+            p_gen,
+            "temperatureMean",
+            p_meas->mean,
+            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_3);
+    }
+    if (adv_decode_aggr_is_meas_valid(p_stat, ADV_AGGR_MEAS_HUMIDITY))
+    {
+        const adv_aggr_meas_stat_t* const p_meas = &p_stat->meas[ADV_AGGR_MEAS_HUMIDITY];
+        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+            p_gen,
+            "humidityMin",
+            p_meas->min,
+            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_4);
+        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+            p_gen,
+            "humidityMax",
+            p_meas->max,
+            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_4);
+        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+            p_gen,
+            "humidityMean",
+            p_meas->mean,
+            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_4);
+    }
+    if (adv_decode_aggr_is_meas_valid(p_stat, ADV_AGGR_MEAS_PRESSURE))
+    {
+        const adv_aggr_meas_stat_t* const p_meas = &p_stat->meas[ADV_AGGR_MEAS_PRESSURE];
+        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+            p_gen,
+            "pressureMin",
+            p_meas->min,
+            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_0);
+        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+            p_gen,
+            "pressureMax",
+            p_meas->max,
+            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_0);
+        JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+            p_gen,
+            "pressureMean",
+            p_meas->mean,
+            JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_0);
+    }
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
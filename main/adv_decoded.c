@@ -0,0 +1,63 @@
+/**
+ * @file adv_decoded.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_decoded.h"
+#include <string.h>
+#include "fmt_fast.h"
+
+void
+adv_decoded_decode(const uint8_t* const p_data_buf, adv_decoded_t* const p_decoded)
+{
+    memset(p_decoded, 0, sizeof(*p_decoded));
+    p_decoded->data_format = ADV_DECODED_DATA_FORMAT_UNKNOWN;
+    if (re_5_check_format(p_data_buf))
+    {
+        if (RE_SUCCESS == re_5_decode(p_data_buf, &p_decoded->data.df5))
+        {
+            p_decoded->data_format = ADV_DECODED_DATA_FORMAT_5;
+        }
+    }
+    else if (re_6_check_format(p_data_buf))
+    {
+        if (RE_SUCCESS == re_6_decode(p_data_buf, &p_decoded->data.df6))
+        {
+            p_decoded->data_format = ADV_DECODED_DATA_FORMAT_6;
+        }
+    }
+    else if (re_f0_check_format(p_data_buf))
+    {
+        if (RE_SUCCESS == re_f0_decode(p_data_buf, &p_decoded->data.dff0))
+        {
+            p_decoded->data_format = ADV_DECODED_DATA_FORMAT_F0;
+        }
+    }
+    else if (re_e0_check_format(p_data_buf))
+    {
+        if (RE_SUCCESS == re_e0_decode(p_data_buf, &p_decoded->data.dfe0))
+        {
+            p_decoded->data_format = ADV_DECODED_DATA_FORMAT_E0;
+        }
+    }
+    else
+    {
+        // Unknown data format
+    }
+}
+
+const mac_address_str_t*
+adv_decoded_get_mac_str(
+    const mac_address_str_t* const p_mac_str,
+    const mac_address_bin_t* const p_mac,
+    mac_address_str_t* const       p_tmp_buf)
+{
+    if ('\0' != p_mac_str->str_buf[0])
+    {
+        return p_mac_str;
+    }
+    *p_tmp_buf = fmt_fast_mac_to_str(p_mac);
+    return p_tmp_buf;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file adv_decoded.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_ADV_DECODED_H
+#define RUUVI_GATEWAY_ESP_ADV_DECODED_H
+
+#include <stdint.h>
+#include "mac_addr.h"
+#include "ruuvi_endpoint_5.h"
+#include "ruuvi_endpoint_6.h"
+#include "ruuvi_endpoint_e0.h"
+#include "ruuvi_endpoint_f0.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum adv_decoded_data_format_e
+{
+    ADV_DECODED_DATA_FORMAT_UNKNOWN = 0, // payload is not a known Ruuvi data format
+    ADV_DECODED_DATA_FORMAT_5,
+    ADV_DECODED_DATA_FORMAT_6,
+    ADV_DECODED_DATA_FORMAT_E0,
+    ADV_DECODED_DATA_FORMAT_F0,
+} adv_decoded_data_format_e;
+
+typedef struct adv_decoded_t
+{
+    adv_decoded_data_format_e data_format;
+    union
+    {
+        re_5_data_t  df5;
+        re_6_data_t  df6;
+        re_e0_data_t dfe0;
+        re_f0_data_t dff0;
+    } data;
+} adv_decoded_t;
+
+/**
+ * @brief Decode the raw advertisement payload into the decoded-measurement representation.
+ * @param p_data_buf - pointer to the raw BLE advertisement data.
+ * @param p_decoded - pointer to the output structure,
+ *                    data_format is set to ADV_DECODED_DATA_FORMAT_UNKNOWN if the data format is not supported.
+ */
+void
+adv_decoded_decode(const uint8_t* const p_data_buf, adv_decoded_t* const p_decoded);
+
+/**
+ * @brief Get the MAC address string, format it into the temporary buffer only if it was not done yet.
+ * @param p_mac_str - pointer to the MAC address string stored next to the binary MAC address (empty if not formatted).
+ * @param p_mac - pointer to the binary MAC address.
+ * @param p_tmp_buf - pointer to the temporary buffer.
+ * @return pointer to p_mac_str if the MAC address was already formatted or to p_tmp_buf otherwise.
+ */
+const mac_address_str_t*
+adv_decoded_get_mac_str(
+    const mac_address_str_t* const p_mac_str,
+    const mac_address_bin_t* const p_mac,
+    mac_address_str_t* const       p_tmp_buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_ADV_DECODED_H
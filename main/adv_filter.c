@@ -0,0 +1,268 @@
+/**
+ * @file adv_filter.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_filter.h"
+#include <string.h>
+
+#define ADV_FILTER_AD_TYPE_MANUFACTURER_DATA (0xFFU)
+#define ADV_FILTER_AD_HDR_LEN                (2U) // length, type
+#define ADV_FILTER_MANUFACTURER_ID_LEN       (2U)
+#define ADV_FILTER_BITS_PER_BYTE             (8U)
+#define ADV_FILTER_RSSI_MIN                  (-128)
+#define ADV_FILTER_RSSI_MAX                  (127)
+
+_Static_assert(
+    GW_CFG_MAX_NUM_ADV_FILTER_RULES <= (sizeof(adv_filter_rule_mask_t) * ADV_FILTER_BITS_PER_BYTE),
+    "adv_filter_rule_mask_t is too small");
+
+static uint32_t
+adv_filter_add_manufacturer_id(adv_filter_t* const p_filter, const uint16_t manufacturer_id)
+{
+    for (uint32_t i = 0; i < p_filter->num_manufacturer_ids; ++i)
+    {
+        if (manufacturer_id == p_filter->manufacturer_ids[i])
+        {
+            return i;
+        }
+    }
+    const uint32_t idx                       = p_filter->num_manufacturer_ids;
+    p_filter->manufacturer_ids[idx]          = manufacturer_id;
+    p_filter->rules_for_manufacturer_id[idx] = 0;
+    p_filter->num_manufacturer_ids += 1;
+    return idx;
+}
+
+static uint32_t
+adv_filter_add_mac_oui(adv_filter_t* const p_filter, const uint8_t* const p_mac_oui)
+{
+    for (uint32_t i = 0; i < p_filter->num_mac_ouis; ++i)
+    {
+        if (0 == memcmp(p_mac_oui, p_filter->mac_ouis[i], GW_CFG_ADV_FILTER_MAC_OUI_NUM_BYTES))
+        {
+            return i;
+        }
+    }
+    const uint32_t idx = p_filter->num_mac_ouis;
+    memcpy(p_filter->mac_ouis[idx], p_mac_oui, GW_CFG_ADV_FILTER_MAC_OUI_NUM_BYTES);
+    p_filter->rules_for_mac_oui[idx] = 0;
+    p_filter->num_mac_ouis += 1;
+    return idx;
+}
+
+static void
+adv_filter_compile_rule(
+    adv_filter_t* const                         p_filter,
+    const uint32_t                              rule_idx,
+    const ruuvi_gw_cfg_adv_filter_rule_t* const p_rule)
+{
+    const adv_filter_rule_mask_t rule_bit = (adv_filter_rule_mask_t)(1U << rule_idx);
+    p_filter->all_rules |= rule_bit;
+
+    if (p_rule->use_data_format)
+    {
+        p_filter->rules_for_data_format[p_rule->data_format] |= rule_bit;
+    }
+    else
+    {
+        for (uint32_t i = 0; i < ADV_FILTER_NUM_BYTE_VALUES; ++i)
+        {
+            p_filter->rules_for_data_format[i] |= rule_bit;
+        }
+        p_filter->rules_any_data_format |= rule_bit;
+    }
+
+    for (int32_t rssi = ADV_FILTER_RSSI_MIN; rssi <= ADV_FILTER_RSSI_MAX; ++rssi)
+    {
+        if ((!p_rule->use_rssi_min) || (rssi >= p_rule->rssi_min))
+        {
+            p_filter->rules_for_rssi[(uint8_t)(int8_t)rssi] |= rule_bit;
+        }
+    }
+
+    if ((!p_rule->use_manufacturer_id) && (!p_rule->use_data_format) && (0 == p_rule->payload_prefix_len))
+    {
+        p_filter->rules_without_manufacturer_data |= rule_bit;
+    }
+
+    if (p_rule->use_manufacturer_id)
+    {
+        const uint32_t idx = adv_filter_add_manufacturer_id(p_filter, p_rule->manufacturer_id);
+        p_filter->rules_for_manufacturer_id[idx] |= rule_bit;
+    }
+    else
+    {
+        p_filter->rules_any_manufacturer_id |= rule_bit;
+    }
+
+    if (p_rule->use_mac_oui)
+    {
+        const uint32_t idx = adv_filter_add_mac_oui(p_filter, p_rule->mac_oui);
+        p_filter->rules_for_mac_oui[idx] |= rule_bit;
+    }
+    else
+    {
+        p_filter->rules_any_mac_oui |= rule_bit;
+    }
+
+    if (0 != p_rule->payload_prefix_len)
+    {
+        const uint8_t prefix_len = (p_rule->payload_prefix_len <= GW_CFG_ADV_FILTER_PREFIX_MAX_LEN)
+                                       ? p_rule->payload_prefix_len
+                                       : (uint8_t)GW_CFG_ADV_FILTER_PREFIX_MAX_LEN;
+        p_filter->rules_with_payload_prefix |= rule_bit;
+
+        p_filter->payload_prefix_len[rule_idx] = prefix_len;
+        for (uint32_t i = 0; i < prefix_len; ++i)
+        {
+            // The prefix is masked in advance, so only the payload needs to be masked on check
+            p_filter->payload_mask[rule_idx][i]   = p_rule->payload_mask[i];
+            p_filter->payload_prefix[rule_idx][i] = p_rule->payload_prefix[i] & p_rule->payload_mask[i];
+        }
+    }
+}
+
+void
+adv_filter_compile(adv_filter_t* const p_filter, const ruuvi_gw_cfg_adv_filter_t* const p_cfg)
+{
+    memset(p_filter, 0, sizeof(*p_filter));
+    const uint32_t num_rules = (p_cfg->num_rules <= GW_CFG_MAX_NUM_ADV_FILTER_RULES)
+                                   ? p_cfg->num_rules
+                                   : GW_CFG_MAX_NUM_ADV_FILTER_RULES;
+    for (uint32_t i = 0; i < num_rules; ++i)
+    {
+        adv_filter_compile_rule(p_filter, i, &p_cfg->rules[i]);
+    }
+}
+
+static bool
+adv_filter_find_manufacturer_data(
+    const uint8_t* const  p_data,
+    const uint32_t        data_len,
+    uint16_t* const       p_manufacturer_id,
+    const uint8_t** const p_p_payload,
+    uint32_t* const       p_payload_len)
+{
+    uint32_t offset = 0;
+    while ((offset + ADV_FILTER_AD_HDR_LEN) <= data_len)
+    {
+        const uint32_t ad_len = p_data[offset];
+        if ((0 == ad_len) || ((offset + 1 + ad_len) > data_len))
+        {
+            break;
+        }
+        if ((ADV_FILTER_AD_TYPE_MANUFACTURER_DATA == p_data[offset + 1])
+            && (ad_len >= (1U + ADV_FILTER_MANUFACTURER_ID_LEN)))
+        {
+            const uint8_t* const p_manufacturer_data = &p_data[offset + ADV_FILTER_AD_HDR_LEN];
+
+            *p_manufacturer_id = (uint16_t)(p_manufacturer_data[0]
+                                            | ((uint16_t)p_manufacturer_data[1] << ADV_FILTER_BITS_PER_BYTE));
+            *p_p_payload       = &p_manufacturer_data[ADV_FILTER_MANUFACTURER_ID_LEN];
+            *p_payload_len     = ad_len - 1U - ADV_FILTER_MANUFACTURER_ID_LEN;
+            return true;
+        }
+        offset += 1 + ad_len;
+    }
+    return false;
+}
+
+static adv_filter_rule_mask_t
+adv_filter_get_rules_for_manufacturer_id(const adv_filter_t* const p_filter, const uint16_t manufacturer_id)
+{
+    for (uint32_t i = 0; i < p_filter->num_manufacturer_ids; ++i)
+    {
+        if (manufacturer_id == p_filter->manufacturer_ids[i])
+        {
+            return p_filter->rules_any_manufacturer_id | p_filter->rules_for_manufacturer_id[i];
+        }
+    }
+    return p_filter->rules_any_manufacturer_id;
+}
+
+static adv_filter_rule_mask_t
+adv_filter_get_rules_for_mac_oui(const adv_filter_t* const p_filter, const mac_address_bin_t* const p_mac)
+{
+    for (uint32_t i = 0; i < p_filter->num_mac_ouis; ++i)
+    {
+        if (0 == memcmp(p_mac->mac, p_filter->mac_ouis[i], GW_CFG_ADV_FILTER_MAC_OUI_NUM_BYTES))
+        {
+            return p_filter->rules_any_mac_oui | p_filter->rules_for_mac_oui[i];
+        }
+    }
+    return p_filter->rules_any_mac_oui;
+}
+
+static adv_filter_rule_mask_t
+adv_filter_check_payload_prefixes(
+    const adv_filter_t* const    p_filter,
+    const adv_filter_rule_mask_t rules,
+    const uint8_t* const         p_payload,
+    const uint32_t               payload_len)
+{
+    adv_filter_rule_mask_t accepted_rules = rules;
+    adv_filter_rule_mask_t rules_to_check = rules & p_filter->rules_with_payload_prefix;
+    for (uint32_t rule_idx = 0; 0 != rules_to_check; ++rule_idx)
+    {
+        const adv_filter_rule_mask_t rule_bit = (adv_filter_rule_mask_t)(1U << rule_idx);
+        if (0 == (rules_to_check & rule_bit))
+        {
+            continue;
+        }
+        rules_to_check &= (adv_filter_rule_mask_t)~rule_bit;
+
+        const uint32_t prefix_len = p_filter->payload_prefix_len[rule_idx];
+        bool           is_match   = (prefix_len <= payload_len);
+        for (uint32_t i = 0; is_match && (i < prefix_len); ++i)
+        {
+            if ((p_payload[i] & p_filter->payload_mask[rule_idx][i]) != p_filter->payload_prefix[rule_idx][i])
+            {
+                is_match = false;
+            }
+        }
+        if (!is_match)
+        {
+            accepted_rules &= (adv_filter_rule_mask_t)~rule_bit;
+        }
+    }
+    return accepted_rules;
+}
+
+bool
+adv_filter_check(
+    const adv_filter_t* const      p_filter,
+    const mac_address_bin_t* const p_mac,
+    const int8_t                   rssi,
+    const uint8_t* const           p_data,
+    const uint32_t                 data_len)
+{
+    if (0 == p_filter->all_rules)
+    {
+        return true;
+    }
+    adv_filter_rule_mask_t rules = p_filter->all_rules;
+    rules &= p_filter->rules_for_rssi[(uint8_t)rssi];
+    rules &= adv_filter_get_rules_for_mac_oui(p_filter, p_mac);
+    if (0 == rules)
+    {
+        return false;
+    }
+
+    uint16_t       manufacturer_id = 0;
+    const uint8_t* p_payload       = NULL;
+    uint32_t       payload_len     = 0;
+    if (!adv_filter_find_manufacturer_data(p_data, data_len, &manufacturer_id, &p_payload, &payload_len))
+    {
+        return 0 != (rules & p_filter->rules_without_manufacturer_data);
+    }
+    rules &= adv_filter_get_rules_for_manufacturer_id(p_filter, manufacturer_id);
+    rules &= (0 != payload_len) ? p_filter->rules_for_data_format[p_payload[0]] : p_filter->rules_any_data_format;
+    if (0 != (rules & p_filter->rules_with_payload_prefix))
+    {
+        rules = adv_filter_check_payload_prefixes(p_filter, rules, p_payload, payload_len);
+    }
+    return 0 != rules;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file adv_filter.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_ADV_FILTER_H
+#define RUUVI_GATEWAY_ESP_ADV_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gw_cfg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADV_FILTER_NUM_BYTE_VALUES (256U)
+
+/**
+ * @brief Bit per rule of ruuvi_gw_cfg_adv_filter_t.
+ */
+typedef uint16_t adv_filter_rule_mask_t;
+
+/**
+ * @brief The filter rules compiled into the decision table: for every condition there is a mask of the rules
+ *        which accept the value, so the advertisement is checked by ANDing a few masks
+ *        without iterating over the rules.
+ */
+typedef struct adv_filter_t
+{
+    adv_filter_rule_mask_t all_rules; // 0 - there are no rules, all the advertisements are accepted
+    adv_filter_rule_mask_t rules_for_data_format[ADV_FILTER_NUM_BYTE_VALUES];
+    adv_filter_rule_mask_t rules_any_data_format;
+    adv_filter_rule_mask_t rules_for_rssi[ADV_FILTER_NUM_BYTE_VALUES]; // Indexed by (uint8_t)rssi
+    adv_filter_rule_mask_t rules_without_manufacturer_data; // The rules which don't check the manufacturer data
+    adv_filter_rule_mask_t rules_any_manufacturer_id;
+    adv_filter_rule_mask_t rules_any_mac_oui;
+    adv_filter_rule_mask_t rules_with_payload_prefix;
+    uint32_t               num_manufacturer_ids;
+    uint16_t               manufacturer_ids[GW_CFG_MAX_NUM_ADV_FILTER_RULES];
+    adv_filter_rule_mask_t rules_for_manufacturer_id[GW_CFG_MAX_NUM_ADV_FILTER_RULES];
+    uint32_t               num_mac_ouis;
+    uint8_t                mac_ouis[GW_CFG_MAX_NUM_ADV_FILTER_RULES][GW_CFG_ADV_FILTER_MAC_OUI_NUM_BYTES];
+    adv_filter_rule_mask_t rules_for_mac_oui[GW_CFG_MAX_NUM_ADV_FILTER_RULES];
+    uint8_t                payload_prefix_len[GW_CFG_MAX_NUM_ADV_FILTER_RULES];
+    uint8_t                payload_prefix[GW_CFG_MAX_NUM_ADV_FILTER_RULES][GW_CFG_ADV_FILTER_PREFIX_MAX_LEN];
+    uint8_t                payload_mask[GW_CFG_MAX_NUM_ADV_FILTER_RULES][GW_CFG_ADV_FILTER_PREFIX_MAX_LEN];
+} adv_filter_t;
+
+/**
+ * @brief Compile the filter rules from gw_cfg into the decision table.
+ * @param[out] p_filter - pointer to the compiled filter.
+ * @param p_cfg - pointer to the filter rules.
+ */
+void
+adv_filter_compile(adv_filter_t* const p_filter, const ruuvi_gw_cfg_adv_filter_t* const p_cfg);
+
+/**
+ * @brief Check if the advertisement is accepted by the compiled filter.
+ * @param p_filter - pointer to the compiled filter.
+ * @param p_mac - pointer to the MAC address of the tag.
+ * @param rssi - RSSI of the advertisement.
+ * @param p_data - pointer to the advertisement data (the sequence of AD structures).
+ * @param data_len - length of the advertisement data.
+ * @return true if the advertisement is accepted.
+ */
+bool
+adv_filter_check(
+    const adv_filter_t* const      p_filter,
+    const mac_address_bin_t* const p_mac,
+    const int8_t                   rssi,
+    const uint8_t* const           p_data,
+    const uint32_t                 data_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_ADV_FILTER_H
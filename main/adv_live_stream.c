@@ -0,0 +1,251 @@
+/**
+ * @file adv_live_stream.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_live_stream.h"
+#include <string.h>
+#include "os_mutex.h"
+
+typedef struct adv_live_stream_client_t
+{
+    adv_live_stream_client_id_t client_id; //!< ADV_LIVE_STREAM_CLIENT_ID_INVALID if the slot is free
+    adv_live_stream_time_ms_t   last_poll;
+    adv_table_ticket_t          pending_ticket; //!< ADV_TABLE_TICKET_NONE if there is no read in flight
+    num_of_advs_t               pending_num_advs;
+} adv_live_stream_client_t;
+
+static adv_live_stream_client_t    g_adv_live_stream_clients[ADV_LIVE_STREAM_MAX_NUM_CLIENTS];
+static adv_live_stream_client_id_t g_adv_live_stream_last_client_id;
+static adv_live_stream_stat_t      g_adv_live_stream_stat;
+static os_mutex_t                  g_p_adv_live_stream_mutex;
+static os_mutex_static_t           g_adv_live_stream_mutex_mem;
+
+static void
+adv_live_stream_lock(void)
+{
+    if (NULL == g_p_adv_live_stream_mutex)
+    {
+        g_p_adv_live_stream_mutex = os_mutex_create_static(&g_adv_live_stream_mutex_mem);
+    }
+    os_mutex_lock(g_p_adv_live_stream_mutex);
+}
+
+static void
+adv_live_stream_unlock(void)
+{
+    os_mutex_unlock(g_p_adv_live_stream_mutex);
+}
+
+void
+adv_live_stream_init(void)
+{
+    adv_live_stream_lock();
+    memset(g_adv_live_stream_clients, 0, sizeof(g_adv_live_stream_clients));
+    memset(&g_adv_live_stream_stat, 0, sizeof(g_adv_live_stream_stat));
+    g_adv_live_stream_last_client_id = ADV_LIVE_STREAM_CLIENT_ID_INVALID;
+    adv_live_stream_unlock();
+}
+
+static adv_table_target_e
+adv_live_stream_get_target(const uint32_t slot_idx)
+{
+    return (adv_table_target_e)((uint32_t)ADV_TABLE_TARGET_LIVE_STREAM_FIRST + slot_idx);
+}
+
+static void
+adv_live_stream_free_slot_unsafe(adv_live_stream_client_t* const p_client)
+{
+    // The read in flight is dropped, the advs must not be returned to the next client of the slot
+    adv_table_retransmission_commit(p_client->pending_ticket);
+    p_client->pending_ticket = ADV_TABLE_TICKET_NONE;
+    p_client->client_id      = ADV_LIVE_STREAM_CLIENT_ID_INVALID;
+    g_adv_live_stream_stat.num_clients -= 1;
+}
+
+static void
+adv_live_stream_expire_clients_unsafe(const adv_live_stream_time_ms_t now)
+{
+    for (uint32_t i = 0; i < ADV_LIVE_STREAM_MAX_NUM_CLIENTS; ++i)
+    {
+        adv_live_stream_client_t* const p_client = &g_adv_live_stream_clients[i];
+        // The unsigned subtraction handles the wrap-around of the uptime
+        if ((ADV_LIVE_STREAM_CLIENT_ID_INVALID != p_client->client_id)
+            && ((adv_live_stream_time_ms_t)(now - p_client->last_poll) >= ADV_LIVE_STREAM_CLIENT_TIMEOUT_MS))
+        {
+            adv_live_stream_free_slot_unsafe(p_client);
+            g_adv_live_stream_stat.cnt_expired += 1;
+        }
+    }
+}
+
+static adv_live_stream_client_t*
+adv_live_stream_find_client_unsafe(const adv_live_stream_client_id_t client_id, uint32_t* const p_slot_idx)
+{
+    if (ADV_LIVE_STREAM_CLIENT_ID_INVALID == client_id)
+    {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < ADV_LIVE_STREAM_MAX_NUM_CLIENTS; ++i)
+    {
+        if (client_id == g_adv_live_stream_clients[i].client_id)
+        {
+            *p_slot_idx = i;
+            return &g_adv_live_stream_clients[i];
+        }
+    }
+    return NULL;
+}
+
+static bool
+adv_live_stream_find_free_slot_unsafe(uint32_t* const p_slot_idx)
+{
+    for (uint32_t i = 0; i < ADV_LIVE_STREAM_MAX_NUM_CLIENTS; ++i)
+    {
+        if (ADV_LIVE_STREAM_CLIENT_ID_INVALID == g_adv_live_stream_clients[i].client_id)
+        {
+            *p_slot_idx = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+adv_live_stream_client_id_t
+adv_live_stream_subscribe(const adv_live_stream_time_ms_t now)
+{
+    adv_live_stream_lock();
+    adv_live_stream_expire_clients_unsafe(now);
+
+    uint32_t slot_idx = 0;
+    if (!adv_live_stream_find_free_slot_unsafe(&slot_idx))
+    {
+        g_adv_live_stream_stat.cnt_rejected += 1;
+        adv_live_stream_unlock();
+        return ADV_LIVE_STREAM_CLIENT_ID_INVALID;
+    }
+    // The client starts with the advs updated after the subscription, the dirty state left by the previous client
+    // of the slot is dropped.
+    adv_table_target_reset(adv_live_stream_get_target(slot_idx));
+
+    g_adv_live_stream_last_client_id += 1;
+    if (ADV_LIVE_STREAM_CLIENT_ID_INVALID == g_adv_live_stream_last_client_id)
+    {
+        g_adv_live_stream_last_client_id += 1;
+    }
+    adv_live_stream_client_t* const p_new_client = &g_adv_live_stream_clients[slot_idx];
+    p_new_client->client_id                      = g_adv_live_stream_last_client_id;
+    p_new_client->last_poll                      = now;
+    p_new_client->pending_ticket                 = ADV_TABLE_TICKET_NONE;
+    p_new_client->pending_num_advs               = 0;
+    g_adv_live_stream_stat.num_clients += 1;
+    g_adv_live_stream_stat.cnt_subscribed += 1;
+    const adv_live_stream_client_id_t client_id = p_new_client->client_id;
+    adv_live_stream_unlock();
+    return client_id;
+}
+
+bool
+adv_live_stream_read_begin(
+    const adv_live_stream_client_id_t client_id,
+    const adv_live_stream_time_ms_t   now,
+    adv_report_table_t* const         p_reports,
+    adv_table_ticket_t* const         p_ticket)
+{
+    p_reports->num_of_advs = 0;
+    *p_ticket              = ADV_TABLE_TICKET_NONE;
+
+    adv_live_stream_lock();
+    adv_live_stream_expire_clients_unsafe(now);
+
+    uint32_t                        slot_idx = 0;
+    adv_live_stream_client_t* const p_client = adv_live_stream_find_client_unsafe(client_id, &slot_idx);
+    if (NULL == p_client)
+    {
+        adv_live_stream_unlock();
+        return false;
+    }
+    p_client->last_poll = now;
+    // The slot stays locked while reading, so it can't be reassigned to another client in the meantime.
+    // The previous read which was neither committed nor rolled back is rolled back by adv_table_read_dirty_begin.
+    p_client->pending_ticket   = adv_table_read_dirty_begin(adv_live_stream_get_target(slot_idx), p_reports);
+    p_client->pending_num_advs = p_reports->num_of_advs;
+    *p_ticket                  = p_client->pending_ticket;
+
+    g_adv_live_stream_stat.cnt_polls += 1;
+    adv_live_stream_unlock();
+    return true;
+}
+
+/**
+ * @return pointer to the client if the ticket is the read in flight of the client, NULL otherwise.
+ */
+static adv_live_stream_client_t*
+adv_live_stream_find_pending_read_unsafe(
+    const adv_live_stream_client_id_t client_id,
+    const adv_table_ticket_t          ticket)
+{
+    uint32_t                        slot_idx = 0;
+    adv_live_stream_client_t* const p_client = adv_live_stream_find_client_unsafe(client_id, &slot_idx);
+    if ((NULL == p_client) || (ADV_TABLE_TICKET_NONE == ticket) || (ticket != p_client->pending_ticket))
+    {
+        // The client was unsubscribed or the read was superseded by the next poll, it's already finished
+        return NULL;
+    }
+    return p_client;
+}
+
+void
+adv_live_stream_read_commit(const adv_live_stream_client_id_t client_id, const adv_table_ticket_t ticket)
+{
+    adv_live_stream_lock();
+    adv_live_stream_client_t* const p_client = adv_live_stream_find_pending_read_unsafe(client_id, ticket);
+    if (NULL != p_client)
+    {
+        adv_table_retransmission_commit(ticket);
+        p_client->pending_ticket = ADV_TABLE_TICKET_NONE;
+
+        g_adv_live_stream_stat.cnt_advs += p_client->pending_num_advs;
+        if (p_client->pending_num_advs > g_adv_live_stream_stat.max_advs_per_poll)
+        {
+            g_adv_live_stream_stat.max_advs_per_poll = p_client->pending_num_advs;
+        }
+    }
+    adv_live_stream_unlock();
+}
+
+void
+adv_live_stream_read_rollback(const adv_live_stream_client_id_t client_id, const adv_table_ticket_t ticket)
+{
+    adv_live_stream_lock();
+    adv_live_stream_client_t* const p_client = adv_live_stream_find_pending_read_unsafe(client_id, ticket);
+    if (NULL != p_client)
+    {
+        adv_table_retransmission_rollback(ticket);
+        p_client->pending_ticket = ADV_TABLE_TICKET_NONE;
+    }
+    adv_live_stream_unlock();
+}
+
+void
+adv_live_stream_unsubscribe(const adv_live_stream_client_id_t client_id)
+{
+    adv_live_stream_lock();
+    uint32_t                        slot_idx = 0;
+    adv_live_stream_client_t* const p_client = adv_live_stream_find_client_unsafe(client_id, &slot_idx);
+    if (NULL != p_client)
+    {
+        adv_live_stream_free_slot_unsafe(p_client);
+    }
+    adv_live_stream_unlock();
+}
+
+void
+adv_live_stream_get_stat(adv_live_stream_stat_t* const p_stat)
+{
+    adv_live_stream_lock();
+    *p_stat = g_adv_live_stream_stat;
+    adv_live_stream_unlock();
+}
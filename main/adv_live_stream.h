@@ -0,0 +1,99 @@
+/**
+ * @file adv_live_stream.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_ADV_LIVE_STREAM_H
+#define RUUVI_GATEWAY_ESP_ADV_LIVE_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adv_table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADV_LIVE_STREAM_MAX_NUM_CLIENTS (ADV_TABLE_NUM_LIVE_STREAM_TARGETS)
+
+/**
+ * @brief The client which has not polled the stream for this time is unsubscribed and its slot is reused.
+ */
+#define ADV_LIVE_STREAM_CLIENT_TIMEOUT_MS (30U * 1000U)
+
+#define ADV_LIVE_STREAM_CLIENT_ID_INVALID (0U)
+
+typedef uint32_t adv_live_stream_client_id_t;
+typedef uint32_t adv_live_stream_time_ms_t;
+
+typedef struct adv_live_stream_stat_t
+{
+    uint32_t num_clients;
+    uint32_t cnt_subscribed;
+    uint32_t cnt_rejected; //!< Number of times there was no free slot for a new client
+    uint32_t cnt_expired;  //!< Number of clients which were unsubscribed because they stopped polling
+    uint32_t cnt_polls;
+    uint32_t cnt_advs;          //!< Number of advs delivered to all the clients (the committed reads)
+    uint32_t max_advs_per_poll; //!< The largest change set delivered by one poll
+} adv_live_stream_stat_t;
+
+void
+adv_live_stream_init(void);
+
+/**
+ * @brief Subscribe a new client to the live stream of the updated advs.
+ * @note Every client is assigned its own adv_table target, so its queue is the set of the tags updated since
+ *       its last poll: it's bounded by the size of adv_table and a newer adv of the tag replaces the unread one.
+ *       A slow client never stalls adv_table_put and does not affect the other clients.
+ * @param now - current uptime in milliseconds.
+ * @return the client ID or ADV_LIVE_STREAM_CLIENT_ID_INVALID if all the slots are in use.
+ */
+adv_live_stream_client_id_t
+adv_live_stream_subscribe(const adv_live_stream_time_ms_t now);
+
+/**
+ * @brief Read the advs which were updated since the previous poll of the client (delta polling).
+ * @note The advs are kept in flight until the read is committed by adv_live_stream_read_commit
+ *       or rolled back by adv_live_stream_read_rollback, so they are not lost if the response can't be created.
+ * @param client_id - the client ID returned by adv_live_stream_subscribe.
+ * @param now - current uptime in milliseconds.
+ * @param[out] p_reports - pointer to the output buffer.
+ * @param[out] p_ticket - pointer to the ticket of the read.
+ * @return false if the client is unknown or it was unsubscribed by timeout.
+ */
+bool
+adv_live_stream_read_begin(
+    const adv_live_stream_client_id_t client_id,
+    const adv_live_stream_time_ms_t   now,
+    adv_report_table_t* const         p_reports,
+    adv_table_ticket_t* const         p_ticket);
+
+/**
+ * @brief Confirm that the advs read by adv_live_stream_read_begin were passed to the client.
+ * @param client_id - the client ID.
+ * @param ticket - the ticket returned by adv_live_stream_read_begin.
+ */
+void
+adv_live_stream_read_commit(const adv_live_stream_client_id_t client_id, const adv_table_ticket_t ticket);
+
+/**
+ * @brief Return the advs read by adv_live_stream_read_begin to the client, so they are read by its next poll.
+ * @param client_id - the client ID.
+ * @param ticket - the ticket returned by adv_live_stream_read_begin.
+ */
+void
+adv_live_stream_read_rollback(const adv_live_stream_client_id_t client_id, const adv_table_ticket_t ticket);
+
+void
+adv_live_stream_unsubscribe(const adv_live_stream_client_id_t client_id);
+
+void
+adv_live_stream_get_stat(adv_live_stream_stat_t* const p_stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_ADV_LIVE_STREAM_H
@@ -0,0 +1,247 @@
+/**
+ * @file adv_log_ring.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_log_ring.h"
+#include <string.h>
+#include "esp_timer.h"
+#include "os_mutex.h"
+#include "os_task.h"
+#include "attribs.h"
+#include "fmt_fast.h"
+
+#if defined(RUUVI_TESTS) && RUUVI_TESTS
+#define LOG_LOCAL_DISABLED 1
+#define LOG_LOCAL_LEVEL    LOG_LEVEL_NONE
+#else
+#define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
+#endif
+#include "log.h"
+static const char* TAG = "ADV_LOG";
+
+#define ADV_LOG_RING_TASK_STACK_SIZE (3U * 1024U)
+#define ADV_LOG_RING_TASK_PRIORITY   (1)
+#define ADV_LOG_RING_FLUSH_PERIOD_MS (50U)
+
+_Static_assert(ADV_LOG_RING_NUM_RECS >= (MAX_ADVS_TABLE + 1U), "ADV_LOG_RING_NUM_RECS");
+_Static_assert(0 == (ADV_LOG_RING_NUM_RECS & (ADV_LOG_RING_NUM_RECS - 1U)), "ADV_LOG_RING_NUM_RECS");
+
+typedef struct adv_log_ring_t
+{
+    adv_log_ring_rec_t recs[ADV_LOG_RING_NUM_RECS];
+    uint32_t           write_seq_num;   //!< seq_num of the next record to put
+    uint32_t           read_seq_num;    //!< seq_num of the next record to print to the log
+    uint32_t           cnt_overwritten; //!< Number of records overwritten by the newer ones
+    uint32_t           cnt_dropped;     //!< Number of records overwritten before they were printed to the log
+} adv_log_ring_t;
+
+static adv_log_ring_t    g_adv_log_ring;
+static os_mutex_t        g_p_adv_log_ring_mutex;
+static os_mutex_static_t g_adv_log_ring_mutex_mem;
+static os_task_handle_t  g_p_adv_log_ring_task_handle;
+
+static void
+adv_log_ring_lock(void)
+{
+    if (NULL == g_p_adv_log_ring_mutex)
+    {
+        g_p_adv_log_ring_mutex = os_mutex_create_static(&g_adv_log_ring_mutex_mem);
+    }
+    os_mutex_lock(g_p_adv_log_ring_mutex);
+}
+
+static void
+adv_log_ring_unlock(void)
+{
+    os_mutex_unlock(g_p_adv_log_ring_mutex);
+}
+
+ATTR_NORETURN
+static void
+adv_log_ring_task(void)
+{
+    for (;;)
+    {
+        adv_log_ring_flush();
+        os_task_delay(pdMS_TO_TICKS(ADV_LOG_RING_FLUSH_PERIOD_MS));
+    }
+}
+
+bool
+adv_log_ring_init(void)
+{
+    adv_log_ring_lock();
+    memset(&g_adv_log_ring, 0, sizeof(g_adv_log_ring));
+    adv_log_ring_unlock();
+
+    if (NULL != g_p_adv_log_ring_task_handle)
+    {
+        return true;
+    }
+    if (!os_task_create_without_param(
+            &adv_log_ring_task,
+            "adv_log_ring",
+            ADV_LOG_RING_TASK_STACK_SIZE,
+            ADV_LOG_RING_TASK_PRIORITY,
+            &g_p_adv_log_ring_task_handle))
+    {
+        LOG_ERR("Can't create thread");
+        return false;
+    }
+    return true;
+}
+
+void
+adv_log_ring_put(
+    const adv_log_ring_cb_print_t p_cb_print,
+    const char* const             p_str,
+    const uint32_t                param,
+    const time_t                  timestamp,
+    const adv_report_t* const     p_adv)
+{
+    const uint32_t uptime_ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+    adv_log_ring_lock();
+    adv_log_ring_rec_t* const p_rec = &g_adv_log_ring.recs[g_adv_log_ring.write_seq_num % ADV_LOG_RING_NUM_RECS];
+    if (g_adv_log_ring.write_seq_num >= ADV_LOG_RING_NUM_RECS)
+    {
+        g_adv_log_ring.cnt_overwritten += 1;
+    }
+    memset(p_rec, 0, sizeof(*p_rec));
+    p_rec->p_cb_print = p_cb_print;
+    p_rec->p_str      = p_str;
+    p_rec->seq_num    = g_adv_log_ring.write_seq_num;
+    p_rec->uptime_ms  = uptime_ms;
+    p_rec->param      = param;
+    p_rec->timestamp  = timestamp;
+    if (NULL != p_adv)
+    {
+        p_rec->adv_timestamp = p_adv->timestamp;
+        p_rec->tag_mac       = p_adv->tag_mac;
+        p_rec->rssi          = p_adv->rssi;
+        p_rec->primary_phy   = p_adv->primary_phy;
+        p_rec->secondary_phy = p_adv->secondary_phy;
+        p_rec->ch_index      = p_adv->ch_index;
+        p_rec->is_coded_phy  = p_adv->is_coded_phy;
+        p_rec->tx_power      = p_adv->tx_power;
+        p_rec->data_len      = p_adv->data_len;
+        memcpy(p_rec->data_buf, p_adv->data_buf, p_adv->data_len);
+    }
+    g_adv_log_ring.write_seq_num += 1;
+    adv_log_ring_unlock();
+}
+
+static bool
+adv_log_ring_get_next_rec_for_flush(adv_log_ring_rec_t* const p_rec)
+{
+    bool res = false;
+    adv_log_ring_lock();
+    const uint32_t num_pending = g_adv_log_ring.write_seq_num - g_adv_log_ring.read_seq_num;
+    if (num_pending > ADV_LOG_RING_NUM_RECS)
+    {
+        // The formatter task could not keep up, the oldest records were overwritten
+        g_adv_log_ring.cnt_dropped += num_pending - ADV_LOG_RING_NUM_RECS;
+        g_adv_log_ring.read_seq_num = g_adv_log_ring.write_seq_num - ADV_LOG_RING_NUM_RECS;
+    }
+    if (0 != num_pending)
+    {
+        *p_rec = g_adv_log_ring.recs[g_adv_log_ring.read_seq_num % ADV_LOG_RING_NUM_RECS];
+        g_adv_log_ring.read_seq_num += 1;
+        res = true;
+    }
+    adv_log_ring_unlock();
+    return res;
+}
+
+uint32_t
+adv_log_ring_flush(void)
+{
+    uint32_t           cnt = 0;
+    adv_log_ring_rec_t rec = { 0 };
+    while (adv_log_ring_get_next_rec_for_flush(&rec))
+    {
+        char      buf[ADV_LOG_RING_MAX_TEXT_LINE_LEN];
+        str_buf_t str_buf = str_buf_init(buf, sizeof(buf));
+        rec.p_cb_print(&str_buf, &rec);
+        if (0 != rec.data_len)
+        {
+            LOG_DUMP_INFO(rec.data_buf, rec.data_len, "%s", buf);
+        }
+        else
+        {
+            LOG_INFO("%s", buf);
+        }
+        cnt += 1;
+    }
+    return cnt;
+}
+
+static void
+adv_log_ring_print_rec(str_buf_t* const p_str_buf, const adv_log_ring_rec_t* const p_rec)
+{
+    str_buf_printf(p_str_buf, "%lu [%lu ms] ", (printf_ulong_t)p_rec->seq_num, (printf_ulong_t)p_rec->uptime_ms);
+    p_rec->p_cb_print(p_str_buf, p_rec);
+    if (0 != p_rec->data_len)
+    {
+        char hex_buf[(ADV_DATA_MAX_LEN * 2) + 1];
+        (void)fmt_fast_hex(hex_buf, sizeof(hex_buf), p_rec->data_buf, p_rec->data_len);
+        str_buf_printf(p_str_buf, ", data: %s", hex_buf);
+    }
+    str_buf_printf(p_str_buf, "\n");
+}
+
+/**
+ * @note The records are copied one by one, so the mutex is not held while the text is printed
+ *       and adv_log_ring_put is not blocked by the HTTP server for a long time.
+ */
+static void
+adv_log_ring_print(str_buf_t* const p_str_buf, const uint32_t write_seq_num, const uint32_t cnt_dropped)
+{
+    const uint32_t num_recs = (write_seq_num < ADV_LOG_RING_NUM_RECS) ? write_seq_num : ADV_LOG_RING_NUM_RECS;
+    str_buf_printf(
+        p_str_buf,
+        "# records: total %lu, kept %lu, dropped from the log %lu\n",
+        (printf_ulong_t)write_seq_num,
+        (printf_ulong_t)num_recs,
+        (printf_ulong_t)cnt_dropped);
+    for (uint32_t seq_num = write_seq_num - num_recs; seq_num != write_seq_num; ++seq_num)
+    {
+        adv_log_ring_lock();
+        const adv_log_ring_rec_t rec = g_adv_log_ring.recs[seq_num % ADV_LOG_RING_NUM_RECS];
+        adv_log_ring_unlock();
+        adv_log_ring_print_rec(p_str_buf, &rec);
+    }
+}
+
+char*
+adv_log_ring_generate_text(void)
+{
+    adv_log_ring_lock();
+    const uint32_t write_seq_num = g_adv_log_ring.write_seq_num;
+    const uint32_t cnt_dropped   = g_adv_log_ring.cnt_dropped;
+    adv_log_ring_unlock();
+
+    str_buf_t str_buf = str_buf_init_null();
+    adv_log_ring_print(&str_buf, write_seq_num, cnt_dropped);
+    if (!str_buf_init_with_alloc(&str_buf))
+    {
+        LOG_ERR("Can't allocate memory");
+        return NULL;
+    }
+    // If some records were overwritten after calculating the size, the text is truncated by str_buf
+    adv_log_ring_print(&str_buf, write_seq_num, cnt_dropped);
+    return str_buf.buf;
+}
+
+void
+adv_log_ring_get_stat(adv_log_ring_stat_t* const p_stat)
+{
+    adv_log_ring_lock();
+    p_stat->cnt_put         = g_adv_log_ring.write_seq_num;
+    p_stat->cnt_overwritten = g_adv_log_ring.cnt_overwritten;
+    p_stat->cnt_dropped     = g_adv_log_ring.cnt_dropped;
+    adv_log_ring_unlock();
+}
@@ -0,0 +1,120 @@
+/**
+ * @file adv_log_ring.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_ADV_LOG_RING_H
+#define RUUVI_GATEWAY_ESP_ADV_LOG_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "adv_table.h"
+#include "str_buf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of records in the ring buffer, when it's full the oldest record is overwritten.
+ * @note It must hold the whole batch of the uploaded advs (the header and MAX_ADVS_TABLE records),
+ *       the value must be a power of two because the index is calculated from the wrapping seq_num.
+ */
+#define ADV_LOG_RING_NUM_RECS (128U)
+
+/**
+ * @brief Maximum length of one record printed by adv_log_ring_generate_text (including the hex dump of the data).
+ */
+#define ADV_LOG_RING_MAX_TEXT_LINE_LEN (256U)
+
+/**
+ * @brief Maximum size of the text generated by adv_log_ring_generate_text.
+ */
+#define ADV_LOG_RING_MAX_TEXT_SIZE ((ADV_LOG_RING_NUM_RECS + 1U) * ADV_LOG_RING_MAX_TEXT_LINE_LEN)
+
+typedef struct adv_log_ring_rec_t adv_log_ring_rec_t;
+
+typedef struct adv_log_ring_stat_t
+{
+    uint32_t cnt_put;
+    uint32_t cnt_overwritten; //!< Number of records overwritten by the newer ones (they are lost for /adv_log)
+    uint32_t cnt_dropped;     //!< Number of records overwritten before they were printed to the log
+} adv_log_ring_stat_t;
+
+/**
+ * @brief The callback which prints the record as text (the data is printed by the caller as a hex dump).
+ * @note It's called from the formatter task or from the HTTP server, not from the task which has put the record.
+ */
+typedef void (*adv_log_ring_cb_print_t)(str_buf_t* const p_str_buf, const adv_log_ring_rec_t* const p_rec);
+
+/**
+ * @brief Compact binary log record, the text is formatted from it only when it's printed.
+ */
+struct adv_log_ring_rec_t
+{
+    adv_log_ring_cb_print_t p_cb_print;
+    const char*             p_str; //!< Only the pointer is saved, so it must point to a string literal
+    uint32_t                seq_num;
+    uint32_t                uptime_ms;
+    uint32_t                param;
+    time_t                  timestamp;
+    time_t                  adv_timestamp;
+    mac_address_bin_t       tag_mac;
+    wifi_rssi_t             rssi;
+    re_ca_uart_ble_phy_e    primary_phy : 4;
+    re_ca_uart_ble_phy_e    secondary_phy : 4;
+    uint8_t                 ch_index;
+    bool                    is_coded_phy;
+    int8_t                  tx_power;
+    ble_data_len_t          data_len;
+    uint8_t                 data_buf[ADV_DATA_MAX_LEN];
+};
+
+/**
+ * @brief Init the ring buffer and create the low-priority task which prints the records to the log.
+ * @return true if successful.
+ */
+bool
+adv_log_ring_init(void);
+
+/**
+ * @brief Put the record into the ring buffer, the text is not formatted at this moment.
+ * @param p_cb_print - pointer to the callback which will print the record.
+ * @param p_str - pointer to the string literal which is passed to the callback.
+ * @param param - the parameter which is passed to the callback.
+ * @param timestamp - the timestamp which is passed to the callback.
+ * @param p_adv - pointer to the advertisement to save in the record, it can be NULL.
+ */
+void
+adv_log_ring_put(
+    const adv_log_ring_cb_print_t p_cb_print,
+    const char* const             p_str,
+    const uint32_t                param,
+    const time_t                  timestamp,
+    const adv_report_t* const     p_adv);
+
+/**
+ * @brief Print the records which were not printed yet to the log, it's called periodically by the formatter task.
+ * @return number of printed records.
+ */
+uint32_t
+adv_log_ring_flush(void);
+
+/**
+ * @brief Generate the text with all the records kept in the ring buffer (from the oldest to the newest).
+ * @return pointer to the allocated string or NULL if there is not enough memory.
+ */
+char*
+adv_log_ring_generate_text(void);
+
+void
+adv_log_ring_get_stat(adv_log_ring_stat_t* const p_stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_ADV_LOG_RING_H
@@ -17,6 +17,18 @@ extern "C" {
 #define ADV_MQTT_TASK_WATCHDOG_FEEDING_PERIOD_TICKS  pdMS_TO_TICKS(1000)
 #define ADV_MQTT_TASK_RETRY_SENDING_ADVS_AFTER_TICKS pdMS_TO_TICKS(50)
 
+/**
+ * @brief Max number of advs dequeued from the retransmission list under one lock of adv_table
+ *        and published back-to-back in instant mode.
+ */
+#define ADV_MQTT_BURST_MAX_NUM_ADVS (8U)
+
+/**
+ * @brief Max time spent on publishing advs per one signal ADV_MQTT_SIG_ON_RECV_ADV,
+ *        after that the signal is re-sent to allow handling of other signals (including the task watchdog feeding).
+ */
+#define ADV_MQTT_BURST_TIME_BUDGET_TICKS pdMS_TO_TICKS(200)
+
 typedef struct adv_mqtt_state_t
 {
     bool flag_stop;
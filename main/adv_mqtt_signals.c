@@ -7,6 +7,8 @@
 
 #include "adv_mqtt_signals.h"
 #include <esp_task_wdt.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "os_malloc.h"
 #include "event_mgr.h"
 #include "adv_table.h"
@@ -31,8 +33,17 @@ static const char* TAG = "ADV_MQTT_TASK";
 
 typedef void (*adv_mqtt_sig_handler_t)(adv_mqtt_state_t* const p_adv_mqtt_state);
 
+typedef struct adv_mqtt_burst_t
+{
+    uint32_t     num_advs;
+    uint32_t     idx;
+    adv_report_t advs[ADV_MQTT_BURST_MAX_NUM_ADVS];
+} adv_mqtt_burst_t;
+
 static os_signal_t*       g_p_adv_mqtt_sig;
 static os_signal_static_t g_adv_mqtt_sig_mem;
+static adv_mqtt_burst_t   g_adv_mqtt_burst;
+static mqtt_json_gen_t    g_adv_mqtt_json_gen;
 
 ATTR_PURE
 os_signal_num_e
@@ -80,6 +91,10 @@ static void
 adv_mqtt_handle_sig_recv_adv(ATTR_UNUSED adv_mqtt_state_t* const p_adv_mqtt_state) // NOSONAR
 {
     LOG_DBG("Got ADV_MQTT_SIG_RECV_ADV");
+    event_mgr_clear_pending_sig(
+        EVENT_MGR_EV_RECV_ADV,
+        g_p_adv_mqtt_sig,
+        adv_mqtt_conv_to_sig_num(ADV_MQTT_SIG_ON_RECV_ADV));
 
     if ((!gw_status_is_mqtt_connected()) || (!gw_status_is_relaying_via_mqtt_enabled()))
     {
@@ -92,30 +107,57 @@ adv_mqtt_handle_sig_recv_adv(ATTR_UNUSED adv_mqtt_state_t* const p_adv_mqtt_stat
         return;
     }
 
-    if (!mqtt_is_buffer_available_for_publish())
-    {
-        LOG_DBG("MQTT buffer is full - postpone sending advs to MQTT");
-        adv_mqtt_timers_start_timer_sig_retry_sending_advs();
-        adv_mqtt_cfg_cache_mutex_unlock(&p_cfg_cache);
-        return;
-    }
-
-    adv_report_t adv_report = { 0 };
-    if (adv_table_read_retransmission_list3_head(&adv_report))
+    adv_mqtt_burst_t* const p_burst    = &g_adv_mqtt_burst;
+    const TickType_t        tick_start = xTaskGetTickCount();
+    for (;;)
     {
+        if (!mqtt_is_buffer_available_for_publish())
+        {
+            LOG_DBG("MQTT buffer is full - postpone sending advs to MQTT");
+            adv_mqtt_timers_start_timer_sig_retry_sending_advs();
+            adv_mqtt_cfg_cache_mutex_unlock(&p_cfg_cache);
+            return;
+        }
+        if (p_burst->idx >= p_burst->num_advs)
+        {
+            p_burst->idx      = 0;
+            p_burst->num_advs = adv_table_read_retransmission_list3_head_batch(
+                p_burst->advs,
+                ADV_MQTT_BURST_MAX_NUM_ADVS);
+            if (0 == p_burst->num_advs)
+            {
+                break;
+            }
+        }
+        const os_delta_ticks_t elapsed_ticks = xTaskGetTickCount() - tick_start;
+        if (elapsed_ticks >= ADV_MQTT_BURST_TIME_BUDGET_TICKS)
+        {
+            break;
+        }
         const time_t timestamp_if_synchronized = time_is_synchronized() ? time(NULL) : 0;
         const time_t timestamp                 = p_cfg_cache->flag_use_ntp ? timestamp_if_synchronized
                                                                            : (time_t)metrics_received_advs_get();
-        if (mqtt_publish_adv(&adv_report, p_cfg_cache->flag_use_ntp, timestamp))
+
+        uint32_t       num_published = 0;
+        const uint32_t num_processed = mqtt_publish_advs(
+            &g_adv_mqtt_json_gen,
+            &p_burst->advs[p_burst->idx],
+            p_burst->num_advs - p_burst->idx,
+            p_cfg_cache->flag_use_ntp,
+            timestamp,
+            ADV_MQTT_BURST_TIME_BUDGET_TICKS - elapsed_ticks,
+            &num_published);
+        p_burst->idx += num_processed;
+        if (0 != num_published)
         {
             network_timeout_update_timestamp();
         }
-        else
+        if (num_published != num_processed)
         {
-            LOG_ERR("%s failed", "mqtt_publish_adv");
+            LOG_ERR("%s failed", "mqtt_publish_advs");
         }
     }
-    if (!adv_table_read_retransmission_list3_is_empty())
+    if ((p_burst->idx < p_burst->num_advs) || (!adv_table_read_retransmission_list3_is_empty()))
     {
         os_signal_send(g_p_adv_mqtt_sig, adv_mqtt_conv_to_sig_num(ADV_MQTT_SIG_ON_RECV_ADV));
     }
@@ -218,6 +260,8 @@ adv_mqtt_signals_init(void)
     {
         os_signal_add(g_p_adv_mqtt_sig, adv_mqtt_conv_to_sig_num((adv_mqtt_sig_e)i));
     }
+    g_adv_mqtt_burst.num_advs = 0;
+    g_adv_mqtt_burst.idx      = 0;
 }
 
 void
@@ -225,4 +269,5 @@ adv_mqtt_signals_deinit(void)
 {
     os_signal_unregister_cur_thread(g_p_adv_mqtt_sig);
     os_signal_delete(&g_p_adv_mqtt_sig);
+    mqtt_json_gen_deinit(&g_adv_mqtt_json_gen);
 }
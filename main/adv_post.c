@@ -9,6 +9,7 @@
 #include <string.h>
 #include <time.h>
 #include "esp_task_wdt.h"
+#include "esp_timer.h"
 #include "os_task.h"
 #include "cJSON.h"
 #include "mqtt.h"
@@ -30,6 +31,8 @@
 #include "adv_post_green_led.h"
 #include "adv_post_async_comm.h"
 #include "adv_post_statistics.h"
+#include "adv_log_ring.h"
+#include "uart_capture.h"
 
 #define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
 #include "log.h"
@@ -54,7 +57,8 @@ static adv_callbacks_fn_t adv_callback_func_tbl = {
     .AdvGetAllCallback = adv_post_send_get_all,
 };
 
-static uint32_t g_adv_post_advs_cnt;
+static uint32_t               g_adv_post_advs_cnt;
+static adv_post_ingest_stat_t g_adv_post_ingest_stat;
 
 static void
 adv_post_advs_cnt_inc(void)
@@ -70,6 +74,34 @@ adv_post_advs_cnt_get_and_clear(void)
     return cnt;
 }
 
+void
+adv_post_get_ingest_stat(adv_post_ingest_stat_t* const p_stat)
+{
+    *p_stat = g_adv_post_ingest_stat;
+}
+
+uint32_t
+adv_post_read_triggered_advs(adv_report_table_t* const p_reports)
+{
+    mac_address_bin_t     macs[ADV_TRIGGER_MAX_NUM_PENDING];
+    adv_post_cfg_cache_t* p_cfg_cache = adv_post_cfg_cache_mutex_lock();
+    const uint32_t        num_macs    = adv_trigger_take_pending(
+        &p_cfg_cache->adv_trigger,
+        macs,
+        ADV_TRIGGER_MAX_NUM_PENDING);
+    adv_post_cfg_cache_mutex_unlock(&p_cfg_cache);
+
+    p_reports->num_of_advs = 0;
+    for (uint32_t i = 0; (i < num_macs) && (p_reports->num_of_advs < MAX_ADVS_TABLE); ++i)
+    {
+        if (adv_table_read_by_mac(&macs[i], &p_reports->table[p_reports->num_of_advs]))
+        {
+            p_reports->num_of_advs += 1;
+        }
+    }
+    return p_reports->num_of_advs;
+}
+
 /** @brief serialise up to U64 into given buffer, MSB first. */
 static inline void
 u64_to_array(const uint64_t u64, uint8_t* const p_array, const uint8_t num_bytes)
@@ -298,14 +330,14 @@ ble_tx_power_to_str(const int8_t tx_power)
 #define NUM_BITS_PER_BYTE                                                    (8U)
 
 static uint16_t
-get_ble_manuf_id(const adv_report_t* const p_adv)
+get_ble_manuf_id(const uint8_t* const p_data_buf, const ble_data_len_t data_len)
 {
-    if (p_adv->data_len < BLE_MSG_CHUNK_DATA_OFFSET)
+    if (data_len < BLE_MSG_CHUNK_DATA_OFFSET)
     {
         return 0;
     }
-    const uint8_t* p_data = p_adv->data_buf;
-    while (((ptrdiff_t)p_adv->data_len - (p_data - p_adv->data_buf)) >= BLE_MSG_CHUNK_DATA_OFFSET)
+    const uint8_t* p_data = p_data_buf;
+    while (((ptrdiff_t)data_len - (p_data - p_data_buf)) >= BLE_MSG_CHUNK_DATA_OFFSET)
     {
         const uint8_t len  = p_data[BLE_MSG_CHUNK_LEN_OFFSET];
         const uint8_t type = p_data[BLE_MSG_CHUNK_TYPE_OFFSET];
@@ -324,8 +356,26 @@ get_ble_manuf_id(const adv_report_t* const p_adv)
     return 0;
 }
 
+static void
+adv_post_log_print_recv_adv(str_buf_t* const p_str_buf, const adv_log_ring_rec_t* const p_rec)
+{
+    str_buf_printf(
+        p_str_buf,
+        "%s: MAC=%s, ID=0x%04x, time=%lu, RSSI=%d, PHY=%s, Chan=%d, tx_power=%s",
+        p_rec->p_str,
+        mac_address_to_str(&p_rec->tag_mac).str_buf,
+        get_ble_manuf_id(p_rec->data_buf, p_rec->data_len),
+        (printf_ulong_t)p_rec->timestamp,
+        p_rec->rssi,
+        ble_phy_agg_info_str(p_rec->primary_phy, p_rec->secondary_phy, p_rec->is_coded_phy).buf,
+        p_rec->ch_index,
+        ble_tx_power_to_str(p_rec->tx_power).buf);
+}
+
 #define ADV_POST_MAX_NUM_SCAN_FILTERS_FOR_LOGGING (3U)
 
+#define ADV_POST_US_PER_MS (1000)
+
 static void
 adv_post_log_adv_report(
     const adv_report_t* const         p_adv,
@@ -349,30 +399,10 @@ adv_post_log_adv_report(
 
     if (flag_log_single_allowed_mac)
     {
-        LOG_DUMP_INFO(
-            p_adv->data_buf,
-            p_adv->data_len,
-            "Recv Adv: MAC=%s, ID=0x%04x, time=%lu, RSSI=%d, PHY=%s, Chan=%d, tx_power=%s",
-            mac_address_to_str(&p_adv->tag_mac).str_buf,
-            get_ble_manuf_id(p_adv),
-            (printf_ulong_t)timestamp,
-            p_adv->rssi,
-            ble_phy_agg_info_str(p_adv->primary_phy, p_adv->secondary_phy, p_adv->is_coded_phy).buf,
-            p_adv->ch_index,
-            ble_tx_power_to_str(p_adv->tx_power).buf);
+        adv_log_ring_put(&adv_post_log_print_recv_adv, "Recv Adv", 0, timestamp, p_adv);
     }
 #else
-    LOG_DUMP_VERBOSE(
-        p_adv->data_buf,
-        p_adv->data_len,
-        "Recv Adv: MAC=%s, ID=0x%04x, time=%lu, RSSI=%d, PHY=%s, Chan=%d, tx_power=%s",
-        mac_address_to_str(&p_adv->tag_mac).str_buf,
-        get_ble_manuf_id(p_adv),
-        (printf_ulong_t)timestamp,
-        p_adv->rssi,
-        ble_phy_agg_info_str(p_adv->primary_phy, p_adv->secondary_phy, p_adv->is_coded_phy).buf,
-        p_adv->ch_index,
-        ble_tx_power_to_str(p_adv->tx_power).buf);
+    adv_log_ring_put(&adv_post_log_print_recv_adv, "Recv Adv", 0, timestamp, p_adv);
 #endif
 }
 
@@ -380,9 +410,14 @@ static void
 adv_post_send_report(void* p_arg)
 {
     adv_post_advs_cnt_inc();
+    g_adv_post_ingest_stat.cnt_recv += 1;
+#if RUUVI_UART_CAPTURE
+    uart_capture_put((const re_ca_uart_payload_t*)p_arg);
+#endif
     if (!gw_cfg_is_initialized())
     {
         LOG_DBG("Drop adv - gw_cfg is not ready yet");
+        g_adv_post_ingest_stat.cnt_dropped_not_ready += 1;
         return;
     }
 
@@ -390,6 +425,7 @@ adv_post_send_report(void* p_arg)
     if (NULL == p_cfg_cache)
     {
         LOG_DBG("Drop adv - gateway in the process of reconfiguration");
+        g_adv_post_ingest_stat.cnt_dropped_not_ready += 1;
         return;
     }
 
@@ -402,6 +438,7 @@ adv_post_send_report(void* p_arg)
     if (!parse_adv_report_from_uart((re_ca_uart_payload_t*)p_arg, timestamp, &adv_report))
     {
         LOG_WARN("Drop adv - parsing failed");
+        g_adv_post_ingest_stat.cnt_parse_failed += 1;
         adv_post_cfg_cache_mutex_unlock(&p_cfg_cache);
         return;
     }
@@ -409,6 +446,20 @@ adv_post_send_report(void* p_arg)
     if (adv_post_check_if_mac_filtered_out(p_cfg_cache, &adv_report.tag_mac))
     {
         LOG_DBG("Drop adv - MAC is filtered out");
+        g_adv_post_ingest_stat.cnt_filtered += 1;
+        adv_post_cfg_cache_mutex_unlock(&p_cfg_cache);
+        return;
+    }
+
+    if (!adv_filter_check(
+            &p_cfg_cache->adv_filter,
+            &adv_report.tag_mac,
+            adv_report.rssi,
+            adv_report.data_buf,
+            adv_report.data_len))
+    {
+        LOG_DBG("Drop adv - filtered out by adv_filter_rules");
+        g_adv_post_ingest_stat.cnt_filtered += 1;
         adv_post_cfg_cache_mutex_unlock(&p_cfg_cache);
         return;
     }
@@ -420,6 +471,30 @@ adv_post_send_report(void* p_arg)
     if (flag_ntp_use && (!flag_time_is_synchronized))
     {
         LOG_DBG("Drop adv - time has not yet synchronized");
+        g_adv_post_ingest_stat.cnt_dropped_not_synced += 1;
+        adv_post_cfg_cache_mutex_unlock(&p_cfg_cache);
+        return;
+    }
+
+    const bool    flag_trigger_enabled = adv_trigger_is_enabled(&p_cfg_cache->adv_trigger);
+    adv_decoded_t decoded              = { .data_format = ADV_DECODED_DATA_FORMAT_UNKNOWN };
+    if (adv_aggr_is_decoding_needed(&p_cfg_cache->adv_aggr) || flag_trigger_enabled)
+    {
+        adv_decoded_decode(adv_report.data_buf, &decoded);
+    }
+    const bool flag_triggered = flag_trigger_enabled
+                                && adv_trigger_check(&p_cfg_cache->adv_trigger, &adv_report.tag_mac, &decoded);
+    // The triggered adv is never downsampled, otherwise the urgent sending would have nothing to send
+    if ((!adv_aggr_put(
+            &p_cfg_cache->adv_aggr,
+            &adv_report.tag_mac,
+            &decoded,
+            (adv_aggr_time_ms_t)(esp_timer_get_time() / ADV_POST_US_PER_MS),
+            &adv_report.aggr))
+        && (!flag_triggered))
+    {
+        LOG_DBG("Drop adv - downsampled by adv_aggr");
+        g_adv_post_ingest_stat.cnt_dropped_aggr += 1;
         adv_post_cfg_cache_mutex_unlock(&p_cfg_cache);
         return;
     }
@@ -431,10 +506,17 @@ adv_post_send_report(void* p_arg)
             mac_address_to_str(&adv_report.tag_mac).str_buf,
             adv_report.data_buf[6],
             adv_report.data_buf[5]);
+        g_adv_post_ingest_stat.cnt_dropped_duplicate += 1;
     }
     else
     {
+        g_adv_post_ingest_stat.cnt_accepted += 1;
         event_mgr_notify(EVENT_MGR_EV_RECV_ADV);
+        if (flag_triggered)
+        {
+            g_adv_post_ingest_stat.cnt_triggered += 1;
+            adv_post_signals_send_sig(ADV_POST_SIG_URGENT_ADVS);
+        }
     }
 
     adv_post_cfg_cache_mutex_unlock(&p_cfg_cache);
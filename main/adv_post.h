@@ -20,9 +20,38 @@ extern "C" {
 void
 adv_post_init(void);
 
+typedef struct adv_post_ingest_stat_t
+{
+    uint32_t cnt_recv;               //!< Number of advertisements received from nRF52
+    uint32_t cnt_dropped_not_ready;  //!< gw_cfg was not ready yet or the gateway was being reconfigured
+    uint32_t cnt_parse_failed;       //!< The message from nRF52 could not be parsed
+    uint32_t cnt_filtered;           //!< MAC address was filtered out by the scan filter
+    uint32_t cnt_dropped_not_synced; //!< NTP is used, but the time has not yet been synchronized
+    uint32_t cnt_dropped_aggr;       //!< The advertisement was downsampled by adv_aggr
+    uint32_t cnt_dropped_duplicate;  //!< The same data from this MAC address is already in adv_table
+    uint32_t cnt_accepted;           //!< The advertisement was put into adv_table
+    uint32_t cnt_triggered;          //!< The advertisement fired adv_trigger and was queued for urgent sending
+} adv_post_ingest_stat_t;
+
 uint32_t
 adv_post_advs_cnt_get_and_clear(void);
 
+/**
+ * @brief Get the counters of the advertisements received from nRF52 (they are never cleared).
+ * @param[out] p_stat - pointer to the output statistics.
+ */
+void
+adv_post_get_ingest_stat(adv_post_ingest_stat_t* const p_stat);
+
+/**
+ * @brief Take the tags queued by adv_trigger and read their latest advertisements from adv_table.
+ * @note The advertisements are still sent with the next periodic batch.
+ * @param[out] p_reports - pointer to the output table.
+ * @return the number of the advertisements in p_reports.
+ */
+uint32_t
+adv_post_read_triggered_advs(adv_report_table_t* const p_reports);
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,12 +7,14 @@
 
 #include "adv_post_async_comm.h"
 #include <esp_system.h>
+#include "esp_timer.h"
 #include "os_malloc.h"
 #include "os_timer_sig.h"
 #include "time_task.h"
 #include "ruuvi_gateway.h"
 #include "gw_status.h"
 #include "adv_table.h"
+#include "adv_report_pool.h"
 #include "http.h"
 #include "mqtt.h"
 #include "leds.h"
@@ -20,6 +22,10 @@
 #include "adv_post_statistics.h"
 #include "adv_post_timers.h"
 #include "adv_post_signals.h"
+#include "adv_post_sched.h"
+#include "adv_log_ring.h"
+#include "http_async_gov.h"
+#include "http_mem_budget.h"
 #if defined(RUUVI_TESTS) && RUUVI_TESTS
 #define LOG_LOCAL_DISABLED 1
 #define LOG_LOCAL_LEVEL    LOG_LEVEL_NONE
@@ -32,12 +38,41 @@ static const char* TAG = "ADV_POST_TASK";
 static uint32_t          g_adv_post_nonce;
 static adv_post_action_e g_adv_post_action = ADV_POST_ACTION_NONE;
 
-static const adv_report_table_t* g_p_adv_post_reports_mqtt;
-static uint32_t                  g_adv_post_reports_mqtt_idx;
-static time_t                    g_adv_post_reports_mqtt_timestamp;
+static adv_report_table_t* g_p_adv_post_reports_mqtt;
+static uint32_t            g_adv_post_reports_mqtt_idx;
+static time_t              g_adv_post_reports_mqtt_timestamp;
+static mqtt_json_gen_t     g_adv_post_mqtt_json_gen;
+
+/**
+ * @brief The buffers with advertisements which are referenced by the JSON generators of the HTTP requests,
+ *        they are returned to the pool in adv_post_async_comm_release_mem when the request is completed.
+ */
+static adv_report_table_t* g_p_adv_post_reports_http[HTTP_ASYNC_SLOT_NUM];
+
+/**
+ * @brief The tickets of the batches read from the retransmission lists of adv_table for the HTTP requests,
+ *        the batch is committed when the request completes with 2xx, otherwise it's rolled back
+ *        and the advs are sent again with the next request.
+ */
+static adv_table_ticket_t g_adv_post_tickets_http[HTTP_ASYNC_SLOT_NUM];
 
 static uint32_t g_adv_post_malloc_fail_cnt[2];
 
+typedef enum adv_post_async_comm_start_res_e
+{
+    ADV_POST_ASYNC_COMM_START_RES_STARTED,
+    ADV_POST_ASYNC_COMM_START_RES_FAILED,    //!< The transfer was attempted, but failed to start
+    ADV_POST_ASYNC_COMM_START_RES_POSTPONED, //!< The preconditions are not met yet, the target remains pending
+    ADV_POST_ASYNC_COMM_START_RES_CANCELLED, //!< The target is disabled or not reachable, the request is dropped
+    ADV_POST_ASYNC_COMM_START_RES_COMPLETED, //!< The transfer was completed synchronously (e.g. MQTT publish)
+} adv_post_async_comm_start_res_e;
+
+static adv_post_sched_time_ms_t
+adv_post_async_comm_get_time_ms(void)
+{
+    return (adv_post_sched_time_ms_t)(esp_timer_get_time() / 1000);
+}
+
 void
 adv_post_async_comm_init(void)
 {
@@ -46,35 +81,55 @@ adv_post_async_comm_init(void)
     g_p_adv_post_reports_mqtt         = NULL;
     g_adv_post_reports_mqtt_idx       = 0;
     g_adv_post_reports_mqtt_timestamp = 0;
+    for (uint32_t i = 0; i < OS_ARRAY_SIZE(g_p_adv_post_reports_http); ++i)
+    {
+        g_p_adv_post_reports_http[i] = NULL;
+        g_adv_post_tickets_http[i]   = ADV_TABLE_TICKET_NONE;
+    }
     for (uint32_t i = 0; i < OS_ARRAY_SIZE(g_adv_post_malloc_fail_cnt); ++i)
     {
         g_adv_post_malloc_fail_cnt[i] = 0;
     }
+    adv_post_sched_init(adv_post_async_comm_get_time_ms());
 }
 
+static void
+adv_post_log_print_table_hdr(str_buf_t* const p_str_buf, const adv_log_ring_rec_t* const p_rec)
+{
+    str_buf_printf(
+        p_str_buf,
+        "Advertisements in table for target=%s (num=%lu):",
+        p_rec->p_str,
+        (printf_ulong_t)p_rec->param);
+}
+
+static void
+adv_post_log_print_table_adv(str_buf_t* const p_str_buf, const adv_log_ring_rec_t* const p_rec)
+{
+    str_buf_printf(
+        p_str_buf,
+        "i: %lu, tag: %s, rssi: %d, %s: %lu",
+        (printf_ulong_t)p_rec->param,
+        mac_address_to_str(&p_rec->tag_mac).str_buf,
+        p_rec->rssi,
+        p_rec->p_str,
+        (printf_ulong_t)p_rec->adv_timestamp);
+}
+
+/**
+ * @brief Log the table of advs which is going to be sent.
+ * @note The records are put to adv_log_ring and printed later by its low-priority task,
+ *       so logging does not delay sending the advs.
+ */
 static void
 adv_post_log(const adv_report_table_t* p_reports, const bool flag_use_timestamps, const char* const p_target_name)
 {
-    (void)flag_use_timestamps;
-    LOG_INFO("Advertisements in table for target=%s (num=%u):", p_target_name, (printf_uint_t)p_reports->num_of_advs);
-#if LOG_LOCAL_LEVEL >= LOG_LEVEL_INFO
+    adv_log_ring_put(&adv_post_log_print_table_hdr, p_target_name, p_reports->num_of_advs, 0, NULL);
+    const char* const p_timestamp_name = flag_use_timestamps ? "timestamp" : "counter";
     for (num_of_advs_t i = 0; i < p_reports->num_of_advs; ++i)
     {
-        const adv_report_t* p_adv = &p_reports->table[i];
-
-        const mac_address_str_t mac_str = mac_address_to_str(&p_adv->tag_mac);
-        LOG_DUMP_INFO(
-            p_adv->data_buf,
-            p_adv->data_len,
-            "i: %d, tag: %s, rssi: %d, %s: %ld",
-            i,
-            mac_str.str_buf,
-            p_adv->rssi,
-            flag_use_timestamps ? "timestamp" : "counter",
-            p_adv->timestamp);
-        vTaskDelay(pdMS_TO_TICKS(5));
+        adv_log_ring_put(&adv_post_log_print_table_adv, p_timestamp_name, i, 0, &p_reports->table[i]);
     }
-#endif
 }
 
 static bool
@@ -99,10 +154,36 @@ adv_post_retransmit_advs(
     return true;
 }
 
+static void
+adv_post_hold_reports_for_http_slot(const http_async_slot_e slot, adv_report_table_t* const p_reports)
+{
+    adv_report_pool_return(g_p_adv_post_reports_http[slot]);
+    g_p_adv_post_reports_http[slot] = p_reports;
+}
+
+static void
+adv_post_finish_ticket_for_http_slot(const http_async_slot_e slot, const bool flag_success)
+{
+    const adv_table_ticket_t ticket = g_adv_post_tickets_http[slot];
+    g_adv_post_tickets_http[slot]   = ADV_TABLE_TICKET_NONE;
+    if (ADV_TABLE_TICKET_NONE == ticket)
+    {
+        return; // The statistics are not read from the retransmission lists
+    }
+    if (flag_success)
+    {
+        adv_table_retransmission_commit(ticket);
+    }
+    else
+    {
+        adv_table_retransmission_rollback(ticket);
+    }
+}
+
 static bool
 adv_post_do_retransmission(const bool flag_use_timestamps, const adv_post_action_e adv_post_action)
 {
-    adv_report_table_t* p_adv_reports_buf = os_calloc(1, sizeof(*p_adv_reports_buf));
+    adv_report_table_t* p_adv_reports_buf = adv_report_pool_checkout();
     if (NULL == p_adv_reports_buf)
     {
         LOG_ERR("Can't allocate memory");
@@ -117,22 +198,40 @@ adv_post_do_retransmission(const bool flag_use_timestamps, const adv_post_action
         case ADV_POST_ACTION_NONE:
             LOG_ERR("Incorrect adv_post_action: %s", "ADV_POST_ACTION_NONE");
             assert(0);
+            adv_report_pool_return(p_adv_reports_buf);
             break;
         case ADV_POST_ACTION_POST_ADVS_TO_RUUVI:
-            adv_table_read_retransmission_list1_and_clear(p_adv_reports_buf);
+            g_adv_post_tickets_http[HTTP_ASYNC_SLOT_MAIN] = adv_table_read_retransmission_list1_begin(
+                p_adv_reports_buf);
             adv_post_log(p_adv_reports_buf, flag_use_timestamps, "HTTP(Ruuvi)");
+            // The JSON generator refers to the buffer, so it is kept until the request is completed
+            adv_post_hold_reports_for_http_slot(HTTP_ASYNC_SLOT_MAIN, p_adv_reports_buf);
             res = adv_post_retransmit_advs(p_adv_reports_buf, flag_use_timestamps, true);
-            os_free(p_adv_reports_buf);
+            if (!res)
+            {
+                adv_post_finish_ticket_for_http_slot(HTTP_ASYNC_SLOT_MAIN, false);
+            }
             break;
         case ADV_POST_ACTION_POST_ADVS_TO_CUSTOM:
-            adv_table_read_retransmission_list2_and_clear(p_adv_reports_buf);
+            g_adv_post_tickets_http[HTTP_ASYNC_SLOT_CUSTOM] = adv_table_read_retransmission_list2_begin(
+                p_adv_reports_buf);
             adv_post_log(p_adv_reports_buf, flag_use_timestamps, "HTTP(Custom)");
+            adv_post_hold_reports_for_http_slot(HTTP_ASYNC_SLOT_CUSTOM, p_adv_reports_buf);
             res = adv_post_retransmit_advs(p_adv_reports_buf, flag_use_timestamps, false);
-            os_free(p_adv_reports_buf);
+            if (!res)
+            {
+                adv_post_finish_ticket_for_http_slot(HTTP_ASYNC_SLOT_CUSTOM, false);
+            }
             break;
         case ADV_POST_ACTION_POST_STATS:
             LOG_ERR("Incorrect adv_post_action: %s", "ADV_POST_ACTION_POST_STATS");
             assert(0);
+            adv_report_pool_return(p_adv_reports_buf);
+            break;
+        case ADV_POST_ACTION_POST_URGENT_ADVS:
+            LOG_ERR("Incorrect adv_post_action: %s", "ADV_POST_ACTION_POST_URGENT_ADVS");
+            assert(0);
+            adv_report_pool_return(p_adv_reports_buf);
             break;
         case ADV_POST_ACTION_POST_ADVS_TO_MQTT:
             adv_table_read_retransmission_list3_and_clear(p_adv_reports_buf);
@@ -146,184 +245,398 @@ adv_post_do_retransmission(const bool flag_use_timestamps, const adv_post_action
     return res;
 }
 
+static http_mem_budget_client_e
+adv_post_conv_http_async_slot_to_mem_budget_client(const http_async_slot_e slot)
+{
+    return (HTTP_ASYNC_SLOT_CUSTOM == slot) ? HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM
+                                            : HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN;
+}
+
+static bool
+adv_post_async_comm_reserve_mem(const http_async_slot_e slot)
+{
+    LOG_DBG("http_mem_budget_reserve: slot=%d", (printf_int_t)slot);
+    return http_mem_budget_reserve(adv_post_conv_http_async_slot_to_mem_budget_client(slot), HTTP_MEM_BUDGET_HTTP_POST);
+}
+
+static void
+adv_post_async_comm_release_mem(const http_async_slot_e slot)
+{
+    LOG_DBG("http_mem_budget_release: slot=%d", (printf_int_t)slot);
+    http_mem_budget_release(adv_post_conv_http_async_slot_to_mem_budget_client(slot));
+    adv_report_pool_return(g_p_adv_post_reports_http[slot]);
+    g_p_adv_post_reports_http[slot] = NULL;
+}
+
+static bool
+adv_post_async_comm_reserve_mem_mqtt(void)
+{
+    LOG_DBG("http_mem_budget_reserve: mqtt");
+    return http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH, HTTP_MEM_BUDGET_MQTT_PUBLISH);
+}
+
 static void
+adv_post_async_comm_release_mem_mqtt(void)
+{
+    LOG_DBG("http_mem_budget_release: mqtt");
+    http_mem_budget_release(HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH);
+    adv_report_pool_return(g_p_adv_post_reports_mqtt);
+    g_p_adv_post_reports_mqtt   = NULL;
+    g_adv_post_reports_mqtt_idx = 0;
+}
+
+static adv_post_async_comm_start_res_e
 adv_post_do_async_comm_send_advs1(adv_post_state_t* const p_adv_post_state)
 {
     if (!p_adv_post_state->flag_network_connected)
     {
         LOG_DBG("Can't send advs1, no network connection");
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
     if (p_adv_post_state->flag_use_timestamps && (!time_is_synchronized()))
     {
         LOG_DBG("Can't send advs1, the time is not yet synchronized");
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
-    LOG_DBG("http_server_mutex_try_lock");
-    if (!http_server_mutex_try_lock())
+    if (!adv_post_async_comm_reserve_mem(HTTP_ASYNC_SLOT_MAIN))
     {
-        LOG_DBG("Wait until incoming HTTP connection is handled, postpone sending advs1");
-        return;
+        LOG_DBG("Not enough memory budget for HTTP request, postpone sending advs1");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
     g_adv_post_action = ADV_POST_ACTION_POST_ADVS_TO_RUUVI;
     if (!adv_post_do_retransmission(p_adv_post_state->flag_use_timestamps, ADV_POST_ACTION_POST_ADVS_TO_RUUVI))
     {
         g_adv_post_action = ADV_POST_ACTION_NONE;
         leds_notify_http1_data_sent_fail();
-        LOG_DBG("http_server_mutex_unlock");
-        http_server_mutex_unlock();
-        return;
+        adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_MAIN);
+        return ADV_POST_ASYNC_COMM_START_RES_FAILED;
     }
     g_adv_post_nonce += 1;
     p_adv_post_state->flag_async_comm_in_progress = true;
     p_adv_post_state->flag_need_to_send_advs1     = false;
+    return ADV_POST_ASYNC_COMM_START_RES_STARTED;
 }
 
-static void
+static adv_post_async_comm_start_res_e
 adv_post_do_async_comm_send_advs2(adv_post_state_t* const p_adv_post_state)
 {
     if (!p_adv_post_state->flag_network_connected)
     {
         LOG_DBG("Can't send advs2, no network connection");
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
     if (p_adv_post_state->flag_use_timestamps && (!time_is_synchronized()))
     {
         LOG_DBG("Can't send advs2, the time is not yet synchronized");
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
-    LOG_DBG("http_server_mutex_try_lock");
-    if (!http_server_mutex_try_lock())
+    if (p_adv_post_state->flag_async_comm_in_progress_concurrent)
     {
-        LOG_DBG("Wait until incoming HTTP connection is handled, postpone sending advs2");
-        return;
+        LOG_DBG("Sending advs2 is already in progress in the concurrent mode, postpone sending advs2");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
+    }
+    if (!adv_post_async_comm_reserve_mem(HTTP_ASYNC_SLOT_CUSTOM))
+    {
+        LOG_DBG("Not enough memory budget for HTTP request, postpone sending advs2");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
     g_adv_post_action = ADV_POST_ACTION_POST_ADVS_TO_CUSTOM;
     if (!adv_post_do_retransmission(p_adv_post_state->flag_use_timestamps, ADV_POST_ACTION_POST_ADVS_TO_CUSTOM))
     {
         g_adv_post_action = ADV_POST_ACTION_NONE;
         leds_notify_http2_data_sent_fail();
-        LOG_DBG("http_server_mutex_unlock");
-        http_server_mutex_unlock();
-        return;
+        adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_CUSTOM);
+        return ADV_POST_ASYNC_COMM_START_RES_FAILED;
     }
     g_adv_post_nonce += 1;
     p_adv_post_state->flag_async_comm_in_progress = true;
     p_adv_post_state->flag_need_to_send_advs2     = false;
+    return ADV_POST_ASYNC_COMM_START_RES_STARTED;
 }
 
-static void
+static adv_post_async_comm_start_res_e
 adv_post_do_async_comm_send_statistics(adv_post_state_t* const p_adv_post_state)
 {
     if (!gw_cfg_get_http_stat_use_http_stat())
     {
         LOG_WARN("Can't send statistics, it was disabled in gw_cfg");
         p_adv_post_state->flag_need_to_send_statistics = false;
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_CANCELLED;
     }
     if (!p_adv_post_state->flag_network_connected)
     {
         LOG_DBG("Can't send statistics, no network connection");
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
     if (p_adv_post_state->flag_use_timestamps && (!time_is_synchronized()))
     {
         LOG_DBG("Can't send statistics, the time is not yet synchronized");
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
-    LOG_DBG("http_server_mutex_try_lock");
-    if (!http_server_mutex_try_lock())
+    if (!adv_post_async_comm_reserve_mem(HTTP_ASYNC_SLOT_MAIN))
     {
-        LOG_DBG("Wait until incoming HTTP connection is handled, postpone sending statistics");
-        return;
+        LOG_DBG("Not enough memory budget for HTTP request, postpone sending statistics");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
     g_adv_post_action = ADV_POST_ACTION_POST_STATS;
     if (!adv_post_statistics_do_send())
     {
         LOG_ERR("Failed to send statistics");
         g_adv_post_action = ADV_POST_ACTION_NONE;
-        LOG_DBG("http_server_mutex_unlock");
-        http_server_mutex_unlock();
-        return;
+        adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_MAIN);
+        return ADV_POST_ASYNC_COMM_START_RES_FAILED;
     }
     p_adv_post_state->flag_need_to_send_statistics = false;
     p_adv_post_state->flag_async_comm_in_progress  = true;
+    return ADV_POST_ASYNC_COMM_START_RES_STARTED;
 }
 
-static void
+static adv_post_async_comm_start_res_e
 adv_post_do_async_comm_start_sending_periodic_mqtt(adv_post_state_t* const p_adv_post_state)
 {
     if (!gw_cfg_get_mqtt_use_mqtt())
     {
         LOG_DBG("Can't send advs via MQTT, it was disabled in gw_cfg");
         p_adv_post_state->flag_need_to_send_mqtt_periodic = false;
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_CANCELLED;
     }
     if (!p_adv_post_state->flag_network_connected)
     {
         LOG_DBG("Can't send advs via MQTT, no network connection");
         p_adv_post_state->flag_need_to_send_mqtt_periodic = false;
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_CANCELLED;
     }
     if (!gw_status_is_mqtt_connected())
     {
         LOG_DBG("Can't send advs via MQTT, MQTT is not connected");
         p_adv_post_state->flag_need_to_send_mqtt_periodic = false;
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_CANCELLED;
     }
     if (p_adv_post_state->flag_use_timestamps && (!time_is_synchronized()))
     {
         LOG_DBG("Can't send advs via MQTT, the time is not yet synchronized");
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
+    }
+    if (!adv_post_async_comm_reserve_mem_mqtt())
+    {
+        LOG_DBG("Not enough memory budget for MQTT publishing, postpone sending advs via MQTT");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
     }
     g_adv_post_action = ADV_POST_ACTION_POST_ADVS_TO_MQTT;
 
     if (!adv_post_do_retransmission(p_adv_post_state->flag_use_timestamps, ADV_POST_ACTION_POST_ADVS_TO_MQTT))
     {
         g_adv_post_action = ADV_POST_ACTION_NONE;
+        adv_post_async_comm_release_mem_mqtt();
         main_task_send_sig_restart_services();
-        return;
+        return ADV_POST_ASYNC_COMM_START_RES_FAILED;
     }
 
     p_adv_post_state->flag_need_to_send_mqtt_periodic = false;
     p_adv_post_state->flag_async_comm_in_progress     = true;
     adv_post_signals_send_sig(ADV_POST_SIG_DO_ASYNC_COMM);
+    return ADV_POST_ASYNC_COMM_START_RES_STARTED;
+}
+
+static bool
+adv_post_is_periodic_mqtt_connected(void)
+{
+    return gw_cfg_get_mqtt_use_mqtt() && (0 != gw_cfg_get_mqtt_sending_interval()) && gw_status_is_mqtt_connected();
+}
+
+static void
+adv_post_publish_urgent_advs_to_mqtt(const adv_report_table_t* const p_reports)
+{
+    if (!adv_post_async_comm_reserve_mem_mqtt())
+    {
+        LOG_WARN("Not enough memory budget for MQTT publishing - urgent advs will be sent with the periodic batch");
+        return;
+    }
+    const bool   flag_ntp_use = gw_cfg_get_ntp_use();
+    const time_t timestamp    = flag_ntp_use ? time(NULL) : 0;
+    for (num_of_advs_t i = 0; i < p_reports->num_of_advs; ++i)
+    {
+        if (!mqtt_is_buffer_available_for_publish())
+        {
+            LOG_WARN("MQTT buffer is full - the rest of urgent advs will be sent with the periodic batch");
+            break;
+        }
+        if (!mqtt_publish_adv(&g_adv_post_mqtt_json_gen, &p_reports->table[i], flag_ntp_use, timestamp))
+        {
+            LOG_ERR("%s failed", "mqtt_publish_adv");
+            break;
+        }
+    }
+    LOG_DBG("http_mem_budget_release: mqtt");
+    http_mem_budget_release(HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH);
+}
+
+/**
+ * @brief Push the advs which fired adv_trigger without waiting for the periodic batch.
+ * @note The advs are not removed from the retransmission lists, so they are sent with the periodic batch as well
+ *       and nothing is lost if the urgent transfer fails.
+ */
+static adv_post_async_comm_start_res_e
+adv_post_do_async_comm_send_urgent(adv_post_state_t* const p_adv_post_state)
+{
+    const bool flag_use_http = gw_cfg_get_http_use_http();
+    const bool flag_use_mqtt = adv_post_is_periodic_mqtt_connected();
+    if (!p_adv_post_state->flag_network_connected)
+    {
+        LOG_DBG("Can't send urgent advs, no network connection");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
+    }
+    if ((!flag_use_http) && (!flag_use_mqtt))
+    {
+        LOG_DBG("Can't send urgent advs, MQTT is not connected");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
+    }
+    if (p_adv_post_state->flag_use_timestamps && (!time_is_synchronized()))
+    {
+        LOG_DBG("Can't send urgent advs, the time is not yet synchronized");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
+    }
+    if (flag_use_http && p_adv_post_state->flag_async_comm_in_progress_concurrent)
+    {
+        LOG_DBG("Sending advs2 is in progress in the concurrent mode, postpone sending urgent advs");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
+    }
+    if (flag_use_http && (!adv_post_async_comm_reserve_mem(HTTP_ASYNC_SLOT_CUSTOM)))
+    {
+        LOG_DBG("Not enough memory budget for HTTP request, postpone sending urgent advs");
+        return ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
+    }
+    adv_report_table_t* const p_reports = adv_report_pool_checkout();
+    if (NULL == p_reports)
+    {
+        LOG_ERR("Can't allocate memory");
+        if (flag_use_http)
+        {
+            adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_CUSTOM);
+        }
+        return ADV_POST_ASYNC_COMM_START_RES_FAILED;
+    }
+    p_adv_post_state->flag_need_to_send_urgent = false;
+    if (0 == adv_post_read_triggered_advs(p_reports))
+    {
+        adv_report_pool_return(p_reports);
+        if (flag_use_http)
+        {
+            adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_CUSTOM);
+        }
+        return ADV_POST_ASYNC_COMM_START_RES_CANCELLED;
+    }
+    adv_post_log(p_reports, p_adv_post_state->flag_use_timestamps, "Urgent");
+    if (flag_use_mqtt)
+    {
+        adv_post_publish_urgent_advs_to_mqtt(p_reports);
+    }
+    if (!flag_use_http)
+    {
+        adv_report_pool_return(p_reports);
+        return ADV_POST_ASYNC_COMM_START_RES_COMPLETED;
+    }
+    // The triggered advs are not read from the retransmission lists, so the completion of the urgent request
+    // must not commit or roll back any adv_table ticket - the custom slot can't hold a pending batch here.
+    assert(ADV_TABLE_TICKET_NONE == g_adv_post_tickets_http[HTTP_ASYNC_SLOT_CUSTOM]);
+    adv_post_hold_reports_for_http_slot(HTTP_ASYNC_SLOT_CUSTOM, p_reports);
+    if (!adv_post_retransmit_advs(p_reports, p_adv_post_state->flag_use_timestamps, false))
+    {
+        g_adv_post_action = ADV_POST_ACTION_NONE;
+        leds_notify_http2_data_sent_fail();
+        adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_CUSTOM);
+        return ADV_POST_ASYNC_COMM_START_RES_FAILED;
+    }
+    // http_post_advs selects the action by the target, but the completion must be accounted to the urgent one
+    g_adv_post_action = ADV_POST_ACTION_POST_URGENT_ADVS;
+    g_adv_post_nonce += 1;
+    p_adv_post_state->flag_async_comm_in_progress = true;
+    return ADV_POST_ASYNC_COMM_START_RES_STARTED;
 }
 
 static bool
-adv_post_do_async_comm_in_progress_mqtt(void)
+adv_post_do_async_comm_in_progress_mqtt(bool* const p_flag_success)
 {
     assert(NULL != g_p_adv_post_reports_mqtt);
 
+    if (!mqtt_is_buffer_available_for_publish())
+    {
+        LOG_DBG("MQTT buffer is full - postpone sending advs to MQTT");
+        return false;
+    }
+
     const adv_report_t* const p_adv_report = &g_p_adv_post_reports_mqtt->table[g_adv_post_reports_mqtt_idx];
 
-    if (!mqtt_publish_adv(p_adv_report, gw_cfg_get_ntp_use(), g_adv_post_reports_mqtt_timestamp))
+    if (!mqtt_publish_adv(
+            &g_adv_post_mqtt_json_gen,
+            p_adv_report,
+            gw_cfg_get_ntp_use(),
+            g_adv_post_reports_mqtt_timestamp))
     {
         LOG_ERR("%s failed", "mqtt_publish_adv");
-        os_free(g_p_adv_post_reports_mqtt);
-        g_p_adv_post_reports_mqtt   = NULL;
-        g_adv_post_reports_mqtt_idx = 0;
+        adv_post_async_comm_release_mem_mqtt();
+        *p_flag_success = false;
         return true;
     }
 
     g_adv_post_reports_mqtt_idx += 1;
     if (g_adv_post_reports_mqtt_idx >= g_p_adv_post_reports_mqtt->num_of_advs)
     {
-        os_free(g_p_adv_post_reports_mqtt);
-        g_p_adv_post_reports_mqtt   = NULL;
-        g_adv_post_reports_mqtt_idx = 0;
+        adv_post_async_comm_release_mem_mqtt();
+        *p_flag_success = true;
         return true;
     }
     return false;
 }
 
+static adv_post_sched_target_e
+adv_post_conv_action_to_sched_target(const adv_post_action_e adv_post_action)
+{
+    adv_post_sched_target_e target = ADV_POST_SCHED_TARGET_NONE;
+    switch (adv_post_action)
+    {
+        case ADV_POST_ACTION_NONE:
+            break;
+        case ADV_POST_ACTION_POST_ADVS_TO_RUUVI:
+            target = ADV_POST_SCHED_TARGET_HTTP_RUUVI;
+            break;
+        case ADV_POST_ACTION_POST_ADVS_TO_CUSTOM:
+            target = ADV_POST_SCHED_TARGET_HTTP_CUSTOM;
+            break;
+        case ADV_POST_ACTION_POST_STATS:
+            target = ADV_POST_SCHED_TARGET_HTTP_STAT;
+            break;
+        case ADV_POST_ACTION_POST_ADVS_TO_MQTT:
+            target = ADV_POST_SCHED_TARGET_MQTT;
+            break;
+        case ADV_POST_ACTION_POST_URGENT_ADVS:
+            target = ADV_POST_SCHED_TARGET_URGENT;
+            break;
+    }
+    return target;
+}
+
+static http_async_slot_e
+adv_post_conv_action_to_http_async_slot(const adv_post_action_e adv_post_action)
+{
+    return ((ADV_POST_ACTION_POST_ADVS_TO_CUSTOM == adv_post_action)
+            || (ADV_POST_ACTION_POST_URGENT_ADVS == adv_post_action))
+               ? HTTP_ASYNC_SLOT_CUSTOM
+               : HTTP_ASYNC_SLOT_MAIN;
+}
+
 static bool
-adv_post_do_async_comm_in_progress(adv_post_state_t* const p_adv_post_state)
+adv_post_do_async_comm_in_progress(adv_post_state_t* const p_adv_post_state, const adv_post_sched_time_ms_t now_ms)
 {
+    const adv_post_sched_target_e target       = adv_post_conv_action_to_sched_target(g_adv_post_action);
+    bool                          flag_success = false;
     if (ADV_POST_ACTION_POST_ADVS_TO_MQTT != g_adv_post_action)
     {
+        const http_async_slot_e slot = adv_post_conv_action_to_http_async_slot(g_adv_post_action);
         if (!http_async_poll(
-                &g_adv_post_malloc_fail_cnt[ADV_POST_ACTION_POST_ADVS_TO_RUUVI == g_adv_post_action ? 0 : 1]))
+                slot,
+                &g_adv_post_malloc_fail_cnt[ADV_POST_ACTION_POST_ADVS_TO_RUUVI == g_adv_post_action ? 0 : 1],
+                &flag_success))
         {
             LOG_DBG("os_timer_sig_one_shot_start: g_p_adv_post_timer_sig_do_async_comm");
             adv_post_timers_start_timer_sig_do_async_comm();
@@ -343,36 +656,235 @@ adv_post_do_async_comm_in_progress(adv_post_state_t* const p_adv_post_state)
                 p_adv_post_state->flag_need_to_send_statistics = false;
                 g_adv_post_action                              = ADV_POST_ACTION_NONE;
                 break;
+            case ADV_POST_ACTION_POST_URGENT_ADVS:
+                // The flag is not cleared, the tags could fire again while the request was in progress
+                g_adv_post_action = ADV_POST_ACTION_NONE;
+                break;
             default:
                 break;
         }
 
-        LOG_DBG("http_server_mutex_unlock");
-        http_server_mutex_unlock();
+        adv_post_finish_ticket_for_http_slot(slot, flag_success);
+        adv_post_async_comm_release_mem(slot);
 
         const uint32_t free_heap = esp_get_free_heap_size();
         LOG_INFO("Cur free heap: %lu", (printf_ulong_t)free_heap);
     }
     else
     {
-        if (!adv_post_do_async_comm_in_progress_mqtt())
+        if (!adv_post_do_async_comm_in_progress_mqtt(&flag_success))
         {
             LOG_DBG("os_timer_sig_one_shot_start: g_p_adv_post_timer_sig_do_async_comm");
             adv_post_timers_start_timer_sig_do_async_comm();
             return false;
         }
     }
+    adv_post_sched_on_finished(target, flag_success, now_ms);
     return true;
 }
 
+static void
+adv_post_do_async_comm_in_progress_concurrent(
+    adv_post_state_t* const        p_adv_post_state,
+    const adv_post_sched_time_ms_t now_ms)
+{
+    // g_adv_post_action belongs to the main slot, switch it temporarily
+    // so that the HTTP response headers of the concurrent request are applied to the custom target
+    const adv_post_action_e saved_adv_post_action = g_adv_post_action;
+    g_adv_post_action                             = ADV_POST_ACTION_POST_ADVS_TO_CUSTOM;
+
+    bool       flag_success   = false;
+    const bool flag_completed = http_async_poll(HTTP_ASYNC_SLOT_CUSTOM, &g_adv_post_malloc_fail_cnt[1], &flag_success);
+
+    g_adv_post_action = saved_adv_post_action;
+    if (!flag_completed)
+    {
+        return;
+    }
+    LOG_INFO("Concurrent request to the custom HTTP target completed, success=%d", (printf_int_t)flag_success);
+    p_adv_post_state->flag_async_comm_in_progress_concurrent = false;
+    adv_post_finish_ticket_for_http_slot(HTTP_ASYNC_SLOT_CUSTOM, flag_success);
+    adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_CUSTOM);
+    adv_post_sched_on_finished(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, flag_success, now_ms);
+}
+
+/**
+ * @brief Start sending advs to the custom HTTP target in the separate slot
+ *        while the request to the Ruuvi target (or statistics) is in progress.
+ * @note The concurrent request is started only if it's enabled, its memory budget is reserved by http_mem_budget
+ *       and http_async_gov confirms that enough free heap remains,
+ *       otherwise the custom target waits for its turn (the serial mode).
+ */
+static void
+adv_post_do_async_comm_start_concurrent(
+    adv_post_state_t* const        p_adv_post_state,
+    const adv_post_sched_time_ms_t now_ms)
+{
+    if (!http_async_gov_is_concurrent_mode_enabled())
+    {
+        return;
+    }
+    if ((!p_adv_post_state->flag_async_comm_in_progress) || p_adv_post_state->flag_async_comm_in_progress_concurrent)
+    {
+        return;
+    }
+    if ((ADV_POST_ACTION_POST_ADVS_TO_RUUVI != g_adv_post_action) && (ADV_POST_ACTION_POST_STATS != g_adv_post_action))
+    {
+        return;
+    }
+    if ((!p_adv_post_state->flag_relaying_enabled) || (!p_adv_post_state->flag_network_connected)
+        || (!p_adv_post_state->flag_need_to_send_advs2))
+    {
+        return;
+    }
+    if (p_adv_post_state->flag_use_timestamps && (!time_is_synchronized()))
+    {
+        return;
+    }
+    if (!adv_post_sched_is_ready(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, now_ms))
+    {
+        return;
+    }
+    if (!adv_post_async_comm_reserve_mem(HTTP_ASYNC_SLOT_CUSTOM))
+    {
+        LOG_INFO("Not enough memory budget for the concurrent HTTP request, fall back to the serial mode");
+        return;
+    }
+    if (!http_async_gov_check_concurrent())
+    {
+        LOG_INFO("Not enough free memory for the concurrent HTTP request, fall back to the serial mode");
+        adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_CUSTOM);
+        return;
+    }
+    LOG_INFO("Start concurrent request to the custom HTTP target");
+
+    const adv_post_action_e saved_adv_post_action = g_adv_post_action;
+    const uint32_t          free_heap_before      = esp_get_free_heap_size();
+    const bool              flag_started          = adv_post_do_retransmission(
+        p_adv_post_state->flag_use_timestamps,
+        ADV_POST_ACTION_POST_ADVS_TO_CUSTOM);
+    http_async_gov_register_mem_usage(free_heap_before, esp_get_free_heap_size());
+    g_adv_post_action = saved_adv_post_action;
+
+    adv_post_sched_on_started(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, now_ms);
+    if (!flag_started)
+    {
+        leds_notify_http2_data_sent_fail();
+        adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_CUSTOM);
+        adv_post_sched_on_finished(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, false, now_ms);
+        return;
+    }
+    g_adv_post_nonce += 1;
+    p_adv_post_state->flag_async_comm_in_progress_concurrent = true;
+    p_adv_post_state->flag_need_to_send_advs2                = false;
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, false, now_ms);
+}
+
+static bool*
+adv_post_get_ptr_to_flag_need_to_send(adv_post_state_t* const p_adv_post_state, const adv_post_sched_target_e target)
+{
+    bool* p_flag = NULL;
+    switch (target)
+    {
+        case ADV_POST_SCHED_TARGET_URGENT:
+            p_flag = &p_adv_post_state->flag_need_to_send_urgent;
+            break;
+        case ADV_POST_SCHED_TARGET_HTTP_RUUVI:
+            p_flag = &p_adv_post_state->flag_need_to_send_advs1;
+            break;
+        case ADV_POST_SCHED_TARGET_HTTP_CUSTOM:
+            p_flag = &p_adv_post_state->flag_need_to_send_advs2;
+            break;
+        case ADV_POST_SCHED_TARGET_HTTP_STAT:
+            p_flag = &p_adv_post_state->flag_need_to_send_statistics;
+            break;
+        case ADV_POST_SCHED_TARGET_MQTT:
+            p_flag = &p_adv_post_state->flag_need_to_send_mqtt_periodic;
+            break;
+        default:
+            break;
+    }
+    return p_flag;
+}
+
+static void
+adv_post_do_async_comm_update_pending(adv_post_state_t* const p_adv_post_state, const adv_post_sched_time_ms_t now_ms)
+{
+    for (uint32_t i = 0; i < ADV_POST_SCHED_TARGET_LAST; ++i)
+    {
+        const adv_post_sched_target_e target = (adv_post_sched_target_e)i;
+        const bool* const             p_flag = adv_post_get_ptr_to_flag_need_to_send(p_adv_post_state, target);
+        adv_post_sched_set_pending(target, *p_flag, now_ms);
+    }
+}
+
+/**
+ * @brief Drop the pending targets which were in backoff for too long.
+ * @return true if there are still pending targets which are waiting for tokens or for the end of backoff.
+ */
+static bool
+adv_post_do_async_comm_drop_aged_out(adv_post_state_t* const p_adv_post_state, const adv_post_sched_time_ms_t now_ms)
+{
+    bool flag_pending = false;
+    for (uint32_t i = 0; i < ADV_POST_SCHED_TARGET_LAST; ++i)
+    {
+        const adv_post_sched_target_e target = (adv_post_sched_target_e)i;
+        if (adv_post_sched_check_aged_out(target, now_ms))
+        {
+            LOG_WARN("Drop pending request for target %s: it keeps failing", adv_post_sched_get_target_name(target));
+            *adv_post_get_ptr_to_flag_need_to_send(p_adv_post_state, target) = false;
+        }
+        if (adv_post_sched_is_pending(target))
+        {
+            flag_pending = true;
+        }
+    }
+    return flag_pending;
+}
+
+static adv_post_async_comm_start_res_e
+adv_post_do_async_comm_start(adv_post_state_t* const p_adv_post_state, const adv_post_sched_target_e target)
+{
+    adv_post_async_comm_start_res_e res = ADV_POST_ASYNC_COMM_START_RES_POSTPONED;
+    switch (target)
+    {
+        case ADV_POST_SCHED_TARGET_URGENT:
+            res = adv_post_do_async_comm_send_urgent(p_adv_post_state);
+            break;
+        case ADV_POST_SCHED_TARGET_HTTP_RUUVI:
+            res = adv_post_do_async_comm_send_advs1(p_adv_post_state);
+            break;
+        case ADV_POST_SCHED_TARGET_HTTP_CUSTOM:
+            res = adv_post_do_async_comm_send_advs2(p_adv_post_state);
+            break;
+        case ADV_POST_SCHED_TARGET_HTTP_STAT:
+            res = adv_post_do_async_comm_send_statistics(p_adv_post_state);
+            break;
+        case ADV_POST_SCHED_TARGET_MQTT:
+            res = adv_post_do_async_comm_start_sending_periodic_mqtt(p_adv_post_state);
+            break;
+        default:
+            break;
+    }
+    return res;
+}
+
 void
 adv_post_do_async_comm(adv_post_state_t* const p_adv_post_state)
 {
+    const adv_post_sched_time_ms_t now_ms = adv_post_async_comm_get_time_ms();
+
     LOG_DBG("flag_async_comm_in_progress=%d", p_adv_post_state->flag_async_comm_in_progress);
+    adv_post_do_async_comm_update_pending(p_adv_post_state, now_ms);
+    if (p_adv_post_state->flag_async_comm_in_progress_concurrent)
+    {
+        adv_post_do_async_comm_in_progress_concurrent(p_adv_post_state, now_ms);
+    }
     if (p_adv_post_state->flag_async_comm_in_progress)
     {
-        if (!adv_post_do_async_comm_in_progress(p_adv_post_state))
+        if (!adv_post_do_async_comm_in_progress(p_adv_post_state, now_ms))
         {
+            adv_post_do_async_comm_start_concurrent(p_adv_post_state, now_ms);
             return;
         }
         p_adv_post_state->flag_async_comm_in_progress = false;
@@ -381,29 +893,51 @@ adv_post_do_async_comm(adv_post_state_t* const p_adv_post_state)
     {
         return;
     }
-    if (p_adv_post_state->flag_need_to_send_advs1)
-    {
-        adv_post_do_async_comm_send_advs1(p_adv_post_state);
-        adv_post_timers_start_timer_sig_do_async_comm();
-        return;
-    }
-    if (p_adv_post_state->flag_need_to_send_advs2)
+    // The flags could be cleared after the completion of the previous transfer
+    adv_post_do_async_comm_update_pending(p_adv_post_state, now_ms);
+    const adv_post_sched_target_e target = adv_post_sched_select(now_ms);
+    if (ADV_POST_SCHED_TARGET_NONE == target)
     {
-        adv_post_do_async_comm_send_advs2(p_adv_post_state);
-        adv_post_timers_start_timer_sig_do_async_comm();
+        if (adv_post_do_async_comm_drop_aged_out(p_adv_post_state, now_ms)
+            || p_adv_post_state->flag_async_comm_in_progress_concurrent)
+        {
+            adv_post_timers_start_timer_sig_do_async_comm();
+        }
         return;
     }
-    if (p_adv_post_state->flag_need_to_send_statistics)
+    switch (adv_post_do_async_comm_start(p_adv_post_state, target))
     {
-        adv_post_do_async_comm_send_statistics(p_adv_post_state);
-        adv_post_timers_start_timer_sig_do_async_comm();
-        return;
+        case ADV_POST_ASYNC_COMM_START_RES_STARTED:
+            adv_post_sched_on_started(target, now_ms);
+            adv_post_do_async_comm_start_concurrent(p_adv_post_state, now_ms);
+            break;
+        case ADV_POST_ASYNC_COMM_START_RES_FAILED:
+            adv_post_sched_on_started(target, now_ms);
+            adv_post_sched_on_finished(target, false, now_ms);
+            break;
+        case ADV_POST_ASYNC_COMM_START_RES_POSTPONED:
+            break;
+        case ADV_POST_ASYNC_COMM_START_RES_CANCELLED:
+            break;
+        case ADV_POST_ASYNC_COMM_START_RES_COMPLETED:
+            adv_post_sched_on_started(target, now_ms);
+            adv_post_sched_on_finished(target, true, now_ms);
+            break;
     }
-    if (p_adv_post_state->flag_need_to_send_mqtt_periodic)
+    adv_post_timers_start_timer_sig_do_async_comm();
+}
+
+void
+adv_post_async_comm_on_abort(void)
+{
+    // The aborted batches were never acknowledged - return them to the retransmission lists.
+    adv_post_finish_ticket_for_http_slot(HTTP_ASYNC_SLOT_MAIN, false);
+    adv_post_finish_ticket_for_http_slot(HTTP_ASYNC_SLOT_CUSTOM, false);
+    adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_MAIN);
+    adv_post_async_comm_release_mem(HTTP_ASYNC_SLOT_CUSTOM);
+    if (NULL != g_p_adv_post_reports_mqtt)
     {
-        adv_post_do_async_comm_start_sending_periodic_mqtt(p_adv_post_state);
-        adv_post_timers_start_timer_sig_do_async_comm();
-        return;
+        adv_post_async_comm_release_mem_mqtt();
     }
 }
 
@@ -418,6 +952,8 @@ adv_post_set_default_period(const uint32_t period_ms)
             adv1_post_timer_set_default_period_by_server_resp(period_ms);
             break;
         case ADV_POST_ACTION_POST_ADVS_TO_CUSTOM:
+            ATTR_FALLTHROUGH;
+        case ADV_POST_ACTION_POST_URGENT_ADVS:
             adv2_post_timer_set_default_period_by_server_resp(period_ms);
             break;
         case ADV_POST_ACTION_POST_STATS:
@@ -438,6 +974,8 @@ adv_post_set_hmac_sha256_key(const char* const p_key_str)
             LOG_INFO("Ruuvi-HMAC-KEY: Server updated HMAC_SHA256 key for Ruuvi target");
             return hmac_sha256_set_key_for_http_ruuvi(p_key_str);
         case ADV_POST_ACTION_POST_ADVS_TO_CUSTOM:
+            ATTR_FALLTHROUGH;
+        case ADV_POST_ACTION_POST_URGENT_ADVS:
             LOG_INFO("Ruuvi-HMAC-KEY: Server updated HMAC_SHA256 key for custom target");
             return hmac_sha256_set_key_for_http_custom(p_key_str);
         case ADV_POST_ACTION_POST_STATS:
@@ -22,6 +22,7 @@ typedef enum adv_post_action_e
     ADV_POST_ACTION_POST_ADVS_TO_CUSTOM,
     ADV_POST_ACTION_POST_STATS,
     ADV_POST_ACTION_POST_ADVS_TO_MQTT,
+    ADV_POST_ACTION_POST_URGENT_ADVS, //!< The advs which fired adv_trigger are posted to the custom HTTP target
 } adv_post_action_e;
 
 void
@@ -30,6 +31,12 @@ adv_post_async_comm_init(void);
 void
 adv_post_do_async_comm(adv_post_state_t* const p_adv_post_state);
 
+/**
+ * @brief Release the memory budget reserved for the HTTP requests after all of them were aborted.
+ */
+void
+adv_post_async_comm_on_abort(void);
+
 void
 adv_post_set_default_period(const uint32_t period_ms);
 
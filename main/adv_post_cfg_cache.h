@@ -11,6 +11,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "mac_addr.h"
+#include "adv_filter.h"
+#include "adv_aggr.h"
+#include "adv_trigger.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -22,6 +25,9 @@ typedef struct adv_post_cfg_cache_t
     bool               scan_filter_allow_listed;
     uint32_t           scan_filter_length;
     mac_address_bin_t* p_arr_of_scan_filter_mac;
+    adv_filter_t       adv_filter;  // Compiled from gw_cfg on every change of the configuration
+    adv_aggr_t         adv_aggr;    // Reset on every change of the configuration
+    adv_trigger_t      adv_trigger; // Reset on every change of the configuration
 } adv_post_cfg_cache_t;
 
 void
@@ -35,6 +35,8 @@ typedef struct adv_post_state_t
     bool flag_relaying_enabled;
     bool flag_use_timestamps;
     bool flag_stop;
+    bool flag_async_comm_in_progress_concurrent;
+    bool flag_need_to_send_urgent;
 } adv_post_state_t;
 
 #ifdef __cplusplus
@@ -0,0 +1,374 @@
+/**
+ * @file adv_post_sched.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_post_sched.h"
+#include <string.h>
+#include "os_mutex.h"
+
+typedef enum adv_post_sched_blocked_e
+{
+    ADV_POST_SCHED_BLOCKED_NONE,
+    ADV_POST_SCHED_BLOCKED_BACKOFF,
+    ADV_POST_SCHED_BLOCKED_RATE_LIMITED,
+} adv_post_sched_blocked_e;
+
+typedef struct adv_post_sched_target_state_t
+{
+    bool                     flag_pending;
+    /**
+     * The reason why the pending target was not eligible the last time it was checked.
+     * The target is polled on every scheduling pass, so the stat counters are incremented only when it changes.
+     */
+    adv_post_sched_blocked_e blocked;
+    adv_post_sched_time_ms_t pending_since_ms;
+    adv_post_sched_time_ms_t backoff_until_ms;
+    /**
+     * The token bucket is stored as an accumulated credit in milliseconds: one token is worth bucket_refill_ms,
+     * so the refill is just adding the elapsed time (limited by bucket_capacity * bucket_refill_ms).
+     */
+    adv_post_sched_time_ms_t bucket_credit_ms;
+    adv_post_sched_time_ms_t bucket_timestamp_ms;
+    adv_post_sched_stat_t    stat;
+} adv_post_sched_target_state_t;
+
+static const adv_post_sched_target_cfg_t g_adv_post_sched_target_cfg[ADV_POST_SCHED_TARGET_LAST] = {
+    [ADV_POST_SCHED_TARGET_URGENT] = {
+        .weight = 8U,
+        .deadline_ms = 1U * 1000U,
+        .max_age_ms = 30U * 1000U,
+        .bucket_capacity = 5U,
+        .bucket_refill_ms = 2U * 1000U, // A tag which is shaking all the time must not flood the network
+    },
+    [ADV_POST_SCHED_TARGET_HTTP_RUUVI] = {
+        .weight = 4U,
+        .deadline_ms = 5U * 1000U,
+        .max_age_ms = 60U * 1000U,
+        .bucket_capacity = 3U,
+        .bucket_refill_ms = 3U * 1000U,
+    },
+    [ADV_POST_SCHED_TARGET_HTTP_CUSTOM] = {
+        .weight = 3U,
+        .deadline_ms = 5U * 1000U,
+        .max_age_ms = 60U * 1000U,
+        .bucket_capacity = 3U,
+        .bucket_refill_ms = 3U * 1000U,
+    },
+    [ADV_POST_SCHED_TARGET_HTTP_STAT] = {
+        .weight = 2U,
+        .deadline_ms = 60U * 1000U,
+        .max_age_ms = 10U * 60U * 1000U,
+        .bucket_capacity = 2U,
+        .bucket_refill_ms = 60U * 1000U,
+    },
+    [ADV_POST_SCHED_TARGET_MQTT] = {
+        .weight = 1U,
+        .deadline_ms = 5U * 1000U,
+        .max_age_ms = 60U * 1000U,
+        .bucket_capacity = 3U,
+        .bucket_refill_ms = 1U * 1000U,
+    },
+};
+
+static const char* const g_adv_post_sched_target_names[ADV_POST_SCHED_TARGET_LAST] = {
+    [ADV_POST_SCHED_TARGET_URGENT]      = "urgent",
+    [ADV_POST_SCHED_TARGET_HTTP_RUUVI]  = "http_ruuvi",
+    [ADV_POST_SCHED_TARGET_HTTP_CUSTOM] = "http_custom",
+    [ADV_POST_SCHED_TARGET_HTTP_STAT]   = "http_stat",
+    [ADV_POST_SCHED_TARGET_MQTT]        = "mqtt",
+};
+
+static adv_post_sched_target_state_t g_adv_post_sched_targets[ADV_POST_SCHED_TARGET_LAST];
+static os_mutex_t                    g_p_adv_post_sched_mutex;
+static os_mutex_static_t             g_adv_post_sched_mutex_mem;
+
+void
+adv_post_sched_init(const adv_post_sched_time_ms_t now_ms)
+{
+    if (NULL == g_p_adv_post_sched_mutex)
+    {
+        g_p_adv_post_sched_mutex = os_mutex_create_static(&g_adv_post_sched_mutex_mem);
+    }
+    os_mutex_lock(g_p_adv_post_sched_mutex);
+    memset(g_adv_post_sched_targets, 0, sizeof(g_adv_post_sched_targets));
+    for (uint32_t i = 0; i < ADV_POST_SCHED_TARGET_LAST; ++i)
+    {
+        const adv_post_sched_target_cfg_t* const p_cfg   = &g_adv_post_sched_target_cfg[i];
+        adv_post_sched_target_state_t* const     p_state = &g_adv_post_sched_targets[i];
+
+        p_state->bucket_credit_ms    = (adv_post_sched_time_ms_t)p_cfg->bucket_capacity * p_cfg->bucket_refill_ms;
+        p_state->bucket_timestamp_ms = now_ms;
+    }
+    os_mutex_unlock(g_p_adv_post_sched_mutex);
+}
+
+static void
+adv_post_sched_lock(void)
+{
+    if (NULL == g_p_adv_post_sched_mutex)
+    {
+        adv_post_sched_init(0);
+    }
+    os_mutex_lock(g_p_adv_post_sched_mutex);
+}
+
+static void
+adv_post_sched_unlock(void)
+{
+    os_mutex_unlock(g_p_adv_post_sched_mutex);
+}
+
+const adv_post_sched_target_cfg_t*
+adv_post_sched_get_target_cfg(const adv_post_sched_target_e target)
+{
+    if (target >= ADV_POST_SCHED_TARGET_LAST)
+    {
+        return NULL;
+    }
+    return &g_adv_post_sched_target_cfg[target];
+}
+
+static void
+adv_post_sched_refill_bucket(const adv_post_sched_target_e target, const adv_post_sched_time_ms_t now_ms)
+{
+    const adv_post_sched_target_cfg_t* const p_cfg   = &g_adv_post_sched_target_cfg[target];
+    adv_post_sched_target_state_t* const     p_state = &g_adv_post_sched_targets[target];
+
+    const adv_post_sched_time_ms_t max_credit_ms = (adv_post_sched_time_ms_t)p_cfg->bucket_capacity
+                                                   * p_cfg->bucket_refill_ms;
+    if (now_ms > p_state->bucket_timestamp_ms)
+    {
+        p_state->bucket_credit_ms += now_ms - p_state->bucket_timestamp_ms;
+    }
+    p_state->bucket_timestamp_ms = now_ms;
+    if (p_state->bucket_credit_ms > max_credit_ms)
+    {
+        p_state->bucket_credit_ms = max_credit_ms;
+    }
+}
+
+void
+adv_post_sched_set_pending(
+    const adv_post_sched_target_e  target,
+    const bool                     flag_pending,
+    const adv_post_sched_time_ms_t now_ms)
+{
+    if (target >= ADV_POST_SCHED_TARGET_LAST)
+    {
+        return;
+    }
+    adv_post_sched_lock();
+    adv_post_sched_target_state_t* const p_state = &g_adv_post_sched_targets[target];
+    if (flag_pending && (!p_state->flag_pending))
+    {
+        p_state->pending_since_ms = now_ms;
+        p_state->blocked          = ADV_POST_SCHED_BLOCKED_NONE;
+    }
+    p_state->flag_pending = flag_pending;
+    adv_post_sched_unlock();
+}
+
+bool
+adv_post_sched_is_pending(const adv_post_sched_target_e target)
+{
+    if (target >= ADV_POST_SCHED_TARGET_LAST)
+    {
+        return false;
+    }
+    adv_post_sched_lock();
+    const bool flag_pending = g_adv_post_sched_targets[target].flag_pending;
+    adv_post_sched_unlock();
+    return flag_pending;
+}
+
+static bool
+adv_post_sched_is_eligible(const adv_post_sched_target_e target, const adv_post_sched_time_ms_t now_ms)
+{
+    const adv_post_sched_target_cfg_t* const p_cfg   = &g_adv_post_sched_target_cfg[target];
+    adv_post_sched_target_state_t* const     p_state = &g_adv_post_sched_targets[target];
+
+    if (now_ms < p_state->backoff_until_ms)
+    {
+        if (ADV_POST_SCHED_BLOCKED_BACKOFF != p_state->blocked)
+        {
+            p_state->blocked = ADV_POST_SCHED_BLOCKED_BACKOFF;
+            p_state->stat.cnt_skipped_backoff += 1;
+        }
+        return false;
+    }
+    adv_post_sched_refill_bucket(target, now_ms);
+    if (p_state->bucket_credit_ms < (adv_post_sched_time_ms_t)p_cfg->bucket_refill_ms)
+    {
+        if (ADV_POST_SCHED_BLOCKED_RATE_LIMITED != p_state->blocked)
+        {
+            p_state->blocked = ADV_POST_SCHED_BLOCKED_RATE_LIMITED;
+            p_state->stat.cnt_rate_limited += 1;
+        }
+        return false;
+    }
+    p_state->blocked = ADV_POST_SCHED_BLOCKED_NONE;
+    return true;
+}
+
+bool
+adv_post_sched_is_ready(const adv_post_sched_target_e target, const adv_post_sched_time_ms_t now_ms)
+{
+    if (target >= ADV_POST_SCHED_TARGET_LAST)
+    {
+        return false;
+    }
+    adv_post_sched_lock();
+    const bool flag_ready = g_adv_post_sched_targets[target].flag_pending && adv_post_sched_is_eligible(target, now_ms);
+    adv_post_sched_unlock();
+    return flag_ready;
+}
+
+adv_post_sched_target_e
+adv_post_sched_select(const adv_post_sched_time_ms_t now_ms)
+{
+    adv_post_sched_target_e  selected_target = ADV_POST_SCHED_TARGET_NONE;
+    adv_post_sched_time_ms_t max_score       = -1;
+
+    adv_post_sched_lock();
+    for (uint32_t i = 0; i < ADV_POST_SCHED_TARGET_LAST; ++i)
+    {
+        const adv_post_sched_target_e        target  = (adv_post_sched_target_e)i;
+        const adv_post_sched_target_state_t* p_state = &g_adv_post_sched_targets[i];
+        if (!p_state->flag_pending)
+        {
+            continue;
+        }
+        if (!adv_post_sched_is_eligible(target, now_ms))
+        {
+            continue;
+        }
+        const adv_post_sched_time_ms_t waiting_ms = (now_ms > p_state->pending_since_ms)
+                                                        ? (now_ms - p_state->pending_since_ms)
+                                                        : 0;
+        const adv_post_sched_time_ms_t score = (waiting_ms + 1) * g_adv_post_sched_target_cfg[i].weight;
+        if (score > max_score)
+        {
+            max_score       = score;
+            selected_target = target;
+        }
+    }
+    adv_post_sched_unlock();
+    return selected_target;
+}
+
+bool
+adv_post_sched_check_aged_out(const adv_post_sched_target_e target, const adv_post_sched_time_ms_t now_ms)
+{
+    if (target >= ADV_POST_SCHED_TARGET_LAST)
+    {
+        return false;
+    }
+    bool flag_aged_out = false;
+    adv_post_sched_lock();
+    adv_post_sched_target_state_t* const p_state = &g_adv_post_sched_targets[target];
+    if (p_state->flag_pending && (now_ms < p_state->backoff_until_ms)
+        && ((now_ms - p_state->pending_since_ms) >= g_adv_post_sched_target_cfg[target].max_age_ms))
+    {
+        p_state->flag_pending = false;
+        p_state->stat.cnt_aged_out += 1;
+        flag_aged_out = true;
+    }
+    adv_post_sched_unlock();
+    return flag_aged_out;
+}
+
+void
+adv_post_sched_on_started(const adv_post_sched_target_e target, const adv_post_sched_time_ms_t now_ms)
+{
+    if (target >= ADV_POST_SCHED_TARGET_LAST)
+    {
+        return;
+    }
+    adv_post_sched_lock();
+    const adv_post_sched_target_cfg_t* const p_cfg   = &g_adv_post_sched_target_cfg[target];
+    adv_post_sched_target_state_t* const     p_state = &g_adv_post_sched_targets[target];
+
+    adv_post_sched_refill_bucket(target, now_ms);
+    p_state->bucket_credit_ms -= p_cfg->bucket_refill_ms;
+    if (p_state->bucket_credit_ms < 0)
+    {
+        p_state->bucket_credit_ms = 0;
+    }
+
+    const adv_post_sched_time_ms_t delay_ms = (p_state->flag_pending && (now_ms > p_state->pending_since_ms))
+                                                  ? (now_ms - p_state->pending_since_ms)
+                                                  : 0;
+    p_state->stat.cnt_started += 1;
+    p_state->stat.queueing_delay_ms_sum += (uint64_t)delay_ms;
+    if (delay_ms > p_state->stat.queueing_delay_ms_max)
+    {
+        p_state->stat.queueing_delay_ms_max = (uint32_t)delay_ms;
+    }
+    if (delay_ms > p_cfg->deadline_ms)
+    {
+        p_state->stat.cnt_deadline_missed += 1;
+    }
+    adv_post_sched_unlock();
+}
+
+void
+adv_post_sched_on_finished(
+    const adv_post_sched_target_e  target,
+    const bool                     flag_success,
+    const adv_post_sched_time_ms_t now_ms)
+{
+    if (target >= ADV_POST_SCHED_TARGET_LAST)
+    {
+        return;
+    }
+    adv_post_sched_lock();
+    adv_post_sched_target_state_t* const p_state = &g_adv_post_sched_targets[target];
+    if (flag_success)
+    {
+        p_state->stat.cnt_succeeded += 1;
+        p_state->stat.consecutive_failures = 0;
+        p_state->backoff_until_ms          = 0;
+    }
+    else
+    {
+        p_state->stat.cnt_failed += 1;
+        p_state->stat.consecutive_failures += 1;
+        if (p_state->stat.consecutive_failures >= ADV_POST_SCHED_BACKOFF_FAILURES_THRESHOLD)
+        {
+            const uint32_t shift = p_state->stat.consecutive_failures - ADV_POST_SCHED_BACKOFF_FAILURES_THRESHOLD;
+            uint32_t       backoff_ms = ADV_POST_SCHED_BACKOFF_MAX_MS;
+            if ((shift < 32U) && ((ADV_POST_SCHED_BACKOFF_MAX_MS >> shift) >= ADV_POST_SCHED_BACKOFF_MIN_MS))
+            {
+                backoff_ms = ADV_POST_SCHED_BACKOFF_MIN_MS << shift;
+            }
+            p_state->backoff_until_ms = now_ms + backoff_ms;
+        }
+    }
+    adv_post_sched_unlock();
+}
+
+void
+adv_post_sched_get_stat(const adv_post_sched_target_e target, adv_post_sched_stat_t* const p_stat)
+{
+    if (target >= ADV_POST_SCHED_TARGET_LAST)
+    {
+        memset(p_stat, 0, sizeof(*p_stat));
+        return;
+    }
+    adv_post_sched_lock();
+    *p_stat = g_adv_post_sched_targets[target].stat;
+    adv_post_sched_unlock();
+}
+
+const char*
+adv_post_sched_get_target_name(const adv_post_sched_target_e target)
+{
+    if (target >= ADV_POST_SCHED_TARGET_LAST)
+    {
+        return "unknown";
+    }
+    return g_adv_post_sched_target_names[target];
+}
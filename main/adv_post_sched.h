@@ -0,0 +1,146 @@
+/**
+ * @file adv_post_sched.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_ADV_POST_SCHED_H
+#define RUUVI_GATEWAY_ESP_ADV_POST_SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of consecutive failures after which the target is put into exponential backoff.
+ */
+#define ADV_POST_SCHED_BACKOFF_FAILURES_THRESHOLD (3U)
+#define ADV_POST_SCHED_BACKOFF_MIN_MS             (5U * 1000U)
+#define ADV_POST_SCHED_BACKOFF_MAX_MS             (5U * 60U * 1000U)
+
+typedef enum adv_post_sched_target_e
+{
+    ADV_POST_SCHED_TARGET_URGENT, //!< The advertisements which fired adv_trigger
+    ADV_POST_SCHED_TARGET_HTTP_RUUVI,
+    ADV_POST_SCHED_TARGET_HTTP_CUSTOM,
+    ADV_POST_SCHED_TARGET_HTTP_STAT,
+    ADV_POST_SCHED_TARGET_MQTT,
+    ADV_POST_SCHED_TARGET_LAST,
+    ADV_POST_SCHED_TARGET_NONE = ADV_POST_SCHED_TARGET_LAST,
+} adv_post_sched_target_e;
+
+/**
+ * @brief Monotonic time in milliseconds (esp_timer_get_time() / 1000).
+ */
+typedef int64_t adv_post_sched_time_ms_t;
+
+typedef struct adv_post_sched_target_cfg_t
+{
+    uint32_t weight;           //!< The waiting time of a pending target is multiplied by its weight
+    uint32_t deadline_ms;      //!< Max expected delay between becoming pending and starting the transfer
+    uint32_t max_age_ms;       //!< Pending target in backoff is dropped after this time
+    uint32_t bucket_capacity;  //!< Max number of transfers in a burst
+    uint32_t bucket_refill_ms; //!< Period of adding one token to the bucket
+} adv_post_sched_target_cfg_t;
+
+typedef struct adv_post_sched_stat_t
+{
+    uint32_t cnt_started;
+    uint32_t cnt_succeeded;
+    uint32_t cnt_failed;
+    uint32_t cnt_deadline_missed;
+    uint32_t cnt_rate_limited;    //!< Number of times the pending target became blocked by the token bucket
+    uint32_t cnt_skipped_backoff; //!< Number of times the pending target became blocked by the backoff
+    uint32_t cnt_aged_out;
+    uint32_t consecutive_failures;
+    uint64_t queueing_delay_ms_sum;
+    uint32_t queueing_delay_ms_max;
+} adv_post_sched_stat_t;
+
+void
+adv_post_sched_init(const adv_post_sched_time_ms_t now_ms);
+
+const adv_post_sched_target_cfg_t*
+adv_post_sched_get_target_cfg(const adv_post_sched_target_e target);
+
+/**
+ * @brief Update the pending state of the target, the queueing delay is measured from the moment when it became pending.
+ * @param target - the target.
+ * @param flag_pending - true if the target has data to send.
+ * @param now_ms - current time.
+ */
+void
+adv_post_sched_set_pending(
+    const adv_post_sched_target_e  target,
+    const bool                     flag_pending,
+    const adv_post_sched_time_ms_t now_ms);
+
+/**
+ * @brief Select the next target to serve.
+ * @note Targets without tokens in their bucket or in backoff are skipped,
+ *       among the remaining pending targets the one with the largest weighted waiting time is selected
+ *       (in case of equal values the target with the lower index wins, which keeps the original priority order).
+ * @param now_ms - current time.
+ * @return the selected target or @ref ADV_POST_SCHED_TARGET_NONE.
+ */
+adv_post_sched_target_e
+adv_post_sched_select(const adv_post_sched_time_ms_t now_ms);
+
+/**
+ * @brief Check if the pending target was in backoff for too long and should be dropped.
+ * @note The data is not lost, it stays in the retransmission list and will be sent with the next request.
+ * @param target - the target.
+ * @param now_ms - current time.
+ * @return true if the target was aged out (it's not pending anymore).
+ */
+bool
+adv_post_sched_check_aged_out(const adv_post_sched_target_e target, const adv_post_sched_time_ms_t now_ms);
+
+bool
+adv_post_sched_is_pending(const adv_post_sched_target_e target);
+
+/**
+ * @brief Check if the target is pending and can be started right now (it has a token and it's not in backoff).
+ * @note This is used to start the transfer for the target out of order, concurrently with the selected one.
+ * @param target - the target.
+ * @param now_ms - current time.
+ * @return true if the target can be started.
+ */
+bool
+adv_post_sched_is_ready(const adv_post_sched_target_e target, const adv_post_sched_time_ms_t now_ms);
+
+/**
+ * @brief Register the start of the transfer (consumes a token and updates the queueing delay statistics).
+ * @param target - the target.
+ * @param now_ms - current time.
+ */
+void
+adv_post_sched_on_started(const adv_post_sched_target_e target, const adv_post_sched_time_ms_t now_ms);
+
+/**
+ * @brief Register the result of the transfer (or failure to start it).
+ * @param target - the target.
+ * @param flag_success - true if the transfer was successful.
+ * @param now_ms - current time.
+ */
+void
+adv_post_sched_on_finished(
+    const adv_post_sched_target_e  target,
+    const bool                     flag_success,
+    const adv_post_sched_time_ms_t now_ms);
+
+void
+adv_post_sched_get_stat(const adv_post_sched_target_e target, adv_post_sched_stat_t* const p_stat);
+
+const char*
+adv_post_sched_get_target_name(const adv_post_sched_target_e target);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_ADV_POST_SCHED_H
@@ -14,6 +14,7 @@
 #include "gw_status.h"
 #include "ruuvi_gateway.h"
 #include "http.h"
+#include "http_mem_budget.h"
 #include "leds.h"
 #include "reset_task.h"
 #include "adv_post.h"
@@ -176,6 +177,17 @@ adv_post_handle_sig_send_statistics(adv_post_state_t* const p_adv_post_state)
     }
 }
 
+static void
+adv_post_handle_sig_urgent_advs(adv_post_state_t* const p_adv_post_state)
+{
+    LOG_DBG("Got ADV_POST_SIG_URGENT_ADVS");
+    if (p_adv_post_state->flag_relaying_enabled)
+    {
+        p_adv_post_state->flag_need_to_send_urgent = true;
+        os_signal_send(g_p_adv_post_sig, adv_post_conv_to_sig_num(ADV_POST_SIG_DO_ASYNC_COMM));
+    }
+}
+
 static void
 adv_post_handle_sig_relaying_mode_changed(adv_post_state_t* const p_adv_post_state)
 {
@@ -183,13 +195,14 @@ adv_post_handle_sig_relaying_mode_changed(adv_post_state_t* const p_adv_post_sta
     LOG_INFO(
         "ADV_POST_SIG_RELAYING_MODE_CHANGED: flag_relaying_enabled=%d",
         (printf_int_t)p_adv_post_state->flag_relaying_enabled);
-    if ((!p_adv_post_state->flag_relaying_enabled) && p_adv_post_state->flag_async_comm_in_progress)
+    if ((!p_adv_post_state->flag_relaying_enabled)
+        && (p_adv_post_state->flag_async_comm_in_progress || p_adv_post_state->flag_async_comm_in_progress_concurrent))
     {
         adv_post_timers_stop_timer_sig_do_async_comm();
         http_abort_any_req_during_processing();
-        p_adv_post_state->flag_async_comm_in_progress = false;
-        LOG_DBG("http_server_mutex_unlock");
-        http_server_mutex_unlock();
+        p_adv_post_state->flag_async_comm_in_progress            = false;
+        p_adv_post_state->flag_async_comm_in_progress_concurrent = false;
+        adv_post_async_comm_on_abort();
     }
     gw_status_clear_http_relaying_cmd();
 }
@@ -266,6 +279,20 @@ adv_post_on_gw_cfg_change_handle_scan_filter(
     return true;
 }
 
+static void
+adv_post_on_gw_cfg_change_init_adv_trigger(adv_post_cfg_cache_t* const p_cfg_cache, const gw_cfg_ruuvi_t* const p_cfg)
+{
+    // The triggered advs are pushed to the custom HTTP target or to MQTT in the periodic mode,
+    // in the instant mode of MQTT every adv is already sent immediately, so the rules are useless.
+    const bool flag_fast_path_available = p_cfg->http.use_http
+                                          || (p_cfg->mqtt.use_mqtt && (0 != p_cfg->mqtt.mqtt_sending_interval));
+
+    const ruuvi_gw_cfg_adv_trigger_t adv_trigger_disabled = { 0 };
+    adv_trigger_init(
+        &p_cfg_cache->adv_trigger,
+        flag_fast_path_available ? &p_cfg->adv_trigger : &adv_trigger_disabled);
+}
+
 static void
 adv_post_on_gw_cfg_change(adv_post_state_t* const p_adv_post_state)
 {
@@ -283,6 +310,9 @@ adv_post_on_gw_cfg_change(adv_post_state_t* const p_adv_post_state)
 
     const gw_cfg_t* p_gw_cfg = gw_cfg_lock_ro();
     const bool      res = adv_post_on_gw_cfg_change_handle_scan_filter(p_cfg_cache, &p_gw_cfg->ruuvi_cfg.scan_filter);
+    adv_filter_compile(&p_cfg_cache->adv_filter, &p_gw_cfg->ruuvi_cfg.adv_filter);
+    adv_aggr_init(&p_cfg_cache->adv_aggr, &p_gw_cfg->ruuvi_cfg.adv_aggr);
+    adv_post_on_gw_cfg_change_init_adv_trigger(p_cfg_cache, &p_gw_cfg->ruuvi_cfg);
     gw_cfg_unlock_ro(&p_gw_cfg);
     if (!res)
     {
@@ -359,14 +389,8 @@ adv_post_handle_sig_gw_cfg_ready(adv_post_state_t* const p_adv_post_state)
         adv_post_timers_postpone_sending_statistics();
     }
     adv_post_on_gw_cfg_change(p_adv_post_state);
-    if (gw_cfg_get_mqtt_use_mqtt_over_ssl_or_wss() && (gw_cfg_get_http_use_http_ruuvi() || gw_cfg_get_http_use_http()))
-    {
-        http_server_mutex_activate();
-    }
-    else
-    {
-        http_server_mutex_deactivate();
-    }
+    http_mem_budget_set_restricted_mode(
+        gw_cfg_get_mqtt_use_mqtt_over_ssl_or_wss() && (gw_cfg_get_http_use_http_ruuvi() || gw_cfg_get_http_use_http()));
 }
 
 static void
@@ -375,14 +399,8 @@ adv_post_handle_sig_gw_cfg_changed_ruuvi(adv_post_state_t* const p_adv_post_stat
     LOG_INFO("Got ADV_POST_SIG_GW_CFG_CHANGED_RUUVI");
     ruuvi_send_nrf_settings_from_gw_cfg();
     adv_post_on_gw_cfg_change(p_adv_post_state);
-    if (gw_cfg_get_mqtt_use_mqtt_over_ssl_or_wss() && (gw_cfg_get_http_use_http_ruuvi() || gw_cfg_get_http_use_http()))
-    {
-        http_server_mutex_activate();
-    }
-    else
-    {
-        http_server_mutex_deactivate();
-    }
+    http_mem_budget_set_restricted_mode(
+        gw_cfg_get_mqtt_use_mqtt_over_ssl_or_wss() && (gw_cfg_get_http_use_http_ruuvi() || gw_cfg_get_http_use_http()));
 }
 
 static void
@@ -472,6 +490,7 @@ adv_post_handle_sig(const adv_post_sig_e adv_post_sig, adv_post_state_t* const p
         [ADV_POST_SIG_GREEN_LED_STATE_CHANGED] = &adv_post_handle_sig_green_led_state_changed,
         [ADV_POST_SIG_GREEN_LED_UPDATE]        = &adv_post_handle_sig_green_led_update,
         [ADV_POST_SIG_RECV_ADV_TIMEOUT]        = &adv_post_handle_sig_recv_adv_timeout,
+        [ADV_POST_SIG_URGENT_ADVS]             = &adv_post_handle_sig_urgent_advs,
     };
 
     assert(adv_post_sig < OS_ARRAY_SIZE(g_adv_post_sig_handlers));
@@ -7,6 +7,7 @@
 
 #include "adv_post_statistics.h"
 #include "os_malloc.h"
+#include "adv_report_pool.h"
 #include "gw_cfg.h"
 #include "runtime_stat.h"
 #include "adv_table.h"
@@ -70,7 +71,7 @@ adv_post_stat(const ruuvi_gw_cfg_http_stat_t* const p_cfg_http_stat, void* const
 {
     log_runtime_statistics();
 
-    adv_report_table_t* p_reports = os_malloc(sizeof(*p_reports));
+    adv_report_table_t* p_reports = adv_report_pool_checkout();
     if (NULL == p_reports)
     {
         LOG_ERR("Can't allocate memory for statistics");
@@ -82,7 +83,7 @@ adv_post_stat(const ruuvi_gw_cfg_http_stat_t* const p_cfg_http_stat, void* const
     if (NULL == reset_info.buf)
     {
         LOG_ERR("Can't allocate memory");
-        os_free(p_reports);
+        adv_report_pool_return(p_reports);
         return false;
     }
     const http_json_statistics_info_t* p_stat_info = adv_post_statistics_info_generate(&reset_info);
@@ -90,7 +91,7 @@ adv_post_stat(const ruuvi_gw_cfg_http_stat_t* const p_cfg_http_stat, void* const
     {
         LOG_ERR("Can't allocate memory");
         str_buf_free_buf(&reset_info);
-        os_free(p_reports);
+        adv_report_pool_return(p_reports);
         return false;
     }
 
@@ -103,7 +104,7 @@ adv_post_stat(const ruuvi_gw_cfg_http_stat_t* const p_cfg_http_stat, void* const
         p_cfg_http_stat->http_stat_use_ssl_server_cert);
     os_free(p_stat_info);
     str_buf_free_buf(&reset_info);
-    os_free(p_reports);
+    adv_report_pool_return(p_reports);
 
     return res;
 }
@@ -0,0 +1,126 @@
+/**
+ * @file adv_report_pool.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_report_pool.h"
+#include <assert.h>
+#include <string.h>
+#include "os_mutex.h"
+#include "heap_prof.h"
+
+_Static_assert(ADV_REPORT_POOL_SIZE <= 32, "ADV_REPORT_POOL_SIZE");
+
+static adv_report_table_t     g_adv_report_pool_bufs[ADV_REPORT_POOL_SIZE];
+_Static_assert(sizeof(g_adv_report_pool_bufs) <= ADV_REPORT_POOL_MAX_TOTAL_SIZE, "ADV_REPORT_POOL_MAX_TOTAL_SIZE");
+static uint32_t               g_adv_report_pool_in_use_mask;
+static adv_report_pool_stat_t g_adv_report_pool_stat;
+static os_mutex_t             g_p_adv_report_pool_mutex;
+static os_mutex_static_t      g_adv_report_pool_mutex_mem;
+
+static void
+adv_report_pool_lock(void)
+{
+    if (NULL == g_p_adv_report_pool_mutex)
+    {
+        g_p_adv_report_pool_mutex = os_mutex_create_static(&g_adv_report_pool_mutex_mem);
+    }
+    os_mutex_lock(g_p_adv_report_pool_mutex);
+}
+
+static void
+adv_report_pool_unlock(void)
+{
+    os_mutex_unlock(g_p_adv_report_pool_mutex);
+}
+
+void
+adv_report_pool_init(void)
+{
+    adv_report_pool_lock();
+    g_adv_report_pool_in_use_mask = 0;
+    memset(&g_adv_report_pool_stat, 0, sizeof(g_adv_report_pool_stat));
+    adv_report_pool_unlock();
+}
+
+static adv_report_table_t*
+adv_report_pool_take_free_buf(void)
+{
+    for (uint32_t i = 0; i < ADV_REPORT_POOL_SIZE; ++i)
+    {
+        if (0 == (g_adv_report_pool_in_use_mask & (1U << i)))
+        {
+            g_adv_report_pool_in_use_mask |= 1U << i;
+            return &g_adv_report_pool_bufs[i];
+        }
+    }
+    return NULL;
+}
+
+adv_report_table_t*
+adv_report_pool_checkout(void)
+{
+    adv_report_pool_lock();
+    adv_report_table_t* p_reports = adv_report_pool_take_free_buf();
+    g_adv_report_pool_stat.cnt_checkout += 1;
+    if (NULL == p_reports)
+    {
+        g_adv_report_pool_stat.cnt_exhausted += 1;
+    }
+    else
+    {
+        g_adv_report_pool_stat.num_in_use += 1;
+        if (g_adv_report_pool_stat.num_in_use > g_adv_report_pool_stat.max_in_use)
+        {
+            g_adv_report_pool_stat.max_in_use = g_adv_report_pool_stat.num_in_use;
+        }
+    }
+    adv_report_pool_unlock();
+
+    if (NULL == p_reports)
+    {
+        p_reports = HEAP_PROF_MALLOC(HEAP_PROF_TAG_ADV_TABLE, sizeof(*p_reports));
+        if (NULL == p_reports)
+        {
+            return NULL;
+        }
+    }
+    p_reports->num_of_advs = 0;
+    return p_reports;
+}
+
+void
+adv_report_pool_return(adv_report_table_t* const p_reports)
+{
+    if (NULL == p_reports)
+    {
+        return;
+    }
+    const uintptr_t addr     = (uintptr_t)p_reports;
+    const uintptr_t addr_beg = (uintptr_t)&g_adv_report_pool_bufs[0];
+    const uintptr_t addr_end = (uintptr_t)&g_adv_report_pool_bufs[ADV_REPORT_POOL_SIZE];
+    if ((addr < addr_beg) || (addr >= addr_end))
+    {
+        // The buffer was allocated from the heap because the pool was exhausted
+        adv_report_table_t* p_reports_from_heap = p_reports;
+        HEAP_PROF_FREE(p_reports_from_heap);
+        return;
+    }
+    const uint32_t idx = (uint32_t)((addr - addr_beg) / sizeof(adv_report_table_t));
+
+    adv_report_pool_lock();
+    assert(0 != (g_adv_report_pool_in_use_mask & (1U << idx)));
+    g_adv_report_pool_in_use_mask &= ~(1U << idx);
+    g_adv_report_pool_stat.num_in_use -= 1;
+    adv_report_pool_unlock();
+}
+
+void
+adv_report_pool_get_stat(adv_report_pool_stat_t* const p_stat)
+{
+    adv_report_pool_lock();
+    *p_stat = g_adv_report_pool_stat;
+    adv_report_pool_unlock();
+}
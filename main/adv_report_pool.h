@@ -0,0 +1,66 @@
+/**
+ * @file adv_report_pool.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_ADV_REPORT_POOL_H
+#define RUUVI_GATEWAY_ESP_ADV_REPORT_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adv_table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of statically reserved adv_report_table_t buffers:
+ *        one for the main async slot (Ruuvi/statistics/MQTT) and one for the custom HTTP slot (custom/urgent advs),
+ *        they hold the buffer until the request is completed.
+ * @note The HTTP server (/history, /live, /info.json) keeps the buffer only while the response generator is created,
+ *       if the pool is empty, it's allocated from the heap, which is already counted in its memory budget.
+ */
+#define ADV_REPORT_POOL_SIZE (2U)
+
+/**
+ * @brief Limit of DRAM statically reserved for the pool.
+ */
+#define ADV_REPORT_POOL_MAX_TOTAL_SIZE (28U * 1024U)
+
+typedef struct adv_report_pool_stat_t
+{
+    uint32_t cnt_checkout;
+    uint32_t cnt_exhausted; //!< Number of times the pool was empty and the buffer was allocated from the heap
+    uint32_t num_in_use;
+    uint32_t max_in_use;
+} adv_report_pool_stat_t;
+
+void
+adv_report_pool_init(void);
+
+/**
+ * @brief Take a buffer from the pool.
+ * @note If all the buffers are in use, the buffer is allocated from the heap (it's counted as the pool exhaustion).
+ * @return pointer to the buffer (with num_of_advs set to 0) or NULL if the pool is exhausted and the heap is full.
+ */
+adv_report_table_t*
+adv_report_pool_checkout(void);
+
+/**
+ * @brief Return the buffer taken by adv_report_pool_checkout.
+ * @param p_reports - pointer to the buffer, NULL is ignored.
+ */
+void
+adv_report_pool_return(adv_report_table_t* const p_reports);
+
+void
+adv_report_pool_get_stat(adv_report_pool_stat_t* const p_stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_ADV_REPORT_POOL_H
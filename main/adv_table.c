@@ -9,12 +9,14 @@
 #include <string.h>
 #include <limits.h>
 #include "os_mutex.h"
+#include "fmt_fast.h"
 #include "sys/queue.h"
 
+// Raw adv (timestamp..data_buf) + tag_mac_str (with padding) + aggr
 #if defined(__XTENSA__)
-#define ADV_REPORT_EXPECTED_SIZE (20U + 48U)
+#define ADV_REPORT_EXPECTED_SIZE (20U + 48U + 20U + 40U)
 #elif defined(__linux__) && defined(__x86_64__)
-#define ADV_REPORT_EXPECTED_SIZE (24U + 48U)
+#define ADV_REPORT_EXPECTED_SIZE (24U + 48U + 20U + 40U + 4U)
 #endif
 
 _Static_assert(sizeof(adv_report_t) == ADV_REPORT_EXPECTED_SIZE, "sizeof(adv_report_t)");
@@ -23,33 +25,49 @@ _Static_assert(sizeof(adv_report_t) == ADV_REPORT_EXPECTED_SIZE, "sizeof(adv_rep
 
 #define BLE_MAX_REGULAR_ADV_DATA_LEN (31U)
 
+#define ADV_TABLE_TARGET_MASK_ALL ((1U << (uint32_t)ADV_TABLE_TARGET_NUM) - 1U)
+
+_Static_assert(ADV_TABLE_TARGET_NUM <= 32, "adv_reports_list_elem_t.dirty_mask");
+
+/**
+ * @brief The generation is incremented on every update of the table, it's 64-bit to never wrap around
+ *        even if some target is not read for a very long time.
+ */
+typedef uint64_t adv_table_gen_t;
+
 typedef struct adv_reports_list_elem_t adv_reports_list_elem_t;
 
 typedef STAILQ_HEAD(adv_report_list_t, adv_reports_list_elem_t) adv_report_list_t;
 typedef TAILQ_HEAD(adv_report_hist_list_t, adv_reports_list_elem_t) adv_report_hist_list_t;
+typedef TAILQ_HEAD(adv_report_dirty_list_t, adv_reports_list_elem_t) adv_report_dirty_list_t;
 
 struct adv_reports_list_elem_t
 {
     STAILQ_ENTRY(adv_reports_list_elem_t) hash_table_list;
-    STAILQ_ENTRY(adv_reports_list_elem_t) retransmission_list1;
-    STAILQ_ENTRY(adv_reports_list_elem_t) retransmission_list2;
-    STAILQ_ENTRY(adv_reports_list_elem_t) retransmission_list3;
     TAILQ_ENTRY(adv_reports_list_elem_t) hist_list;
-    bool         is_in_hash_table;
-    bool         is_in_retransmission_list1;
-    bool         is_in_retransmission_list2;
-    bool         is_in_retransmission_list3;
-    adv_report_t adv_report;
+    TAILQ_ENTRY(adv_reports_list_elem_t) dirty_list;
+    bool               is_in_hash_table;
+    uint32_t           dirty_mask; //!< Bit per adv_table_target_e, the elem is in dirty_list if it's not zero
+    adv_table_gen_t    gen;        //!< The generation when the elem was added to the tail of dirty_list
+    adv_table_ticket_t in_flight_tickets[ADV_TABLE_TARGET_NUM]; //!< The batches which are not committed yet
+    adv_report_t       adv_report;
 };
 
+typedef struct adv_table_target_t
+{
+    adv_table_gen_t    read_gen;       //!< All the dirty advs of the target have a greater generation
+    adv_table_ticket_t pending_ticket; //!< The last batch which was neither committed nor rolled back
+} adv_table_target_t;
+
 static os_mutex_t              gp_adv_reports_mutex;
 static os_mutex_static_t       g_adv_reports_mutex_mem;
 static adv_reports_list_elem_t g_arr_of_adv_reports[MAX_ADVS_TABLE];
 static adv_report_list_t       g_adv_hash_table[ADV_TABLE_HASH_SIZE];
-static adv_report_list_t       g_adv_reports_retransmission_list1;
-static adv_report_list_t       g_adv_reports_retransmission_list2;
-static adv_report_list_t       g_adv_reports_retransmission_list3;
 static adv_report_hist_list_t  g_adv_reports_hist_list;
+static adv_report_dirty_list_t g_adv_reports_dirty_list;
+static adv_table_gen_t         g_adv_table_gen;
+static adv_table_target_t      g_adv_table_targets[ADV_TABLE_TARGET_NUM];
+static adv_table_ticket_t      g_adv_table_last_ticket;
 
 void
 adv_table_init(void)
@@ -60,20 +78,20 @@ adv_table_init(void)
     {
         STAILQ_INIT(&g_adv_hash_table[i]);
     }
-    STAILQ_INIT(&g_adv_reports_retransmission_list1);
-    STAILQ_INIT(&g_adv_reports_retransmission_list2);
-    STAILQ_INIT(&g_adv_reports_retransmission_list3);
     TAILQ_INIT(&g_adv_reports_hist_list);
+    TAILQ_INIT(&g_adv_reports_dirty_list);
+    g_adv_table_gen         = 0;
+    g_adv_table_last_ticket = ADV_TABLE_TICKET_NONE;
+    memset(g_adv_table_targets, 0, sizeof(g_adv_table_targets));
     for (uint32_t i = 0; i < (sizeof(g_arr_of_adv_reports) / sizeof(g_arr_of_adv_reports[0])); ++i)
     {
         adv_reports_list_elem_t* p_elem = &g_arr_of_adv_reports[i];
         memset(p_elem, 0, sizeof(*p_elem));
-        p_elem->is_in_hash_table           = false;
-        p_elem->is_in_retransmission_list1 = false;
-        p_elem->is_in_retransmission_list2 = false;
-        p_elem->is_in_retransmission_list3 = false;
-        p_elem->adv_report.timestamp       = 0;
-        p_elem->adv_report.data_len        = 0; // mark adv_report as free in hist_list
+        p_elem->is_in_hash_table     = false;
+        p_elem->dirty_mask           = 0;
+        p_elem->gen                  = 0;
+        p_elem->adv_report.timestamp = 0;
+        p_elem->adv_report.data_len  = 0; // mark adv_report as free in hist_list
         TAILQ_INSERT_TAIL(&g_adv_reports_hist_list, p_elem, hist_list);
     }
 }
@@ -172,6 +190,39 @@ adv_table_check_if_adv_must_be_discarded(const adv_report_t* const p_adv, const
     return false;
 }
 
+/**
+ * @brief Mark the elem as not yet read by all the targets, it's O(1) regardless of the number of targets.
+ * @note The elem which is still unread by all the targets keeps its place in dirty_list (like in a FIFO),
+ *       otherwise it's moved to the tail with the new generation. So, dirty_list is sorted by the generation
+ *       and every target reads only the tail of the list which was added after its last read.
+ */
+static void
+adv_table_mark_dirty_unsafe(adv_reports_list_elem_t* const p_elem)
+{
+    if (ADV_TABLE_TARGET_MASK_ALL == p_elem->dirty_mask)
+    {
+        return;
+    }
+    if (0 != p_elem->dirty_mask)
+    {
+        TAILQ_REMOVE(&g_adv_reports_dirty_list, p_elem, dirty_list);
+    }
+    g_adv_table_gen += 1;
+    p_elem->gen        = g_adv_table_gen;
+    p_elem->dirty_mask = ADV_TABLE_TARGET_MASK_ALL;
+    TAILQ_INSERT_TAIL(&g_adv_reports_dirty_list, p_elem, dirty_list);
+}
+
+static void
+adv_table_clear_dirty_unsafe(adv_reports_list_elem_t* const p_elem, const uint32_t mask)
+{
+    p_elem->dirty_mask &= ~mask;
+    if (0 == p_elem->dirty_mask)
+    {
+        TAILQ_REMOVE(&g_adv_reports_dirty_list, p_elem, dirty_list);
+    }
+}
+
 static bool
 adv_table_put_unsafe(const adv_report_t* const p_adv)
 {
@@ -186,6 +237,12 @@ adv_table_put_unsafe(const adv_report_t* const p_adv)
         adv_hash_table_remove(p_elem);
 
         p_elem->adv_report = *p_adv;
+        p_elem->adv_report.tag_mac_str = fmt_fast_mac_to_str(&p_elem->adv_report.tag_mac);
+        // The element is reused for another tag, so the not committed batches of the previous tag must not return it
+        for (uint32_t i = 0; i < ADV_TABLE_TARGET_NUM; ++i)
+        {
+            p_elem->in_flight_tickets[i] = ADV_TABLE_TICKET_NONE;
+        }
         adv_hash_table_add(p_elem);
         flag_updated = true;
     }
@@ -193,10 +250,12 @@ adv_table_put_unsafe(const adv_report_t* const p_adv)
     {
         if (!adv_table_check_if_adv_must_be_discarded(p_adv, &p_elem->adv_report))
         {
-            const adv_counter_t prev_counter   = p_elem->adv_report.samples_counter;
-            p_elem->adv_report                 = *p_adv; // Update data
-            p_elem->adv_report.samples_counter = prev_counter + 1;
-            flag_updated                       = true;
+            const adv_counter_t     prev_counter = p_elem->adv_report.samples_counter;
+            const mac_address_str_t tag_mac_str  = p_elem->adv_report.tag_mac_str;
+            p_elem->adv_report                   = *p_adv; // Update data
+            p_elem->adv_report.samples_counter   = prev_counter + 1;
+            p_elem->adv_report.tag_mac_str       = tag_mac_str;
+            flag_updated = true;
         }
         else
         {
@@ -205,21 +264,7 @@ adv_table_put_unsafe(const adv_report_t* const p_adv)
     }
     if (flag_updated)
     {
-        if (!p_elem->is_in_retransmission_list1)
-        {
-            STAILQ_INSERT_TAIL(&g_adv_reports_retransmission_list1, p_elem, retransmission_list1);
-            p_elem->is_in_retransmission_list1 = true;
-        }
-        if (!p_elem->is_in_retransmission_list2)
-        {
-            STAILQ_INSERT_TAIL(&g_adv_reports_retransmission_list2, p_elem, retransmission_list2);
-            p_elem->is_in_retransmission_list2 = true;
-        }
-        if (!p_elem->is_in_retransmission_list3)
-        {
-            STAILQ_INSERT_TAIL(&g_adv_reports_retransmission_list3, p_elem, retransmission_list3);
-            p_elem->is_in_retransmission_list3 = true;
-        }
+        adv_table_mark_dirty_unsafe(p_elem);
         TAILQ_REMOVE(&g_adv_reports_hist_list, p_elem, hist_list);
         TAILQ_INSERT_HEAD(&g_adv_reports_hist_list, p_elem, hist_list);
     }
@@ -235,126 +280,312 @@ adv_table_put(const adv_report_t* const p_adv)
     return flag_updated;
 }
 
-static void
-adv_table_read_retransmission_list1_and_clear_unsafe(adv_report_table_t* const p_reports)
+static uint32_t
+adv_table_target_mask(const adv_table_target_e target)
 {
-    p_reports->num_of_advs = 0;
-    for (;;)
+    return 1U << (uint32_t)target;
+}
+
+/**
+ * @brief Find the first elem of dirty_list which was added after the last read of the target.
+ */
+static adv_reports_list_elem_t*
+adv_table_find_first_unread_unsafe(const adv_table_target_e target)
+{
+    const adv_table_gen_t    read_gen = g_adv_table_targets[target].read_gen;
+    adv_reports_list_elem_t* p_first  = NULL;
+    adv_reports_list_elem_t* p_elem   = NULL;
+    TAILQ_FOREACH_REVERSE(p_elem, &g_adv_reports_dirty_list, adv_report_dirty_list_t, dirty_list)
     {
-        adv_reports_list_elem_t* p_elem = STAILQ_FIRST(&g_adv_reports_retransmission_list1);
-        if (NULL == p_elem)
+        if (p_elem->gen <= read_gen)
         {
             break;
         }
-        STAILQ_REMOVE_HEAD(&g_adv_reports_retransmission_list1, retransmission_list1);
-        p_elem->is_in_retransmission_list1 = false;
-        if (p_reports->num_of_advs >= (sizeof(p_reports->table) / sizeof(p_reports->table[0])))
+        p_first = p_elem;
+    }
+    return p_first;
+}
+
+static uint32_t
+adv_table_read_dirty_unsafe(
+    const adv_table_target_e target,
+    adv_report_t* const      p_advs,
+    const uint32_t           max_num_advs,
+    const adv_table_ticket_t ticket)
+{
+    adv_table_target_t* const p_target = &g_adv_table_targets[target];
+    const uint32_t            mask     = adv_table_target_mask(target);
+    uint32_t                  num_advs = 0;
+
+    adv_reports_list_elem_t* p_elem = adv_table_find_first_unread_unsafe(target);
+    while (NULL != p_elem)
+    {
+        adv_reports_list_elem_t* const p_next = TAILQ_NEXT(p_elem, dirty_list);
+        if (0 != (p_elem->dirty_mask & mask))
         {
-            break;
+            if (num_advs >= max_num_advs)
+            {
+                break;
+            }
+            p_elem->in_flight_tickets[target] = ticket;
+            p_advs[num_advs]                  = p_elem->adv_report;
+            num_advs += 1;
+            adv_table_clear_dirty_unsafe(p_elem, mask);
         }
-        p_reports->table[p_reports->num_of_advs] = p_elem->adv_report;
-        p_reports->num_of_advs += 1;
+        p_target->read_gen = p_elem->gen;
+        p_elem             = p_next;
     }
+    return num_advs;
 }
 
 static void
-adv_table_read_retransmission_list2_and_clear_unsafe(adv_report_table_t* const p_reports)
+adv_table_read_dirty_and_clear_unsafe(
+    const adv_table_target_e  target,
+    adv_report_table_t* const p_reports,
+    const adv_table_ticket_t  ticket)
 {
-    p_reports->num_of_advs = 0;
-    for (;;)
+    p_reports->num_of_advs = adv_table_read_dirty_unsafe(
+        target,
+        p_reports->table,
+        sizeof(p_reports->table) / sizeof(p_reports->table[0]),
+        ticket);
+}
+
+/**
+ * @brief Return the elem of the rolled back batch to the target, it keeps its generation,
+ *        so the target reads the advs in the same order as before.
+ */
+static void
+adv_table_restore_dirty_unsafe(adv_reports_list_elem_t* const p_elem, const adv_table_target_e target)
+{
+    if (0 == p_elem->dirty_mask)
     {
-        adv_reports_list_elem_t* p_elem = STAILQ_FIRST(&g_adv_reports_retransmission_list2);
-        if (NULL == p_elem)
+        adv_reports_list_elem_t* p_prev = NULL;
+        TAILQ_FOREACH_REVERSE(p_prev, &g_adv_reports_dirty_list, adv_report_dirty_list_t, dirty_list)
         {
-            break;
+            if (p_prev->gen < p_elem->gen)
+            {
+                break;
+            }
         }
-        STAILQ_REMOVE_HEAD(&g_adv_reports_retransmission_list2, retransmission_list2);
-        p_elem->is_in_retransmission_list2 = false;
-        if (p_reports->num_of_advs >= (sizeof(p_reports->table) / sizeof(p_reports->table[0])))
+        if (NULL != p_prev)
         {
-            break;
+            TAILQ_INSERT_AFTER(&g_adv_reports_dirty_list, p_prev, p_elem, dirty_list);
         }
-        p_reports->table[p_reports->num_of_advs] = p_elem->adv_report;
-        p_reports->num_of_advs += 1;
+        else
+        {
+            TAILQ_INSERT_HEAD(&g_adv_reports_dirty_list, p_elem, dirty_list);
+        }
+    }
+    p_elem->dirty_mask |= adv_table_target_mask(target);
+    if (p_elem->gen <= g_adv_table_targets[target].read_gen)
+    {
+        g_adv_table_targets[target].read_gen = p_elem->gen - 1;
     }
 }
 
+static adv_table_ticket_t
+adv_table_ticket_gen_unsafe(void)
+{
+    g_adv_table_last_ticket += 1;
+    if (ADV_TABLE_TICKET_NONE == g_adv_table_last_ticket)
+    {
+        g_adv_table_last_ticket += 1;
+    }
+    return g_adv_table_last_ticket;
+}
+
 static void
-adv_table_read_retransmission_list3_and_clear_unsafe(adv_report_table_t* const p_reports)
+adv_table_finish_unsafe(const adv_table_ticket_t ticket, const bool flag_commit)
 {
-    p_reports->num_of_advs = 0;
-    for (;;)
+    if (ADV_TABLE_TICKET_NONE == ticket)
     {
-        adv_reports_list_elem_t* p_elem = STAILQ_FIRST(&g_adv_reports_retransmission_list3);
-        if (NULL == p_elem)
+        return;
+    }
+    adv_reports_list_elem_t* p_elem = NULL;
+    TAILQ_FOREACH(p_elem, &g_adv_reports_hist_list, hist_list)
+    {
+        for (uint32_t i = 0; i < ADV_TABLE_TARGET_NUM; ++i)
         {
-            break;
+            if (ticket != p_elem->in_flight_tickets[i])
+            {
+                continue;
+            }
+            p_elem->in_flight_tickets[i] = ADV_TABLE_TICKET_NONE;
+            const uint32_t mask          = adv_table_target_mask((adv_table_target_e)i);
+            // If the tag was updated in the meantime, it's already dirty with the newer data
+            if ((!flag_commit) && (0 == (p_elem->dirty_mask & mask)))
+            {
+                adv_table_restore_dirty_unsafe(p_elem, (adv_table_target_e)i);
+            }
         }
-        STAILQ_REMOVE_HEAD(&g_adv_reports_retransmission_list3, retransmission_list3);
-        p_elem->is_in_retransmission_list3 = false;
-        if (p_reports->num_of_advs >= (sizeof(p_reports->table) / sizeof(p_reports->table[0])))
+    }
+    for (uint32_t i = 0; i < ADV_TABLE_TARGET_NUM; ++i)
+    {
+        if (ticket == g_adv_table_targets[i].pending_ticket)
+        {
+            g_adv_table_targets[i].pending_ticket = ADV_TABLE_TICKET_NONE;
+        }
+    }
+}
+
+static bool
+adv_table_is_dirty_unsafe(const adv_table_target_e target)
+{
+    const adv_table_gen_t    read_gen = g_adv_table_targets[target].read_gen;
+    const uint32_t           mask     = adv_table_target_mask(target);
+    adv_reports_list_elem_t* p_elem   = NULL;
+    TAILQ_FOREACH_REVERSE(p_elem, &g_adv_reports_dirty_list, adv_report_dirty_list_t, dirty_list)
+    {
+        if (p_elem->gen <= read_gen)
         {
             break;
         }
-        p_reports->table[p_reports->num_of_advs] = p_elem->adv_report;
-        p_reports->num_of_advs += 1;
+        if (0 != (p_elem->dirty_mask & mask))
+        {
+            return true;
+        }
     }
+    return false;
 }
 
 void
-adv_table_read_retransmission_list1_and_clear(adv_report_table_t* const p_reports)
+adv_table_read_dirty_and_clear(const adv_table_target_e target, adv_report_table_t* const p_reports)
 {
     os_mutex_lock(gp_adv_reports_mutex);
-    adv_table_read_retransmission_list1_and_clear_unsafe(p_reports);
+    adv_table_read_dirty_and_clear_unsafe(target, p_reports, ADV_TABLE_TICKET_NONE);
     os_mutex_unlock(gp_adv_reports_mutex);
 }
 
-void
-adv_table_read_retransmission_list2_and_clear(adv_report_table_t* const p_reports)
+adv_table_ticket_t
+adv_table_read_dirty_begin(const adv_table_target_e target, adv_report_table_t* const p_reports)
 {
     os_mutex_lock(gp_adv_reports_mutex);
-    adv_table_read_retransmission_list2_and_clear_unsafe(p_reports);
+    adv_table_target_t* const p_target = &g_adv_table_targets[target];
+    // The previous batch was abandoned without the result (e.g. the request was aborted), so roll it back
+    adv_table_finish_unsafe(p_target->pending_ticket, false);
+    const adv_table_ticket_t ticket = adv_table_ticket_gen_unsafe();
+    p_target->pending_ticket        = ticket;
+    adv_table_read_dirty_and_clear_unsafe(target, p_reports, ticket);
     os_mutex_unlock(gp_adv_reports_mutex);
+    return ticket;
 }
 
-void
-adv_table_read_retransmission_list3_and_clear(adv_report_table_t* const p_reports)
+uint32_t
+adv_table_read_dirty_batch(const adv_table_target_e target, adv_report_t* const p_advs, const uint32_t max_num_advs)
 {
     os_mutex_lock(gp_adv_reports_mutex);
-    adv_table_read_retransmission_list3_and_clear_unsafe(p_reports);
+    const uint32_t num_advs = adv_table_read_dirty_unsafe(target, p_advs, max_num_advs, ADV_TABLE_TICKET_NONE);
     os_mutex_unlock(gp_adv_reports_mutex);
+    return num_advs;
 }
 
-static bool
-adv_table_read_retransmission_list3_head_unsafe(adv_report_t* const p_adv_report)
+bool
+adv_table_is_dirty(const adv_table_target_e target)
 {
-    adv_reports_list_elem_t* p_elem = STAILQ_FIRST(&g_adv_reports_retransmission_list3);
-    if (NULL == p_elem)
+    os_mutex_lock(gp_adv_reports_mutex);
+    const bool is_dirty = adv_table_is_dirty_unsafe(target);
+    os_mutex_unlock(gp_adv_reports_mutex);
+    return is_dirty;
+}
+
+void
+adv_table_target_reset(const adv_table_target_e target)
+{
+    os_mutex_lock(gp_adv_reports_mutex);
+    const uint32_t           mask   = adv_table_target_mask(target);
+    adv_reports_list_elem_t* p_elem = TAILQ_FIRST(&g_adv_reports_dirty_list);
+    while (NULL != p_elem)
     {
-        return false;
+        adv_reports_list_elem_t* const p_next = TAILQ_NEXT(p_elem, dirty_list);
+        // The dirty bits left by the previous consumer must be cleared, otherwise such an elem keeps its old generation
+        // on the next update (if it's unread by all the targets) and it's skipped by the new consumer.
+        if (0 != (p_elem->dirty_mask & mask))
+        {
+            adv_table_clear_dirty_unsafe(p_elem, mask);
+        }
+        p_elem = p_next;
     }
-    STAILQ_REMOVE_HEAD(&g_adv_reports_retransmission_list3, retransmission_list3);
-    p_elem->is_in_retransmission_list3 = false;
-    *p_adv_report                      = p_elem->adv_report;
-    return true;
+    g_adv_table_targets[target].read_gen       = g_adv_table_gen;
+    g_adv_table_targets[target].pending_ticket = ADV_TABLE_TICKET_NONE;
+    os_mutex_unlock(gp_adv_reports_mutex);
 }
 
-bool
-adv_table_read_retransmission_list3_head(adv_report_t* const p_adv_report)
+void
+adv_table_retransmission_commit(const adv_table_ticket_t ticket)
 {
     os_mutex_lock(gp_adv_reports_mutex);
-    const bool res = adv_table_read_retransmission_list3_head_unsafe(p_adv_report);
+    adv_table_finish_unsafe(ticket, true);
     os_mutex_unlock(gp_adv_reports_mutex);
-    return res;
+}
+
+void
+adv_table_retransmission_rollback(const adv_table_ticket_t ticket)
+{
+    os_mutex_lock(gp_adv_reports_mutex);
+    adv_table_finish_unsafe(ticket, false);
+    os_mutex_unlock(gp_adv_reports_mutex);
+}
+
+void
+adv_table_read_retransmission_list1_and_clear(adv_report_table_t* const p_reports)
+{
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_RUUVI, p_reports);
+}
+
+void
+adv_table_read_retransmission_list2_and_clear(adv_report_table_t* const p_reports)
+{
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_CUSTOM, p_reports);
+}
+
+void
+adv_table_read_retransmission_list3_and_clear(adv_report_table_t* const p_reports)
+{
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_MQTT, p_reports);
+}
+
+adv_table_ticket_t
+adv_table_read_retransmission_list1_begin(adv_report_table_t* const p_reports)
+{
+    return adv_table_read_dirty_begin(ADV_TABLE_TARGET_HTTP_RUUVI, p_reports);
+}
+
+adv_table_ticket_t
+adv_table_read_retransmission_list2_begin(adv_report_table_t* const p_reports)
+{
+    return adv_table_read_dirty_begin(ADV_TABLE_TARGET_HTTP_CUSTOM, p_reports);
+}
+
+bool
+adv_table_read_retransmission_list3_head(adv_report_t* const p_adv_report)
+{
+    return (0 != adv_table_read_dirty_batch(ADV_TABLE_TARGET_MQTT, p_adv_report, 1)) ? true : false;
+}
+
+uint32_t
+adv_table_read_retransmission_list3_head_batch(adv_report_t* const p_advs, const uint32_t max_num_advs)
+{
+    return adv_table_read_dirty_batch(ADV_TABLE_TARGET_MQTT, p_advs, max_num_advs);
 }
 
 bool
 adv_table_read_retransmission_list3_is_empty(void)
+{
+    return !adv_table_is_dirty(ADV_TABLE_TARGET_MQTT);
+}
+
+bool
+adv_table_read_by_mac(const mac_address_bin_t* const p_mac, adv_report_t* const p_adv_report)
 {
     os_mutex_lock(gp_adv_reports_mutex);
-    const bool is_empty = (NULL == STAILQ_FIRST(&g_adv_reports_retransmission_list3)) ? true : false;
+    const adv_reports_list_elem_t* const p_elem = adv_hash_table_search(p_mac);
+    if (NULL != p_elem)
+    {
+        *p_adv_report = p_elem->adv_report;
+    }
     os_mutex_unlock(gp_adv_reports_mutex);
-    return is_empty;
+    return NULL != p_elem;
 }
 
 static void
@@ -441,62 +672,19 @@ adv_table_statistics_read(adv_report_table_t* const p_reports)
     os_mutex_unlock(gp_adv_reports_mutex);
 }
 
-static void
-adv_retransmission_list1_clear_unsafe(void)
-{
-    while (1)
-    {
-        adv_reports_list_elem_t* p_elem = STAILQ_FIRST(&g_adv_reports_retransmission_list1);
-        if (NULL == p_elem)
-        {
-            break;
-        }
-        STAILQ_REMOVE_HEAD(&g_adv_reports_retransmission_list1, retransmission_list1);
-        p_elem->is_in_retransmission_list1 = false;
-    }
-}
-
-static void
-adv_retransmission_list2_clear_unsafe(void)
-{
-    while (1)
-    {
-        adv_reports_list_elem_t* p_elem = STAILQ_FIRST(&g_adv_reports_retransmission_list2);
-        if (NULL == p_elem)
-        {
-            break;
-        }
-        STAILQ_REMOVE_HEAD(&g_adv_reports_retransmission_list2, retransmission_list2);
-        p_elem->is_in_retransmission_list2 = false;
-    }
-}
-
-static void
-adv_retransmission_list3_clear_unsafe(void)
-{
-    while (1)
-    {
-        adv_reports_list_elem_t* p_elem = STAILQ_FIRST(&g_adv_reports_retransmission_list3);
-        if (NULL == p_elem)
-        {
-            break;
-        }
-        STAILQ_REMOVE_HEAD(&g_adv_reports_retransmission_list3, retransmission_list3);
-        p_elem->is_in_retransmission_list3 = false;
-    }
-}
-
 void
 adv_table_clear(void)
 {
     os_mutex_lock(gp_adv_reports_mutex);
-    adv_retransmission_list1_clear_unsafe();
-    adv_retransmission_list2_clear_unsafe();
-    adv_retransmission_list3_clear_unsafe();
+    memset(g_adv_table_targets, 0, sizeof(g_adv_table_targets));
+    TAILQ_INIT(&g_adv_reports_dirty_list);
 
     adv_reports_list_elem_t* p_elem = NULL;
     TAILQ_FOREACH(p_elem, &g_adv_reports_hist_list, hist_list)
     {
+        p_elem->dirty_mask = 0;
+        p_elem->gen        = 0;
+        memset(p_elem->in_flight_tickets, 0, sizeof(p_elem->in_flight_tickets));
         p_elem->adv_report.timestamp       = 0;
         p_elem->adv_report.samples_counter = 0;
         p_elem->adv_report.data_len        = 0; // mark adv_report as free in hist_list
@@ -15,6 +15,7 @@
 #include "gw_cfg.h"
 #include "ruuvi_endpoint_ca_uart.h"
 #include "ruuvi_gateway.h"
+#include "adv_aggr.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,10 +50,39 @@ typedef struct adv_report_t
     int8_t               tx_power;
     ble_data_len_t       data_len;
     uint8_t              data_buf[ADV_DATA_MAX_LEN];
+    mac_address_str_t    tag_mac_str; // Formatted once in adv_table_put when the tag is added to the table
+    adv_aggr_stat_t      aggr;        // Statistics over the window of adv_aggr, num_samples is 0 if not aggregated
 } adv_report_t;
 
 typedef uint32_t num_of_advs_t;
 
+/**
+ * @brief The ticket identifies the batch of advs read from the retransmission list which is not committed yet.
+ */
+typedef uint32_t adv_table_ticket_t;
+
+#define ADV_TABLE_TICKET_NONE (0U)
+
+/**
+ * @brief Number of the LAN clients which can read the live stream of the updated advs at the same time.
+ */
+#define ADV_TABLE_NUM_LIVE_STREAM_TARGETS (4)
+
+/**
+ * @brief The upload targets which read the updated advs independently of each other.
+ * @note Every adv carries a dirty bit per target, so a new target can be added here without extra cost
+ *       of adv_table_put. The retransmission list1/2/3 functions are the shortcuts for the first three targets.
+ */
+typedef enum adv_table_target_e
+{
+    ADV_TABLE_TARGET_HTTP_RUUVI        = 0, //!< retransmission list1
+    ADV_TABLE_TARGET_HTTP_CUSTOM       = 1, //!< retransmission list2
+    ADV_TABLE_TARGET_MQTT              = 2, //!< retransmission list3
+    ADV_TABLE_TARGET_LIVE_STREAM_FIRST = 3, //!< The first client of adv_live_stream
+    ADV_TABLE_TARGET_LIVE_STREAM_LAST  = ADV_TABLE_TARGET_LIVE_STREAM_FIRST + ADV_TABLE_NUM_LIVE_STREAM_TARGETS - 1,
+    ADV_TABLE_TARGET_NUM,
+} adv_table_target_e;
+
 typedef struct adv_report_table_t
 {
     num_of_advs_t num_of_advs;
@@ -68,6 +98,49 @@ adv_table_deinit(void);
 bool
 adv_table_put(const adv_report_t* const p_adv);
 
+/**
+ * @brief Read the advs which were updated since the last read by the target and mark them as read.
+ * @note The advs are read in the order of updating (the oldest one first).
+ * @param target - the upload target.
+ * @param[out] p_reports - pointer to the output buffer.
+ */
+void
+adv_table_read_dirty_and_clear(const adv_table_target_e target, adv_report_table_t* const p_reports);
+
+/**
+ * @brief The same as adv_table_read_dirty_and_clear, but keep the batch in flight until it's committed or rolled back.
+ * @note If the previous batch of the target was neither committed nor rolled back, it's rolled back first.
+ * @param target - the upload target.
+ * @param[out] p_reports - pointer to the output buffer.
+ * @return the ticket for adv_table_retransmission_commit / adv_table_retransmission_rollback.
+ */
+adv_table_ticket_t
+adv_table_read_dirty_begin(const adv_table_target_e target, adv_report_table_t* const p_reports);
+
+/**
+ * @brief Read up to max_num_advs updated advs of the target under one table lock and mark them as read.
+ * @param target - the upload target.
+ * @param p_advs - pointer to the array for the reports.
+ * @param max_num_advs - size of the array.
+ * @return number of the read reports.
+ */
+uint32_t
+adv_table_read_dirty_batch(const adv_table_target_e target, adv_report_t* const p_advs, const uint32_t max_num_advs);
+
+/**
+ * @brief Check if there are advs which were updated since the last read by the target.
+ */
+bool
+adv_table_is_dirty(const adv_table_target_e target);
+
+/**
+ * @brief Mark all the advs as read by the target, so it will read only the advs which are updated after this call.
+ * @note It's used when the target is reassigned to another consumer, the target must not have a batch in flight.
+ * @param target - the upload target.
+ */
+void
+adv_table_target_reset(const adv_table_target_e target);
+
 void
 adv_table_read_retransmission_list1_and_clear(adv_report_table_t* const p_reports);
 
@@ -77,12 +150,59 @@ adv_table_read_retransmission_list2_and_clear(adv_report_table_t* const p_report
 void
 adv_table_read_retransmission_list3_and_clear(adv_report_table_t* const p_reports);
 
+/**
+ * @brief The same as adv_table_read_dirty_begin for ADV_TABLE_TARGET_HTTP_RUUVI.
+ */
+adv_table_ticket_t
+adv_table_read_retransmission_list1_begin(adv_report_table_t* const p_reports);
+
+/**
+ * @brief The same as adv_table_read_dirty_begin for ADV_TABLE_TARGET_HTTP_CUSTOM.
+ */
+adv_table_ticket_t
+adv_table_read_retransmission_list2_begin(adv_report_table_t* const p_reports);
+
+/**
+ * @brief Confirm that the batch was delivered (HTTP 2xx), the advs are removed from the retransmission list for good.
+ * @param ticket - the ticket returned by adv_table_read_dirty_begin.
+ */
+void
+adv_table_retransmission_commit(const adv_table_ticket_t ticket);
+
+/**
+ * @brief Return the advs of the failed batch to the retransmission list, so they are sent with the next batch.
+ * @note The tags which were updated while the batch was in flight are already in the list with the newer data,
+ *       they are left unchanged.
+ * @param ticket - the ticket returned by adv_table_read_dirty_begin.
+ */
+void
+adv_table_retransmission_rollback(const adv_table_ticket_t ticket);
+
 bool
 adv_table_read_retransmission_list3_head(adv_report_t* const p_adv_report);
 
+/**
+ * @brief Dequeue up to max_num_advs reports from the head of the retransmission list3 under one table lock.
+ * @param p_advs - pointer to the array for the dequeued reports.
+ * @param max_num_advs - size of the array.
+ * @return number of dequeued reports.
+ */
+uint32_t
+adv_table_read_retransmission_list3_head_batch(adv_report_t* const p_advs, const uint32_t max_num_advs);
+
 bool
 adv_table_read_retransmission_list3_is_empty(void);
 
+/**
+ * @brief Read the latest advertisement of the tag without changing its dirty state,
+ *        so it is still sent with the next periodic batch.
+ * @param p_mac - pointer to the MAC address of the tag.
+ * @param[out] p_adv_report - pointer to the output advertisement.
+ * @return true if the tag was found.
+ */
+bool
+adv_table_read_by_mac(const mac_address_bin_t* const p_mac, adv_report_t* const p_adv_report);
+
 void
 adv_table_history_read(
     adv_report_table_t* const p_reports,
@@ -0,0 +1,206 @@
+/**
+ * @file adv_trigger.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_trigger.h"
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+void
+adv_trigger_init(adv_trigger_t* const p_trigger, const ruuvi_gw_cfg_adv_trigger_t* const p_cfg)
+{
+    memset(p_trigger, 0, sizeof(*p_trigger));
+    p_trigger->cfg = *p_cfg;
+
+    for (uint32_t i = 0; i < ADV_TRIGGER_HASH_SIZE; ++i)
+    {
+        STAILQ_INIT(&p_trigger->hash_table[i]);
+    }
+    TAILQ_INIT(&p_trigger->lru_list);
+    for (uint32_t i = 0; i < ADV_TRIGGER_MAX_NUM_TAGS; ++i)
+    {
+        TAILQ_INSERT_TAIL(&p_trigger->lru_list, &p_trigger->tags[i], lru_list);
+    }
+}
+
+bool
+adv_trigger_is_enabled(const adv_trigger_t* const p_trigger)
+{
+    return p_trigger->cfg.on_movement || p_trigger->cfg.use_temperature_low || p_trigger->cfg.use_temperature_high;
+}
+
+static uint32_t
+adv_trigger_calc_hash_idx(const mac_address_bin_t* const p_mac)
+{
+    uint32_t     hash_val           = 0;
+    const size_t mac_addr_half_size = sizeof(p_mac->mac) / sizeof(p_mac->mac[0]) / 2;
+    for (uint32_t i = 0; i < mac_addr_half_size; ++i)
+    {
+        hash_val |= ((uint32_t)p_mac->mac[i] ^ (uint32_t)p_mac->mac[i + mac_addr_half_size]) << (i * CHAR_BIT);
+    }
+    return hash_val % ADV_TRIGGER_HASH_SIZE;
+}
+
+static adv_trigger_tag_t*
+adv_trigger_find_or_add_tag(adv_trigger_t* const p_trigger, const mac_address_bin_t* const p_mac)
+{
+    const uint32_t     hash_idx = adv_trigger_calc_hash_idx(p_mac);
+    adv_trigger_tag_t* p_tag    = NULL;
+    STAILQ_FOREACH(p_tag, &p_trigger->hash_table[hash_idx], hash_list)
+    {
+        if (0 == memcmp(p_mac->mac, p_tag->mac.mac, sizeof(p_mac->mac)))
+        {
+            return p_tag;
+        }
+    }
+    // Reuse the least recently seen tag
+    p_tag = TAILQ_LAST(&p_trigger->lru_list, adv_trigger_lru_list_t);
+    if (p_tag->is_in_hash_table)
+    {
+        STAILQ_REMOVE(
+            &p_trigger->hash_table[adv_trigger_calc_hash_idx(&p_tag->mac)],
+            p_tag,
+            adv_trigger_tag_t,
+            hash_list);
+    }
+    p_tag->mac = *p_mac;
+    STAILQ_INSERT_TAIL(&p_trigger->hash_table[hash_idx], p_tag, hash_list);
+    p_tag->is_in_hash_table = true;
+    p_tag->movement_counter = NAN;
+    p_tag->temperature_zone = ADV_TRIGGER_TEMPERATURE_ZONE_UNKNOWN;
+    return p_tag;
+}
+
+static void
+adv_trigger_get_meas(const adv_decoded_t* const p_decoded, float* const p_temperature, float* const p_movement_counter)
+{
+    *p_temperature      = NAN;
+    *p_movement_counter = NAN;
+    switch (p_decoded->data_format)
+    {
+        case ADV_DECODED_DATA_FORMAT_5:
+            *p_temperature      = p_decoded->data.df5.temperature_c;
+            *p_movement_counter = p_decoded->data.df5.movement_count;
+            break;
+        case ADV_DECODED_DATA_FORMAT_6:
+            *p_temperature = p_decoded->data.df6.temperature_c;
+            break;
+        case ADV_DECODED_DATA_FORMAT_E0:
+            *p_temperature = p_decoded->data.dfe0.temperature_c;
+            break;
+        case ADV_DECODED_DATA_FORMAT_F0:
+            *p_temperature = p_decoded->data.dff0.temperature_c;
+            break;
+        default:
+            break;
+    }
+}
+
+static adv_trigger_temperature_zone_e
+adv_trigger_calc_temperature_zone(
+    const ruuvi_gw_cfg_adv_trigger_t* const p_cfg,
+    const adv_trigger_temperature_zone_e    prev_zone,
+    const float                             temperature)
+{
+    if (p_cfg->use_temperature_high)
+    {
+        const float limit = (ADV_TRIGGER_TEMPERATURE_ZONE_HIGH == prev_zone)
+                                ? ((float)p_cfg->temperature_high - ADV_TRIGGER_TEMPERATURE_HYSTERESIS)
+                                : (float)p_cfg->temperature_high;
+        if (temperature > limit)
+        {
+            return ADV_TRIGGER_TEMPERATURE_ZONE_HIGH;
+        }
+    }
+    if (p_cfg->use_temperature_low)
+    {
+        const float limit = (ADV_TRIGGER_TEMPERATURE_ZONE_LOW == prev_zone)
+                                ? ((float)p_cfg->temperature_low + ADV_TRIGGER_TEMPERATURE_HYSTERESIS)
+                                : (float)p_cfg->temperature_low;
+        if (temperature < limit)
+        {
+            return ADV_TRIGGER_TEMPERATURE_ZONE_LOW;
+        }
+    }
+    return ADV_TRIGGER_TEMPERATURE_ZONE_NORMAL;
+}
+
+static void
+adv_trigger_put_pending(adv_trigger_t* const p_trigger, const mac_address_bin_t* const p_mac)
+{
+    for (uint32_t i = 0; i < p_trigger->num_pending; ++i)
+    {
+        if (0 == memcmp(p_mac->mac, p_trigger->pending[i].mac, sizeof(p_mac->mac)))
+        {
+            return;
+        }
+    }
+    if (p_trigger->num_pending >= ADV_TRIGGER_MAX_NUM_PENDING)
+    {
+        // The advertisement is still sent with the periodic batch
+        p_trigger->cnt_pending_overflow += 1;
+        return;
+    }
+    p_trigger->pending[p_trigger->num_pending] = *p_mac;
+    p_trigger->num_pending += 1;
+}
+
+bool
+adv_trigger_check(
+    adv_trigger_t* const           p_trigger,
+    const mac_address_bin_t* const p_mac,
+    const adv_decoded_t* const     p_decoded)
+{
+    if (!adv_trigger_is_enabled(p_trigger))
+    {
+        return false;
+    }
+    adv_trigger_tag_t* const p_tag = adv_trigger_find_or_add_tag(p_trigger, p_mac);
+    TAILQ_REMOVE(&p_trigger->lru_list, p_tag, lru_list);
+    TAILQ_INSERT_HEAD(&p_trigger->lru_list, p_tag, lru_list);
+
+    float temperature      = NAN;
+    float movement_counter = NAN;
+    adv_trigger_get_meas(p_decoded, &temperature, &movement_counter);
+
+    bool flag_fired = false;
+    if (p_trigger->cfg.on_movement && (!isnan(movement_counter)))
+    {
+        if ((!isnan(p_tag->movement_counter)) && (movement_counter != p_tag->movement_counter))
+        {
+            flag_fired = true;
+        }
+        p_tag->movement_counter = movement_counter;
+    }
+    if ((p_trigger->cfg.use_temperature_low || p_trigger->cfg.use_temperature_high) && (!isnan(temperature)))
+    {
+        const adv_trigger_temperature_zone_e zone = adv_trigger_calc_temperature_zone(
+            &p_trigger->cfg,
+            p_tag->temperature_zone,
+            temperature);
+        if ((ADV_TRIGGER_TEMPERATURE_ZONE_UNKNOWN != p_tag->temperature_zone) && (zone != p_tag->temperature_zone))
+        {
+            flag_fired = true;
+        }
+        p_tag->temperature_zone = zone;
+    }
+    if (flag_fired)
+    {
+        adv_trigger_put_pending(p_trigger, p_mac);
+    }
+    return flag_fired;
+}
+
+uint32_t
+adv_trigger_take_pending(adv_trigger_t* const p_trigger, mac_address_bin_t* const p_macs, const uint32_t max_num_macs)
+{
+    const uint32_t num_macs = (p_trigger->num_pending < max_num_macs) ? p_trigger->num_pending : max_num_macs;
+    memcpy(p_macs, p_trigger->pending, num_macs * sizeof(p_macs[0]));
+    p_trigger->num_pending -= num_macs;
+    memmove(&p_trigger->pending[0], &p_trigger->pending[num_macs], p_trigger->num_pending * sizeof(p_macs[0]));
+    return num_macs;
+}
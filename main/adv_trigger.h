@@ -0,0 +1,114 @@
+/**
+ * @file adv_trigger.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_ADV_TRIGGER_H
+#define RUUVI_GATEWAY_ESP_ADV_TRIGGER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sys/queue.h"
+#include "gw_cfg.h"
+#include "adv_decoded.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADV_TRIGGER_MAX_NUM_TAGS    (GW_CFG_MAX_NUM_SENSORS)
+#define ADV_TRIGGER_HASH_SIZE       (101)
+#define ADV_TRIGGER_MAX_NUM_PENDING (8)
+
+/**
+ * @brief The temperature must return inside the limits by this value to leave the LOW or HIGH zone,
+ *        so that the noise of the measurements around the limit does not fire the trigger on every advertisement.
+ */
+#define ADV_TRIGGER_TEMPERATURE_HYSTERESIS (0.5f)
+
+typedef enum adv_trigger_temperature_zone_e
+{
+    ADV_TRIGGER_TEMPERATURE_ZONE_UNKNOWN = 0,
+    ADV_TRIGGER_TEMPERATURE_ZONE_NORMAL,
+    ADV_TRIGGER_TEMPERATURE_ZONE_LOW,
+    ADV_TRIGGER_TEMPERATURE_ZONE_HIGH,
+} adv_trigger_temperature_zone_e;
+
+typedef struct adv_trigger_tag_t adv_trigger_tag_t;
+
+struct adv_trigger_tag_t
+{
+    STAILQ_ENTRY(adv_trigger_tag_t) hash_list;
+    TAILQ_ENTRY(adv_trigger_tag_t) lru_list;
+    bool                           is_in_hash_table;
+    mac_address_bin_t              mac;
+    float                          movement_counter; // NAN - unknown
+    adv_trigger_temperature_zone_e temperature_zone;
+};
+
+typedef STAILQ_HEAD(adv_trigger_hash_list_t, adv_trigger_tag_t) adv_trigger_hash_list_t;
+typedef TAILQ_HEAD(adv_trigger_lru_list_t, adv_trigger_tag_t) adv_trigger_lru_list_t;
+
+/**
+ * @brief The per-tag state of the trigger rules and the queue of the tags which must be sent immediately.
+ * @note The least recently seen tag is reused when the table is full.
+ */
+typedef struct adv_trigger_t
+{
+    ruuvi_gw_cfg_adv_trigger_t cfg;
+    adv_trigger_hash_list_t    hash_table[ADV_TRIGGER_HASH_SIZE];
+    adv_trigger_lru_list_t     lru_list;
+    adv_trigger_tag_t          tags[ADV_TRIGGER_MAX_NUM_TAGS];
+    uint32_t                   num_pending;
+    mac_address_bin_t          pending[ADV_TRIGGER_MAX_NUM_PENDING];
+    uint32_t                   cnt_pending_overflow;
+} adv_trigger_t;
+
+/**
+ * @brief Apply the settings from gw_cfg, forget the state of all the tags and clear the queue.
+ * @param[out] p_trigger - pointer to the trigger state.
+ * @param p_cfg - pointer to the settings.
+ */
+void
+adv_trigger_init(adv_trigger_t* const p_trigger, const ruuvi_gw_cfg_adv_trigger_t* const p_cfg);
+
+/**
+ * @brief Check if any trigger rule is in use (the advertisements need to be decoded before calling adv_trigger_check).
+ * @param p_trigger - pointer to the trigger state.
+ * @return true if at least one rule is in use.
+ */
+bool
+adv_trigger_is_enabled(const adv_trigger_t* const p_trigger);
+
+/**
+ * @brief Evaluate the trigger rules on the decoded measurements and queue the tag if any of them fires.
+ * @note The first advertisement of the tag only sets the reference values, so the rules fire on changes:
+ *       the movement counter is changed or the temperature crosses the low or high limit in any direction.
+ * @param p_trigger - pointer to the trigger state.
+ * @param p_mac - pointer to the MAC address of the tag.
+ * @param p_decoded - pointer to the decoded measurements.
+ * @return true if the advertisement must be sent immediately.
+ */
+bool
+adv_trigger_check(
+    adv_trigger_t* const           p_trigger,
+    const mac_address_bin_t* const p_mac,
+    const adv_decoded_t* const     p_decoded);
+
+/**
+ * @brief Take the MAC addresses of the tags which must be sent immediately and clear the queue.
+ * @param p_trigger - pointer to the trigger state.
+ * @param[out] p_macs - pointer to the output array.
+ * @param max_num_macs - size of the output array.
+ * @return the number of MAC addresses copied to p_macs.
+ */
+uint32_t
+adv_trigger_take_pending(adv_trigger_t* const p_trigger, mac_address_bin_t* const p_macs, const uint32_t max_num_macs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_ADV_TRIGGER_H
@@ -10,21 +10,43 @@
 #include <stdlib.h>
 #include "str_buf.h"
 #include "os_malloc.h"
+#include "fmt_fast.h"
+
+#define BIN2HEX_CHUNK_NUM_BYTES (32U)
 
 BIN2HEX_STATIC
 void
 bin2hex(str_buf_t* p_str_buf, const uint8_t* const p_bin_buf, const size_t bin_buf_len)
 {
     const size_t len_of_hex_digit_with_separator = 3;
+    const size_t num_hex_digits_per_byte         = 2;
+    char         hex_buf[(BIN2HEX_CHUNK_NUM_BYTES * 2) + 1];
     str_buf_printf(p_str_buf, "%s", "");
-    for (size_t i = 0; i < bin_buf_len; ++i)
+    size_t offset = 0;
+    while (offset < bin_buf_len)
     {
-        if ((0 != p_str_buf->size)
-            && ((str_buf_get_len(p_str_buf) + len_of_hex_digit_with_separator) > p_str_buf->size))
+        size_t chunk_len = bin_buf_len - offset;
+        if (chunk_len > BIN2HEX_CHUNK_NUM_BYTES)
+        {
+            chunk_len = BIN2HEX_CHUNK_NUM_BYTES;
+        }
+        if (0 != p_str_buf->size)
         {
-            break;
+            const size_t len = str_buf_get_len(p_str_buf);
+            if ((len + len_of_hex_digit_with_separator) > p_str_buf->size)
+            {
+                break;
+            }
+            // Only the whole bytes are printed, the same as it was done by "%02X" byte by byte
+            const size_t max_chunk_len = (p_str_buf->size - len - 1) / num_hex_digits_per_byte;
+            if (chunk_len > max_chunk_len)
+            {
+                chunk_len = max_chunk_len;
+            }
         }
-        str_buf_printf(p_str_buf, "%02X", p_bin_buf[i]);
+        (void)fmt_fast_hex(hex_buf, sizeof(hex_buf), &p_bin_buf[offset], chunk_len);
+        str_buf_printf(p_str_buf, "%s", hex_buf);
+        offset += chunk_len;
     }
 }
 
@@ -0,0 +1,88 @@
+/**
+ * @file boot_timeline.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "boot_timeline.h"
+#include <string.h>
+#include "esp_timer.h"
+#include "os_mutex.h"
+
+static const char* const g_boot_timeline_stage_names[BOOT_TIMELINE_STAGE_LAST] = {
+    [BOOT_TIMELINE_STAGE_APP_MAIN]                 = "app_main",
+    [BOOT_TIMELINE_STAGE_NVS_READY]                = "nvs_ready",
+    [BOOT_TIMELINE_STAGE_GW_CFG_DEFAULT_READY]     = "gw_cfg_default_ready",
+    [BOOT_TIMELINE_STAGE_NRF52_CHECK_STARTED]      = "nrf52_check_started",
+    [BOOT_TIMELINE_STAGE_ADV_TASKS_STARTED]        = "adv_tasks_started",
+    [BOOT_TIMELINE_STAGE_NRF52_CHECK_FINISHED]     = "nrf52_check_finished",
+    [BOOT_TIMELINE_STAGE_NRF52_DEVICE_ID_RECEIVED] = "nrf52_device_id_received",
+    [BOOT_TIMELINE_STAGE_GW_CFG_READY]             = "gw_cfg_ready",
+    [BOOT_TIMELINE_STAGE_NETWORK_INIT_FINISHED]    = "network_init_finished",
+    [BOOT_TIMELINE_STAGE_NETWORK_CONNECTED]        = "network_connected",
+};
+
+static boot_timeline_t   g_boot_timeline;
+static os_mutex_t        g_p_boot_timeline_mutex;
+static os_mutex_static_t g_boot_timeline_mutex_mem;
+
+void
+boot_timeline_init(void)
+{
+    memset(&g_boot_timeline, 0, sizeof(g_boot_timeline));
+    if (NULL == g_p_boot_timeline_mutex)
+    {
+        g_p_boot_timeline_mutex = os_mutex_create_static(&g_boot_timeline_mutex_mem);
+    }
+}
+
+static void
+boot_timeline_lock(void)
+{
+    if (NULL == g_p_boot_timeline_mutex)
+    {
+        boot_timeline_init();
+    }
+    os_mutex_lock(g_p_boot_timeline_mutex);
+}
+
+static void
+boot_timeline_unlock(void)
+{
+    os_mutex_unlock(g_p_boot_timeline_mutex);
+}
+
+void
+boot_timeline_mark(const boot_timeline_stage_e stage)
+{
+    if (stage >= BOOT_TIMELINE_STAGE_LAST)
+    {
+        return;
+    }
+    const boot_timeline_timestamp_us_t timestamp_us = esp_timer_get_time();
+    boot_timeline_lock();
+    if (0 == g_boot_timeline.stages[stage])
+    {
+        g_boot_timeline.stages[stage] = timestamp_us;
+    }
+    boot_timeline_unlock();
+}
+
+void
+boot_timeline_get(boot_timeline_t* const p_timeline)
+{
+    boot_timeline_lock();
+    *p_timeline = g_boot_timeline;
+    boot_timeline_unlock();
+}
+
+const char*
+boot_timeline_get_stage_name(const boot_timeline_stage_e stage)
+{
+    if (stage >= BOOT_TIMELINE_STAGE_LAST)
+    {
+        return "unknown";
+    }
+    return g_boot_timeline_stage_names[stage];
+}
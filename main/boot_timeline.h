@@ -0,0 +1,63 @@
+/**
+ * @file boot_timeline.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_BOOT_TIMELINE_H
+#define RUUVI_GATEWAY_ESP_BOOT_TIMELINE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum boot_timeline_stage_e
+{
+    BOOT_TIMELINE_STAGE_APP_MAIN,
+    BOOT_TIMELINE_STAGE_NVS_READY,
+    BOOT_TIMELINE_STAGE_GW_CFG_DEFAULT_READY,
+    BOOT_TIMELINE_STAGE_NRF52_CHECK_STARTED,
+    BOOT_TIMELINE_STAGE_ADV_TASKS_STARTED,
+    BOOT_TIMELINE_STAGE_NRF52_CHECK_FINISHED,
+    BOOT_TIMELINE_STAGE_NRF52_DEVICE_ID_RECEIVED,
+    BOOT_TIMELINE_STAGE_GW_CFG_READY,
+    BOOT_TIMELINE_STAGE_NETWORK_INIT_FINISHED,
+    BOOT_TIMELINE_STAGE_NETWORK_CONNECTED,
+    BOOT_TIMELINE_STAGE_LAST,
+} boot_timeline_stage_e;
+
+/**
+ * @brief Timestamp in microseconds since power-on (esp_timer_get_time), 0 means that the stage was not reached yet.
+ */
+typedef int64_t boot_timeline_timestamp_us_t;
+
+typedef struct boot_timeline_t
+{
+    boot_timeline_timestamp_us_t stages[BOOT_TIMELINE_STAGE_LAST];
+} boot_timeline_t;
+
+void
+boot_timeline_init(void);
+
+/**
+ * @brief Record the timestamp of the boot stage.
+ * @note Only the first call for each stage is recorded, so it's safe to call it on every (re)connection.
+ * @param stage - boot stage.
+ */
+void
+boot_timeline_mark(const boot_timeline_stage_e stage);
+
+void
+boot_timeline_get(boot_timeline_t* const p_timeline);
+
+const char*
+boot_timeline_get_stage_name(const boot_timeline_stage_e stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_BOOT_TIMELINE_H
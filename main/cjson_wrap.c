@@ -19,6 +19,8 @@
 void
 cjson_wrap_init(void)
 {
+    // The strings returned by cJSON_Print are passed to the HTTP server which releases them with os_free,
+    // so cJSON must use the plain heap functions without the heap_prof header.
     cJSON_Hooks hooks = {
         .malloc_fn = &os_malloc,
         .free_fn   = &os_free_internal,
@@ -6,6 +6,7 @@
  */
 
 #include "event_mgr.h"
+#include <string.h>
 #include "assert.h"
 #include "os_mutex.h"
 #include "os_signal.h"
@@ -27,9 +28,38 @@ _Static_assert(
     sizeof(event_mgr_ev_info_static_t) == sizeof(event_mgr_ev_info_t),
     "sizeof(event_mgr_ev_info_static_t) == sizeof(event_mgr_ev_info_t)");
 
+#define EVENT_MGR_FAST_PATH_MAX_SUBSCRIBERS (4U)
+
+enum
+{
+    EVENT_MGR_NUM_FAST_PATH_EVENTS = 1U,
+};
+
+/**
+ * @brief Subscriber of the high-rate event.
+ * @note p_signal, sig_num and flag_coalesce are written only once before the subscriber is published
+ *       by incrementing event_mgr_fast_path_t::num_subscribers, so event_mgr_notify can read them without locking.
+ */
+typedef struct event_mgr_fast_subscriber_t
+{
+    os_signal_t*    p_signal;
+    os_signal_num_e sig_num;
+    bool            flag_coalesce;
+    volatile bool   flag_active;
+    volatile bool   flag_pending;
+} event_mgr_fast_subscriber_t;
+
+typedef struct event_mgr_fast_path_t
+{
+    volatile uint32_t           num_subscribers;
+    event_mgr_fast_subscriber_t subscribers[EVENT_MGR_FAST_PATH_MAX_SUBSCRIBERS];
+} event_mgr_fast_path_t;
+
 typedef struct event_mgr_queue_of_subscribers_t
 {
     TAILQ_HEAD(event_mgr_queue_of_subscribers_head_t, event_mgr_ev_info_t) head;
+    event_mgr_fast_path_t* p_fast_path;
+    event_mgr_ev_stat_t    stat;
 } event_mgr_queue_of_subscribers_t;
 
 struct event_mgr_t
@@ -37,12 +67,47 @@ struct event_mgr_t
     os_mutex_t                       h_mutex;
     os_mutex_static_t                mutex_static;
     event_mgr_queue_of_subscribers_t events[EVENT_MGR_EV_LAST];
+    event_mgr_fast_path_t            fast_path[EVENT_MGR_NUM_FAST_PATH_EVENTS];
 };
 
 static const char* TAG = "event_mgr";
 
 static event_mgr_t g_event_mgr;
 
+static const event_mgr_ev_e g_event_mgr_fast_path_events[EVENT_MGR_NUM_FAST_PATH_EVENTS] = {
+    EVENT_MGR_EV_RECV_ADV,
+};
+
+static const char* const g_event_mgr_ev_names[EVENT_MGR_EV_LAST] = {
+    [EVENT_MGR_EV_NONE]                              = "none",
+    [EVENT_MGR_EV_REBOOT]                            = "reboot",
+    [EVENT_MGR_EV_WIFI_AP_STARTED]                   = "wifi_ap_started",
+    [EVENT_MGR_EV_WIFI_AP_STOPPED]                   = "wifi_ap_stopped",
+    [EVENT_MGR_EV_WPS_ACTIVATED]                     = "wps_activated",
+    [EVENT_MGR_EV_WPS_DEACTIVATED]                   = "wps_deactivated",
+    [EVENT_MGR_EV_WIFI_AP_STA_CONNECTED]             = "wifi_ap_sta_connected",
+    [EVENT_MGR_EV_WIFI_AP_STA_DISCONNECTED]          = "wifi_ap_sta_disconnected",
+    [EVENT_MGR_EV_WIFI_CONNECTED]                    = "wifi_connected",
+    [EVENT_MGR_EV_WIFI_DISCONNECTED]                 = "wifi_disconnected",
+    [EVENT_MGR_EV_ETH_CONNECTED]                     = "eth_connected",
+    [EVENT_MGR_EV_ETH_DISCONNECTED]                  = "eth_disconnected",
+    [EVENT_MGR_EV_TIME_SYNCHRONIZED]                 = "time_synchronized",
+    [EVENT_MGR_EV_GW_CFG_READY]                      = "gw_cfg_ready",
+    [EVENT_MGR_EV_GW_CFG_CHANGED_RUUVI]              = "gw_cfg_changed_ruuvi",
+    [EVENT_MGR_EV_GW_CFG_CHANGED_ETH]                = "gw_cfg_changed_eth",
+    [EVENT_MGR_EV_GW_CFG_CHANGED_WIFI]               = "gw_cfg_changed_wifi",
+    [EVENT_MGR_EV_GW_CFG_CHANGED_RUUVI_NTP_USE]      = "gw_cfg_changed_ruuvi_ntp_use",
+    [EVENT_MGR_EV_GW_CFG_CHANGED_RUUVI_NTP_USE_DHCP] = "gw_cfg_changed_ruuvi_ntp_use_dhcp",
+    [EVENT_MGR_EV_RELAYING_MODE_CHANGED]             = "relaying_mode_changed",
+    [EVENT_MGR_EV_CFG_MODE_ACTIVATED]                = "cfg_mode_activated",
+    [EVENT_MGR_EV_CFG_MODE_DEACTIVATED]              = "cfg_mode_deactivated",
+    [EVENT_MGR_EV_CFG_BLE_SCAN_CHANGED]              = "cfg_ble_scan_changed",
+    [EVENT_MGR_EV_RECV_ADV]                          = "recv_adv",
+    [EVENT_MGR_EV_RECV_ADV_TIMEOUT]                  = "recv_adv_timeout",
+    [EVENT_MGR_EV_GREEN_LED_STATE_CHANGED]           = "green_led_state_changed",
+    [EVENT_MGR_EV_MQTT_CONNECTED]                    = "mqtt_connected",
+};
+
 bool
 event_mgr_init(void)
 {
@@ -56,6 +121,14 @@ event_mgr_init(void)
     {
         const event_mgr_ev_e ev = (const event_mgr_ev_e)i;
         TAILQ_INIT(&p_obj->events[ev].head);
+        p_obj->events[ev].p_fast_path = NULL;
+        memset(&p_obj->events[ev].stat, 0, sizeof(p_obj->events[ev].stat));
+    }
+    for (uint32_t i = 0; i < EVENT_MGR_NUM_FAST_PATH_EVENTS; ++i)
+    {
+        event_mgr_fast_path_t* const p_fast_path = &p_obj->fast_path[i];
+        memset(p_fast_path, 0, sizeof(*p_fast_path));
+        p_obj->events[g_event_mgr_fast_path_events[i]].p_fast_path = p_fast_path;
     }
     return true;
 }
@@ -78,7 +151,9 @@ event_mgr_deinit(void)
                 os_free(p_ev_info);
             }
         }
+        p_queue->p_fast_path = NULL;
     }
+    memset(&p_obj->fast_path, 0, sizeof(p_obj->fast_path));
     os_mutex_delete(&p_obj->h_mutex);
 }
 
@@ -126,12 +201,68 @@ event_mgr_subscribe_sig(const event_mgr_ev_e event, os_signal_t* const p_signal,
     return true;
 }
 
-void
-event_mgr_subscribe_sig_static(
+static event_mgr_fast_subscriber_t*
+event_mgr_fast_path_find(
+    event_mgr_fast_path_t* const p_fast_path,
+    const os_signal_t* const     p_signal,
+    const os_signal_num_e        sig_num)
+{
+    const uint32_t num_subscribers = p_fast_path->num_subscribers;
+    for (uint32_t i = 0; i < num_subscribers; ++i)
+    {
+        event_mgr_fast_subscriber_t* const p_subscriber = &p_fast_path->subscribers[i];
+        if ((p_subscriber->p_signal == p_signal) && (p_subscriber->sig_num == sig_num))
+        {
+            return p_subscriber;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @note The array of subscribers is append-only: the slot of the unsubscribed signal is deactivated,
+ *       but it is never reused for another signal, so event_mgr_notify can iterate it without locking.
+ *       Must be called with the mutex locked.
+ */
+static bool
+event_mgr_fast_path_subscribe(
+    event_mgr_fast_path_t* const p_fast_path,
+    os_signal_t* const           p_signal,
+    const os_signal_num_e        sig_num,
+    const bool                   flag_coalesce)
+{
+    event_mgr_fast_subscriber_t* p_subscriber = event_mgr_fast_path_find(p_fast_path, p_signal, sig_num);
+    if (NULL != p_subscriber)
+    {
+        if (p_subscriber->flag_coalesce != flag_coalesce)
+        {
+            return false;
+        }
+        p_subscriber->flag_pending = false;
+        p_subscriber->flag_active  = true;
+        return true;
+    }
+    if (p_fast_path->num_subscribers >= EVENT_MGR_FAST_PATH_MAX_SUBSCRIBERS)
+    {
+        return false;
+    }
+    p_subscriber                = &p_fast_path->subscribers[p_fast_path->num_subscribers];
+    p_subscriber->p_signal      = p_signal;
+    p_subscriber->sig_num       = sig_num;
+    p_subscriber->flag_coalesce = flag_coalesce;
+    p_subscriber->flag_pending  = false;
+    p_subscriber->flag_active   = true;
+    p_fast_path->num_subscribers += 1;
+    return true;
+}
+
+static void
+event_mgr_subscribe_sig_static_internal(
     event_mgr_ev_info_static_t* const p_ev_info_mem,
     const event_mgr_ev_e              event,
     os_signal_t* const                p_signal,
-    const os_signal_num_e             sig_num)
+    const os_signal_num_e             sig_num,
+    const bool                        flag_coalesce)
 {
     event_mgr_t* const p_obj = &g_event_mgr;
     assert((event > EVENT_MGR_EV_NONE) && (event < EVENT_MGR_EV_LAST));
@@ -144,10 +275,40 @@ event_mgr_subscribe_sig_static(
 
     event_mgr_mutex_lock(p_obj);
     event_mgr_queue_of_subscribers_t* const p_queue_of_subscribers = &p_obj->events[event];
+    if ((NULL != p_queue_of_subscribers->p_fast_path)
+        && event_mgr_fast_path_subscribe(p_queue_of_subscribers->p_fast_path, p_signal, sig_num, flag_coalesce))
+    {
+        event_mgr_mutex_unlock(p_obj);
+        return;
+    }
+    if (NULL != p_queue_of_subscribers->p_fast_path)
+    {
+        LOG_WARN("Event %s: can't use fast path for subscriber", g_event_mgr_ev_names[event]);
+    }
     TAILQ_INSERT_TAIL(&p_queue_of_subscribers->head, p_ev_info, list);
     event_mgr_mutex_unlock(p_obj);
 }
 
+void
+event_mgr_subscribe_sig_static(
+    event_mgr_ev_info_static_t* const p_ev_info_mem,
+    const event_mgr_ev_e              event,
+    os_signal_t* const                p_signal,
+    const os_signal_num_e             sig_num)
+{
+    event_mgr_subscribe_sig_static_internal(p_ev_info_mem, event, p_signal, sig_num, false);
+}
+
+void
+event_mgr_subscribe_sig_static_coalesced(
+    event_mgr_ev_info_static_t* const p_ev_info_mem,
+    const event_mgr_ev_e              event,
+    os_signal_t* const                p_signal,
+    const os_signal_num_e             sig_num)
+{
+    event_mgr_subscribe_sig_static_internal(p_ev_info_mem, event, p_signal, sig_num, true);
+}
+
 void
 event_mgr_unsubscribe_sig(const event_mgr_ev_e event, const os_signal_t* const p_signal, const os_signal_num_e sig_num)
 {
@@ -187,7 +348,21 @@ event_mgr_unsubscribe_sig_static(event_mgr_ev_info_static_t* const p_ev_info_mem
     event_mgr_t* const p_obj = &g_event_mgr;
     event_mgr_mutex_lock(p_obj);
     event_mgr_queue_of_subscribers_t* const p_queue_of_subscribers = &p_obj->events[event];
-    event_mgr_ev_info_t*                    p_elem                 = NULL;
+    if (NULL != p_queue_of_subscribers->p_fast_path)
+    {
+        event_mgr_fast_subscriber_t* const p_subscriber = event_mgr_fast_path_find(
+            p_queue_of_subscribers->p_fast_path,
+            p_ev_info->p_signal,
+            p_ev_info->sig_num);
+        if ((NULL != p_subscriber) && p_subscriber->flag_active)
+        {
+            p_subscriber->flag_active  = false;
+            p_subscriber->flag_pending = false;
+            event_mgr_mutex_unlock(p_obj);
+            return;
+        }
+    }
+    event_mgr_ev_info_t* p_elem = NULL;
     TAILQ_FOREACH(p_elem, &p_queue_of_subscribers->head, list)
     {
         if (p_elem == p_ev_info)
@@ -204,6 +379,35 @@ event_mgr_unsubscribe_sig_static(event_mgr_ev_info_static_t* const p_ev_info_mem
     event_mgr_mutex_unlock(p_obj);
 }
 
+static void
+event_mgr_notify_fast_path(event_mgr_queue_of_subscribers_t* const p_queue_of_subscribers)
+{
+    event_mgr_fast_path_t* const p_fast_path     = p_queue_of_subscribers->p_fast_path;
+    event_mgr_ev_stat_t* const   p_stat          = &p_queue_of_subscribers->stat;
+    const uint32_t               num_subscribers = p_fast_path->num_subscribers;
+    for (uint32_t i = 0; i < num_subscribers; ++i)
+    {
+        event_mgr_fast_subscriber_t* const p_subscriber = &p_fast_path->subscribers[i];
+        if (!p_subscriber->flag_active)
+        {
+            continue;
+        }
+        if (p_subscriber->flag_coalesce)
+        {
+            if (p_subscriber->flag_pending)
+            {
+                p_stat->cnt_coalesced += 1;
+                continue;
+            }
+            // The subscriber clears this flag before reading the data, so the signal can't be lost,
+            // at worst a concurrent notification will send one redundant signal.
+            p_subscriber->flag_pending = true;
+        }
+        os_signal_send(p_subscriber->p_signal, p_subscriber->sig_num);
+        p_stat->cnt_sent += 1;
+    }
+}
+
 void
 event_mgr_notify(const event_mgr_ev_e event)
 {
@@ -218,11 +422,64 @@ event_mgr_notify(const event_mgr_ev_e event)
         return;
     }
     event_mgr_queue_of_subscribers_t* const p_queue_of_subscribers = &p_obj->events[event];
-    event_mgr_mutex_lock(p_obj);
+    if (NULL != p_queue_of_subscribers->p_fast_path)
+    {
+        // High-rate events are notified from a single task (adv_post), so the statistics are updated without locking.
+        p_queue_of_subscribers->stat.cnt_notify += 1;
+        event_mgr_notify_fast_path(p_queue_of_subscribers);
+        if (TAILQ_EMPTY(&p_queue_of_subscribers->head))
+        {
+            return;
+        }
+        event_mgr_mutex_lock(p_obj);
+    }
+    else
+    {
+        event_mgr_mutex_lock(p_obj);
+        p_queue_of_subscribers->stat.cnt_notify += 1;
+    }
     event_mgr_ev_info_t* p_ev_info = NULL;
     TAILQ_FOREACH(p_ev_info, &p_queue_of_subscribers->head, list)
     {
         os_signal_send(p_ev_info->p_signal, p_ev_info->sig_num);
+        p_queue_of_subscribers->stat.cnt_sent += 1;
     }
     event_mgr_mutex_unlock(p_obj);
 }
+
+void
+event_mgr_clear_pending_sig(
+    const event_mgr_ev_e     event,
+    const os_signal_t* const p_signal,
+    const os_signal_num_e    sig_num)
+{
+    assert((event > EVENT_MGR_EV_NONE) && (event < EVENT_MGR_EV_LAST));
+
+    event_mgr_fast_path_t* const p_fast_path = g_event_mgr.events[event].p_fast_path;
+    if (NULL == p_fast_path)
+    {
+        return;
+    }
+    event_mgr_fast_subscriber_t* const p_subscriber = event_mgr_fast_path_find(p_fast_path, p_signal, sig_num);
+    if (NULL != p_subscriber)
+    {
+        p_subscriber->flag_pending = false;
+    }
+}
+
+void
+event_mgr_get_stat(const event_mgr_ev_e event, event_mgr_ev_stat_t* const p_stat)
+{
+    assert((event > EVENT_MGR_EV_NONE) && (event < EVENT_MGR_EV_LAST));
+    *p_stat = g_event_mgr.events[event].stat;
+}
+
+const char*
+event_mgr_get_ev_name(const event_mgr_ev_e event)
+{
+    if ((event <= EVENT_MGR_EV_NONE) || (event >= EVENT_MGR_EV_LAST))
+    {
+        return "unknown";
+    }
+    return g_event_mgr_ev_names[event];
+}
@@ -9,6 +9,7 @@
 #define RUUVI_GATEWAY_ESP_EVENT_MGR_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "os_signal.h"
 #include "attribs.h"
 
@@ -59,6 +60,13 @@ typedef struct event_mgr_ev_info_static_t
     bool            stub5;
 } event_mgr_ev_info_static_t;
 
+typedef struct event_mgr_ev_stat_t
+{
+    uint32_t cnt_notify;    // Number of calls of event_mgr_notify for the event
+    uint32_t cnt_sent;      // Number of signals sent to the subscribers
+    uint32_t cnt_coalesced; // Number of signals skipped because the subscriber has not handled the previous one yet
+} event_mgr_ev_stat_t;
+
 bool
 event_mgr_init(void);
 
@@ -76,6 +84,22 @@ event_mgr_subscribe_sig_static(
     os_signal_t* const                p_signal,
     const os_signal_num_e             sig_num);
 
+/**
+ * @brief Subscribe to the event with coalescing of the signals.
+ * @note The signal is not re-sent while the previous one is still pending,
+ *       the subscriber must call event_mgr_clear_pending_sig when it starts handling the signal.
+ *       Coalescing is supported only for high-rate events (EVENT_MGR_EV_RECV_ADV),
+ *       for other events this function works the same way as event_mgr_subscribe_sig_static.
+ * @note Signals of high-rate events are sent without locking the mutex,
+ *       so p_signal must not be deleted after unsubscribing (use os_signal_create_static).
+ */
+void
+event_mgr_subscribe_sig_static_coalesced(
+    event_mgr_ev_info_static_t* const p_ev_info_mem,
+    const event_mgr_ev_e              event,
+    os_signal_t* const                p_signal,
+    const os_signal_num_e             sig_num);
+
 void
 event_mgr_unsubscribe_sig(const event_mgr_ev_e event, const os_signal_t* const p_signal, const os_signal_num_e sig_num);
 
@@ -85,6 +109,24 @@ event_mgr_unsubscribe_sig_static(event_mgr_ev_info_static_t* const p_ev_info_mem
 void
 event_mgr_notify(const event_mgr_ev_e event);
 
+/**
+ * @brief Allow event_mgr_notify to send the signal again to the subscriber with coalescing.
+ * @param event - the event which was subscribed with event_mgr_subscribe_sig_static_coalesced.
+ * @param p_signal - pointer to the signal of the subscriber.
+ * @param sig_num - signal number.
+ */
+void
+event_mgr_clear_pending_sig(
+    const event_mgr_ev_e     event,
+    const os_signal_t* const p_signal,
+    const os_signal_num_e    sig_num);
+
+void
+event_mgr_get_stat(const event_mgr_ev_e event, event_mgr_ev_stat_t* const p_stat);
+
+const char*
+event_mgr_get_ev_name(const event_mgr_ev_e event);
+
 #ifdef __cplusplus
 }
 #endif
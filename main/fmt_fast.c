@@ -0,0 +1,64 @@
+/**
+ * @file fmt_fast.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "fmt_fast.h"
+
+#define FMT_FAST_NUM_HEX_DIGITS_PER_BYTE (2U)
+#define FMT_FAST_NIBBLE_SHIFT            (4U)
+#define FMT_FAST_NIBBLE_MASK             (0x0FU)
+#define FMT_FAST_MAC_SEPARATOR           (':')
+
+_Static_assert(
+    sizeof(((mac_address_str_t*)NULL)->str_buf) >= (MAC_ADDRESS_NUM_BYTES * (FMT_FAST_NUM_HEX_DIGITS_PER_BYTE + 1U)),
+    "mac_address_str_t");
+
+static const char g_fmt_fast_hex_digits[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+};
+
+static inline char*
+fmt_fast_put_hex_byte(char* p_dst, const uint8_t byte)
+{
+    *p_dst++ = g_fmt_fast_hex_digits[byte >> FMT_FAST_NIBBLE_SHIFT];
+    *p_dst++ = g_fmt_fast_hex_digits[byte & FMT_FAST_NIBBLE_MASK];
+    return p_dst;
+}
+
+size_t
+fmt_fast_hex(char* const p_dst, const size_t dst_size, const uint8_t* const p_bin_buf, const size_t bin_buf_len)
+{
+    if (0 == dst_size)
+    {
+        return 0;
+    }
+    const size_t max_len = (dst_size - 1) / FMT_FAST_NUM_HEX_DIGITS_PER_BYTE;
+    const size_t len     = (bin_buf_len < max_len) ? bin_buf_len : max_len;
+    char*        p_out   = p_dst;
+    for (size_t i = 0; i < len; ++i)
+    {
+        p_out = fmt_fast_put_hex_byte(p_out, p_bin_buf[i]);
+    }
+    *p_out = '\0';
+    return len * FMT_FAST_NUM_HEX_DIGITS_PER_BYTE;
+}
+
+mac_address_str_t
+fmt_fast_mac_to_str(const mac_address_bin_t* const p_mac)
+{
+    mac_address_str_t mac_str = { 0 };
+    char*             p_out   = mac_str.str_buf;
+    for (uint32_t i = 0; i < MAC_ADDRESS_NUM_BYTES; ++i)
+    {
+        if (0 != i)
+        {
+            *p_out++ = FMT_FAST_MAC_SEPARATOR;
+        }
+        p_out = fmt_fast_put_hex_byte(p_out, p_mac->mac[i]);
+    }
+    *p_out = '\0';
+    return mac_str;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file fmt_fast.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_FMT_FAST_H
+#define RUUVI_GATEWAY_ESP_FMT_FAST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "mac_addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Print the binary buffer as an upper-case hex string without printf,
+ *        the output is the same as "%02X" for every byte.
+ * @note If the output buffer is too small, only the whole bytes which fit into it are printed.
+ * @param p_dst - pointer to the output buffer.
+ * @param dst_size - size of the output buffer (including the terminating null character).
+ * @param p_bin_buf - pointer to the binary buffer.
+ * @param bin_buf_len - size of the binary buffer.
+ * @return the number of printed characters (without the terminating null character).
+ */
+size_t
+fmt_fast_hex(char* const p_dst, const size_t dst_size, const uint8_t* const p_bin_buf, const size_t bin_buf_len);
+
+/**
+ * @brief Convert MAC address to string without printf, the output is the same as mac_address_to_str.
+ * @param p_mac - pointer to the binary MAC address.
+ * @return MAC address string in the format "AA:BB:CC:DD:EE:FF".
+ */
+mac_address_str_t
+fmt_fast_mac_to_str(const mac_address_bin_t* const p_mac);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_FMT_FAST_H
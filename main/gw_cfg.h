@@ -32,6 +32,10 @@ extern "C" {
 
 #define GW_CFG_MAX_NUM_SENSORS (100U)
 
+#define GW_CFG_MAX_NUM_ADV_FILTER_RULES     (16U)
+#define GW_CFG_ADV_FILTER_PREFIX_MAX_LEN    (8U)
+#define GW_CFG_ADV_FILTER_MAC_OUI_NUM_BYTES (3U)
+
 #define GW_CFG_MAX_HTTP_BEARER_TOKEN_LEN 256
 #define GW_CFG_MAX_HTTP_TOKEN_LEN        256
 #define GW_CFG_MAX_HTTP_APIKEY_LEN       256
@@ -101,6 +105,26 @@ typedef enum gw_cfg_mqtt_data_format_e
     GW_CFG_MQTT_DATA_FORMAT_RUUVI_DECODED,
 } gw_cfg_mqtt_data_format_e;
 
+#define GW_CFG_MQTT_QOS_MAX (2U)
+
+#define GW_CFG_ADV_AGGR_MODE_STR_NONE       "none"
+#define GW_CFG_ADV_AGGR_MODE_STR_DOWNSAMPLE "downsample"
+#define GW_CFG_ADV_AGGR_MODE_STR_WINDOW     "window"
+
+#define GW_CFG_ADV_AGGR_MODE_STR_SIZE sizeof(GW_CFG_ADV_AGGR_MODE_STR_DOWNSAMPLE)
+
+#define GW_CFG_ADV_AGGR_DEFAULT_PERIOD_SECONDS (60U)
+#define GW_CFG_ADV_AGGR_MAX_PERIOD_SECONDS     (3600U)
+
+typedef enum gw_cfg_adv_aggr_mode_e
+{
+    GW_CFG_ADV_AGGR_MODE_NONE = 0,   // Every advertisement is forwarded
+    GW_CFG_ADV_AGGR_MODE_DOWNSAMPLE, // At most one advertisement per period is forwarded for every tag
+    GW_CFG_ADV_AGGR_MODE_WINDOW,     // The same as DOWNSAMPLE + min/max/mean of the measurements over the period
+} gw_cfg_adv_aggr_mode_e;
+
+typedef uint8_t gw_cfg_mqtt_qos_t;
+
 typedef struct ruuvi_gw_cfg_mqtt_server_t
 {
     char buf[GW_CFG_MAX_MQTT_SERVER_LEN];
@@ -134,6 +158,7 @@ typedef struct ruuvi_gw_cfg_mqtt_t
     bool                          use_ssl_server_cert;
     ruuvi_gw_cfg_mqtt_transport_t mqtt_transport;
     gw_cfg_mqtt_data_format_e     mqtt_data_format;
+    gw_cfg_mqtt_qos_t             mqtt_qos;
     ruuvi_gw_cfg_mqtt_server_t    mqtt_server;
     uint16_t                      mqtt_port;
     uint32_t                      mqtt_sending_interval;
@@ -336,6 +361,58 @@ typedef struct ruuvi_gw_cfg_scan_filter_t
     mac_address_bin_t scan_filter_list[GW_CFG_MAX_NUM_SENSORS];
 } ruuvi_gw_cfg_scan_filter_t;
 
+/**
+ * @brief The rule accepts the advertisement if all the conditions which are in use are met.
+ * @note The data format is the first byte of the manufacturer specific data after the company ID,
+ *       the payload prefix is compared with this data (starting from the data format byte) under the mask.
+ */
+typedef struct ruuvi_gw_cfg_adv_filter_rule_t
+{
+    bool     use_manufacturer_id;
+    bool     use_data_format;
+    bool     use_rssi_min;
+    bool     use_mac_oui;
+    uint16_t manufacturer_id;
+    uint8_t  data_format;
+    int8_t   rssi_min;
+    uint8_t  mac_oui[GW_CFG_ADV_FILTER_MAC_OUI_NUM_BYTES];
+    uint8_t  payload_prefix_len; // 0 - payload prefix is not in use
+    uint8_t  payload_prefix[GW_CFG_ADV_FILTER_PREFIX_MAX_LEN];
+    uint8_t  payload_mask[GW_CFG_ADV_FILTER_PREFIX_MAX_LEN];
+} ruuvi_gw_cfg_adv_filter_rule_t;
+
+/**
+ * @brief The advertisement is accepted if any rule accepts it,
+ *        all the advertisements are accepted if there are no rules.
+ */
+typedef struct ruuvi_gw_cfg_adv_filter_t
+{
+    uint32_t                       num_rules;
+    ruuvi_gw_cfg_adv_filter_rule_t rules[GW_CFG_MAX_NUM_ADV_FILTER_RULES];
+} ruuvi_gw_cfg_adv_filter_t;
+
+/**
+ * @brief Per-tag downsampling of the advertisements before they are put into adv_table.
+ */
+typedef struct ruuvi_gw_cfg_adv_aggr_t
+{
+    gw_cfg_adv_aggr_mode_e mode;
+    uint32_t               period_seconds;
+} ruuvi_gw_cfg_adv_aggr_t;
+
+/**
+ * @brief The rules which push the advertisement of the tag immediately, bypassing the periodic batch.
+ * @note The temperature limits are in whole degrees Celsius.
+ */
+typedef struct ruuvi_gw_cfg_adv_trigger_t
+{
+    bool   on_movement; // The movement counter of the tag was changed
+    bool   use_temperature_low;
+    bool   use_temperature_high;
+    int8_t temperature_low;
+    int8_t temperature_high;
+} ruuvi_gw_cfg_adv_trigger_t;
+
 typedef struct ruuvi_gw_cfg_coordinates_t
 {
     char buf[GW_CFG_MAX_COORDINATES_STR_LEN];
@@ -358,6 +435,9 @@ typedef struct ruuvi_gw_cfg_t
     ruuvi_gw_cfg_filter_t      filter;
     ruuvi_gw_cfg_scan_t        scan;
     ruuvi_gw_cfg_scan_filter_t scan_filter;
+    ruuvi_gw_cfg_adv_filter_t  adv_filter;
+    ruuvi_gw_cfg_adv_aggr_t    adv_aggr;
+    ruuvi_gw_cfg_adv_trigger_t adv_trigger;
     ruuvi_gw_cfg_coordinates_t coordinates;
     ruuvi_gw_cfg_fw_update_t   fw_update;
 } gw_cfg_ruuvi_t;
@@ -217,6 +217,10 @@ ruuvi_gw_cfg_mqtt_cmp(const ruuvi_gw_cfg_mqtt_t* const p_mqtt1, const ruuvi_gw_c
     {
         return false;
     }
+    if (p_mqtt1->mqtt_qos != p_mqtt2->mqtt_qos)
+    {
+        return false;
+    }
     if (0 != strcmp(p_mqtt1->mqtt_server.buf, p_mqtt2->mqtt_server.buf))
     {
         return false;
@@ -417,6 +421,69 @@ ruuvi_gw_cfg_scan_filter_cmp(
     return true;
 }
 
+static bool
+ruuvi_gw_cfg_adv_filter_cmp(
+    const ruuvi_gw_cfg_adv_filter_t* const p_adv_filter1,
+    const ruuvi_gw_cfg_adv_filter_t* const p_adv_filter2)
+{
+    if (p_adv_filter1->num_rules != p_adv_filter2->num_rules)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < p_adv_filter1->num_rules; ++i)
+    {
+        if (0 != memcmp(&p_adv_filter1->rules[i], &p_adv_filter2->rules[i], sizeof(p_adv_filter1->rules[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+ruuvi_gw_cfg_adv_aggr_cmp(
+    const ruuvi_gw_cfg_adv_aggr_t* const p_adv_aggr1,
+    const ruuvi_gw_cfg_adv_aggr_t* const p_adv_aggr2)
+{
+    if (p_adv_aggr1->mode != p_adv_aggr2->mode)
+    {
+        return false;
+    }
+    if (p_adv_aggr1->period_seconds != p_adv_aggr2->period_seconds)
+    {
+        return false;
+    }
+    return true;
+}
+
+static bool
+ruuvi_gw_cfg_adv_trigger_cmp(
+    const ruuvi_gw_cfg_adv_trigger_t* const p_adv_trigger1,
+    const ruuvi_gw_cfg_adv_trigger_t* const p_adv_trigger2)
+{
+    if (p_adv_trigger1->on_movement != p_adv_trigger2->on_movement)
+    {
+        return false;
+    }
+    if (p_adv_trigger1->use_temperature_low != p_adv_trigger2->use_temperature_low)
+    {
+        return false;
+    }
+    if (p_adv_trigger1->use_temperature_low && (p_adv_trigger1->temperature_low != p_adv_trigger2->temperature_low))
+    {
+        return false;
+    }
+    if (p_adv_trigger1->use_temperature_high != p_adv_trigger2->use_temperature_high)
+    {
+        return false;
+    }
+    if (p_adv_trigger1->use_temperature_high && (p_adv_trigger1->temperature_high != p_adv_trigger2->temperature_high))
+    {
+        return false;
+    }
+    return true;
+}
+
 static bool
 ruuvi_gw_cfg_coordinates_cmp(
     const ruuvi_gw_cfg_coordinates_t* const p_coordinates1,
@@ -484,6 +551,18 @@ gw_cfg_ruuvi_cmp(const gw_cfg_ruuvi_t* const p_cfg_ruuvi1, const gw_cfg_ruuvi_t*
     {
         return false;
     }
+    if (!ruuvi_gw_cfg_adv_filter_cmp(&p_cfg_ruuvi1->adv_filter, &p_cfg_ruuvi2->adv_filter))
+    {
+        return false;
+    }
+    if (!ruuvi_gw_cfg_adv_aggr_cmp(&p_cfg_ruuvi1->adv_aggr, &p_cfg_ruuvi2->adv_aggr))
+    {
+        return false;
+    }
+    if (!ruuvi_gw_cfg_adv_trigger_cmp(&p_cfg_ruuvi1->adv_trigger, &p_cfg_ruuvi2->adv_trigger))
+    {
+        return false;
+    }
     if (!ruuvi_gw_cfg_coordinates_cmp(&p_cfg_ruuvi1->coordinates, &p_cfg_ruuvi2->coordinates))
     {
         return false;
@@ -70,6 +70,7 @@ static const gw_cfg_ruuvi_t g_gateway_config_default_ruuvi = {
             .use_ssl_server_cert = false,
             .mqtt_transport = {{ MQTT_TRANSPORT_TCP }},
             .mqtt_data_format = GW_CFG_MQTT_DATA_FORMAT_RUUVI_RAW,
+            .mqtt_qos = 0,
             .mqtt_server = {{ "test.mosquitto.org" }},
             .mqtt_port = 1883,
             .mqtt_sending_interval = 0,
@@ -118,6 +119,21 @@ static const gw_cfg_ruuvi_t g_gateway_config_default_ruuvi = {
             .scan_filter_length = 0,
             .scan_filter_list = { },
         },
+        .adv_filter = {
+            .num_rules = 0,
+            .rules = { },
+        },
+        .adv_aggr = {
+            .mode = GW_CFG_ADV_AGGR_MODE_NONE,
+            .period_seconds = GW_CFG_ADV_AGGR_DEFAULT_PERIOD_SECONDS,
+        },
+        .adv_trigger = {
+            .on_movement = false,
+            .use_temperature_low = false,
+            .use_temperature_high = false,
+            .temperature_low = 0,
+            .temperature_high = 0,
+        },
         .coordinates = {{ "" }},
         .fw_update = {
             .fw_update_url = { RUUVI_GATEWAY_FW_UPDATE_URL },
@@ -57,6 +57,9 @@ gw_cfg_json_parse_cjson_ruuvi_cfg(const cJSON* const p_json_root, gw_cfg_ruuvi_t
     gw_cfg_json_parse_filter(p_json_root, &p_ruuvi_cfg->filter);
     gw_cfg_json_parse_scan(p_json_root, &p_ruuvi_cfg->scan);
     gw_cfg_json_parse_scan_filter(p_json_root, &p_ruuvi_cfg->scan_filter);
+    gw_cfg_json_parse_adv_filter(p_json_root, &p_ruuvi_cfg->adv_filter);
+    gw_cfg_json_parse_adv_aggr(p_json_root, &p_ruuvi_cfg->adv_aggr);
+    gw_cfg_json_parse_adv_trigger(p_json_root, &p_ruuvi_cfg->adv_trigger);
     if (!gw_cfg_json_copy_string_val(
             p_json_root,
             "coordinates",
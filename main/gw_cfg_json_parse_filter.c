@@ -6,6 +6,7 @@
  */
 
 #include "gw_cfg_json_parse_filter.h"
+#include <string.h>
 #include "gw_cfg_json_parse_internal.h"
 
 #if !defined(RUUVI_TESTS_HTTP_SERVER_CB)
@@ -41,3 +42,222 @@ gw_cfg_json_parse_filter(const cJSON* const p_json_root, ruuvi_gw_cfg_filter_t*
         LOG_WARN("Can't find key '%s' in config-json", "company_use_filtering");
     }
 }
+
+static int32_t
+gw_cfg_json_parse_hex_digit(const char ch)
+{
+    if ((ch >= '0') && (ch <= '9'))
+    {
+        return ch - '0';
+    }
+    if ((ch >= 'A') && (ch <= 'F'))
+    {
+        return ch - 'A' + 10;
+    }
+    if ((ch >= 'a') && (ch <= 'f'))
+    {
+        return ch - 'a' + 10;
+    }
+    return -1;
+}
+
+/**
+ * @brief Parse the hex string, the bytes can be separated by ':' (like in MAC address).
+ * @return the number of bytes or -1 if the string is invalid or too long.
+ */
+static int32_t
+gw_cfg_json_parse_hex_str(const char* p_str, uint8_t* const p_buf, const size_t buf_size)
+{
+    size_t len = 0;
+    while ('\0' != *p_str)
+    {
+        if ((0 != len) && (':' == *p_str))
+        {
+            p_str += 1;
+        }
+        const int32_t hi = gw_cfg_json_parse_hex_digit(p_str[0]);
+        const int32_t lo = (hi >= 0) ? gw_cfg_json_parse_hex_digit(p_str[1]) : -1;
+        if ((lo < 0) || (len >= buf_size))
+        {
+            return -1;
+        }
+        p_buf[len] = (uint8_t)((hi << 4) | lo);
+        len += 1;
+        p_str += 2;
+    }
+    return (int32_t)len;
+}
+
+static void
+gw_cfg_json_parse_adv_filter_rule_payload(const cJSON* const p_json_rule, ruuvi_gw_cfg_adv_filter_rule_t* const p_rule)
+{
+    const char* const p_prefix = cJSON_GetStringValue(cJSON_GetObjectItem(p_json_rule, "payload_prefix"));
+    if (NULL == p_prefix)
+    {
+        return;
+    }
+    const int32_t prefix_len = gw_cfg_json_parse_hex_str(
+        p_prefix,
+        p_rule->payload_prefix,
+        sizeof(p_rule->payload_prefix));
+    if (prefix_len < 0)
+    {
+        LOG_ERR("Can't parse payload_prefix in adv_filter_rules: %s", p_prefix);
+        return;
+    }
+    // The bytes which are missing in the mask are compared exactly
+    memset(p_rule->payload_mask, 0xFF, sizeof(p_rule->payload_mask));
+    const char* const p_mask = cJSON_GetStringValue(cJSON_GetObjectItem(p_json_rule, "payload_mask"));
+    if ((NULL != p_mask) && (gw_cfg_json_parse_hex_str(p_mask, p_rule->payload_mask, (size_t)prefix_len) < 0))
+    {
+        LOG_ERR("Can't parse payload_mask in adv_filter_rules: %s", p_mask);
+        memset(p_rule->payload_mask, 0xFF, sizeof(p_rule->payload_mask));
+    }
+    p_rule->payload_prefix_len = (uint8_t)prefix_len;
+}
+
+static void
+gw_cfg_json_parse_adv_filter_rule(const cJSON* const p_json_rule, ruuvi_gw_cfg_adv_filter_rule_t* const p_rule)
+{
+    memset(p_rule, 0, sizeof(*p_rule));
+    p_rule->use_manufacturer_id = gw_cfg_json_get_uint16_val(p_json_rule, "manufacturer_id", &p_rule->manufacturer_id);
+    p_rule->use_data_format     = gw_cfg_json_get_uint8_val(p_json_rule, "data_format", &p_rule->data_format);
+    p_rule->use_rssi_min        = gw_cfg_json_get_int8_val(p_json_rule, "rssi_min", &p_rule->rssi_min);
+
+    const char* const p_mac_oui = cJSON_GetStringValue(cJSON_GetObjectItem(p_json_rule, "mac_oui"));
+    if (NULL != p_mac_oui)
+    {
+        if (GW_CFG_ADV_FILTER_MAC_OUI_NUM_BYTES
+            == gw_cfg_json_parse_hex_str(p_mac_oui, p_rule->mac_oui, sizeof(p_rule->mac_oui)))
+        {
+            p_rule->use_mac_oui = true;
+        }
+        else
+        {
+            LOG_ERR("Can't parse mac_oui in adv_filter_rules: %s", p_mac_oui);
+        }
+    }
+    gw_cfg_json_parse_adv_filter_rule_payload(p_json_rule, p_rule);
+}
+
+void
+gw_cfg_json_parse_adv_filter(const cJSON* const p_json_root, ruuvi_gw_cfg_adv_filter_t* const p_gw_cfg_adv_filter)
+{
+    const cJSON* const p_json_rules = cJSON_GetObjectItem(p_json_root, "adv_filter_rules");
+    if (NULL == p_json_rules)
+    {
+        return;
+    }
+    const int32_t num_rules = cJSON_GetArraySize(p_json_rules);
+    uint32_t      arr_idx   = 0;
+    for (int32_t i = 0; i < num_rules; ++i)
+    {
+        if (arr_idx >= GW_CFG_MAX_NUM_ADV_FILTER_RULES)
+        {
+            LOG_ERR("Too many adv_filter_rules, max %u", (printf_uint_t)GW_CFG_MAX_NUM_ADV_FILTER_RULES);
+            break;
+        }
+        gw_cfg_json_parse_adv_filter_rule(cJSON_GetArrayItem(p_json_rules, i), &p_gw_cfg_adv_filter->rules[arr_idx]);
+        arr_idx += 1;
+    }
+    p_gw_cfg_adv_filter->num_rules = arr_idx;
+}
+
+static gw_cfg_adv_aggr_mode_e
+gw_cfg_json_parse_adv_aggr_mode(const char* const p_mode_str)
+{
+    if (0 == strcmp(GW_CFG_ADV_AGGR_MODE_STR_NONE, p_mode_str))
+    {
+        return GW_CFG_ADV_AGGR_MODE_NONE;
+    }
+    if (0 == strcmp(GW_CFG_ADV_AGGR_MODE_STR_DOWNSAMPLE, p_mode_str))
+    {
+        return GW_CFG_ADV_AGGR_MODE_DOWNSAMPLE;
+    }
+    if (0 == strcmp(GW_CFG_ADV_AGGR_MODE_STR_WINDOW, p_mode_str))
+    {
+        return GW_CFG_ADV_AGGR_MODE_WINDOW;
+    }
+    LOG_WARN("Unknown adv_aggr_mode='%s', use '%s'", p_mode_str, GW_CFG_ADV_AGGR_MODE_STR_NONE);
+    return GW_CFG_ADV_AGGR_MODE_NONE;
+}
+
+void
+gw_cfg_json_parse_adv_aggr(const cJSON* const p_json_root, ruuvi_gw_cfg_adv_aggr_t* const p_gw_cfg_adv_aggr)
+{
+    if (NULL == cJSON_GetObjectItem(p_json_root, "adv_aggr_mode"))
+    {
+        return;
+    }
+    char mode_str[GW_CFG_ADV_AGGR_MODE_STR_SIZE];
+    if (!gw_cfg_json_copy_string_val(p_json_root, "adv_aggr_mode", &mode_str[0], sizeof(mode_str)))
+    {
+        mode_str[0] = '\0';
+    }
+    p_gw_cfg_adv_aggr->mode = gw_cfg_json_parse_adv_aggr_mode(mode_str);
+
+    uint32_t period_seconds = 0;
+    if (!gw_cfg_json_get_uint32_val(p_json_root, "adv_aggr_period", &period_seconds))
+    {
+        LOG_WARN("Can't find key '%s' in config-json", "adv_aggr_period");
+        period_seconds = GW_CFG_ADV_AGGR_DEFAULT_PERIOD_SECONDS;
+    }
+    if ((0 == period_seconds) || (period_seconds > GW_CFG_ADV_AGGR_MAX_PERIOD_SECONDS))
+    {
+        LOG_WARN(
+            "Invalid adv_aggr_period=%u, use %u",
+            (printf_uint_t)period_seconds,
+            (printf_uint_t)GW_CFG_ADV_AGGR_DEFAULT_PERIOD_SECONDS);
+        period_seconds = GW_CFG_ADV_AGGR_DEFAULT_PERIOD_SECONDS;
+    }
+    p_gw_cfg_adv_aggr->period_seconds = period_seconds;
+}
+
+static bool
+gw_cfg_json_parse_adv_trigger_temperature(
+    const cJSON* const p_json_root,
+    const char* const  p_attr_name,
+    int8_t* const      p_temperature)
+{
+    if (NULL == cJSON_GetObjectItem(p_json_root, p_attr_name))
+    {
+        return false;
+    }
+    if (!gw_cfg_json_get_int8_val(p_json_root, p_attr_name, p_temperature))
+    {
+        LOG_WARN("Invalid value of key '%s' in config-json, the limit is not used", p_attr_name);
+        return false;
+    }
+    return true;
+}
+
+void
+gw_cfg_json_parse_adv_trigger(
+    const cJSON* const                p_json_root,
+    ruuvi_gw_cfg_adv_trigger_t* const p_gw_cfg_adv_trigger)
+{
+    if ((NULL != cJSON_GetObjectItem(p_json_root, "adv_trigger_movement"))
+        && (!gw_cfg_json_get_bool_val(p_json_root, "adv_trigger_movement", &p_gw_cfg_adv_trigger->on_movement)))
+    {
+        LOG_WARN("Invalid value of key '%s' in config-json", "adv_trigger_movement");
+        p_gw_cfg_adv_trigger->on_movement = false;
+    }
+    p_gw_cfg_adv_trigger->use_temperature_low = gw_cfg_json_parse_adv_trigger_temperature(
+        p_json_root,
+        "adv_trigger_temperature_low",
+        &p_gw_cfg_adv_trigger->temperature_low);
+    p_gw_cfg_adv_trigger->use_temperature_high = gw_cfg_json_parse_adv_trigger_temperature(
+        p_json_root,
+        "adv_trigger_temperature_high",
+        &p_gw_cfg_adv_trigger->temperature_high);
+    if (p_gw_cfg_adv_trigger->use_temperature_low && p_gw_cfg_adv_trigger->use_temperature_high
+        && (p_gw_cfg_adv_trigger->temperature_low >= p_gw_cfg_adv_trigger->temperature_high))
+    {
+        LOG_WARN(
+            "Invalid adv_trigger_temperature_low=%d >= adv_trigger_temperature_high=%d, the limits are not used",
+            (printf_int_t)p_gw_cfg_adv_trigger->temperature_low,
+            (printf_int_t)p_gw_cfg_adv_trigger->temperature_high);
+        p_gw_cfg_adv_trigger->use_temperature_low  = false;
+        p_gw_cfg_adv_trigger->use_temperature_high = false;
+    }
+}
@@ -18,6 +18,28 @@ extern "C" {
 void
 gw_cfg_json_parse_filter(const cJSON* const p_json_root, ruuvi_gw_cfg_filter_t* const p_gw_cfg_filter);
 
+/**
+ * @brief Parse the optional array "adv_filter_rules", the rules are not changed if the key is missing.
+ */
+void
+gw_cfg_json_parse_adv_filter(const cJSON* const p_json_root, ruuvi_gw_cfg_adv_filter_t* const p_gw_cfg_adv_filter);
+
+/**
+ * @brief Parse the optional keys "adv_aggr_mode" and "adv_aggr_period", the settings are not changed
+ *        if "adv_aggr_mode" is missing.
+ */
+void
+gw_cfg_json_parse_adv_aggr(const cJSON* const p_json_root, ruuvi_gw_cfg_adv_aggr_t* const p_gw_cfg_adv_aggr);
+
+/**
+ * @brief Parse the optional keys "adv_trigger_movement", "adv_trigger_temperature_low"
+ *        and "adv_trigger_temperature_high", a temperature limit is not used if its key is missing.
+ */
+void
+gw_cfg_json_parse_adv_trigger(
+    const cJSON* const                p_json_root,
+    ruuvi_gw_cfg_adv_trigger_t* const p_gw_cfg_adv_trigger);
+
 #ifdef __cplusplus
 }
 #endif
@@ -76,6 +76,20 @@ gw_cfg_json_parse_mqtt(const cJSON* const p_cjson, ruuvi_gw_cfg_mqtt_t* const p_
         LOG_WARN("Can't find key '%s' in config-json", "mqtt_transport");
     }
     p_mqtt->mqtt_data_format = gw_cfg_json_parse_mqtt_data_format(p_cjson);
+    if (!gw_cfg_json_get_uint8_val(p_cjson, "mqtt_qos", &p_mqtt->mqtt_qos))
+    {
+        LOG_WARN("Can't find key '%s' in config-json", "mqtt_qos");
+    }
+    if (p_mqtt->mqtt_qos > GW_CFG_MQTT_QOS_MAX)
+    {
+        const ruuvi_gw_cfg_mqtt_t* const p_default_mqtt = gw_cfg_default_get_mqtt();
+        LOG_WARN(
+            "Invalid value of key '%s' in config-json: %u, use default value: %u",
+            "mqtt_qos",
+            (printf_uint_t)p_mqtt->mqtt_qos,
+            (printf_uint_t)p_default_mqtt->mqtt_qos);
+        p_mqtt->mqtt_qos = p_default_mqtt->mqtt_qos;
+    }
     if (!gw_cfg_json_copy_string_val(
             p_cjson,
             "mqtt_server",
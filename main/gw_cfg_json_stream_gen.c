@@ -0,0 +1,663 @@
+/**
+ * @file gw_cfg_json_stream_gen.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "gw_cfg_json_stream_gen.h"
+#include <string.h>
+#include "gw_cfg_default.h"
+#include "gw_cfg_storage.h"
+#include "fmt_fast.h"
+#include "os_malloc.h"
+#include "heap_prof.h"
+
+#define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
+#include "log.h"
+
+#define GW_CFG_JSON_STREAM_GEN_MAX_NESTING_LEVEL (3U)
+
+typedef struct gw_cfg_json_stream_gen_ctx_t
+{
+    gw_cfg_t gw_cfg;
+    bool     flag_hide_passwords_and_add_device_info;
+    bool     flag_storage_ready;
+    bool     storage_files[GW_CFG_STORAGE_NUM_ALLOWED_FILES];
+} gw_cfg_json_stream_gen_ctx_t;
+
+static const char TAG[] = "gw_cfg";
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_device_info,
+    json_stream_gen_t* const                  p_gen,
+    const gw_cfg_json_stream_gen_ctx_t* const p_ctx)
+{
+    const gw_cfg_device_info_t* const p_dev_info = &p_ctx->gw_cfg.device_info;
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "fw_ver", p_dev_info->esp32_fw_ver.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "nrf52_fw_ver", p_dev_info->nrf52_fw_ver.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "gw_mac", p_dev_info->nrf52_mac_addr.str_buf);
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "storage");
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "storage_ready", p_ctx->flag_storage_ready);
+    if (p_ctx->flag_storage_ready)
+    {
+        for (uint32_t i = 0; i < GW_CFG_STORAGE_NUM_ALLOWED_FILES; ++i)
+        {
+            JSON_STREAM_GEN_ADD_BOOL(p_gen, g_gw_cfg_storage_list_of_allowed_files[i], p_ctx->storage_files[i]);
+        }
+    }
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_wifi,
+    json_stream_gen_t* const      p_gen,
+    const wifiman_config_t* const p_wifi_cfg,
+    const bool                    flag_hide_passwords)
+{
+    const wifi_sta_config_t* const p_wifi_cfg_sta = &p_wifi_cfg->sta.wifi_config_sta;
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "wifi_sta_config");
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "ssid", (const char*)p_wifi_cfg_sta->ssid);
+    if (!flag_hide_passwords)
+    {
+        JSON_STREAM_GEN_ADD_STRING(p_gen, "password", (const char*)p_wifi_cfg_sta->password);
+    }
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+
+    const wifi_ap_config_t* const p_wifi_cfg_ap = &p_wifi_cfg->ap.wifi_config_ap;
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "wifi_ap_config");
+    if (!flag_hide_passwords)
+    {
+        JSON_STREAM_GEN_ADD_STRING(p_gen, "password", (const char*)p_wifi_cfg_ap->password);
+    }
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "channel", (0 != p_wifi_cfg_ap->channel) ? p_wifi_cfg_ap->channel : 1);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_eth,
+    json_stream_gen_t* const  p_gen,
+    const gw_cfg_eth_t* const p_cfg_eth)
+{
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "use_eth", p_cfg_eth->use_eth);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "eth_dhcp", p_cfg_eth->eth_dhcp);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "eth_static_ip", p_cfg_eth->eth_static_ip.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "eth_netmask", p_cfg_eth->eth_netmask.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "eth_gw", p_cfg_eth->eth_gw.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "eth_dns1", p_cfg_eth->eth_dns1.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "eth_dns2", p_cfg_eth->eth_dns2.buf);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_remote,
+    json_stream_gen_t* const           p_gen,
+    const ruuvi_gw_cfg_remote_t* const p_cfg_remote,
+    const bool                         flag_hide_passwords)
+{
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "remote_cfg_use", p_cfg_remote->use_remote_cfg);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "remote_cfg_url", p_cfg_remote->url.buf);
+    switch (p_cfg_remote->auth_type)
+    {
+        case GW_CFG_HTTP_AUTH_TYPE_NONE:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "remote_cfg_auth_type", GW_CFG_HTTP_AUTH_TYPE_STR_NONE);
+            break;
+        case GW_CFG_HTTP_AUTH_TYPE_BASIC:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "remote_cfg_auth_type", GW_CFG_HTTP_AUTH_TYPE_STR_BASIC);
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "remote_cfg_auth_basic_user", p_cfg_remote->auth.auth_basic.user.buf);
+            if (!flag_hide_passwords)
+            {
+                JSON_STREAM_GEN_ADD_STRING(
+                    p_gen,
+                    "remote_cfg_auth_basic_pass",
+                    p_cfg_remote->auth.auth_basic.password.buf);
+            }
+            break;
+        case GW_CFG_HTTP_AUTH_TYPE_BEARER:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "remote_cfg_auth_type", GW_CFG_HTTP_AUTH_TYPE_STR_BEARER);
+            if (!flag_hide_passwords)
+            {
+                JSON_STREAM_GEN_ADD_STRING(
+                    p_gen,
+                    "remote_cfg_auth_bearer_token",
+                    p_cfg_remote->auth.auth_bearer.token.buf);
+            }
+            break;
+        case GW_CFG_HTTP_AUTH_TYPE_TOKEN:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "remote_cfg_auth_type", GW_CFG_HTTP_AUTH_TYPE_STR_TOKEN);
+            if (!flag_hide_passwords)
+            {
+                JSON_STREAM_GEN_ADD_STRING(p_gen, "remote_cfg_auth_token", p_cfg_remote->auth.auth_token.token.buf);
+            }
+            break;
+        case GW_CFG_HTTP_AUTH_TYPE_APIKEY:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "remote_cfg_auth_type", GW_CFG_HTTP_AUTH_TYPE_STR_APIKEY);
+            if (!flag_hide_passwords)
+            {
+                JSON_STREAM_GEN_ADD_STRING(
+                    p_gen,
+                    "remote_cfg_auth_apikey",
+                    p_cfg_remote->auth.auth_apikey.api_key.buf);
+            }
+            break;
+    }
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "remote_cfg_use_ssl_client_cert", p_cfg_remote->use_ssl_client_cert);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "remote_cfg_use_ssl_server_cert", p_cfg_remote->use_ssl_server_cert);
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "remote_cfg_refresh_interval_minutes", p_cfg_remote->refresh_interval_minutes);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_http_default, json_stream_gen_t* const p_gen)
+{
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "use_http_ruuvi", true);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "use_http", true);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "http_url", RUUVI_GATEWAY_HTTP_DEFAULT_URL);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "http_data_format", GW_CFG_HTTP_DATA_FORMAT_STR_RUUVI);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "http_auth", GW_CFG_HTTP_AUTH_TYPE_STR_NONE);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_http_custom_auth,
+    json_stream_gen_t* const         p_gen,
+    const ruuvi_gw_cfg_http_t* const p_cfg_http,
+    const bool                       flag_hide_passwords)
+{
+    switch (p_cfg_http->auth_type)
+    {
+        case GW_CFG_HTTP_AUTH_TYPE_NONE:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "http_auth", GW_CFG_HTTP_AUTH_TYPE_STR_NONE);
+            break;
+        case GW_CFG_HTTP_AUTH_TYPE_BASIC:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "http_auth", GW_CFG_HTTP_AUTH_TYPE_STR_BASIC);
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "http_user", p_cfg_http->auth.auth_basic.user.buf);
+            if (!flag_hide_passwords)
+            {
+                JSON_STREAM_GEN_ADD_STRING(p_gen, "http_pass", p_cfg_http->auth.auth_basic.password.buf);
+            }
+            break;
+        case GW_CFG_HTTP_AUTH_TYPE_BEARER:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "http_auth", GW_CFG_HTTP_AUTH_TYPE_STR_BEARER);
+            if (!flag_hide_passwords)
+            {
+                JSON_STREAM_GEN_ADD_STRING(p_gen, "http_bearer_token", p_cfg_http->auth.auth_bearer.token.buf);
+            }
+            break;
+        case GW_CFG_HTTP_AUTH_TYPE_TOKEN:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "http_auth", GW_CFG_HTTP_AUTH_TYPE_STR_TOKEN);
+            if (!flag_hide_passwords)
+            {
+                JSON_STREAM_GEN_ADD_STRING(p_gen, "http_api_key", p_cfg_http->auth.auth_token.token.buf);
+            }
+            break;
+        case GW_CFG_HTTP_AUTH_TYPE_APIKEY:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "http_auth", GW_CFG_HTTP_AUTH_TYPE_STR_APIKEY);
+            if (!flag_hide_passwords)
+            {
+                JSON_STREAM_GEN_ADD_STRING(p_gen, "http_api_key", p_cfg_http->auth.auth_apikey.api_key.buf);
+            }
+            break;
+    }
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_http_custom_params,
+    json_stream_gen_t* const         p_gen,
+    const ruuvi_gw_cfg_http_t* const p_cfg_http,
+    const bool                       flag_hide_passwords)
+{
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "http_use_ssl_client_cert", p_cfg_http->http_use_ssl_client_cert);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "http_use_ssl_server_cert", p_cfg_http->http_use_ssl_server_cert);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "http_url", p_cfg_http->http_url.buf);
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "http_period", p_cfg_http->http_period);
+    switch (p_cfg_http->data_format)
+    {
+        case GW_CFG_HTTP_DATA_FORMAT_RUUVI:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "http_data_format", GW_CFG_HTTP_DATA_FORMAT_STR_RUUVI);
+            break;
+        case GW_CFG_HTTP_DATA_FORMAT_RUUVI_RAW_AND_DECODED:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "http_data_format", GW_CFG_HTTP_DATA_FORMAT_STR_RAW_AND_DECODED);
+            break;
+        case GW_CFG_HTTP_DATA_FORMAT_RUUVI_DECODED:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "http_data_format", GW_CFG_HTTP_DATA_FORMAT_STR_DECODED);
+            break;
+    }
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(
+        gw_cfg_json_stream_gen_http_custom_auth,
+        p_gen,
+        p_cfg_http,
+        flag_hide_passwords);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_http,
+    json_stream_gen_t* const         p_gen,
+    const ruuvi_gw_cfg_http_t* const p_cfg_http,
+    const bool                       flag_hide_passwords)
+{
+    // See gw_cfg_json_add_items_http: the default Ruuvi HTTP settings are always saved in the same (v1.14) form
+    // to ensure compatibility between configuration versions when upgrading or rolling back the firmware.
+    const bool flag_use_http_default = (p_cfg_http->use_http_ruuvi && (!p_cfg_http->use_http))
+                                       || (p_cfg_http->use_http
+                                           && (GW_CFG_HTTP_DATA_FORMAT_RUUVI == p_cfg_http->data_format)
+                                           && (GW_CFG_HTTP_AUTH_TYPE_NONE == p_cfg_http->auth_type)
+                                           && (0 == strcmp(RUUVI_GATEWAY_HTTP_DEFAULT_URL, p_cfg_http->http_url.buf)));
+    if (flag_use_http_default)
+    {
+        JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_http_default, p_gen);
+    }
+    else
+    {
+        JSON_STREAM_GEN_ADD_BOOL(p_gen, "use_http_ruuvi", p_cfg_http->use_http_ruuvi);
+        JSON_STREAM_GEN_ADD_BOOL(p_gen, "use_http", p_cfg_http->use_http);
+        if (p_cfg_http->use_http)
+        {
+            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(
+                gw_cfg_json_stream_gen_http_custom_params,
+                p_gen,
+                p_cfg_http,
+                flag_hide_passwords);
+        }
+    }
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_http_stat,
+    json_stream_gen_t* const              p_gen,
+    const ruuvi_gw_cfg_http_stat_t* const p_cfg_http_stat,
+    const bool                            flag_hide_passwords)
+{
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "use_http_stat", p_cfg_http_stat->use_http_stat);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "http_stat_url", p_cfg_http_stat->http_stat_url.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "http_stat_user", p_cfg_http_stat->http_stat_user.buf);
+    if (!flag_hide_passwords)
+    {
+        JSON_STREAM_GEN_ADD_STRING(p_gen, "http_stat_pass", p_cfg_http_stat->http_stat_pass.buf);
+    }
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "http_stat_use_ssl_client_cert", p_cfg_http_stat->http_stat_use_ssl_client_cert);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "http_stat_use_ssl_server_cert", p_cfg_http_stat->http_stat_use_ssl_server_cert);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_mqtt,
+    json_stream_gen_t* const         p_gen,
+    const ruuvi_gw_cfg_mqtt_t* const p_cfg_mqtt,
+    const bool                       flag_hide_passwords)
+{
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "use_mqtt", p_cfg_mqtt->use_mqtt);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "mqtt_disable_retained_messages", p_cfg_mqtt->mqtt_disable_retained_messages);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "mqtt_transport", p_cfg_mqtt->mqtt_transport.buf);
+    switch (p_cfg_mqtt->mqtt_data_format)
+    {
+        case GW_CFG_MQTT_DATA_FORMAT_RUUVI_RAW:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "mqtt_data_format", GW_CFG_MQTT_DATA_FORMAT_STR_RUUVI_RAW);
+            break;
+        case GW_CFG_MQTT_DATA_FORMAT_RUUVI_RAW_AND_DECODED:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "mqtt_data_format", GW_CFG_MQTT_DATA_FORMAT_STR_RAW_AND_DECODED);
+            break;
+        case GW_CFG_MQTT_DATA_FORMAT_RUUVI_DECODED:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "mqtt_data_format", GW_CFG_MQTT_DATA_FORMAT_STR_DECODED);
+            break;
+    }
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "mqtt_qos", p_cfg_mqtt->mqtt_qos);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "mqtt_server", p_cfg_mqtt->mqtt_server.buf);
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "mqtt_port", p_cfg_mqtt->mqtt_port);
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "mqtt_sending_interval", p_cfg_mqtt->mqtt_sending_interval);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "mqtt_prefix", p_cfg_mqtt->mqtt_prefix.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "mqtt_client_id", p_cfg_mqtt->mqtt_client_id.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "mqtt_user", p_cfg_mqtt->mqtt_user.buf);
+    if (!flag_hide_passwords)
+    {
+        JSON_STREAM_GEN_ADD_STRING(p_gen, "mqtt_pass", p_cfg_mqtt->mqtt_pass.buf);
+    }
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "mqtt_use_ssl_client_cert", p_cfg_mqtt->use_ssl_client_cert);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "mqtt_use_ssl_server_cert", p_cfg_mqtt->use_ssl_server_cert);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_lan_auth,
+    json_stream_gen_t* const             p_gen,
+    const ruuvi_gw_cfg_lan_auth_t* const p_cfg_lan_auth,
+    const bool                           flag_hide_passwords)
+{
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "lan_auth_type", gw_cfg_auth_type_to_str(p_cfg_lan_auth));
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "lan_auth_user", p_cfg_lan_auth->lan_auth_user.buf);
+    if (flag_hide_passwords)
+    {
+        JSON_STREAM_GEN_ADD_BOOL(
+            p_gen,
+            "lan_auth_api_key_use",
+            ('\0' != p_cfg_lan_auth->lan_auth_api_key.buf[0]) ? true : false);
+        JSON_STREAM_GEN_ADD_BOOL(
+            p_gen,
+            "lan_auth_api_key_rw_use",
+            ('\0' != p_cfg_lan_auth->lan_auth_api_key_rw.buf[0]) ? true : false);
+    }
+    else
+    {
+        switch (p_cfg_lan_auth->lan_auth_type)
+        {
+            case HTTP_SERVER_AUTH_TYPE_BASIC:
+            case HTTP_SERVER_AUTH_TYPE_DIGEST:
+            case HTTP_SERVER_AUTH_TYPE_RUUVI:
+                JSON_STREAM_GEN_ADD_STRING(p_gen, "lan_auth_pass", p_cfg_lan_auth->lan_auth_pass.buf);
+                break;
+            default:
+                break;
+        }
+        JSON_STREAM_GEN_ADD_STRING(p_gen, "lan_auth_api_key", p_cfg_lan_auth->lan_auth_api_key.buf);
+        JSON_STREAM_GEN_ADD_STRING(p_gen, "lan_auth_api_key_rw", p_cfg_lan_auth->lan_auth_api_key_rw.buf);
+    }
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static const char*
+gw_cfg_json_stream_gen_conv_auto_update_cycle_to_str(const auto_update_cycle_type_e auto_update_cycle)
+{
+    switch (auto_update_cycle)
+    {
+        case AUTO_UPDATE_CYCLE_TYPE_REGULAR:
+            return AUTO_UPDATE_CYCLE_TYPE_STR_REGULAR;
+        case AUTO_UPDATE_CYCLE_TYPE_BETA_TESTER:
+            return AUTO_UPDATE_CYCLE_TYPE_STR_BETA_TESTER;
+        case AUTO_UPDATE_CYCLE_TYPE_MANUAL:
+            return AUTO_UPDATE_CYCLE_TYPE_STR_MANUAL;
+    }
+    return AUTO_UPDATE_CYCLE_TYPE_STR_REGULAR;
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_auto_update,
+    json_stream_gen_t* const                p_gen,
+    const ruuvi_gw_cfg_auto_update_t* const p_cfg_auto_update)
+{
+    JSON_STREAM_GEN_ADD_STRING(
+        p_gen,
+        "auto_update_cycle",
+        gw_cfg_json_stream_gen_conv_auto_update_cycle_to_str(p_cfg_auto_update->auto_update_cycle));
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "auto_update_weekdays_bitmask", p_cfg_auto_update->auto_update_weekdays_bitmask);
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "auto_update_interval_from", p_cfg_auto_update->auto_update_interval_from);
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "auto_update_interval_to", p_cfg_auto_update->auto_update_interval_to);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "auto_update_tz_offset_hours", p_cfg_auto_update->auto_update_tz_offset_hours);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_ntp,
+    json_stream_gen_t* const        p_gen,
+    const ruuvi_gw_cfg_ntp_t* const p_cfg_ntp)
+{
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "ntp_use", p_cfg_ntp->ntp_use);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "ntp_use_dhcp", p_cfg_ntp->ntp_use_dhcp);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "ntp_server1", p_cfg_ntp->ntp_server1.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "ntp_server2", p_cfg_ntp->ntp_server2.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "ntp_server3", p_cfg_ntp->ntp_server3.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "ntp_server4", p_cfg_ntp->ntp_server4.buf);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_filter_and_scan,
+    json_stream_gen_t* const    p_gen,
+    const gw_cfg_ruuvi_t* const p_ruuvi_cfg)
+{
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "company_id", p_ruuvi_cfg->filter.company_id);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "company_use_filtering", p_ruuvi_cfg->filter.company_use_filtering);
+
+    const ruuvi_gw_cfg_scan_t* const p_cfg_scan = &p_ruuvi_cfg->scan;
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "scan_coded_phy", p_cfg_scan->scan_coded_phy);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "scan_1mbit_phy", p_cfg_scan->scan_1mbit_phy);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "scan_2mbit_phy", p_cfg_scan->scan_2mbit_phy);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "scan_channel_37", p_cfg_scan->scan_channel_37);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "scan_channel_38", p_cfg_scan->scan_channel_38);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "scan_channel_39", p_cfg_scan->scan_channel_39);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "scan_default", p_cfg_scan->scan_default);
+
+    const ruuvi_gw_cfg_scan_filter_t* const p_cfg_scan_filter = &p_ruuvi_cfg->scan_filter;
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "scan_filter_allow_listed", p_cfg_scan_filter->scan_filter_allow_listed);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "scan_filter_list");
+    for (uint32_t i = 0; i < p_cfg_scan_filter->scan_filter_length; ++i)
+    {
+        const mac_address_str_t mac_addr_str = mac_address_to_str(&p_cfg_scan_filter->scan_filter_list[i]);
+        JSON_STREAM_GEN_ADD_STRING(p_gen, NULL, mac_addr_str.str_buf);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_adv_filter,
+    json_stream_gen_t* const               p_gen,
+    const ruuvi_gw_cfg_adv_filter_t* const p_cfg_adv_filter)
+{
+    char hex_str[(GW_CFG_ADV_FILTER_PREFIX_MAX_LEN * 2U) + 1U];
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "adv_filter_rules");
+    for (uint32_t i = 0; i < p_cfg_adv_filter->num_rules; ++i)
+    {
+        const ruuvi_gw_cfg_adv_filter_rule_t* const p_rule = &p_cfg_adv_filter->rules[i];
+        JSON_STREAM_GEN_START_OBJECT(p_gen, NULL);
+        if (p_rule->use_manufacturer_id)
+        {
+            JSON_STREAM_GEN_ADD_UINT32(p_gen, "manufacturer_id", p_rule->manufacturer_id);
+        }
+        if (p_rule->use_data_format)
+        {
+            JSON_STREAM_GEN_ADD_UINT32(p_gen, "data_format", p_rule->data_format);
+        }
+        if (p_rule->use_rssi_min)
+        {
+            JSON_STREAM_GEN_ADD_INT32(p_gen, "rssi_min", p_rule->rssi_min);
+        }
+        if (p_rule->use_mac_oui)
+        {
+            (void)fmt_fast_hex(hex_str, sizeof(hex_str), p_rule->mac_oui, sizeof(p_rule->mac_oui));
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "mac_oui", hex_str);
+        }
+        if (0 != p_rule->payload_prefix_len)
+        {
+            (void)fmt_fast_hex(hex_str, sizeof(hex_str), p_rule->payload_prefix, p_rule->payload_prefix_len);
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "payload_prefix", hex_str);
+            (void)fmt_fast_hex(hex_str, sizeof(hex_str), p_rule->payload_mask, p_rule->payload_prefix_len);
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "payload_mask", hex_str);
+        }
+        JSON_STREAM_GEN_END_OBJECT(p_gen);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_adv_aggr,
+    json_stream_gen_t* const             p_gen,
+    const ruuvi_gw_cfg_adv_aggr_t* const p_cfg_adv_aggr)
+{
+    switch (p_cfg_adv_aggr->mode)
+    {
+        case GW_CFG_ADV_AGGR_MODE_NONE:
+            // The aggregation is optional, so the keys are omitted if it's not in use
+            break;
+        case GW_CFG_ADV_AGGR_MODE_DOWNSAMPLE:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "adv_aggr_mode", GW_CFG_ADV_AGGR_MODE_STR_DOWNSAMPLE);
+            JSON_STREAM_GEN_ADD_UINT32(p_gen, "adv_aggr_period", p_cfg_adv_aggr->period_seconds);
+            break;
+        case GW_CFG_ADV_AGGR_MODE_WINDOW:
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "adv_aggr_mode", GW_CFG_ADV_AGGR_MODE_STR_WINDOW);
+            JSON_STREAM_GEN_ADD_UINT32(p_gen, "adv_aggr_period", p_cfg_adv_aggr->period_seconds);
+            break;
+    }
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    gw_cfg_json_stream_gen_adv_trigger,
+    json_stream_gen_t* const                p_gen,
+    const ruuvi_gw_cfg_adv_trigger_t* const p_cfg_adv_trigger)
+{
+    // The rules are optional, so the keys are omitted for the rules which are not in use
+    if (p_cfg_adv_trigger->on_movement)
+    {
+        JSON_STREAM_GEN_ADD_BOOL(p_gen, "adv_trigger_movement", true);
+    }
+    if (p_cfg_adv_trigger->use_temperature_low)
+    {
+        JSON_STREAM_GEN_ADD_INT32(p_gen, "adv_trigger_temperature_low", p_cfg_adv_trigger->temperature_low);
+    }
+    if (p_cfg_adv_trigger->use_temperature_high)
+    {
+        JSON_STREAM_GEN_ADD_INT32(p_gen, "adv_trigger_temperature_high", p_cfg_adv_trigger->temperature_high);
+    }
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static json_stream_gen_callback_result_t
+gw_cfg_json_stream_gen_cb(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    const gw_cfg_json_stream_gen_ctx_t* const p_ctx       = p_user_ctx;
+    const gw_cfg_t* const                     p_cfg       = &p_ctx->gw_cfg;
+    const bool                                flag_hidden = p_ctx->flag_hide_passwords_and_add_device_info;
+
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    if (flag_hidden)
+    {
+        JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_device_info, p_gen, p_ctx);
+    }
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_wifi, p_gen, &p_cfg->wifi_cfg, flag_hidden);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_eth, p_gen, &p_cfg->eth_cfg);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(
+        gw_cfg_json_stream_gen_remote,
+        p_gen,
+        &p_cfg->ruuvi_cfg.remote,
+        flag_hidden);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_http, p_gen, &p_cfg->ruuvi_cfg.http, flag_hidden);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(
+        gw_cfg_json_stream_gen_http_stat,
+        p_gen,
+        &p_cfg->ruuvi_cfg.http_stat,
+        flag_hidden);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_mqtt, p_gen, &p_cfg->ruuvi_cfg.mqtt, flag_hidden);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(
+        gw_cfg_json_stream_gen_lan_auth,
+        p_gen,
+        &p_cfg->ruuvi_cfg.lan_auth,
+        flag_hidden);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_auto_update, p_gen, &p_cfg->ruuvi_cfg.auto_update);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_ntp, p_gen, &p_cfg->ruuvi_cfg.ntp);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_filter_and_scan, p_gen, &p_cfg->ruuvi_cfg);
+    if (0 != p_cfg->ruuvi_cfg.adv_filter.num_rules)
+    {
+        // The rules are optional, so the key is omitted if there are no rules
+        JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_adv_filter, p_gen, &p_cfg->ruuvi_cfg.adv_filter);
+    }
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_adv_aggr, p_gen, &p_cfg->ruuvi_cfg.adv_aggr);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(gw_cfg_json_stream_gen_adv_trigger, p_gen, &p_cfg->ruuvi_cfg.adv_trigger);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "coordinates", p_cfg->ruuvi_cfg.coordinates.buf);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "fw_update_url", p_cfg->ruuvi_cfg.fw_update.fw_update_url);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static json_stream_gen_t*
+gw_cfg_json_stream_gen_create(const gw_cfg_t* const p_gw_cfg, const bool flag_hide_passwords_and_add_device_info)
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size      = GW_CFG_JSON_STREAM_GEN_MAX_CHUNK_SIZE,
+        .flag_formatted_json = false,
+        .indentation_mark    = ' ',
+        .indentation         = 0,
+        .max_nesting_level   = GW_CFG_JSON_STREAM_GEN_MAX_NESTING_LEVEL,
+        .p_malloc            = HEAP_PROF_FN_MALLOC_JSON_STREAM_GEN,
+        .p_free              = HEAP_PROF_FN_FREE,
+        .p_localeconv        = NULL,
+    };
+    gw_cfg_json_stream_gen_ctx_t* p_ctx = NULL;
+    json_stream_gen_t*            p_gen = json_stream_gen_create(
+        &cfg,
+        &gw_cfg_json_stream_gen_cb,
+        sizeof(*p_ctx),
+        (void**)&p_ctx);
+    if (NULL == p_gen)
+    {
+        LOG_ERR("Not enough memory");
+        return NULL;
+    }
+    p_ctx->gw_cfg                                  = *p_gw_cfg;
+    p_ctx->flag_hide_passwords_and_add_device_info = flag_hide_passwords_and_add_device_info;
+    p_ctx->flag_storage_ready                      = false;
+    memset(p_ctx->storage_files, 0, sizeof(p_ctx->storage_files));
+    if (flag_hide_passwords_and_add_device_info)
+    {
+        // The generator callback is re-entered for every chunk, so the state of the storage is sampled only once
+        // to guarantee consistent output.
+        p_ctx->flag_storage_ready = gw_cfg_storage_check();
+        for (uint32_t i = 0; p_ctx->flag_storage_ready && (i < GW_CFG_STORAGE_NUM_ALLOWED_FILES); ++i)
+        {
+            p_ctx->storage_files[i] = gw_cfg_storage_check_file(g_gw_cfg_storage_list_of_allowed_files[i]);
+        }
+    }
+    return p_gen;
+}
+
+json_stream_gen_t*
+gw_cfg_json_stream_gen_create_for_saving(const gw_cfg_t* const p_gw_cfg)
+{
+    const bool flag_hide_passwords_and_add_device_info = false;
+    return gw_cfg_json_stream_gen_create(p_gw_cfg, flag_hide_passwords_and_add_device_info);
+}
+
+json_stream_gen_t*
+gw_cfg_json_stream_gen_create_for_ui_client(const gw_cfg_t* const p_gw_cfg)
+{
+    const bool flag_hide_passwords_and_add_device_info = true;
+    return gw_cfg_json_stream_gen_create(p_gw_cfg, flag_hide_passwords_and_add_device_info);
+}
+
+static bool
+gw_cfg_json_stream_gen_print_chunks(json_stream_gen_t* const p_gen, str_buf_t* const p_str_buf)
+{
+    json_stream_gen_reset(p_gen);
+    while (true)
+    {
+        const char* const p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if (NULL == p_chunk)
+        {
+            LOG_ERR("Error while json generation (exceeding the nesting level, etc.)");
+            json_stream_gen_reset(p_gen);
+            return false;
+        }
+        if ('\0' == *p_chunk)
+        {
+            break;
+        }
+        str_buf_printf(p_str_buf, "%s", p_chunk);
+    }
+    json_stream_gen_reset(p_gen);
+    return true;
+}
+
+str_buf_t
+gw_cfg_json_stream_gen_to_str(json_stream_gen_t* const p_gen)
+{
+    str_buf_t str_buf = STR_BUF_INIT_NULL();
+    // The first pass calculates the length of json, the second one fills the buffer of the exact size.
+    if (!gw_cfg_json_stream_gen_print_chunks(p_gen, &str_buf))
+    {
+        return str_buf_init_null();
+    }
+    if (!str_buf_init_with_alloc(&str_buf))
+    {
+        LOG_ERR("Can't allocate memory for json");
+        return str_buf_init_null();
+    }
+    if (!gw_cfg_json_stream_gen_print_chunks(p_gen, &str_buf))
+    {
+        str_buf_free_buf(&str_buf);
+        return str_buf_init_null();
+    }
+    return str_buf;
+}
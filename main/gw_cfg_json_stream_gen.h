@@ -0,0 +1,53 @@
+/**
+ * @file gw_cfg_json_stream_gen.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_GW_CFG_JSON_STREAM_GEN_H
+#define RUUVI_GATEWAY_ESP_GW_CFG_JSON_STREAM_GEN_H
+
+#include <stdbool.h>
+#include "gw_cfg.h"
+#include "json_stream_gen.h"
+#include "str_buf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GW_CFG_JSON_STREAM_GEN_MAX_CHUNK_SIZE (512U)
+
+/**
+ * @brief Create a streaming generator of gw_cfg json which is used for saving the configuration to NVS.
+ * @note The generator works on its own copy of gw_cfg, so gw_cfg can be unlocked right after this call.
+ * @param p_gw_cfg - pointer to gw_cfg.
+ * @return pointer to the generator (it should be deleted with json_stream_gen_delete) or NULL if out of memory.
+ */
+json_stream_gen_t*
+gw_cfg_json_stream_gen_create_for_saving(const gw_cfg_t* const p_gw_cfg);
+
+/**
+ * @brief Create a streaming generator of gw_cfg json for the UI client (ruuvi.json, metrics):
+ *        passwords are hidden and the device info is added.
+ * @note /ruuvi.json is served by this generator, so its hash in /metrics matches the served bytes.
+ * @param p_gw_cfg - pointer to gw_cfg.
+ * @return pointer to the generator (it should be deleted with json_stream_gen_delete) or NULL if out of memory.
+ */
+json_stream_gen_t*
+gw_cfg_json_stream_gen_create_for_ui_client(const gw_cfg_t* const p_gw_cfg);
+
+/**
+ * @brief Generate the whole json into a single heap buffer of the exact size.
+ * @param p_gen - pointer to the generator (it is reset after the call).
+ * @return str_buf_t with the allocated buffer (it should be freed with str_buf_free_buf) or NULL buffer on error.
+ */
+str_buf_t
+gw_cfg_json_stream_gen_to_str(json_stream_gen_t* const p_gen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_GW_CFG_JSON_STREAM_GEN_H
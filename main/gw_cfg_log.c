@@ -436,6 +436,7 @@ gw_cfg_log_ruuvi_cfg_mqtt(const ruuvi_gw_cfg_mqtt_t* const p_mqtt)
             LOG_INFO("config: mqtt data format: %s", GW_CFG_MQTT_DATA_FORMAT_STR_DECODED);
             break;
     }
+    LOG_INFO("config: mqtt QoS: %u", (printf_uint_t)p_mqtt->mqtt_qos);
     LOG_INFO("config: mqtt server: %s", p_mqtt->mqtt_server.buf);
     LOG_INFO("config: mqtt port: %u", p_mqtt->mqtt_port);
     LOG_INFO("config: mqtt sending interval: %lu", (printf_ulong_t)p_mqtt->mqtt_sending_interval);
@@ -551,6 +552,78 @@ gw_cfg_log_ruuvi_cfg_scan_filter(const ruuvi_gw_cfg_scan_filter_t* const p_scan_
     }
 }
 
+static void
+gw_cfg_log_ruuvi_cfg_adv_filter(const ruuvi_gw_cfg_adv_filter_t* const p_adv_filter)
+{
+    // The rules are optional, so nothing is printed if there are no rules
+    for (uint32_t i = 0; i < p_adv_filter->num_rules; ++i)
+    {
+        const ruuvi_gw_cfg_adv_filter_rule_t* const p_rule = &p_adv_filter->rules[i];
+        LOG_INFO(
+            "config: adv filter rule [%2u]: use manufacturer_id: %d, manufacturer_id: 0x%04x",
+            (printf_uint_t)i,
+            p_rule->use_manufacturer_id,
+            (printf_uint_t)p_rule->manufacturer_id);
+        LOG_INFO(
+            "config: adv filter rule [%2u]: use data_format: %d, data_format: 0x%02x",
+            (printf_uint_t)i,
+            p_rule->use_data_format,
+            (printf_uint_t)p_rule->data_format);
+        LOG_INFO(
+            "config: adv filter rule [%2u]: use rssi_min: %d, rssi_min: %d",
+            (printf_uint_t)i,
+            p_rule->use_rssi_min,
+            (printf_int_t)p_rule->rssi_min);
+        LOG_INFO(
+            "config: adv filter rule [%2u]: use mac_oui: %d, mac_oui: %02X:%02X:%02X",
+            (printf_uint_t)i,
+            p_rule->use_mac_oui,
+            (printf_uint_t)p_rule->mac_oui[0],
+            (printf_uint_t)p_rule->mac_oui[1],
+            (printf_uint_t)p_rule->mac_oui[2]);
+        LOG_INFO(
+            "config: adv filter rule [%2u]: payload_prefix_len: %u",
+            (printf_uint_t)i,
+            (printf_uint_t)p_rule->payload_prefix_len);
+    }
+}
+
+static void
+gw_cfg_log_ruuvi_cfg_adv_aggr(const ruuvi_gw_cfg_adv_aggr_t* const p_adv_aggr)
+{
+    // Nothing is printed if the aggregation is not in use to keep the log of the default configuration unchanged
+    switch (p_adv_aggr->mode)
+    {
+        case GW_CFG_ADV_AGGR_MODE_NONE:
+            return;
+        case GW_CFG_ADV_AGGR_MODE_DOWNSAMPLE:
+            LOG_INFO("config: adv aggr mode: %s", GW_CFG_ADV_AGGR_MODE_STR_DOWNSAMPLE);
+            break;
+        case GW_CFG_ADV_AGGR_MODE_WINDOW:
+            LOG_INFO("config: adv aggr mode: %s", GW_CFG_ADV_AGGR_MODE_STR_WINDOW);
+            break;
+    }
+    LOG_INFO("config: adv aggr period: %u", (printf_uint_t)p_adv_aggr->period_seconds);
+}
+
+static void
+gw_cfg_log_ruuvi_cfg_adv_trigger(const ruuvi_gw_cfg_adv_trigger_t* const p_adv_trigger)
+{
+    // Nothing is printed for the rules which are not in use to keep the log of the default configuration unchanged
+    if (p_adv_trigger->on_movement)
+    {
+        LOG_INFO("config: adv trigger on movement: %s", "yes");
+    }
+    if (p_adv_trigger->use_temperature_low)
+    {
+        LOG_INFO("config: adv trigger temperature low: %d", (printf_int_t)p_adv_trigger->temperature_low);
+    }
+    if (p_adv_trigger->use_temperature_high)
+    {
+        LOG_INFO("config: adv trigger temperature high: %d", (printf_int_t)p_adv_trigger->temperature_high);
+    }
+}
+
 static void
 gw_cfg_log_ruuvi_cfg_fw_update(const ruuvi_gw_cfg_fw_update_t* const p_fw_update)
 {
@@ -575,6 +648,9 @@ gw_cfg_log_ruuvi_cfg(const gw_cfg_ruuvi_t* const p_gw_cfg_ruuvi, const char* con
     gw_cfg_log_ruuvi_cfg_filter(&p_gw_cfg_ruuvi->filter);
     gw_cfg_log_ruuvi_cfg_scan(&p_gw_cfg_ruuvi->scan);
     gw_cfg_log_ruuvi_cfg_scan_filter(&p_gw_cfg_ruuvi->scan_filter);
+    gw_cfg_log_ruuvi_cfg_adv_filter(&p_gw_cfg_ruuvi->adv_filter);
+    gw_cfg_log_ruuvi_cfg_adv_aggr(&p_gw_cfg_ruuvi->adv_aggr);
+    gw_cfg_log_ruuvi_cfg_adv_trigger(&p_gw_cfg_ruuvi->adv_trigger);
     LOG_INFO("config: coordinates: %s", p_gw_cfg_ruuvi->coordinates.buf);
     gw_cfg_log_ruuvi_cfg_fw_update(&p_gw_cfg_ruuvi->fw_update);
 }
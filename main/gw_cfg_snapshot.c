@@ -0,0 +1,126 @@
+/**
+ * @file gw_cfg_snapshot.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "gw_cfg_snapshot.h"
+#include <string.h>
+#include <esp_crc.h>
+
+static uint32_t
+gw_cfg_snapshot_calc_crc32(const gw_cfg_snapshot_t* const p_snapshot)
+{
+    return esp_crc32_le(0, (const uint8_t*)p_snapshot, offsetof(gw_cfg_snapshot_t, crc32));
+}
+
+uint32_t
+gw_cfg_snapshot_calc_defaults_crc32(const gw_cfg_t* const p_gw_cfg_default)
+{
+    return esp_crc32_le(0, (const uint8_t*)p_gw_cfg_default, sizeof(*p_gw_cfg_default));
+}
+
+gw_cfg_snapshot_json_id_t
+gw_cfg_snapshot_calc_json_id(const char* const p_json_str)
+{
+    const uint32_t json_size = (uint32_t)strlen(p_json_str) + 1U;
+    return (gw_cfg_snapshot_json_id_t) {
+        .json_size  = json_size,
+        .json_crc32 = esp_crc32_le(0, (const uint8_t*)p_json_str, json_size),
+    };
+}
+
+bool
+gw_cfg_snapshot_is_json_id_equal(
+    const gw_cfg_snapshot_json_id_t* const p_json_id1,
+    const gw_cfg_snapshot_json_id_t* const p_json_id2)
+{
+    if ((p_json_id1->json_size != p_json_id2->json_size) || (p_json_id1->json_crc32 != p_json_id2->json_crc32))
+    {
+        return false;
+    }
+    return true;
+}
+
+void
+gw_cfg_snapshot_create(
+    const gw_cfg_t* const                  p_gw_cfg,
+    const uint32_t                         defaults_crc32,
+    const gw_cfg_snapshot_json_id_t* const p_json_id,
+    gw_cfg_snapshot_t* const               p_snapshot)
+{
+    // Clear the padding bytes, otherwise the CRC of two identical snapshots would differ
+    memset(p_snapshot, 0, sizeof(*p_snapshot));
+    p_snapshot->magic                = GW_CFG_SNAPSHOT_MAGIC;
+    p_snapshot->fmt_version          = GW_CFG_SNAPSHOT_FMT_VERSION;
+    p_snapshot->payload_size         = (uint32_t)sizeof(p_snapshot->payload);
+    p_snapshot->defaults_crc32       = defaults_crc32;
+    p_snapshot->json_id              = *p_json_id;
+    p_snapshot->payload.ruuvi_cfg    = p_gw_cfg->ruuvi_cfg;
+    p_snapshot->payload.eth_cfg      = p_gw_cfg->eth_cfg;
+    p_snapshot->payload.wifi_cfg_ap  = p_gw_cfg->wifi_cfg.ap;
+    p_snapshot->payload.wifi_cfg_sta = p_gw_cfg->wifi_cfg.sta;
+    p_snapshot->crc32                = gw_cfg_snapshot_calc_crc32(p_snapshot);
+}
+
+gw_cfg_snapshot_status_e
+gw_cfg_snapshot_check(
+    const gw_cfg_snapshot_t* const         p_snapshot,
+    const size_t                           snapshot_size,
+    const uint32_t                         defaults_crc32,
+    const gw_cfg_snapshot_json_id_t* const p_json_id)
+{
+    if (sizeof(*p_snapshot) != snapshot_size)
+    {
+        return GW_CFG_SNAPSHOT_STATUS_INVALID_SIZE;
+    }
+    if ((GW_CFG_SNAPSHOT_MAGIC != p_snapshot->magic) || (GW_CFG_SNAPSHOT_FMT_VERSION != p_snapshot->fmt_version)
+        || (sizeof(p_snapshot->payload) != p_snapshot->payload_size))
+    {
+        return GW_CFG_SNAPSHOT_STATUS_INVALID_HEADER;
+    }
+    if (gw_cfg_snapshot_calc_crc32(p_snapshot) != p_snapshot->crc32)
+    {
+        return GW_CFG_SNAPSHOT_STATUS_INVALID_CRC;
+    }
+    if (defaults_crc32 != p_snapshot->defaults_crc32)
+    {
+        return GW_CFG_SNAPSHOT_STATUS_DEFAULTS_CHANGED;
+    }
+    if (!gw_cfg_snapshot_is_json_id_equal(p_json_id, &p_snapshot->json_id))
+    {
+        return GW_CFG_SNAPSHOT_STATUS_JSON_CHANGED;
+    }
+    return GW_CFG_SNAPSHOT_STATUS_OK;
+}
+
+void
+gw_cfg_snapshot_apply(const gw_cfg_snapshot_t* const p_snapshot, gw_cfg_t* const p_gw_cfg)
+{
+    p_gw_cfg->ruuvi_cfg    = p_snapshot->payload.ruuvi_cfg;
+    p_gw_cfg->eth_cfg      = p_snapshot->payload.eth_cfg;
+    p_gw_cfg->wifi_cfg.ap  = p_snapshot->payload.wifi_cfg_ap;
+    p_gw_cfg->wifi_cfg.sta = p_snapshot->payload.wifi_cfg_sta;
+}
+
+const char*
+gw_cfg_snapshot_status_to_str(const gw_cfg_snapshot_status_e status)
+{
+    switch (status)
+    {
+        case GW_CFG_SNAPSHOT_STATUS_OK:
+            return "OK";
+        case GW_CFG_SNAPSHOT_STATUS_INVALID_SIZE:
+            return "invalid size";
+        case GW_CFG_SNAPSHOT_STATUS_INVALID_HEADER:
+            return "invalid header";
+        case GW_CFG_SNAPSHOT_STATUS_INVALID_CRC:
+            return "invalid CRC";
+        case GW_CFG_SNAPSHOT_STATUS_DEFAULTS_CHANGED:
+            return "default config changed";
+        case GW_CFG_SNAPSHOT_STATUS_JSON_CHANGED:
+            return "config-json changed";
+    }
+    return "unknown";
+}
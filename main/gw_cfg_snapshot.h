@@ -0,0 +1,125 @@
+/**
+ * @file gw_cfg_snapshot.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_GW_CFG_SNAPSHOT_H
+#define RUUVI_GATEWAY_ESP_GW_CFG_SNAPSHOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "gw_cfg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GW_CFG_SNAPSHOT_MAGIC       (0x53434752U) /* "RGCS" */
+#define GW_CFG_SNAPSHOT_FMT_VERSION (2U)
+
+/**
+ * @brief Identifier of the config-json from which the snapshot was made.
+ * @note It's stored in NVS next to the config-json, so the snapshot can be checked on boot
+ *       without reading the config-json: it's enough to compare the size of the config-json in NVS with json_size.
+ */
+typedef struct gw_cfg_snapshot_json_id_t
+{
+    uint32_t json_size; // The size of the config-json in NVS (including the terminating '\0')
+    uint32_t json_crc32;
+} gw_cfg_snapshot_json_id_t;
+
+/**
+ * @brief The parts of gw_cfg_t which are restored from config-json by gw_cfg_json_parse.
+ */
+typedef struct gw_cfg_snapshot_payload_t
+{
+    gw_cfg_ruuvi_t       ruuvi_cfg;
+    gw_cfg_eth_t         eth_cfg;
+    wifiman_config_ap_t  wifi_cfg_ap;
+    wifiman_config_sta_t wifi_cfg_sta;
+} gw_cfg_snapshot_payload_t;
+
+/**
+ * @brief Binary snapshot of the parsed config-json which is stored in NVS next to the config-json.
+ * @note The snapshot is valid only for the same default configuration (see @ref gw_cfg_snapshot_calc_defaults_crc32),
+ *       the default configuration includes the firmware versions, so any firmware update invalidates the snapshot
+ *       and it's re-created from config-json (this also protects against changes in the layout of gw_cfg_t).
+ */
+typedef struct gw_cfg_snapshot_t
+{
+    uint32_t                  magic;
+    uint32_t                  fmt_version;
+    uint32_t                  payload_size;
+    uint32_t                  defaults_crc32;
+    gw_cfg_snapshot_json_id_t json_id;
+    gw_cfg_snapshot_payload_t payload;
+    uint32_t                  crc32;
+} gw_cfg_snapshot_t;
+
+typedef enum gw_cfg_snapshot_status_e
+{
+    GW_CFG_SNAPSHOT_STATUS_OK,
+    GW_CFG_SNAPSHOT_STATUS_INVALID_SIZE,
+    GW_CFG_SNAPSHOT_STATUS_INVALID_HEADER,
+    GW_CFG_SNAPSHOT_STATUS_INVALID_CRC,
+    GW_CFG_SNAPSHOT_STATUS_DEFAULTS_CHANGED,
+    GW_CFG_SNAPSHOT_STATUS_JSON_CHANGED,
+} gw_cfg_snapshot_status_e;
+
+/**
+ * @brief Calculate CRC32 of the default configuration which is used to fill the missing keys when parsing config-json.
+ * @param p_gw_cfg_default - pointer to the default configuration (filled by gw_cfg_default_get).
+ * @return CRC32
+ */
+uint32_t
+gw_cfg_snapshot_calc_defaults_crc32(const gw_cfg_t* const p_gw_cfg_default);
+
+/**
+ * @brief Calculate the identifier of config-json.
+ * @param p_json_str - pointer to config-json.
+ * @return @ref gw_cfg_snapshot_json_id_t
+ */
+gw_cfg_snapshot_json_id_t
+gw_cfg_snapshot_calc_json_id(const char* const p_json_str);
+
+bool
+gw_cfg_snapshot_is_json_id_equal(
+    const gw_cfg_snapshot_json_id_t* const p_json_id1,
+    const gw_cfg_snapshot_json_id_t* const p_json_id2);
+
+void
+gw_cfg_snapshot_create(
+    const gw_cfg_t* const                  p_gw_cfg,
+    const uint32_t                         defaults_crc32,
+    const gw_cfg_snapshot_json_id_t* const p_json_id,
+    gw_cfg_snapshot_t* const               p_snapshot);
+
+/**
+ * @brief Check that the snapshot read from NVS can be used instead of parsing config-json.
+ * @param p_snapshot - pointer to the snapshot.
+ * @param snapshot_size - size of the data read from NVS.
+ * @param defaults_crc32 - CRC32 of the current default configuration.
+ * @param p_json_id - identifier of the config-json currently stored in NVS.
+ * @return @ref GW_CFG_SNAPSHOT_STATUS_OK if the snapshot is valid.
+ */
+gw_cfg_snapshot_status_e
+gw_cfg_snapshot_check(
+    const gw_cfg_snapshot_t* const         p_snapshot,
+    const size_t                           snapshot_size,
+    const uint32_t                         defaults_crc32,
+    const gw_cfg_snapshot_json_id_t* const p_json_id);
+
+void
+gw_cfg_snapshot_apply(const gw_cfg_snapshot_t* const p_snapshot, gw_cfg_t* const p_gw_cfg);
+
+const char*
+gw_cfg_snapshot_status_to_str(const gw_cfg_snapshot_status_e status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_GW_CFG_SNAPSHOT_H
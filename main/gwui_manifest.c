@@ -0,0 +1,162 @@
+/**
+ * @file gwui_manifest.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "gwui_manifest.h"
+#include <string.h>
+#include "os_malloc.h"
+#include "os_str.h"
+
+#if defined(RUUVI_TESTS)
+#define LOG_LOCAL_DISABLED 1
+#endif
+#define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
+#include "log.h"
+
+static const char TAG[] = "gwui_manifest";
+
+static gwui_manifest_t* g_p_gwui_manifest;
+
+static const char*
+gwui_manifest_skip_spaces(const char* p_str)
+{
+    while ((' ' == *p_str) || ('\t' == *p_str))
+    {
+        p_str += 1;
+    }
+    return p_str;
+}
+
+static const char*
+gwui_manifest_find_end_of_token(const char* p_str)
+{
+    while (('\0' != *p_str) && (' ' != *p_str) && ('\t' != *p_str) && ('\r' != *p_str) && ('\n' != *p_str))
+    {
+        p_str += 1;
+    }
+    return p_str;
+}
+
+GWUI_MANIFEST_STATIC
+bool
+gwui_manifest_parse_line(const char* const p_line, gwui_manifest_entry_t* const p_entry)
+{
+    const char*  p_token     = gwui_manifest_skip_spaces(p_line);
+    const char*  p_token_end = gwui_manifest_find_end_of_token(p_token);
+    const size_t name_len    = (size_t)(p_token_end - p_token);
+    if ((0 == name_len) || (name_len >= sizeof(p_entry->file_name)))
+    {
+        return false;
+    }
+    memcpy(p_entry->file_name, p_token, name_len);
+    p_entry->file_name[name_len] = '\0';
+
+    p_token                  = gwui_manifest_skip_spaces(p_token_end);
+    const char*    end       = NULL;
+    const uint32_t file_size = os_str_to_uint32_cptr(p_token, &end, 10);
+    if ((end == p_token) || ((' ' != *end) && ('\t' != *end)))
+    {
+        return false;
+    }
+    p_entry->file_size = file_size;
+
+    p_token = gwui_manifest_skip_spaces(end);
+    if (('0' != p_token[0]) && ('1' != p_token[0]))
+    {
+        return false;
+    }
+    p_entry->flag_immutable = ('1' == p_token[0]) ? true : false;
+    p_token                 = gwui_manifest_skip_spaces(&p_token[1]);
+    if (('\0' != *p_token) && ('\r' != *p_token) && ('\n' != *p_token))
+    {
+        return false;
+    }
+    return true;
+}
+
+GWUI_MANIFEST_STATIC
+int32_t
+gwui_manifest_parse_file(FILE* p_fd, gwui_manifest_t* const p_manifest)
+{
+    p_manifest->num_files = 0;
+
+    char    line_buf[112];
+    int32_t line_cnt = 0;
+    while (NULL != fgets(line_buf, sizeof(line_buf), p_fd))
+    {
+        line_cnt += 1;
+        if (p_manifest->num_files >= GWUI_MANIFEST_MAX_NUM_FILES)
+        {
+            return line_cnt;
+        }
+        if (!gwui_manifest_parse_line(line_buf, &p_manifest->files[p_manifest->num_files]))
+        {
+            return line_cnt;
+        }
+        p_manifest->num_files += 1;
+    }
+    return 0;
+}
+
+bool
+gwui_manifest_init(const flash_fat_fs_t* const p_ffs)
+{
+    gwui_manifest_deinit();
+
+    const bool flag_use_binary_mode = false;
+    FILE*      p_fd                 = flashfatfs_fopen(p_ffs, GWUI_MANIFEST_FILE_NAME, flag_use_binary_mode);
+    if (NULL == p_fd)
+    {
+        LOG_WARN("There is no %s, HTTP caching of GWUI files is disabled", GWUI_MANIFEST_FILE_NAME);
+        return false;
+    }
+    gwui_manifest_t* p_manifest = os_calloc(1, sizeof(*p_manifest));
+    if (NULL == p_manifest)
+    {
+        LOG_ERR("Can't allocate memory");
+        fclose(p_fd);
+        return false;
+    }
+    const int32_t err_line_num = gwui_manifest_parse_file(p_fd, p_manifest);
+    fclose(p_fd);
+    if (0 != err_line_num)
+    {
+        LOG_ERR("Failed to parse '%s' at line %d", GWUI_MANIFEST_FILE_NAME, (printf_int_t)err_line_num);
+        os_free(p_manifest);
+        return false;
+    }
+    LOG_INFO("Loaded %s: %u files", GWUI_MANIFEST_FILE_NAME, (printf_uint_t)p_manifest->num_files);
+    g_p_gwui_manifest = p_manifest;
+    return true;
+}
+
+void
+gwui_manifest_deinit(void)
+{
+    if (NULL != g_p_gwui_manifest)
+    {
+        os_free(g_p_gwui_manifest);
+        g_p_gwui_manifest = NULL;
+    }
+}
+
+const gwui_manifest_entry_t*
+gwui_manifest_find(const char* const p_file_name)
+{
+    const gwui_manifest_t* const p_manifest = g_p_gwui_manifest;
+    if (NULL == p_manifest)
+    {
+        return NULL;
+    }
+    for (gwui_manifest_num_files_t i = 0; i < p_manifest->num_files; ++i)
+    {
+        if (0 == strcmp(p_manifest->files[i].file_name, p_file_name))
+        {
+            return &p_manifest->files[i];
+        }
+    }
+    return NULL;
+}
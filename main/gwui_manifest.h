@@ -0,0 +1,86 @@
+/**
+ * @file gwui_manifest.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_GWUI_MANIFEST_H
+#define RUUVI_GATEWAY_ESP_GWUI_MANIFEST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "flashfatfs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(RUUVI_TESTS_GWUI_MANIFEST)
+#define RUUVI_TESTS_GWUI_MANIFEST (0)
+#endif
+
+#if RUUVI_TESTS_GWUI_MANIFEST
+#define GWUI_MANIFEST_STATIC
+#else
+#define GWUI_MANIFEST_STATIC static
+#endif
+
+#define GWUI_MANIFEST_FILE_NAME "gwui_manifest.txt"
+
+#define GWUI_MANIFEST_MAX_NUM_FILES     (48U)
+#define GWUI_MANIFEST_FILE_NAME_MAX_LEN (64U)
+
+typedef struct gwui_manifest_entry_t
+{
+    char   file_name[GWUI_MANIFEST_FILE_NAME_MAX_LEN];
+    size_t file_size;
+    bool   flag_immutable; //!< The name of the file contains a content hash, so it can be cached by the browser
+} gwui_manifest_entry_t;
+
+typedef uint32_t gwui_manifest_num_files_t;
+
+typedef struct gwui_manifest_t
+{
+    gwui_manifest_num_files_t num_files;
+    gwui_manifest_entry_t     files[GWUI_MANIFEST_MAX_NUM_FILES];
+} gwui_manifest_t;
+
+/**
+ * @brief Load the manifest with the file sizes generated by prep_gwui.py
+ * @note If the manifest is missing (old image of fatfs_gwui), then all lookups fall back to the file system.
+ * @param p_ffs - pointer to the mounted fatfs_gwui partition.
+ * @return true if the manifest was loaded successfully.
+ */
+bool
+gwui_manifest_init(const flash_fat_fs_t* const p_ffs);
+
+void
+gwui_manifest_deinit(void);
+
+/**
+ * @brief Find the file in the manifest.
+ * @param p_file_name - path to the file relative to the root of fatfs_gwui (including ".gz" suffix if present).
+ * @return pointer to the manifest entry or NULL if the file is not found or the manifest is not loaded.
+ */
+const gwui_manifest_entry_t*
+gwui_manifest_find(const char* const p_file_name);
+
+#if RUUVI_TESTS_GWUI_MANIFEST
+
+GWUI_MANIFEST_STATIC
+bool
+gwui_manifest_parse_line(const char* const p_line, gwui_manifest_entry_t* const p_entry);
+
+GWUI_MANIFEST_STATIC
+int32_t
+gwui_manifest_parse_file(FILE* p_fd, gwui_manifest_t* const p_manifest);
+
+#endif // RUUVI_TESTS_GWUI_MANIFEST
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_GWUI_MANIFEST_H
@@ -0,0 +1,227 @@
+/**
+ * @file heap_prof.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "heap_prof.h"
+#include <string.h>
+#include "os_mutex.h"
+
+#if RUUVI_HEAP_PROF
+/**
+ * @brief The header which is placed before each profiled allocation,
+ *        its size is a multiple of 8 bytes, so the alignment of the returned memory is preserved.
+ */
+typedef struct heap_prof_hdr_t
+{
+    uint32_t size;
+    uint32_t tag;
+} heap_prof_hdr_t;
+
+_Static_assert((sizeof(heap_prof_hdr_t) % 8U) == 0, "sizeof(heap_prof_hdr_t) % 8");
+#endif
+
+typedef struct heap_prof_largest_free_blk_history_t
+{
+    uint32_t samples[HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE];
+    uint32_t idx;
+    uint32_t num_samples;
+    uint32_t min_val;
+} heap_prof_largest_free_blk_history_t;
+
+static heap_prof_tag_stat_t                 g_heap_prof_tags_stat[HEAP_PROF_TAG_NUM];
+static heap_prof_largest_free_blk_history_t g_heap_prof_largest_free_blk;
+static os_mutex_t                           g_p_heap_prof_mutex;
+static os_mutex_static_t                    g_heap_prof_mutex_mem;
+
+static void
+heap_prof_lock(void)
+{
+    if (NULL == g_p_heap_prof_mutex)
+    {
+        g_p_heap_prof_mutex = os_mutex_create_static(&g_heap_prof_mutex_mem);
+    }
+    os_mutex_lock(g_p_heap_prof_mutex);
+}
+
+static void
+heap_prof_unlock(void)
+{
+    os_mutex_unlock(g_p_heap_prof_mutex);
+}
+
+void
+heap_prof_init(void)
+{
+    heap_prof_lock();
+    memset(g_heap_prof_tags_stat, 0, sizeof(g_heap_prof_tags_stat));
+    memset(&g_heap_prof_largest_free_blk, 0, sizeof(g_heap_prof_largest_free_blk));
+    g_heap_prof_largest_free_blk.min_val = UINT32_MAX;
+    heap_prof_unlock();
+}
+
+#if RUUVI_HEAP_PROF
+
+static void
+heap_prof_register_alloc(const heap_prof_tag_e tag, const uint32_t size, const bool flag_success)
+{
+    heap_prof_lock();
+    heap_prof_tag_stat_t* const p_stat = &g_heap_prof_tags_stat[tag];
+    if (flag_success)
+    {
+        p_stat->cnt_alloc += 1;
+        p_stat->live_bytes += size;
+        if (p_stat->live_bytes > p_stat->peak_bytes)
+        {
+            p_stat->peak_bytes = p_stat->live_bytes;
+        }
+    }
+    else
+    {
+        p_stat->cnt_alloc_failed += 1;
+    }
+    heap_prof_unlock();
+}
+
+static void*
+heap_prof_attach_hdr(const heap_prof_tag_e tag, void* const p_mem, const uint32_t size)
+{
+    heap_prof_register_alloc(tag, size, NULL != p_mem);
+    if (NULL == p_mem)
+    {
+        return NULL;
+    }
+    heap_prof_hdr_t* const p_hdr = p_mem;
+    p_hdr->size                  = size;
+    p_hdr->tag                   = (uint32_t)tag;
+    return p_hdr + 1;
+}
+
+void*
+heap_prof_malloc(const heap_prof_tag_e tag, const size_t size)
+{
+    if (size > (UINT32_MAX - sizeof(heap_prof_hdr_t)))
+    {
+        heap_prof_register_alloc(tag, 0, false);
+        return NULL;
+    }
+    return heap_prof_attach_hdr(tag, os_malloc(sizeof(heap_prof_hdr_t) + size), (uint32_t)size);
+}
+
+void*
+heap_prof_calloc(const heap_prof_tag_e tag, const size_t nmemb, const size_t size)
+{
+    if ((0 != nmemb) && (size > ((UINT32_MAX - sizeof(heap_prof_hdr_t)) / nmemb)))
+    {
+        heap_prof_register_alloc(tag, 0, false);
+        return NULL;
+    }
+    const size_t total_size = nmemb * size;
+    // os_calloc is used instead of os_malloc+memset to keep the same heap allocator as the non-profiled build
+    return heap_prof_attach_hdr(tag, os_calloc(1, sizeof(heap_prof_hdr_t) + total_size), (uint32_t)total_size);
+}
+
+void
+heap_prof_free(void* const p_mem)
+{
+    if (NULL == p_mem)
+    {
+        return;
+    }
+    heap_prof_hdr_t* const p_hdr = (heap_prof_hdr_t*)p_mem - 1;
+    if (p_hdr->tag < HEAP_PROF_TAG_NUM)
+    {
+        heap_prof_lock();
+        heap_prof_tag_stat_t* const p_stat = &g_heap_prof_tags_stat[p_hdr->tag];
+        p_stat->live_bytes -= p_hdr->size;
+        heap_prof_unlock();
+    }
+    os_free_internal(p_hdr);
+}
+
+void*
+heap_prof_malloc_json_stream_gen(const size_t size)
+{
+    return heap_prof_malloc(HEAP_PROF_TAG_JSON_STREAM_GEN, size);
+}
+
+void*
+heap_prof_calloc_mbedtls(const size_t nmemb, const size_t size)
+{
+    return heap_prof_calloc(HEAP_PROF_TAG_MBEDTLS, nmemb, size);
+}
+
+#endif // RUUVI_HEAP_PROF
+
+void
+heap_prof_register_largest_free_block(const uint32_t largest_free_blk)
+{
+    heap_prof_lock();
+    heap_prof_largest_free_blk_history_t* const p_history = &g_heap_prof_largest_free_blk;
+    if (0 == p_history->num_samples)
+    {
+        p_history->min_val = UINT32_MAX;
+    }
+    p_history->idx                     = (p_history->idx + 1) % HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE;
+    p_history->samples[p_history->idx] = largest_free_blk;
+    if (p_history->num_samples < HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE)
+    {
+        p_history->num_samples += 1;
+    }
+    if (largest_free_blk < p_history->min_val)
+    {
+        p_history->min_val = largest_free_blk;
+    }
+    heap_prof_unlock();
+}
+
+void
+heap_prof_get_stat(heap_prof_stat_t* const p_stat)
+{
+    memset(p_stat, 0, sizeof(*p_stat));
+    p_stat->flag_enabled = (0 != RUUVI_HEAP_PROF);
+
+    heap_prof_lock();
+    memcpy(p_stat->tags, g_heap_prof_tags_stat, sizeof(p_stat->tags));
+
+    const heap_prof_largest_free_blk_history_t* const p_history = &g_heap_prof_largest_free_blk;
+    if (0 != p_history->num_samples)
+    {
+        // The oldest sample is the next one after the current, if the history is full, otherwise it's the first one
+        const uint32_t idx_oldest = (p_history->num_samples < HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE)
+                                        ? 1U
+                                        : ((p_history->idx + 1) % HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE);
+
+        p_stat->largest_free_blk_cur   = p_history->samples[p_history->idx];
+        p_stat->largest_free_blk_min   = p_history->min_val;
+        p_stat->largest_free_blk_trend = (int32_t)(p_history->samples[p_history->idx]
+                                                   - p_history->samples[idx_oldest]);
+    }
+    heap_prof_unlock();
+}
+
+const char*
+heap_prof_get_tag_name(const heap_prof_tag_e tag)
+{
+    const char* p_name = "unknown";
+    switch (tag)
+    {
+        case HEAP_PROF_TAG_JSON_STREAM_GEN:
+            p_name = "json_stream_gen";
+            break;
+        case HEAP_PROF_TAG_HTTP_CLIENT:
+            p_name = "http_client";
+            break;
+        case HEAP_PROF_TAG_MBEDTLS:
+            p_name = "mbedtls";
+            break;
+        case HEAP_PROF_TAG_ADV_TABLE:
+            p_name = "adv_table";
+            break;
+        case HEAP_PROF_TAG_NUM:
+            break;
+    }
+    return p_name;
+}
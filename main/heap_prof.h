@@ -0,0 +1,123 @@
+/**
+ * @file heap_prof.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_HEAP_PROF_H
+#define RUUVI_GATEWAY_ESP_HEAP_PROF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "os_malloc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The allocation-site profiler is disabled by default,
+ *        it can be enabled with cmake option RUUVI_HEAP_PROF (it adds a small header to every profiled allocation).
+ *        When it is disabled, the HEAP_PROF_* macros are mapped directly to os_malloc/os_calloc/os_free.
+ */
+#if !defined(RUUVI_HEAP_PROF)
+#define RUUVI_HEAP_PROF (0)
+#endif
+
+/**
+ * @brief Number of samples of the largest free block used to calculate the trend.
+ */
+#define HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE (30U)
+
+typedef enum heap_prof_tag_e
+{
+    HEAP_PROF_TAG_JSON_STREAM_GEN,
+    HEAP_PROF_TAG_HTTP_CLIENT,
+    HEAP_PROF_TAG_MBEDTLS,
+    HEAP_PROF_TAG_ADV_TABLE,
+    HEAP_PROF_TAG_NUM,
+} heap_prof_tag_e;
+
+typedef struct heap_prof_tag_stat_t
+{
+    uint32_t live_bytes;
+    uint32_t peak_bytes;
+    uint32_t cnt_alloc;
+    uint32_t cnt_alloc_failed;
+} heap_prof_tag_stat_t;
+
+typedef struct heap_prof_stat_t
+{
+    bool                 flag_enabled; //!< true if the allocation-site profiler is compiled in
+    heap_prof_tag_stat_t tags[HEAP_PROF_TAG_NUM];
+    uint32_t             largest_free_blk_cur;
+    uint32_t             largest_free_blk_min;
+    int32_t              largest_free_blk_trend; //!< Change of the largest free block over the history window
+} heap_prof_stat_t;
+
+#if RUUVI_HEAP_PROF
+
+void*
+heap_prof_malloc(const heap_prof_tag_e tag, const size_t size);
+
+void*
+heap_prof_calloc(const heap_prof_tag_e tag, const size_t nmemb, const size_t size);
+
+/**
+ * @brief Free the memory allocated by heap_prof_malloc or heap_prof_calloc.
+ */
+void
+heap_prof_free(void* const p_mem);
+
+void*
+heap_prof_malloc_json_stream_gen(const size_t size);
+
+void*
+heap_prof_calloc_mbedtls(const size_t nmemb, const size_t size);
+
+#define HEAP_PROF_MALLOC(tag_, size_)         heap_prof_malloc((tag_), (size_))
+#define HEAP_PROF_CALLOC(tag_, nmemb_, size_) heap_prof_calloc((tag_), (nmemb_), (size_))
+#define HEAP_PROF_FREE(p_mem_) \
+    do \
+    { \
+        heap_prof_free((void*)(p_mem_)); \
+        (p_mem_) = NULL; \
+    } while (0)
+
+#define HEAP_PROF_FN_MALLOC_JSON_STREAM_GEN (&heap_prof_malloc_json_stream_gen)
+#define HEAP_PROF_FN_FREE                   (&heap_prof_free)
+
+#else
+
+#define HEAP_PROF_MALLOC(tag_, size_)         os_malloc(size_)
+#define HEAP_PROF_CALLOC(tag_, nmemb_, size_) os_calloc((nmemb_), (size_))
+#define HEAP_PROF_FREE(p_mem_)                os_free(p_mem_)
+
+#define HEAP_PROF_FN_MALLOC_JSON_STREAM_GEN (&os_malloc)
+#define HEAP_PROF_FN_FREE                   (&os_free_internal)
+
+#endif // RUUVI_HEAP_PROF
+
+void
+heap_prof_init(void);
+
+/**
+ * @brief Register the current size of the largest free block of the heap, it's called periodically from main_loop.
+ * @param largest_free_blk - size of the largest free block in bytes.
+ */
+void
+heap_prof_register_largest_free_block(const uint32_t largest_free_blk);
+
+void
+heap_prof_get_stat(heap_prof_stat_t* const p_stat);
+
+const char*
+heap_prof_get_tag_name(const heap_prof_tag_e tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_HEAP_PROF_H
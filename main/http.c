@@ -45,12 +45,13 @@ static const char TAG[] = "http";
 typedef int esp_http_client_len_t;
 typedef int esp_http_client_http_status_code_t;
 
-static http_async_info_t g_http_async_info;
+static http_async_info_t g_http_async_info[HTTP_ASYNC_SLOT_NUM];
 
 http_async_info_t*
-http_get_async_info(void)
+http_get_async_info(const http_async_slot_e slot)
 {
-    http_async_info_t* p_http_async_info = &g_http_async_info;
+    assert(slot < HTTP_ASYNC_SLOT_NUM);
+    http_async_info_t* p_http_async_info = &g_http_async_info[slot];
     if (NULL == p_http_async_info->p_http_async_sema)
     {
         p_http_async_info->p_http_async_sema = os_sema_create_static(&p_http_async_info->http_async_sema_mem);
@@ -481,11 +482,12 @@ http_async_info_free_data(http_async_info_t* const p_http_async_info)
     }
     if (p_http_async_info->use_json_stream_gen)
     {
-        if (NULL != p_http_async_info->select.p_gen)
+        if ((NULL != p_http_async_info->select.p_gen)
+            && (p_http_async_info->select.p_gen != p_http_async_info->reusable_gen_advs.p_gen))
         {
             json_stream_gen_delete(&p_http_async_info->select.p_gen);
-            p_http_async_info->select.p_gen = NULL;
         }
+        p_http_async_info->select.p_gen = NULL;
     }
     else
     {
@@ -634,9 +636,10 @@ http_async_poll_do_actions_after_completion(const http_async_info_t* const p_htt
 }
 
 bool
-http_async_poll(uint32_t* const p_malloc_fail_cnt)
+http_async_poll(const http_async_slot_e slot, uint32_t* const p_malloc_fail_cnt, bool* const p_flag_success)
 {
-    http_async_info_t* p_http_async_info = http_get_async_info();
+    http_async_info_t* p_http_async_info = http_get_async_info(slot);
+    *p_flag_success                      = false;
 
     if (p_http_async_info->p_task != os_task_get_cur_task_handle())
     {
@@ -709,6 +712,7 @@ http_async_poll(uint32_t* const p_malloc_fail_cnt)
     }
 
     http_async_poll_do_actions_after_completion(p_http_async_info, flag_success);
+    *p_flag_success = flag_success;
 
     LOG_DBG("os_sema_signal: p_http_async_sema");
     os_sema_signal(p_http_async_info->p_http_async_sema);
@@ -755,10 +759,10 @@ http_method_to_str(const http_async_info_t* const p_http_async_info)
     return http_client_method_to_str(p_http_async_info->http_client_config.esp_http_client_config.method);
 }
 
-void
-http_abort_any_req_during_processing(void)
+static void
+http_abort_req_during_processing(const http_async_slot_e slot)
 {
-    http_async_info_t* p_http_async_info = http_get_async_info();
+    http_async_info_t* p_http_async_info = http_get_async_info(slot);
     LOG_DBG("os_sema_wait_immediate: p_http_async_sema");
     if (!os_sema_wait_immediate(p_http_async_info->p_http_async_sema))
     {
@@ -785,3 +789,12 @@ http_abort_any_req_during_processing(void)
     LOG_DBG("os_sema_signal: p_http_async_sema");
     os_sema_signal(p_http_async_info->p_http_async_sema);
 }
+
+void
+http_abort_any_req_during_processing(void)
+{
+    for (uint32_t i = 0; i < HTTP_ASYNC_SLOT_NUM; ++i)
+    {
+        http_abort_req_during_processing((http_async_slot_e)i);
+    }
+}
@@ -43,6 +43,18 @@ typedef enum http_post_recipient_e
     HTTP_POST_RECIPIENT_ADVS2,
 } http_post_recipient_e;
 
+/**
+ * @brief Slots for asynchronous HTTP requests.
+ * @note The custom HTTP target has its own slot, so that it can be uploaded concurrently with the Ruuvi target
+ *       (if it's admitted by http_async_gov), all other requests use the main slot.
+ */
+typedef enum http_async_slot_e
+{
+    HTTP_ASYNC_SLOT_MAIN,
+    HTTP_ASYNC_SLOT_CUSTOM,
+    HTTP_ASYNC_SLOT_NUM,
+} http_async_slot_e;
+
 typedef struct http_resp_cb_info_t
 {
     uint32_t content_length;
@@ -66,6 +78,11 @@ typedef struct http_async_info_t
     http_post_recipient_e recipient;
     os_task_handle_t      p_task;
     http_resp_cb_info_t   http_resp_cb_info;
+    /**
+     * The generator of advs JSON which is kept between the requests in this slot,
+     * select.p_gen refers to it while posting advs, so it is not deleted in http_async_info_free_data.
+     */
+    http_json_reusable_gen_advs_t reusable_gen_advs;
 } http_async_info_t;
 
 typedef struct http_header_item_t
@@ -96,6 +113,11 @@ typedef struct http_init_client_config_params_t
     const size_t                              ssl_out_content_len;
 } http_init_client_config_params_t;
 
+/**
+ * @brief Start the asynchronous HTTP POST of the advertisements.
+ * @note The generator refers to p_reports without copying,
+ *       so the table must be kept unchanged until http_async_poll reports the completion.
+ */
 bool
 http_post_advs(
     const adv_report_table_t* const  p_reports,
@@ -124,13 +146,20 @@ http_server_resp_t
 http_check_mqtt(const ruuvi_gw_cfg_mqtt_t* const p_mqtt_cfg, const TimeUnitsSeconds_t timeout_seconds);
 
 http_async_info_t*
-http_get_async_info(void);
+http_get_async_info(const http_async_slot_e slot);
 
 void
 http_async_info_free_data(http_async_info_t* const p_http_async_info);
 
+/**
+ * @brief Poll the asynchronous HTTP request.
+ * @param slot - the slot of the request.
+ * @param p_malloc_fail_cnt - pointer to the counter of consecutive SSL handshake failures caused by low memory.
+ * @param[out] p_flag_success - set to true if the request was completed successfully (only when true is returned).
+ * @return true if the request was completed (successfully or not), false if it's still in progress.
+ */
 bool
-http_async_poll(uint32_t* const p_malloc_fail_cnt);
+http_async_poll(const http_async_slot_e slot, uint32_t* const p_malloc_fail_cnt, bool* const p_flag_success);
 
 void
 http_abort_any_req_during_processing(void);
@@ -0,0 +1,123 @@
+/**
+ * @file http_async_gov.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "http_async_gov.h"
+#include <string.h>
+#include <esp_system.h>
+#include "os_mutex.h"
+
+#if !defined(RUUVI_HTTP_ASYNC_CONCURRENT_MODE)
+#define RUUVI_HTTP_ASYNC_CONCURRENT_MODE (0)
+#endif
+
+static bool                  g_http_async_gov_flag_concurrent_mode = (0 != RUUVI_HTTP_ASYNC_CONCURRENT_MODE);
+static http_async_gov_stat_t g_http_async_gov_stat;
+static os_mutex_t            g_p_http_async_gov_mutex;
+static os_mutex_static_t     g_http_async_gov_mutex_mem;
+
+void
+http_async_gov_init(void)
+{
+    if (NULL == g_p_http_async_gov_mutex)
+    {
+        g_p_http_async_gov_mutex = os_mutex_create_static(&g_http_async_gov_mutex_mem);
+    }
+    os_mutex_lock(g_p_http_async_gov_mutex);
+    memset(&g_http_async_gov_stat, 0, sizeof(g_http_async_gov_stat));
+    os_mutex_unlock(g_p_http_async_gov_mutex);
+}
+
+static void
+http_async_gov_lock(void)
+{
+    if (NULL == g_p_http_async_gov_mutex)
+    {
+        http_async_gov_init();
+    }
+    os_mutex_lock(g_p_http_async_gov_mutex);
+}
+
+static void
+http_async_gov_unlock(void)
+{
+    os_mutex_unlock(g_p_http_async_gov_mutex);
+}
+
+void
+http_async_gov_set_concurrent_mode(const bool flag_enabled)
+{
+    http_async_gov_lock();
+    g_http_async_gov_flag_concurrent_mode = flag_enabled;
+    http_async_gov_unlock();
+}
+
+bool
+http_async_gov_is_concurrent_mode_enabled(void)
+{
+    http_async_gov_lock();
+    const bool flag_enabled = g_http_async_gov_flag_concurrent_mode;
+    http_async_gov_unlock();
+    return flag_enabled;
+}
+
+static uint32_t
+http_async_gov_get_mem_budget_per_req(void)
+{
+    return (g_http_async_gov_stat.max_mem_usage_per_req > HTTP_MEM_BUDGET_HTTP_POST)
+               ? g_http_async_gov_stat.max_mem_usage_per_req
+               : HTTP_MEM_BUDGET_HTTP_POST;
+}
+
+bool
+http_async_gov_check_concurrent(void)
+{
+    bool flag_admitted = false;
+    http_async_gov_lock();
+    if (g_http_async_gov_flag_concurrent_mode)
+    {
+        const uint32_t min_free_heap = http_async_gov_get_mem_budget_per_req() + HTTP_ASYNC_GOV_MEM_RESERVE;
+        if (esp_get_free_heap_size() >= min_free_heap)
+        {
+            g_http_async_gov_stat.cnt_concurrent_admitted += 1;
+            flag_admitted = true;
+        }
+        else
+        {
+            g_http_async_gov_stat.cnt_serial_fallback += 1;
+        }
+    }
+    http_async_gov_unlock();
+    return flag_admitted;
+}
+
+void
+http_async_gov_register_mem_usage(const uint32_t free_heap_before, const uint32_t free_heap_after)
+{
+    if (free_heap_after >= free_heap_before)
+    {
+        return;
+    }
+    const uint32_t mem_usage = free_heap_before - free_heap_after;
+    http_async_gov_lock();
+    if (mem_usage > g_http_async_gov_stat.max_mem_usage_per_req)
+    {
+        g_http_async_gov_stat.max_mem_usage_per_req = mem_usage;
+    }
+    if (mem_usage > HTTP_MEM_BUDGET_HTTP_POST)
+    {
+        g_http_async_gov_stat.cnt_mem_budget_exceeded += 1;
+    }
+    http_async_gov_unlock();
+}
+
+void
+http_async_gov_get_stat(http_async_gov_stat_t* const p_stat)
+{
+    http_async_gov_lock();
+    *p_stat = g_http_async_gov_stat;
+    http_async_gov_unlock();
+}
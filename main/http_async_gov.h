@@ -0,0 +1,80 @@
+/**
+ * @file http_async_gov.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_HTTP_ASYNC_GOV_H
+#define RUUVI_GATEWAY_ESP_HTTP_ASYNC_GOV_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "http_mem_budget.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Amount of free heap which should remain after starting the concurrent request.
+ */
+#define HTTP_ASYNC_GOV_MEM_RESERVE (30U * 1024U)
+
+/**
+ * @brief Min amount of free heap required to start the second request while the first one is in progress.
+ * @note The memory of the request itself is reserved by http_mem_budget (@ref HTTP_MEM_BUDGET_HTTP_POST),
+ *       if some request has consumed more than that, then the max registered memory usage is used instead.
+ */
+#define HTTP_ASYNC_GOV_MIN_FREE_HEAP_FOR_CONCURRENT (HTTP_MEM_BUDGET_HTTP_POST + HTTP_ASYNC_GOV_MEM_RESERVE)
+
+typedef struct http_async_gov_stat_t
+{
+    uint32_t cnt_concurrent_admitted;
+    uint32_t cnt_serial_fallback; //!< Number of times the concurrent request was rejected due to low memory
+    uint32_t cnt_mem_budget_exceeded;
+    uint32_t max_mem_usage_per_req;
+} http_async_gov_stat_t;
+
+void
+http_async_gov_init(void);
+
+/**
+ * @brief Enable or disable the concurrent mode at runtime.
+ * @note The default is set at build time by the cmake option RUUVI_HTTP_ASYNC_CONCURRENT_MODE.
+ */
+void
+http_async_gov_set_concurrent_mode(const bool flag_enabled);
+
+bool
+http_async_gov_is_concurrent_mode_enabled(void);
+
+/**
+ * @brief Check if one more asynchronous HTTP request can be started while another one is in progress.
+ * @note The memory of the request is reserved by http_mem_budget, this is only the fallback check of the free heap:
+ *       if the concurrent mode is disabled or there is not enough free heap for the request and the reserve,
+ *       the request is rejected and the caller should fall back to the serial mode (wait until the first one is done).
+ *       The request is expected to use the max of @ref HTTP_MEM_BUDGET_HTTP_POST and the max registered memory usage,
+ *       so a request which has exceeded the budget once makes the admission stricter.
+ * @return true if the concurrent request is admitted.
+ */
+bool
+http_async_gov_check_concurrent(void);
+
+/**
+ * @brief Register the amount of heap consumed by starting the asynchronous HTTP request.
+ * @note The max registered value is used by @ref http_async_gov_check_concurrent if it exceeds the budget.
+ * @param free_heap_before - free heap before starting the request.
+ * @param free_heap_after - free heap after starting the request.
+ */
+void
+http_async_gov_register_mem_usage(const uint32_t free_heap_before, const uint32_t free_heap_after);
+
+void
+http_async_gov_get_stat(http_async_gov_stat_t* const p_stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_HTTP_ASYNC_GOV_H
@@ -86,7 +86,7 @@ http_check_mqtt_internal(const ruuvi_gw_cfg_mqtt_t* const p_mqtt_cfg, const Time
 http_server_resp_t
 http_check_mqtt(const ruuvi_gw_cfg_mqtt_t* const p_mqtt_cfg, const TimeUnitsSeconds_t timeout_seconds)
 {
-    http_async_info_t* const p_http_async_info = http_get_async_info();
+    http_async_info_t* const p_http_async_info = http_get_async_info(HTTP_ASYNC_SLOT_MAIN);
     LOG_DBG("os_sema_wait_immediate: p_http_async_sema");
     if (!os_sema_wait_immediate(p_http_async_info->p_http_async_sema))
     {
@@ -12,6 +12,7 @@
 #include "freertos/task.h"
 #include "str_buf.h"
 #include "os_malloc.h"
+#include "heap_prof.h"
 #include "time_str.h"
 #include "ruuvi_gateway.h"
 #include "http_server_cb.h"
@@ -216,7 +217,7 @@ http_download_create_config(
     http_event_handle_cb const                  p_event_handler,
     void* const                                 p_cb_info)
 {
-    esp_http_client_config_t* p_http_config = os_calloc(1, sizeof(*p_http_config));
+    esp_http_client_config_t* p_http_config = HEAP_PROF_CALLOC(HEAP_PROF_TAG_HTTP_CLIENT, 1, sizeof(*p_http_config));
     if (NULL == p_http_config)
     {
         LOG_ERR("Can't allocate memory for http_config");
@@ -336,7 +337,7 @@ http_download_or_check(
         p_auth_basic = &p_param->p_http_auth->auth_basic;
     }
 
-    http_download_cb_info_t* p_cb_info = os_calloc(1, sizeof(*p_cb_info));
+    http_download_cb_info_t* p_cb_info = HEAP_PROF_CALLOC(HEAP_PROF_TAG_HTTP_CLIENT, 1, sizeof(*p_cb_info));
     if (NULL == p_cb_info)
     {
         LOG_ERR("Can't allocate memory");
@@ -358,7 +359,7 @@ http_download_or_check(
     if (NULL == p_http_config)
     {
         LOG_ERR("Can't allocate memory for http_config");
-        os_free(p_cb_info);
+        HEAP_PROF_FREE(p_cb_info);
         return http_server_resp_500();
     }
 
@@ -370,8 +371,8 @@ http_download_or_check(
     p_cb_info->http_handle = http_client_init(p_param, p_http_config);
     if (NULL == p_cb_info->http_handle)
     {
-        os_free(p_http_config);
-        os_free(p_cb_info);
+        HEAP_PROF_FREE(p_http_config);
+        HEAP_PROF_FREE(p_cb_info);
         LOG_DBG("resume_http_relaying and wait");
         gw_status_resume_http_relaying(flag_wait_relaying_completed);
         LOG_DBG("resume_http_relaying: finished");
@@ -401,8 +402,8 @@ http_download_or_check(
         LOG_ERR_ESP(err, "esp_http_client_cleanup failed");
     }
 
-    os_free(p_http_config);
-    os_free(p_cb_info);
+    HEAP_PROF_FREE(p_http_config);
+    HEAP_PROF_FREE(p_cb_info);
     LOG_DBG("resume_http_relaying and wait");
     gw_status_resume_http_relaying(flag_wait_relaying_completed);
     LOG_DBG("resume_http_relaying: finished");
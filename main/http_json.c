@@ -6,13 +6,11 @@
  */
 
 #include "http_json.h"
+#include <assert.h>
 #include <string.h>
 #include "os_malloc.h"
+#include "heap_prof.h"
 #include "runtime_stat.h"
-#include "ruuvi_endpoint_5.h"
-#include "ruuvi_endpoint_6.h"
-#include "ruuvi_endpoint_e0.h"
-#include "ruuvi_endpoint_f0.h"
 #include "adv_decode.h"
 
 #if defined(RUUVI_TESTS)
@@ -24,18 +22,25 @@ static const char TAG[] = "http";
 
 #define BYTE_MASK (0xFFU)
 
-typedef struct http_json_stream_gen_advs_ctx_t
+struct http_json_stream_gen_advs_ctx_t
 {
-    bool                       flag_raw_data;
-    bool                       flag_decode;
-    bool                       flag_use_timestamps;
-    bool                       flag_use_nonce;
-    time_t                     timestamp;
-    uint32_t                   nonce;
-    mac_address_str_t          gw_mac;
-    ruuvi_gw_cfg_coordinates_t coordinates;
-    adv_report_table_t         reports;
-} http_json_stream_gen_advs_ctx_t;
+    bool                           flag_raw_data;
+    bool                           flag_decode;
+    bool                           flag_use_timestamps;
+    bool                           flag_use_nonce;
+    time_t                         timestamp;
+    uint32_t                       nonce;
+    mac_address_str_t              gw_mac;
+    ruuvi_gw_cfg_coordinates_t     coordinates;
+    http_json_cb_on_gen_finished_t p_cb_on_finished;
+    const adv_report_table_t*      p_reports;       //!< Points to the copy of reports or to the caller's table
+    adv_report_table_t*            p_reports_copy;  //!< Placed after decoded_table, NULL if the table is not copied
+    num_of_advs_t                  decoded_cap;     //!< The number of items allocated in decoded_table
+    adv_decoded_t                  decoded_table[]; //!< p_reports->table decoded once when the generator is targeted
+};
+
+// The copy of reports is placed right after decoded_table, so it must not require the stricter alignment.
+_Static_assert(_Alignof(adv_report_table_t) <= _Alignof(adv_decoded_t), "adv_report_table_t alignment");
 
 static bool
 http_json_generate_task_info(const char* const p_task_name, const uint32_t min_free_stack_size, void* p_userdata)
@@ -75,8 +80,12 @@ http_json_generate_attributes_for_sensors(
     }
     for (num_of_advs_t i = 0; i < p_reports->num_of_advs; ++i)
     {
-        const adv_report_t* const p_adv   = &p_reports->table[i];
-        const mac_address_str_t   mac_str = mac_address_to_str(&p_adv->tag_mac);
+        const adv_report_t* const      p_adv     = &p_reports->table[i];
+        mac_address_str_t              mac_str_tmp;
+        const mac_address_str_t* const p_mac_str = adv_decoded_get_mac_str(
+            &p_adv->tag_mac_str,
+            &p_adv->tag_mac,
+            &mac_str_tmp);
         if (0 != p_adv->samples_counter)
         {
             cJSON* p_json_obj = cJSON_CreateObject();
@@ -85,7 +94,7 @@ http_json_generate_attributes_for_sensors(
                 return false;
             }
             cJSON_AddItemToArray(p_json_active_sensors, p_json_obj);
-            if (NULL == cJSON_AddStringToObject(p_json_obj, "MAC", mac_str.str_buf))
+            if (NULL == cJSON_AddStringToObject(p_json_obj, "MAC", p_mac_str->str_buf))
             {
                 return false;
             }
@@ -96,7 +105,7 @@ http_json_generate_attributes_for_sensors(
         }
         else
         {
-            cJSON* p_json_str = cJSON_CreateString(mac_str.str_buf);
+            cJSON* p_json_str = cJSON_CreateString(p_mac_str->str_buf);
             if (NULL == p_json_str)
             {
                 return false;
@@ -241,11 +250,15 @@ static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
     cb_json_stream_gen_adv,
     json_stream_gen_t* const                     p_gen,
     const http_json_stream_gen_advs_ctx_t* const p_ctx,
-    const adv_report_t* const                    p_adv)
+    const num_of_advs_t                          adv_idx)
 {
-
-    const mac_address_str_t mac_str = mac_address_to_str(&p_adv->tag_mac);
-    JSON_STREAM_GEN_START_OBJECT(p_gen, mac_str.str_buf);
+    const adv_report_t* const      p_adv = &p_ctx->p_reports->table[adv_idx];
+    mac_address_str_t              mac_str_tmp;
+    const mac_address_str_t* const p_mac_str = adv_decoded_get_mac_str(
+        &p_adv->tag_mac_str,
+        &p_adv->tag_mac,
+        &mac_str_tmp);
+    JSON_STREAM_GEN_START_OBJECT(p_gen, p_mac_str->str_buf);
     JSON_STREAM_GEN_ADD_INT32(p_gen, "rssi", p_adv->rssi);
 
     if (p_ctx->flag_use_timestamps)
@@ -281,23 +294,28 @@ static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
     }
     if (p_ctx->flag_decode)
     {
-        if (re_5_check_format(p_adv->data_buf))
+        const adv_decoded_t* const p_decoded = &p_ctx->decoded_table[adv_idx];
+        if (ADV_DECODED_DATA_FORMAT_5 == p_decoded->data_format)
         {
-            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_df5_cb_json_stream_gen, p_gen, p_adv);
+            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_df5_cb_json_stream_gen, p_gen, &p_decoded->data.df5);
         }
-        if (re_6_check_format(p_adv->data_buf))
+        if (ADV_DECODED_DATA_FORMAT_6 == p_decoded->data_format)
         {
-            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_df6_cb_json_stream_gen, p_gen, p_adv);
+            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_df6_cb_json_stream_gen, p_gen, &p_decoded->data.df6);
         }
-        if (re_f0_check_format(p_adv->data_buf))
+        if (ADV_DECODED_DATA_FORMAT_F0 == p_decoded->data_format)
         {
-            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_dfxf0_cb_json_stream_gen, p_gen, p_adv);
+            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_dfxf0_cb_json_stream_gen, p_gen, &p_decoded->data.dff0);
         }
-        if (re_e0_check_format(p_adv->data_buf))
+        if (ADV_DECODED_DATA_FORMAT_E0 == p_decoded->data_format)
         {
-            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_dfxe0_cb_json_stream_gen, p_gen, p_adv);
+            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_dfxe0_cb_json_stream_gen, p_gen, &p_decoded->data.dfe0);
         }
     }
+    if (0 != p_adv->aggr.num_samples)
+    {
+        JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_aggr_cb_json_stream_gen, p_gen, &p_adv->aggr);
+    }
     JSON_STREAM_GEN_END_OBJECT(p_gen);
     JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
 }
@@ -321,20 +339,22 @@ cb_json_stream_gen_advs(json_stream_gen_t* const p_gen, const void* const p_user
 
     JSON_STREAM_GEN_START_OBJECT(p_gen, "tags");
 
-    for (num_of_advs_t i = 0; i < p_ctx->reports.num_of_advs; ++i)
+    for (num_of_advs_t i = 0; i < p_ctx->p_reports->num_of_advs; ++i)
     {
-        JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(cb_json_stream_gen_adv, p_gen, p_ctx, &p_ctx->reports.table[i]);
+        JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(cb_json_stream_gen_adv, p_gen, p_ctx, i);
     }
 
     JSON_STREAM_GEN_END_OBJECT(p_gen);
     JSON_STREAM_GEN_END_OBJECT(p_gen);
+    if (NULL != p_ctx->p_cb_on_finished)
+    {
+        p_ctx->p_cb_on_finished();
+    }
     JSON_STREAM_GEN_END_GENERATOR_FUNC();
 }
 
-json_stream_gen_t*
-http_json_create_stream_gen_advs(
-    const adv_report_table_t* const                        p_reports,
-    const http_json_create_stream_gen_advs_params_t* const p_params)
+static json_stream_gen_t*
+http_json_stream_gen_advs_create_gen(const size_t ctx_size, http_json_stream_gen_advs_ctx_t** const p_p_ctx)
 {
     const json_stream_gen_cfg_t cfg = {
         .max_chunk_size      = 768U,
@@ -342,17 +362,49 @@ http_json_create_stream_gen_advs(
         .indentation_mark    = ' ',
         .indentation         = 2,
         .max_nesting_level   = 4,
-        .p_malloc            = &os_malloc,
-        .p_free              = &os_free_internal,
+        .p_malloc            = HEAP_PROF_FN_MALLOC_JSON_STREAM_GEN,
+        .p_free              = HEAP_PROF_FN_FREE,
         .p_localeconv        = NULL,
     };
-    http_json_stream_gen_advs_ctx_t* p_ctx = NULL;
-    json_stream_gen_t* p_gen = json_stream_gen_create(&cfg, &cb_json_stream_gen_advs, sizeof(*p_ctx), (void**)&p_ctx);
+    json_stream_gen_t* p_gen = json_stream_gen_create(&cfg, &cb_json_stream_gen_advs, ctx_size, (void**)p_p_ctx);
     if (NULL == p_gen)
     {
         LOG_ERR("Not enough memory");
         return NULL;
     }
+    return p_gen;
+}
+
+static size_t
+http_json_stream_gen_advs_calc_ctx_size(const num_of_advs_t decoded_cap, const bool flag_copy_reports)
+{
+    return sizeof(http_json_stream_gen_advs_ctx_t) + (decoded_cap * sizeof(adv_decoded_t))
+           + (flag_copy_reports ? sizeof(adv_report_table_t) : 0);
+}
+
+/**
+ * @brief Decode the payloads of all the advs once, so that the generator does not decode them
+ *        every time it re-enters an adv which does not fit into the current chunk.
+ */
+static void
+http_json_stream_gen_advs_decode(http_json_stream_gen_advs_ctx_t* const p_ctx)
+{
+    if (!p_ctx->flag_decode)
+    {
+        return;
+    }
+    assert(p_ctx->p_reports->num_of_advs <= p_ctx->decoded_cap);
+    for (num_of_advs_t i = 0; i < p_ctx->p_reports->num_of_advs; ++i)
+    {
+        adv_decoded_decode(p_ctx->p_reports->table[i].data_buf, &p_ctx->decoded_table[i]);
+    }
+}
+
+static void
+http_json_stream_gen_advs_set_params(
+    http_json_stream_gen_advs_ctx_t* const                 p_ctx,
+    const http_json_create_stream_gen_advs_params_t* const p_params)
+{
     p_ctx->flag_raw_data       = p_params->flag_raw_data;
     p_ctx->flag_decode         = p_params->flag_decode;
     p_ctx->flag_use_timestamps = p_params->flag_use_timestamps;
@@ -361,13 +413,89 @@ http_json_create_stream_gen_advs(
     p_ctx->nonce               = p_params->nonce;
     p_ctx->gw_mac              = *p_params->p_mac_addr;
     p_ctx->coordinates         = *p_params->p_coordinates;
-    if (NULL == p_reports)
+    p_ctx->p_cb_on_finished    = p_params->p_cb_on_finished;
+}
+
+json_stream_gen_t*
+http_json_create_stream_gen_advs(
+    const adv_report_table_t* const                        p_reports,
+    const http_json_create_stream_gen_advs_params_t* const p_params)
+{
+    const bool          flag_keep_ref_to_reports = p_params->flag_keep_ref_to_reports && (NULL != p_reports);
+    const num_of_advs_t decoded_cap = (p_params->flag_decode && (NULL != p_reports)) ? p_reports->num_of_advs : 0;
+    const size_t        ctx_size    = http_json_stream_gen_advs_calc_ctx_size(decoded_cap, !flag_keep_ref_to_reports);
+
+    http_json_stream_gen_advs_ctx_t* p_ctx = NULL;
+    json_stream_gen_t*               p_gen = http_json_stream_gen_advs_create_gen(ctx_size, &p_ctx);
+    if (NULL == p_gen)
+    {
+        return NULL;
+    }
+    http_json_stream_gen_advs_set_params(p_ctx, p_params);
+    p_ctx->decoded_cap = decoded_cap;
+    if (flag_keep_ref_to_reports)
     {
-        p_ctx->reports.num_of_advs = 0;
+        p_ctx->p_reports_copy = NULL;
+        p_ctx->p_reports      = p_reports;
     }
     else
     {
-        memcpy(&p_ctx->reports, p_reports, sizeof(*p_reports));
+        p_ctx->p_reports_copy = (adv_report_table_t*)(void*)&p_ctx->decoded_table[decoded_cap];
+        if (NULL == p_reports)
+        {
+            p_ctx->p_reports_copy->num_of_advs = 0;
+        }
+        else
+        {
+            memcpy(p_ctx->p_reports_copy, p_reports, sizeof(*p_reports));
+        }
+        p_ctx->p_reports = p_ctx->p_reports_copy;
     }
+    http_json_stream_gen_advs_decode(p_ctx);
     return p_gen;
 }
+
+json_stream_gen_t*
+http_json_reusable_gen_advs_retarget(
+    http_json_reusable_gen_advs_t* const                   p_reusable_gen,
+    const adv_report_table_t* const                        p_reports,
+    const http_json_create_stream_gen_advs_params_t* const p_params)
+{
+    assert(NULL != p_reports);
+    // The table for the decoded advs is allocated for the maximum number of advs only when decoding is requested,
+    // the generator created without it is re-created once the decoding is enabled.
+    const num_of_advs_t decoded_cap = p_params->flag_decode ? MAX_ADVS_TABLE : 0;
+    if ((NULL != p_reusable_gen->p_gen) && (p_reusable_gen->p_ctx->decoded_cap < decoded_cap))
+    {
+        http_json_reusable_gen_advs_delete(p_reusable_gen);
+    }
+    if (NULL == p_reusable_gen->p_gen)
+    {
+        p_reusable_gen->p_gen = http_json_stream_gen_advs_create_gen(
+            http_json_stream_gen_advs_calc_ctx_size(decoded_cap, false),
+            &p_reusable_gen->p_ctx);
+        if (NULL == p_reusable_gen->p_gen)
+        {
+            p_reusable_gen->p_ctx = NULL;
+            return NULL;
+        }
+        p_reusable_gen->p_ctx->decoded_cap = decoded_cap;
+    }
+    http_json_stream_gen_advs_set_params(p_reusable_gen->p_ctx, p_params);
+    p_reusable_gen->p_ctx->p_reports_copy = NULL;
+    p_reusable_gen->p_ctx->p_reports      = p_reports;
+    http_json_stream_gen_advs_decode(p_reusable_gen->p_ctx);
+    json_stream_gen_reset(p_reusable_gen->p_gen);
+    return p_reusable_gen->p_gen;
+}
+
+void
+http_json_reusable_gen_advs_delete(http_json_reusable_gen_advs_t* const p_reusable_gen)
+{
+    if (NULL != p_reusable_gen->p_gen)
+    {
+        json_stream_gen_delete(&p_reusable_gen->p_gen);
+    }
+    p_reusable_gen->p_gen = NULL;
+    p_reusable_gen->p_ctx = NULL;
+}
@@ -57,6 +57,8 @@ http_json_create_status_str(
     const adv_report_table_t* const          p_reports,
     cjson_wrap_str_t* const                  p_json_str);
 
+typedef void (*http_json_cb_on_gen_finished_t)(void);
+
 typedef struct http_json_create_stream_gen_advs_params_t
 {
     const bool                              flag_raw_data;
@@ -67,6 +69,16 @@ typedef struct http_json_create_stream_gen_advs_params_t
     const uint32_t                          nonce;
     const mac_address_str_t* const          p_mac_addr;
     const ruuvi_gw_cfg_coordinates_t* const p_coordinates;
+    /**
+     * If true, the generator keeps the pointer to p_reports instead of making a copy,
+     * so the table must not be modified or released until the generation is finished.
+     */
+    const bool flag_keep_ref_to_reports;
+    /**
+     * Optional callback which is called when the whole JSON has been generated
+     * (it's not called if the generator is deleted earlier).
+     */
+    const http_json_cb_on_gen_finished_t p_cb_on_finished;
 } http_json_create_stream_gen_advs_params_t;
 
 json_stream_gen_t*
@@ -74,6 +86,37 @@ http_json_create_stream_gen_advs(
     const adv_report_table_t* const                        p_reports,
     const http_json_create_stream_gen_advs_params_t* const p_params);
 
+typedef struct http_json_stream_gen_advs_ctx_t http_json_stream_gen_advs_ctx_t;
+
+/**
+ * @brief The generator of advs JSON which is kept between the HTTP requests,
+ *        it's created on the first use and then only re-targeted at the new table of advs.
+ * @note It must be zero-initialized before the first use.
+ */
+typedef struct http_json_reusable_gen_advs_t
+{
+    json_stream_gen_t*               p_gen;
+    http_json_stream_gen_advs_ctx_t* p_ctx;
+} http_json_reusable_gen_advs_t;
+
+/**
+ * @brief Re-target the reusable generator at the new table of advs and reset it.
+ * @note The table is not copied (like with flag_keep_ref_to_reports),
+ *       so it must be kept unchanged until the generation is finished.
+ * @param p_reusable_gen - pointer to the reusable generator.
+ * @param p_reports - pointer to the table of advs, it must not be NULL.
+ * @param p_params - pointer to the parameters, flag_keep_ref_to_reports is ignored.
+ * @return pointer to the generator or NULL if it was not possible to create it.
+ */
+json_stream_gen_t*
+http_json_reusable_gen_advs_retarget(
+    http_json_reusable_gen_advs_t* const                   p_reusable_gen,
+    const adv_report_table_t* const                        p_reports,
+    const http_json_create_stream_gen_advs_params_t* const p_params);
+
+void
+http_json_reusable_gen_advs_delete(http_json_reusable_gen_advs_t* const p_reusable_gen);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,213 @@
+/**
+ * @file http_mem_budget.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "http_mem_budget.h"
+#include <assert.h>
+#include <string.h>
+#include <esp_system.h>
+#include "esp_timer.h"
+#include "os_mutex.h"
+
+typedef int64_t http_mem_budget_time_ms_t;
+
+typedef struct http_mem_budget_reservation_t
+{
+    uint32_t                  mem_size;
+    http_mem_budget_time_ms_t expiration_time_ms; //!< 0 if the reservation does not expire automatically
+} http_mem_budget_reservation_t;
+
+static http_mem_budget_reservation_t g_http_mem_budget_reservations[HTTP_MEM_BUDGET_CLIENT_NUM];
+static uint32_t                      g_http_mem_budget_limit = HTTP_MEM_BUDGET_LIMIT_UNRESTRICTED;
+static http_mem_budget_stat_t        g_http_mem_budget_stat;
+static os_mutex_t                    g_p_http_mem_budget_mutex;
+static os_mutex_static_t             g_http_mem_budget_mutex_mem;
+
+void
+http_mem_budget_init(void)
+{
+    if (NULL == g_p_http_mem_budget_mutex)
+    {
+        g_p_http_mem_budget_mutex = os_mutex_create_static(&g_http_mem_budget_mutex_mem);
+    }
+    os_mutex_lock(g_p_http_mem_budget_mutex);
+    memset(g_http_mem_budget_reservations, 0, sizeof(g_http_mem_budget_reservations));
+    memset(&g_http_mem_budget_stat, 0, sizeof(g_http_mem_budget_stat));
+    os_mutex_unlock(g_p_http_mem_budget_mutex);
+}
+
+static void
+http_mem_budget_lock(void)
+{
+    if (NULL == g_p_http_mem_budget_mutex)
+    {
+        http_mem_budget_init();
+    }
+    os_mutex_lock(g_p_http_mem_budget_mutex);
+}
+
+static void
+http_mem_budget_unlock(void)
+{
+    os_mutex_unlock(g_p_http_mem_budget_mutex);
+}
+
+static http_mem_budget_time_ms_t
+http_mem_budget_get_time_ms(void)
+{
+    return (http_mem_budget_time_ms_t)(esp_timer_get_time() / 1000);
+}
+
+void
+http_mem_budget_set_restricted_mode(const bool flag_restricted)
+{
+    http_mem_budget_lock();
+    g_http_mem_budget_limit = flag_restricted ? HTTP_MEM_BUDGET_LIMIT_RESTRICTED : HTTP_MEM_BUDGET_LIMIT_UNRESTRICTED;
+    http_mem_budget_unlock();
+}
+
+static void
+http_mem_budget_release_expired(const http_mem_budget_time_ms_t now_ms)
+{
+    for (uint32_t i = 0; i < HTTP_MEM_BUDGET_CLIENT_NUM; ++i)
+    {
+        http_mem_budget_reservation_t* const p_reservation = &g_http_mem_budget_reservations[i];
+        if ((0 != p_reservation->expiration_time_ms) && (now_ms >= p_reservation->expiration_time_ms))
+        {
+            p_reservation->mem_size           = 0;
+            p_reservation->expiration_time_ms = 0;
+        }
+    }
+}
+
+static uint32_t
+http_mem_budget_calc_reserved_by_others(const http_mem_budget_client_e client)
+{
+    uint32_t reserved = 0;
+    for (uint32_t i = 0; i < HTTP_MEM_BUDGET_CLIENT_NUM; ++i)
+    {
+        if (i != (uint32_t)client)
+        {
+            reserved += g_http_mem_budget_reservations[i].mem_size;
+        }
+    }
+    return reserved;
+}
+
+static bool
+http_mem_budget_check(const uint32_t reserved_by_others, const uint32_t mem_size)
+{
+    if (0 == reserved_by_others)
+    {
+        // There is no concurrent activity, so the request is started in the same way as before
+        return true;
+    }
+    if ((reserved_by_others + mem_size) > g_http_mem_budget_limit)
+    {
+        return false;
+    }
+    if (esp_get_free_heap_size() < (mem_size + HTTP_MEM_BUDGET_MIN_FREE_HEAP))
+    {
+        return false;
+    }
+    return true;
+}
+
+bool
+http_mem_budget_reserve(const http_mem_budget_client_e client, const uint32_t mem_size)
+{
+    assert(client < HTTP_MEM_BUDGET_CLIENT_NUM);
+    const http_mem_budget_time_ms_t now_ms = http_mem_budget_get_time_ms();
+
+    http_mem_budget_lock();
+    http_mem_budget_release_expired(now_ms);
+
+    const uint32_t reserved_by_others = http_mem_budget_calc_reserved_by_others(client);
+    const bool     flag_admitted      = http_mem_budget_check(reserved_by_others, mem_size);
+    if (flag_admitted)
+    {
+        http_mem_budget_reservation_t* const p_reservation = &g_http_mem_budget_reservations[client];
+
+        p_reservation->mem_size           = mem_size;
+        p_reservation->expiration_time_ms = (HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP == client)
+                                                ? (now_ms + HTTP_MEM_BUDGET_HTTP_SERVER_RESP_LEASE_MS)
+                                                : 0;
+        g_http_mem_budget_stat.cnt_admitted[client] += 1;
+        if ((reserved_by_others + mem_size) > g_http_mem_budget_stat.max_reserved)
+        {
+            g_http_mem_budget_stat.max_reserved = reserved_by_others + mem_size;
+        }
+    }
+    else
+    {
+        g_http_mem_budget_stat.cnt_rejected[client] += 1;
+    }
+    http_mem_budget_unlock();
+    return flag_admitted;
+}
+
+void
+http_mem_budget_release(const http_mem_budget_client_e client)
+{
+    assert(client < HTTP_MEM_BUDGET_CLIENT_NUM);
+    http_mem_budget_lock();
+    g_http_mem_budget_reservations[client].mem_size           = 0;
+    g_http_mem_budget_reservations[client].expiration_time_ms = 0;
+    http_mem_budget_unlock();
+}
+
+void
+http_mem_budget_hold(const http_mem_budget_client_e client)
+{
+    assert(client < HTTP_MEM_BUDGET_CLIENT_NUM);
+    http_mem_budget_lock();
+    g_http_mem_budget_reservations[client].expiration_time_ms = 0;
+    http_mem_budget_unlock();
+}
+
+uint32_t
+http_mem_budget_get_total_reserved(void)
+{
+    const http_mem_budget_time_ms_t now_ms = http_mem_budget_get_time_ms();
+    http_mem_budget_lock();
+    http_mem_budget_release_expired(now_ms);
+    // HTTP_MEM_BUDGET_CLIENT_NUM does not match any client, so all the reservations are summed up
+    const uint32_t total_reserved = http_mem_budget_calc_reserved_by_others(HTTP_MEM_BUDGET_CLIENT_NUM);
+    http_mem_budget_unlock();
+    return total_reserved;
+}
+
+void
+http_mem_budget_get_stat(http_mem_budget_stat_t* const p_stat)
+{
+    http_mem_budget_lock();
+    *p_stat = g_http_mem_budget_stat;
+    http_mem_budget_unlock();
+}
+
+const char*
+http_mem_budget_get_client_name(const http_mem_budget_client_e client)
+{
+    const char* p_name = "unknown";
+    switch (client)
+    {
+        case HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN:
+            p_name = "http_post_main";
+            break;
+        case HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM:
+            p_name = "http_post_custom";
+            break;
+        case HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP:
+            p_name = "http_server_resp";
+            break;
+        case HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH:
+            p_name = "mqtt_publish";
+            break;
+        case HTTP_MEM_BUDGET_CLIENT_NUM:
+            break;
+    }
+    return p_name;
+}
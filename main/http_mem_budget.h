@@ -0,0 +1,120 @@
+/**
+ * @file http_mem_budget.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_HTTP_MEM_BUDGET_H
+#define RUUVI_GATEWAY_ESP_HTTP_MEM_BUDGET_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Estimated amount of heap used by one outgoing HTTP(S) post (TLS session, HTTP client buffers, JSON generator).
+ */
+#define HTTP_MEM_BUDGET_HTTP_POST (40U * 1024U)
+
+/**
+ * @brief Estimated amount of heap used by one response of the HTTP server (file chunk, small JSON).
+ */
+#define HTTP_MEM_BUDGET_HTTP_SERVER_RESP (4U * 1024U)
+
+/**
+ * @brief Estimated amount of heap used by publishing advs via MQTT (JSON of the message, MQTT outbox).
+ */
+#define HTTP_MEM_BUDGET_MQTT_PUBLISH (8U * 1024U)
+
+/**
+ * @brief The budget which is used when the heap is shared with MQTT over SSL/WSS:
+ *        it's enough for one outgoing post, one response of the HTTP server and MQTT publishing.
+ */
+#define HTTP_MEM_BUDGET_LIMIT_RESTRICTED (64U * 1024U)
+
+#define HTTP_MEM_BUDGET_LIMIT_UNRESTRICTED (UINT32_MAX)
+
+/**
+ * @brief Amount of free heap which should remain after admitting the reservation
+ *        if some other reservation is already active.
+ */
+#define HTTP_MEM_BUDGET_MIN_FREE_HEAP (20U * 1024U)
+
+/**
+ * @brief The HTTP server does not notify when the response has been sent,
+ *        so its reservation is released automatically after this timeout
+ *        or when the next incoming request is handled (the server handles connections one by one).
+ *        The responses which are generated while they are being sent are held by @ref http_mem_budget_hold.
+ */
+#define HTTP_MEM_BUDGET_HTTP_SERVER_RESP_LEASE_MS (5000U)
+
+typedef enum http_mem_budget_client_e
+{
+    HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN,   //!< Outgoing post in HTTP_ASYNC_SLOT_MAIN
+    HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM, //!< Outgoing post in HTTP_ASYNC_SLOT_CUSTOM
+    HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, //!< Response to the incoming request (Web UI, /history, /metrics)
+    HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH,     //!< Publishing of the periodic or urgent advs via MQTT
+    HTTP_MEM_BUDGET_CLIENT_NUM,
+} http_mem_budget_client_e;
+
+typedef struct http_mem_budget_stat_t
+{
+    uint32_t cnt_admitted[HTTP_MEM_BUDGET_CLIENT_NUM];
+    uint32_t cnt_rejected[HTTP_MEM_BUDGET_CLIENT_NUM];
+    uint32_t max_reserved; //!< Max total amount of memory reserved simultaneously
+} http_mem_budget_stat_t;
+
+void
+http_mem_budget_init(void);
+
+/**
+ * @brief Set the restricted mode (@ref HTTP_MEM_BUDGET_LIMIT_RESTRICTED) or unrestricted mode.
+ * @param flag_restricted - true if the heap is shared with MQTT over SSL/WSS.
+ */
+void
+http_mem_budget_set_restricted_mode(const bool flag_restricted);
+
+/**
+ * @brief Reserve the estimated amount of heap for the HTTP request.
+ * @note The reservation is always admitted if there are no other active reservations,
+ *       otherwise the total reserved memory should fit the limit and enough free heap should remain.
+ *       The previous reservation of the same client is replaced.
+ * @param client - the owner of the reservation.
+ * @param mem_size - estimated amount of heap.
+ * @return true if the request can be started, false if it should be postponed (or rejected).
+ */
+bool
+http_mem_budget_reserve(const http_mem_budget_client_e client, const uint32_t mem_size);
+
+void
+http_mem_budget_release(const http_mem_budget_client_e client);
+
+/**
+ * @brief Cancel the lease of the active reservation, so it's kept until it's released explicitly.
+ * @note It's used for the responses of the HTTP server which are generated by chunks (/history, /live)
+ *       and can be sent longer than @ref HTTP_MEM_BUDGET_HTTP_SERVER_RESP_LEASE_MS.
+ *       If the connection is closed before the generation is finished,
+ *       then the reservation is replaced when the next incoming request is handled.
+ * @param client - the owner of the reservation.
+ */
+void
+http_mem_budget_hold(const http_mem_budget_client_e client);
+
+uint32_t
+http_mem_budget_get_total_reserved(void);
+
+void
+http_mem_budget_get_stat(http_mem_budget_stat_t* const p_stat);
+
+const char*
+http_mem_budget_get_client_name(const http_mem_budget_client_e client);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_HTTP_MEM_BUDGET_H
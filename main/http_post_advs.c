@@ -185,7 +185,19 @@ http_send_advs_internal(
         .p_mac_addr          = gw_cfg_get_nrf52_mac_addr(),
         .p_coordinates       = &p_gw_cfg->ruuvi_cfg.coordinates,
     };
-    p_http_async_info->select.p_gen = http_json_create_stream_gen_advs(p_reports, &params);
+    if (NULL != p_reports)
+    {
+        // The table is owned by adv_post_async_comm until the request is completed,
+        // so the generator of this slot refers to it without copying and is reused for the next requests.
+        p_http_async_info->select.p_gen = http_json_reusable_gen_advs_retarget(
+            &p_http_async_info->reusable_gen_advs,
+            p_reports,
+            &params);
+    }
+    else
+    {
+        p_http_async_info->select.p_gen = http_json_create_stream_gen_advs(p_reports, &params);
+    }
     gw_cfg_unlock_ro(&p_gw_cfg);
     if (NULL == p_http_async_info->select.p_gen)
     {
@@ -265,7 +277,8 @@ http_post_advs(
     const ruuvi_gw_cfg_http_t* const p_cfg_http,
     void* const                      p_user_data)
 {
-    http_async_info_t* p_http_async_info = http_get_async_info();
+    http_async_info_t* p_http_async_info = http_get_async_info(
+        flag_post_to_ruuvi ? HTTP_ASYNC_SLOT_MAIN : HTTP_ASYNC_SLOT_CUSTOM);
     LOG_DBG("os_sema_wait_immediate: p_http_async_sema");
     if (!os_sema_wait_immediate(p_http_async_info->p_http_async_sema))
     {
@@ -503,7 +516,7 @@ http_check_post_advs_internal2(
 http_server_resp_t
 http_check_post_advs(const http_check_params_t* const p_params, const TimeUnitsSeconds_t timeout_seconds)
 {
-    http_async_info_t* const p_http_async_info = http_get_async_info();
+    http_async_info_t* const p_http_async_info = http_get_async_info(HTTP_ASYNC_SLOT_MAIN);
     LOG_DBG("os_sema_wait_immediate: p_http_async_sema");
     if (!os_sema_wait_immediate(p_http_async_info->p_http_async_sema))
     {
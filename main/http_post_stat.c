@@ -104,7 +104,7 @@ http_post_stat(
     const bool                               use_ssl_client_cert,
     const bool                               use_ssl_server_cert)
 {
-    http_async_info_t* p_http_async_info = http_get_async_info();
+    http_async_info_t* p_http_async_info = http_get_async_info(HTTP_ASYNC_SLOT_MAIN);
     LOG_DBG("os_sema_wait_immediate: p_http_async_sema");
     if (!os_sema_wait_immediate(p_http_async_info->p_http_async_sema))
     {
@@ -291,7 +291,7 @@ http_check_post_stat_internal2(
 http_server_resp_t
 http_check_post_stat(const http_check_params_t* const p_params, const TimeUnitsSeconds_t timeout_seconds)
 {
-    http_async_info_t* const p_http_async_info = http_get_async_info();
+    http_async_info_t* const p_http_async_info = http_get_async_info(HTTP_ASYNC_SLOT_MAIN);
     LOG_DBG("os_sema_wait_immediate: p_http_async_sema");
     if (!os_sema_wait_immediate(p_http_async_info->p_http_async_sema))
     {
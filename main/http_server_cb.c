@@ -11,6 +11,7 @@
 #include "ruuvi_gateway.h"
 #include "wifi_manager.h"
 #include "flashfatfs.h"
+#include "gwui_manifest.h"
 #include "os_malloc.h"
 #include "http_server.h"
 #include "http.h"
@@ -23,6 +24,7 @@
 #include "gw_status.h"
 #include "url_encode.h"
 #include "gw_cfg_storage.h"
+#include "http_mem_budget.h"
 
 #if RUUVI_TESTS_HTTP_SERVER_CB
 #define LOG_LOCAL_LEVEL LOG_LEVEL_DEBUG
@@ -61,12 +63,14 @@ http_server_cb_init(const char* const p_fatfs_gwui_partition_name)
         LOG_ERR("flashfatfs_mount: failed to mount partition '%s'", GW_GWUI_PARTITION);
         return false;
     }
+    (void)gwui_manifest_init(gp_ffs_gwui);
     return true;
 }
 
 void
 http_server_cb_deinit(void)
 {
+    gwui_manifest_deinit();
     if (NULL != gp_ffs_gwui)
     {
         flashfatfs_unmount(&gp_ffs_gwui);
@@ -113,6 +117,11 @@ http_server_cb_on_delete(
 {
     (void)flag_access_from_lan;
     (void)p_resp_auth;
+    if (!http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, HTTP_MEM_BUDGET_HTTP_SERVER_RESP))
+    {
+        LOG_WARN("Not enough memory budget to handle DELETE /%s, try again later", p_file_name);
+        return http_server_resp_503();
+    }
     if (0 == strcmp(p_file_name, "ssl_cert"))
     {
         return http_server_cb_on_delete_ssl_cert(p_uri_params);
@@ -129,6 +129,9 @@ http_server_resp_json(const char* p_file_name, const bool flag_access_from_lan);
 http_server_resp_t
 http_server_resp_metrics(void);
 
+http_server_resp_t
+http_server_resp_adv_log(void);
+
 http_content_type_e
 http_get_content_type_by_ext(const char* p_file_ext);
 
@@ -9,19 +9,28 @@
 #include <string.h>
 #include <stdlib.h>
 #include "os_malloc.h"
-#include "gw_cfg_ruuvi_json.h"
+#include "adv_report_pool.h"
+#include "adv_live_stream.h"
+#include "adv_log_ring.h"
+#include "uart_capture.h"
 #include "http_server_resp.h"
 #include "reset_task.h"
 #include "metrics.h"
 #include "time_task.h"
 #include "adv_post.h"
 #include "flashfatfs.h"
+#include "gwui_manifest.h"
+#include "gw_cfg_json_stream_gen.h"
 #include "ruuvi_gateway.h"
 #include "str_buf.h"
 #include "gw_status.h"
 #include "validate_url.h"
 #include "network_timeout.h"
 #include "esp_transport_ssl.h"
+#include "boot_timeline.h"
+#include "http_mem_budget.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 #if RUUVI_TESTS_HTTP_SERVER_CB
 #define LOG_LOCAL_LEVEL LOG_LEVEL_DEBUG
@@ -45,22 +54,21 @@ HTTP_SERVER_CB_STATIC
 http_server_resp_t
 http_server_resp_json_ruuvi(void)
 {
-    const gw_cfg_t*  p_gw_cfg = gw_cfg_lock_ro();
-    cjson_wrap_str_t json_str = cjson_wrap_str_null();
-    if (!gw_cfg_ruuvi_json_generate(p_gw_cfg, &json_str))
+    // ruuvi.json is served by the same generator which is used to calculate its hash in /metrics,
+    // the generator works on its own copy of gw_cfg.
+    const gw_cfg_t*    p_gw_cfg = gw_cfg_lock_ro();
+    json_stream_gen_t* p_gen    = gw_cfg_json_stream_gen_create_for_ui_client(p_gw_cfg);
+    gw_cfg_unlock_ro(&p_gw_cfg);
+    if (NULL == p_gen)
     {
-        gw_cfg_unlock_ro(&p_gw_cfg);
         return http_server_resp_503();
     }
-    gw_cfg_unlock_ro(&p_gw_cfg);
-
-    LOG_INFO("ruuvi.json: %s", json_str.p_str);
 
     LOG_INFO("Activate cfg_mode");
     main_task_send_sig_activate_cfg_mode();
     timer_cfg_mode_deactivation_start();
 
-    return http_server_resp_200_json_in_heap(json_str.p_str);
+    return http_server_resp_200_json_generator(p_gen);
 }
 
 HTTP_SERVER_CB_STATIC
@@ -109,6 +117,34 @@ json_info_add_uint32(cJSON* p_json_root, const char* p_item_name, const uint32_t
     return true;
 }
 
+static bool
+json_info_add_boot_timeline(cJSON* p_json_root)
+{
+    cJSON* const p_json_boot_timeline = cJSON_AddObjectToObject(p_json_root, "BOOT_TIMELINE_US");
+    if (NULL == p_json_boot_timeline)
+    {
+        LOG_ERR("Can't add json item: %s", "BOOT_TIMELINE_US");
+        return false;
+    }
+    boot_timeline_t boot_timeline = { 0 };
+    boot_timeline_get(&boot_timeline);
+    for (uint32_t i = 0; i < BOOT_TIMELINE_STAGE_LAST; ++i)
+    {
+        if (0 == boot_timeline.stages[i])
+        {
+            continue; // The stage was not reached yet
+        }
+        const char* const    p_stage_name = boot_timeline_get_stage_name((boot_timeline_stage_e)i);
+        const cjson_double_t timestamp_us = (cjson_double_t)boot_timeline.stages[i];
+        if (NULL == cJSON_AddNumberToObject(p_json_boot_timeline, p_stage_name, timestamp_us))
+        {
+            LOG_ERR("Can't add json item: %s", p_stage_name);
+            return false;
+        }
+    }
+    return true;
+}
+
 static bool
 json_info_add_items(cJSON* p_json_root, const bool flag_use_timestamps)
 {
@@ -137,7 +173,7 @@ json_info_add_items(cJSON* p_json_root, const bool flag_use_timestamps)
         return false;
     }
     const time_t        cur_time  = http_server_get_cur_time();
-    adv_report_table_t* p_reports = os_malloc(sizeof(*p_reports));
+    adv_report_table_t* p_reports = adv_report_pool_checkout();
     if (NULL == p_reports)
     {
         return false;
@@ -150,7 +186,7 @@ json_info_add_items(cJSON* p_json_root, const bool flag_use_timestamps)
         flag_use_timestamps ? HTTP_SERVER_DEFAULT_HISTORY_INTERVAL_SECONDS : 0,
         flag_use_filter);
     const num_of_advs_t num_of_advs = p_reports->num_of_advs;
-    os_free(p_reports);
+    adv_report_pool_return(p_reports);
 
     if (!json_info_add_uint32(p_json_root, "TAGS_SEEN", num_of_advs))
     {
@@ -160,6 +196,10 @@ json_info_add_items(cJSON* p_json_root, const bool flag_use_timestamps)
     {
         return false;
     }
+    if (!json_info_add_boot_timeline(p_json_root))
+    {
+        return false;
+    }
     return true;
 }
 
@@ -248,6 +288,57 @@ http_server_resp_metrics(void)
         flag_add_header_date);
 }
 
+HTTP_SERVER_CB_STATIC
+http_server_resp_t
+http_server_resp_adv_log(void)
+{
+    const char* p_text = adv_log_ring_generate_text();
+    if (NULL == p_text)
+    {
+        LOG_ERR("Not enough memory");
+        return http_server_resp_503();
+    }
+    const bool flag_no_cache        = true;
+    const bool flag_add_header_date = true;
+    return http_server_resp_200_data_in_heap(
+        HTTP_CONTENT_TYPE_TEXT_PLAIN,
+        NULL,
+        strlen(p_text),
+        HTTP_CONTENT_ENCODING_NONE,
+        (const uint8_t*)p_text,
+        flag_no_cache,
+        flag_add_header_date);
+}
+
+#if RUUVI_UART_CAPTURE
+static http_server_resp_t
+http_server_resp_uart_capture(void)
+{
+    size_t         len         = 0;
+    uint32_t       cnt_dropped = 0;
+    const uint8_t* p_data      = uart_capture_take(&len, &cnt_dropped);
+    if (NULL == p_data)
+    {
+        LOG_ERR("Not enough memory");
+        return http_server_resp_503();
+    }
+    if (0 != cnt_dropped)
+    {
+        LOG_WARN("uart_capture: %lu records were dropped, the capture buffer was full", (printf_ulong_t)cnt_dropped);
+    }
+    const bool flag_no_cache        = true;
+    const bool flag_add_header_date = true;
+    return http_server_resp_200_data_in_heap(
+        HTTP_CONTENT_TYPE_APPLICATION_OCTET_STREAM,
+        NULL,
+        len,
+        HTTP_CONTENT_ENCODING_NONE,
+        p_data,
+        flag_no_cache,
+        flag_add_header_date);
+}
+#endif
+
 HTTP_SERVER_CB_STATIC
 void
 http_server_get_filter_from_params(
@@ -300,6 +391,49 @@ http_server_get_decode_from_params(const char* const p_params)
     return flag_decode;
 }
 
+static void
+http_server_cb_on_stream_gen_advs_finished(void)
+{
+    http_mem_budget_release(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP);
+}
+
+/**
+ * @brief Create the JSON generator of the advs in the format of /history.
+ * @note The buffer with advs is returned to adv_report_pool, the generator keeps its own copy.
+ *       The response is generated while it's being sent, so the memory budget of the HTTP server is held
+ *       until the whole JSON has been generated instead of being released by the lease.
+ */
+static json_stream_gen_t*
+http_server_create_stream_gen_advs(
+    adv_report_table_t* const p_reports,
+    const bool                flag_decode,
+    const bool                flag_use_timestamps)
+{
+    const bool      flag_use_nonce = false;
+    const uint32_t  nonce          = 0;
+    const gw_cfg_t* p_gw_cfg       = gw_cfg_lock_ro();
+
+    const http_json_create_stream_gen_advs_params_t params = {
+        .flag_raw_data       = true,
+        .flag_decode         = flag_decode,
+        .flag_use_timestamps = flag_use_timestamps,
+        .cur_time            = http_server_get_cur_time(),
+        .flag_use_nonce      = flag_use_nonce,
+        .nonce               = nonce,
+        .p_mac_addr          = gw_cfg_get_nrf52_mac_addr(),
+        .p_coordinates       = &p_gw_cfg->ruuvi_cfg.coordinates,
+        .p_cb_on_finished    = &http_server_cb_on_stream_gen_advs_finished,
+    };
+    json_stream_gen_t* p_gen = http_json_create_stream_gen_advs(p_reports, &params);
+    gw_cfg_unlock_ro(&p_gw_cfg);
+    adv_report_pool_return(p_reports);
+    if (NULL != p_gen)
+    {
+        http_mem_budget_hold(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP);
+    }
+    return p_gen;
+}
+
 HTTP_SERVER_CB_STATIC
 http_server_resp_t
 http_server_resp_history(const char* const p_params)
@@ -322,7 +456,7 @@ http_server_resp_history(const char* const p_params)
     }
 
     const time_t        cur_time  = http_server_get_cur_time();
-    adv_report_table_t* p_reports = os_calloc(1, sizeof(*p_reports));
+    adv_report_table_t* p_reports = adv_report_pool_checkout();
     if (NULL == p_reports)
     {
         return http_server_resp_503();
@@ -330,23 +464,7 @@ http_server_resp_history(const char* const p_params)
 
     adv_table_history_read(p_reports, cur_time, flag_use_timestamps, filter, flag_use_filter);
 
-    const bool      flag_use_nonce = false;
-    const uint32_t  nonce          = 0;
-    const gw_cfg_t* p_gw_cfg       = gw_cfg_lock_ro();
-
-    const http_json_create_stream_gen_advs_params_t params = {
-        .flag_raw_data       = true,
-        .flag_decode         = flag_decode,
-        .flag_use_timestamps = flag_use_timestamps,
-        .cur_time            = http_server_get_cur_time(),
-        .flag_use_nonce      = flag_use_nonce,
-        .nonce               = nonce,
-        .p_mac_addr          = gw_cfg_get_nrf52_mac_addr(),
-        .p_coordinates       = &p_gw_cfg->ruuvi_cfg.coordinates,
-    };
-    json_stream_gen_t* p_gen = http_json_create_stream_gen_advs(p_reports, &params);
-    gw_cfg_unlock_ro(&p_gw_cfg);
-    os_free(p_reports);
+    json_stream_gen_t* p_gen = http_server_create_stream_gen_advs(p_reports, flag_decode, flag_use_timestamps);
     if (NULL == p_gen)
     {
         return http_server_resp_503();
@@ -374,6 +492,107 @@ http_server_resp_history(const char* const p_params)
     return http_server_resp_200_json_generator(p_gen);
 }
 
+static adv_live_stream_client_id_t
+http_server_get_live_client_id_from_params(const char* const p_params)
+{
+    adv_live_stream_client_id_t client_id = ADV_LIVE_STREAM_CLIENT_ID_INVALID;
+    if (NULL == p_params)
+    {
+        return client_id;
+    }
+    str_buf_t str_buf = http_server_get_from_params(p_params, "client=");
+    if (NULL != str_buf.buf)
+    {
+        client_id = (adv_live_stream_client_id_t)strtoul(str_buf.buf, NULL, 0);
+        str_buf_free_buf(&str_buf);
+    }
+    return client_id;
+}
+
+static http_server_resp_t
+http_server_resp_live_subscribe(const adv_live_stream_time_ms_t now)
+{
+    const adv_live_stream_client_id_t client_id = adv_live_stream_subscribe(now);
+    if (ADV_LIVE_STREAM_CLIENT_ID_INVALID == client_id)
+    {
+        LOG_WARN(
+            "Requested /live: all %u slots for clients are in use",
+            (printf_uint_t)ADV_LIVE_STREAM_MAX_NUM_CLIENTS);
+        return http_server_resp_503();
+    }
+    const str_buf_t json_str = str_buf_printf_with_alloc("{\"client\": %lu}", (printf_ulong_t)client_id);
+    if (NULL == json_str.buf)
+    {
+        adv_live_stream_unsubscribe(client_id);
+        return http_server_resp_503();
+    }
+    LOG_INFO("Requested /live: new client %lu", (printf_ulong_t)client_id);
+    return http_server_resp_200_json_in_heap(json_str.buf);
+}
+
+/**
+ * @brief Handle the delta polling of the live stream of the advs for the LAN clients.
+ * @note GET /live subscribes a new client and returns its ID: {"client": <id>},
+ *       GET /live?client=<id> returns the advs updated since the previous poll of the client
+ *       (in the same format as /history, only the latest adv of every tag),
+ *       GET /live?client=<id>&unsubscribe=true releases the slot of the client.
+ *       The client which is unknown or has not polled for ADV_LIVE_STREAM_CLIENT_TIMEOUT_MS gets 404,
+ *       so it should subscribe again.
+ */
+HTTP_SERVER_CB_STATIC
+http_server_resp_t
+http_server_resp_live(const char* const p_params)
+{
+    const adv_live_stream_time_ms_t   now       = (adv_live_stream_time_ms_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+    const adv_live_stream_client_id_t client_id = http_server_get_live_client_id_from_params(p_params);
+    if (ADV_LIVE_STREAM_CLIENT_ID_INVALID == client_id)
+    {
+        return http_server_resp_live_subscribe(now);
+    }
+    str_buf_t str_buf_unsubscribe = http_server_get_from_params(p_params, "unsubscribe=");
+    if (NULL != str_buf_unsubscribe.buf)
+    {
+        const bool flag_unsubscribe = (0 == strcmp("true", str_buf_unsubscribe.buf)) ? true : false;
+        str_buf_free_buf(&str_buf_unsubscribe);
+        if (flag_unsubscribe)
+        {
+            LOG_INFO("Requested /live: unsubscribe client %lu", (printf_ulong_t)client_id);
+            adv_live_stream_unsubscribe(client_id);
+            return http_server_resp_200_json("{}");
+        }
+    }
+
+    adv_report_table_t* p_reports = adv_report_pool_checkout();
+    if (NULL == p_reports)
+    {
+        return http_server_resp_503();
+    }
+    adv_table_ticket_t ticket = ADV_TABLE_TICKET_NONE;
+    if (!adv_live_stream_read_begin(client_id, now, p_reports, &ticket))
+    {
+        adv_report_pool_return(p_reports);
+        LOG_INFO("Requested /live: unknown client %lu", (printf_ulong_t)client_id);
+        return http_server_resp_404();
+    }
+    LOG_DBG(
+        "Requested /live: client %lu, num_advs=%lu",
+        (printf_ulong_t)client_id,
+        (printf_ulong_t)p_reports->num_of_advs);
+
+    json_stream_gen_t* p_gen = http_server_create_stream_gen_advs(
+        p_reports,
+        http_server_get_decode_from_params(p_params),
+        gw_cfg_get_ntp_use());
+    if (NULL == p_gen)
+    {
+        // The advs are returned to the client, so they will be sent in response to the next poll
+        adv_live_stream_read_rollback(client_id, ticket);
+        return http_server_resp_503();
+    }
+    adv_live_stream_read_commit(client_id, ticket);
+    return http_server_resp_200_json_generator(p_gen);
+}
+
 HTTP_SERVER_CB_STATIC
 http_content_type_e
 http_get_content_type_by_ext(const char* p_file_ext)
@@ -405,6 +624,41 @@ http_get_content_type_by_ext(const char* p_file_ext)
     return HTTP_CONTENT_TYPE_APPLICATION_OCTET_STREAM;
 }
 
+static bool
+http_server_is_gzipped_ext(const char* const p_file_ext)
+{
+    return (0 == strcmp(".js", p_file_ext)) || (0 == strcmp(".html", p_file_ext)) || (0 == strcmp(".css", p_file_ext));
+}
+
+static const char*
+http_server_get_file_ext(const char* const p_file_path)
+{
+    const char* const p_file_ext = strrchr(p_file_path, '.');
+    return (NULL != p_file_ext) ? p_file_ext : "";
+}
+
+static const gwui_manifest_entry_t*
+http_server_gwui_manifest_find(const char* const p_file_path)
+{
+    if (http_server_is_gzipped_ext(http_server_get_file_ext(p_file_path)))
+    {
+        char tmp_file_path[GWUI_MANIFEST_FILE_NAME_MAX_LEN];
+        (void)snprintf(tmp_file_path, sizeof(tmp_file_path), "%s.gz", p_file_path);
+        const gwui_manifest_entry_t* const p_entry = gwui_manifest_find(tmp_file_path);
+        if (NULL != p_entry)
+        {
+            return p_entry;
+        }
+    }
+    return gwui_manifest_find(p_file_path);
+}
+
+static const char*
+http_server_get_file_path(const char* const p_path)
+{
+    return ('\0' == p_path[0]) ? "ruuvi.html" : p_path;
+}
+
 HTTP_SERVER_CB_STATIC
 http_server_resp_t
 http_server_resp_file(const char* file_path, const http_resp_code_e http_resp_code)
@@ -417,14 +671,11 @@ http_server_resp_file(const char* file_path, const http_resp_code_e http_resp_co
     }
     const flash_fat_fs_t* p_ffs = gp_ffs_gwui;
 
-    const char* p_file_ext = strrchr(file_path, '.');
-    if (NULL == p_file_ext)
-    {
-        p_file_ext = "";
-    }
+    const char* const p_file_ext = http_server_get_file_ext(file_path);
 
     size_t            file_size         = 0;
     bool              is_gzipped        = false;
+    bool              flag_no_cache     = true;
     char              tmp_file_path[64] = { '\0' };
     const char* const p_suffix_gz       = ".gz";
     const size_t      suffix_gz_len     = strlen(p_suffix_gz);
@@ -433,21 +684,37 @@ http_server_resp_file(const char* file_path, const http_resp_code_e http_resp_co
         LOG_ERR("Temporary buffer is not enough for the file path '%s'", file_path);
         return http_server_resp_503();
     }
-    if ((0 == strcmp(".js", p_file_ext)) || (0 == strcmp(".html", p_file_ext)) || (0 == strcmp(".css", p_file_ext)))
+    // TODO: Hashed assets are only served without 'no-cache' for now. Sending the ETag,
+    // 'Cache-Control: max-age=31536000, immutable' and answering If-None-Match with 304 requires
+    // esp32-wifi-manager to pass the request headers to cb_on_http_get and to support these headers
+    // in http_server_resp_t, this is tracked as a separate change of the component.
+    const gwui_manifest_entry_t* const p_entry = http_server_gwui_manifest_find(file_path);
+    if (NULL != p_entry)
     {
-        (void)snprintf(tmp_file_path, sizeof(tmp_file_path), "%s%s", file_path, p_suffix_gz);
-        if (flashfatfs_get_file_size(p_ffs, tmp_file_path, &file_size))
-        {
-            is_gzipped = true;
-        }
+        // File size is taken from the manifest to avoid FAT directory scans on every request
+        (void)snprintf(tmp_file_path, sizeof(tmp_file_path), "%s", p_entry->file_name);
+        file_size     = p_entry->file_size;
+        is_gzipped    = (0 == strcmp(p_suffix_gz, http_server_get_file_ext(p_entry->file_name))) ? true : false;
+        flag_no_cache = !p_entry->flag_immutable;
     }
-    if (!is_gzipped)
+    else
     {
-        (void)snprintf(tmp_file_path, sizeof(tmp_file_path), "%s", file_path);
-        if (!flashfatfs_get_file_size(p_ffs, tmp_file_path, &file_size))
+        if (http_server_is_gzipped_ext(p_file_ext))
+        {
+            (void)snprintf(tmp_file_path, sizeof(tmp_file_path), "%s%s", file_path, p_suffix_gz);
+            if (flashfatfs_get_file_size(p_ffs, tmp_file_path, &file_size))
+            {
+                is_gzipped = true;
+            }
+        }
+        if (!is_gzipped)
         {
-            LOG_ERR("Can't find file: %s", tmp_file_path);
-            return http_server_resp_404();
+            (void)snprintf(tmp_file_path, sizeof(tmp_file_path), "%s", file_path);
+            if (!flashfatfs_get_file_size(p_ffs, tmp_file_path, &file_size))
+            {
+                LOG_ERR("Can't find file: %s", tmp_file_path);
+                return http_server_resp_404();
+            }
         }
     }
     const http_content_type_e     content_type     = http_get_content_type_by_ext(p_file_ext);
@@ -461,7 +728,6 @@ http_server_resp_file(const char* file_path, const http_resp_code_e http_resp_co
         return http_server_resp_503();
     }
     LOG_DBG("File %s was opened successfully, fd=%d", tmp_file_path, file_desc);
-    const bool flag_no_cache = true;
     return http_server_resp_data_from_file(
         http_resp_code,
         content_type,
@@ -472,6 +738,35 @@ http_server_resp_file(const char* file_path, const http_resp_code_e http_resp_co
         flag_no_cache);
 }
 
+/**
+ * @brief Estimate the amount of heap required to generate and send the response to GET request.
+ * @note /history, /live and /info.json make a copy of adv_table, /adv_log generates the text of all the log records,
+ *       /validate_url opens the outgoing connection, other responses are generated or sent by small chunks.
+ */
+static uint32_t
+http_server_estimate_resp_mem_size(const char* const p_path)
+{
+    if ((0 == strcmp(p_path, "history")) || (0 == strcmp(p_path, "live")) || (0 == strcmp(p_path, "info.json")))
+    {
+        return HTTP_MEM_BUDGET_HTTP_SERVER_RESP + (uint32_t)sizeof(adv_report_table_t);
+    }
+    if (0 == strcmp(p_path, "adv_log"))
+    {
+        return HTTP_MEM_BUDGET_HTTP_SERVER_RESP + ADV_LOG_RING_MAX_TEXT_SIZE;
+    }
+    if (0 == strcmp(p_path, "validate_url"))
+    {
+        return HTTP_MEM_BUDGET_HTTP_SERVER_RESP + HTTP_MEM_BUDGET_HTTP_POST;
+    }
+#if RUUVI_UART_CAPTURE
+    if (0 == strcmp(p_path, "uart_capture"))
+    {
+        return HTTP_MEM_BUDGET_HTTP_SERVER_RESP + UART_CAPTURE_BUF_SIZE;
+    }
+#endif
+    return HTTP_MEM_BUDGET_HTTP_SERVER_RESP;
+}
+
 http_server_resp_t
 http_server_cb_on_get(
     const char* const               p_path,
@@ -486,6 +781,12 @@ http_server_cb_on_get(
         (NULL != p_uri_params) ? "?" : "",
         (NULL != p_uri_params) ? p_uri_params : "");
 
+    if (!http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, http_server_estimate_resp_mem_size(p_path)))
+    {
+        LOG_WARN("Not enough memory budget to handle GET /%s, try again later", p_path);
+        return http_server_resp_503();
+    }
+
     if ((NULL != p_file_ext) && (0 == strcmp(p_file_ext, ".json")))
     {
         return http_server_resp_json(p_path, flag_access_from_lan);
@@ -498,12 +799,26 @@ http_server_cb_on_get(
     {
         return http_server_resp_history(p_uri_params);
     }
+    if (0 == strcmp(p_path, "live"))
+    {
+        return http_server_resp_live(p_uri_params);
+    }
+    if (0 == strcmp(p_path, "adv_log"))
+    {
+        return http_server_resp_adv_log();
+    }
+#if RUUVI_UART_CAPTURE
+    if (0 == strcmp(p_path, "uart_capture"))
+    {
+        return http_server_resp_uart_capture();
+    }
+#endif
     if (0 == strcmp(p_path, "validate_url"))
     {
         LOG_INFO("%s: Clear all saved TLS session tickets", __func__);
         esp_transport_ssl_clear_saved_session_tickets();
         return validate_url(p_uri_params);
     }
-    const char* p_file_path = ('\0' == p_path[0]) ? "ruuvi.html" : p_path;
+    const char* p_file_path = http_server_get_file_path(p_path);
     return http_server_resp_file(p_file_path, (NULL != p_resp_auth) ? p_resp_auth->http_resp_code : HTTP_RESP_CODE_200);
 }
@@ -23,6 +23,7 @@
 #include "reset_task.h"
 #include "event_mgr.h"
 #include "esp_transport_ssl.h"
+#include "http_mem_budget.h"
 
 #if RUUVI_TESTS_HTTP_SERVER_CB
 #define LOG_LOCAL_LEVEL LOG_LEVEL_DEBUG
@@ -273,6 +274,25 @@ http_server_cb_on_post_init_storage(const char* const p_uri_params)
     return http_server_resp_200_json("{}");
 }
 
+/**
+ * @brief Estimate the amount of heap required to handle POST request.
+ * @note POST /ruuvi.json makes a copy of gw_cfg, POST /fw_update.json and /gw_cfg_download open the outgoing
+ *       connection to download the files, other requests are handled with small allocations.
+ */
+static uint32_t
+http_server_estimate_post_mem_size(const char* const p_file_name)
+{
+    if (0 == strcmp(p_file_name, "ruuvi.json"))
+    {
+        return HTTP_MEM_BUDGET_HTTP_SERVER_RESP + (uint32_t)sizeof(gw_cfg_t);
+    }
+    if ((0 == strcmp(p_file_name, "fw_update.json")) || (0 == strcmp(p_file_name, "gw_cfg_download")))
+    {
+        return HTTP_MEM_BUDGET_HTTP_SERVER_RESP + HTTP_MEM_BUDGET_HTTP_POST;
+    }
+    return HTTP_MEM_BUDGET_HTTP_SERVER_RESP;
+}
+
 http_server_resp_t
 http_server_cb_on_post(
     const char* const p_file_name,
@@ -281,6 +301,13 @@ http_server_cb_on_post(
     const bool        flag_access_from_lan)
 {
     LOG_DBG("http_server_cb_on_post /%s, params=%s", p_file_name, (NULL != p_uri_params) ? p_uri_params : "");
+    if (!http_mem_budget_reserve(
+            HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP,
+            http_server_estimate_post_mem_size(p_file_name)))
+    {
+        LOG_WARN("Not enough memory budget to handle POST /%s, try again later", p_file_name);
+        return http_server_resp_503();
+    }
     if (0 == strcmp(p_file_name, "fw_update_reset"))
     {
         return http_server_cb_on_post_fw_update_reset();
@@ -25,6 +25,8 @@
 #include "gw_cfg_log.h"
 #include "reset_task.h"
 #include "runtime_stat.h"
+#include "heap_prof.h"
+#include "esp_heap_caps.h"
 
 #define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
 #include "log.h"
@@ -206,6 +208,7 @@ main_task_handle_sig_log_heap_usage(void)
             "free heap: %lu .. %lu",
             (printf_ulong_t)g_heap_usage_min_free_heap,
             (printf_ulong_t)g_heap_usage_max_free_heap);
+        heap_prof_register_largest_free_block((uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
         if (g_heap_usage_max_free_heap < (RUUVI_FREE_HEAP_LIM_KIB * RUUVI_NUM_BYTES_IN_1KB))
         {
             g_heap_limit_cnt += 1;
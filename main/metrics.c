@@ -20,8 +20,18 @@
 #include "nrf52fw.h"
 #include "fw_ver.h"
 #include "fw_update.h"
-#include "cjson_wrap.h"
-#include "gw_cfg_ruuvi_json.h"
+#include "gw_cfg_json_stream_gen.h"
+#include "event_mgr.h"
+#include "mqtt.h"
+#include "boot_timeline.h"
+#include "adv_post_sched.h"
+#include "http_async_gov.h"
+#include "http_mem_budget.h"
+#include "runtime_stat.h"
+#include "heap_prof.h"
+#include "adv_report_pool.h"
+#include "adv_live_stream.h"
+#include "adv_log_ring.h"
 
 #define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
 #include "log.h"
@@ -105,6 +115,18 @@ typedef struct metrics_info_t
     metrics_sha256_str_t        gw_cfg_sha256;
     metrics_crc32_str_t         ruuvi_json_crc32;
     metrics_sha256_str_t        ruuvi_json_sha256;
+    event_mgr_ev_stat_t         event_mgr_stat[EVENT_MGR_EV_LAST];
+    mqtt_stat_t                 mqtt_stat;
+    boot_timeline_t             boot_timeline;
+    adv_post_sched_stat_t       adv_post_sched_stat[ADV_POST_SCHED_TARGET_LAST];
+    http_async_gov_stat_t       http_async_gov_stat;
+    http_mem_budget_stat_t      http_mem_budget_stat;
+    uint32_t                    num_tasks_metrics;
+    runtime_stat_task_metrics_t tasks_metrics[RUNTIME_STAT_MAX_NUM_TASKS];
+    heap_prof_stat_t            heap_prof_stat;
+    adv_report_pool_stat_t      adv_report_pool_stat;
+    adv_live_stream_stat_t      adv_live_stream_stat;
+    adv_log_ring_stat_t         adv_log_ring_stat;
 } metrics_info_t;
 
 typedef struct metrics_tmp_buf_t
@@ -254,26 +276,33 @@ metrics_calc_ruuvi_json_hash(
     memset(p_crc32, 0, sizeof(*p_crc32));
     memset(p_sha256, 0, sizeof(*p_sha256));
 
-    const gw_cfg_t*  p_gw_cfg = gw_cfg_lock_ro();
-    cjson_wrap_str_t json_str = cjson_wrap_str_null();
-    if (!gw_cfg_ruuvi_json_generate(p_gw_cfg, &json_str))
+    const gw_cfg_t*    p_gw_cfg = gw_cfg_lock_ro();
+    json_stream_gen_t* p_gen    = gw_cfg_json_stream_gen_create_for_ui_client(p_gw_cfg);
+    gw_cfg_unlock_ro(&p_gw_cfg);
+    if (NULL == p_gen)
     {
-        gw_cfg_unlock_ro(&p_gw_cfg);
         return;
     }
-    gw_cfg_unlock_ro(&p_gw_cfg);
-
-    const metrics_crc32_t crc32 = {
-        .val = crc32_le(0, (const void*)json_str.p_str, strlen(json_str.p_str)),
-    };
 
+    // ruuvi.json is hashed chunk by chunk, so there is no need to keep the whole json in memory.
+    metrics_crc32_t crc32 = { .val = 0 };
     mbedtls_sha256_init(p_tmp_sha256_ctx);
     mbedtls_sha256_starts_ret(p_tmp_sha256_ctx, false);
-    mbedtls_sha256_update_ret(p_tmp_sha256_ctx, (const void*)json_str.p_str, strlen(json_str.p_str));
+    while (true)
+    {
+        const char* const p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if ((NULL == p_chunk) || ('\0' == *p_chunk))
+        {
+            break;
+        }
+        const size_t chunk_len = strlen(p_chunk);
+        crc32.val              = crc32_le(crc32.val, (const void*)p_chunk, chunk_len);
+        mbedtls_sha256_update_ret(p_tmp_sha256_ctx, (const void*)p_chunk, chunk_len);
+    }
     mbedtls_sha256_finish_ret(p_tmp_sha256_ctx, p_tmp_sha256->buf);
     mbedtls_sha256_free(p_tmp_sha256_ctx);
 
-    os_free(json_str.p_str);
+    json_stream_gen_delete(&p_gen);
 
     (void)snprintf(p_crc32->buf, sizeof(p_crc32->buf), "%lu", (printf_ulong_t)crc32.val);
     str_buf_t str_buf = STR_BUF_INIT(p_sha256->buf, sizeof(p_sha256->buf));
@@ -347,6 +376,25 @@ gen_metrics(void)
     p_metrics->gw_cfg_sha256                    = p_tmp_buf->gw_cfg_sha256_str;
     p_metrics->ruuvi_json_crc32                 = p_tmp_buf->ruuvi_json_crc32_str;
     p_metrics->ruuvi_json_sha256                = p_tmp_buf->ruuvi_json_sha256_str;
+    for (uint32_t i = EVENT_MGR_EV_NONE + 1; i < EVENT_MGR_EV_LAST; ++i)
+    {
+        event_mgr_get_stat((event_mgr_ev_e)i, &p_metrics->event_mgr_stat[i]);
+    }
+    mqtt_get_stat(&p_metrics->mqtt_stat);
+    boot_timeline_get(&p_metrics->boot_timeline);
+    for (uint32_t i = 0; i < ADV_POST_SCHED_TARGET_LAST; ++i)
+    {
+        adv_post_sched_get_stat((adv_post_sched_target_e)i, &p_metrics->adv_post_sched_stat[i]);
+    }
+    http_async_gov_get_stat(&p_metrics->http_async_gov_stat);
+    http_mem_budget_get_stat(&p_metrics->http_mem_budget_stat);
+    p_metrics->num_tasks_metrics = runtime_stat_get_tasks_metrics(
+        p_metrics->tasks_metrics,
+        sizeof(p_metrics->tasks_metrics) / sizeof(*p_metrics->tasks_metrics));
+    heap_prof_get_stat(&p_metrics->heap_prof_stat);
+    adv_report_pool_get_stat(&p_metrics->adv_report_pool_stat);
+    adv_live_stream_get_stat(&p_metrics->adv_live_stream_stat);
+    adv_log_ring_get_stat(&p_metrics->adv_log_ring_stat);
 
     os_free(p_tmp_buf);
 
@@ -490,6 +538,340 @@ metrics_print_gw_cfg_info(str_buf_t* const p_str_buf, const metrics_info_t* cons
 #endif
 }
 
+static void
+metrics_print_event_mgr_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    for (uint32_t i = EVENT_MGR_EV_NONE + 1; i < EVENT_MGR_EV_LAST; ++i)
+    {
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "event_notify_total{event=\"%s\"} %lu\n",
+            event_mgr_get_ev_name((event_mgr_ev_e)i),
+            (printf_ulong_t)p_metrics->event_mgr_stat[i].cnt_notify);
+    }
+
+    // Coalescing of signals is used only for the high-rate event EVENT_MGR_EV_RECV_ADV
+    const event_mgr_ev_stat_t* const p_stat      = &p_metrics->event_mgr_stat[EVENT_MGR_EV_RECV_ADV];
+    const char* const                p_name      = event_mgr_get_ev_name(EVENT_MGR_EV_RECV_ADV);
+    const uint64_t                   cnt_sigs    = (uint64_t)p_stat->cnt_sent + p_stat->cnt_coalesced;
+    uint32_t                         ratio_x1000 = 0;
+    if (0 != cnt_sigs)
+    {
+        ratio_x1000 = (uint32_t)(((uint64_t)p_stat->cnt_coalesced * 1000U) / cnt_sigs);
+    }
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "event_signals_sent_total{event=\"%s\"} %lu\n",
+        p_name,
+        (printf_ulong_t)p_stat->cnt_sent);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "event_signals_coalesced_total{event=\"%s\"} %lu\n",
+        p_name,
+        (printf_ulong_t)p_stat->cnt_coalesced);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "event_signals_coalesce_ratio{event=\"%s\"} %lu.%03lu\n",
+        p_name,
+        (printf_ulong_t)(ratio_x1000 / 1000U),
+        (printf_ulong_t)(ratio_x1000 % 1000U));
+}
+
+static void
+metrics_print_mqtt_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    const mqtt_stat_t* const           p_stat      = &p_metrics->mqtt_stat;
+    const mqtt_in_flight_stat_t* const p_in_flight = &p_stat->in_flight;
+    str_buf_printf(p_str_buf, METRICS_PREFIX "mqtt_qos %u\n", (printf_uint_t)p_stat->qos);
+    str_buf_printf(p_str_buf, METRICS_PREFIX "mqtt_outbox_size_bytes %lu\n", (printf_ulong_t)p_stat->outbox_size);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_in_flight_msgs %lu\n",
+        (printf_ulong_t)p_in_flight->num_in_flight);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_published_msgs_total{qos=\"1+\"} %lu\n",
+        (printf_ulong_t)p_in_flight->cnt_published);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_lost_msgs_total{qos=\"1+\"} %lu\n",
+        (printf_ulong_t)p_in_flight->cnt_lost);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_puback_latency_ms_sum %lld\n",
+        (printf_long_long_t)p_in_flight->ack_latency_ms_sum);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_puback_latency_ms_count %lu\n",
+        (printf_ulong_t)p_in_flight->cnt_acked);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_puback_latency_ms_max %lu\n",
+        (printf_ulong_t)p_in_flight->ack_latency_ms_max);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_topic_cache_hits_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_topic_cache_hits);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_topic_cache_rebuilds_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_topic_cache_rebuilds);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_topic_bytes_total %lld\n",
+        (printf_long_long_t)p_stat->topic_bytes_total);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "mqtt_topic_cache_saved_bytes_total %lld\n",
+        (printf_long_long_t)p_stat->topic_cache_saved_bytes);
+}
+
+static void
+metrics_print_boot_timeline(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    for (uint32_t i = 0; i < BOOT_TIMELINE_STAGE_LAST; ++i)
+    {
+        const boot_timeline_timestamp_us_t timestamp_us = p_metrics->boot_timeline.stages[i];
+        if (0 == timestamp_us)
+        {
+            continue; // The stage was not reached yet
+        }
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "boot_stage_timestamp_us{stage=\"%s\"} %lld\n",
+            boot_timeline_get_stage_name((boot_timeline_stage_e)i),
+            (printf_long_long_t)timestamp_us);
+    }
+}
+
+static void
+metrics_print_adv_post_sched_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    for (uint32_t i = 0; i < ADV_POST_SCHED_TARGET_LAST; ++i)
+    {
+        const adv_post_sched_stat_t* const p_stat = &p_metrics->adv_post_sched_stat[i];
+        const char* const                  p_name = adv_post_sched_get_target_name((adv_post_sched_target_e)i);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "adv_post_started_total{target=\"%s\"} %lu\n",
+            p_name,
+            (printf_ulong_t)p_stat->cnt_started);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "adv_post_failed_total{target=\"%s\"} %lu\n",
+            p_name,
+            (printf_ulong_t)p_stat->cnt_failed);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "adv_post_deadline_missed_total{target=\"%s\"} %lu\n",
+            p_name,
+            (printf_ulong_t)p_stat->cnt_deadline_missed);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "adv_post_rate_limited_total{target=\"%s\"} %lu\n",
+            p_name,
+            (printf_ulong_t)p_stat->cnt_rate_limited);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "adv_post_skipped_backoff_total{target=\"%s\"} %lu\n",
+            p_name,
+            (printf_ulong_t)p_stat->cnt_skipped_backoff);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "adv_post_aged_out_total{target=\"%s\"} %lu\n",
+            p_name,
+            (printf_ulong_t)p_stat->cnt_aged_out);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "adv_post_queueing_delay_ms_sum{target=\"%s\"} %lld\n",
+            p_name,
+            (printf_long_long_t)p_stat->queueing_delay_ms_sum);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "adv_post_queueing_delay_ms_max{target=\"%s\"} %lu\n",
+            p_name,
+            (printf_ulong_t)p_stat->queueing_delay_ms_max);
+    }
+}
+
+static void
+metrics_print_http_async_gov_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    const http_async_gov_stat_t* const p_stat = &p_metrics->http_async_gov_stat;
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "http_async_concurrent_admitted_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_concurrent_admitted);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "http_async_serial_fallback_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_serial_fallback);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "http_async_mem_budget_exceeded_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_mem_budget_exceeded);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "http_async_max_mem_usage_per_req_bytes %lu\n",
+        (printf_ulong_t)p_stat->max_mem_usage_per_req);
+}
+
+static void
+metrics_print_http_mem_budget_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    const http_mem_budget_stat_t* const p_stat = &p_metrics->http_mem_budget_stat;
+    for (uint32_t i = 0; i < HTTP_MEM_BUDGET_CLIENT_NUM; ++i)
+    {
+        const char* const p_name = http_mem_budget_get_client_name((http_mem_budget_client_e)i);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "http_mem_budget_admitted_total{client=\"%s\"} %lu\n",
+            p_name,
+            (printf_ulong_t)p_stat->cnt_admitted[i]);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "http_mem_budget_rejected_total{client=\"%s\"} %lu\n",
+            p_name,
+            (printf_ulong_t)p_stat->cnt_rejected[i]);
+    }
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "http_mem_budget_max_reserved_bytes %lu\n",
+        (printf_ulong_t)p_stat->max_reserved);
+}
+
+static void
+metrics_print_runtime_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    for (uint32_t i = 0; i < p_metrics->num_tasks_metrics; ++i)
+    {
+        const runtime_stat_task_metrics_t* const p_task = &p_metrics->tasks_metrics[i];
+        if (RUNTIME_STAT_CPU_USAGE_UNKNOWN != p_task->cpu_usage_percent)
+        {
+            str_buf_printf(
+                p_str_buf,
+                METRICS_PREFIX "task_cpu_usage_percent{task=\"%s\",task_num=\"%lu\"} %lu\n",
+                p_task->task_name,
+                (printf_ulong_t)p_task->task_number,
+                (printf_ulong_t)p_task->cpu_usage_percent);
+        }
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "task_stack_size_bytes{task=\"%s\",task_num=\"%lu\"} %lu\n",
+            p_task->task_name,
+            (printf_ulong_t)p_task->task_number,
+            (printf_ulong_t)p_task->stack_size);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "task_stack_free_min_bytes{task=\"%s\",task_num=\"%lu\"} %lu\n",
+            p_task->task_name,
+            (printf_ulong_t)p_task->task_number,
+            (printf_ulong_t)p_task->min_free_stack_size);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "task_state{task=\"%s\",task_num=\"%lu\",state=\"%s\"} 1\n",
+            p_task->task_name,
+            (printf_ulong_t)p_task->task_number,
+            p_task->p_state);
+    }
+}
+
+static void
+metrics_print_heap_prof_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    const heap_prof_stat_t* const p_stat = &p_metrics->heap_prof_stat;
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "heap_largest_free_block_min_bytes %lu\n",
+        (printf_ulong_t)p_stat->largest_free_blk_min);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "heap_largest_free_block_trend_bytes %ld\n",
+        (printf_long_t)p_stat->largest_free_blk_trend);
+    if (!p_stat->flag_enabled)
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < HEAP_PROF_TAG_NUM; ++i)
+    {
+        const char* const                 p_tag_name = heap_prof_get_tag_name((heap_prof_tag_e)i);
+        const heap_prof_tag_stat_t* const p_tag_stat = &p_stat->tags[i];
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "heap_prof_live_bytes{tag=\"%s\"} %lu\n",
+            p_tag_name,
+            (printf_ulong_t)p_tag_stat->live_bytes);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "heap_prof_peak_bytes{tag=\"%s\"} %lu\n",
+            p_tag_name,
+            (printf_ulong_t)p_tag_stat->peak_bytes);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "heap_prof_alloc_total{tag=\"%s\"} %lu\n",
+            p_tag_name,
+            (printf_ulong_t)p_tag_stat->cnt_alloc);
+        str_buf_printf(
+            p_str_buf,
+            METRICS_PREFIX "heap_prof_alloc_failed_total{tag=\"%s\"} %lu\n",
+            p_tag_name,
+            (printf_ulong_t)p_tag_stat->cnt_alloc_failed);
+    }
+}
+
+static void
+metrics_print_adv_report_pool_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    const adv_report_pool_stat_t* const p_stat = &p_metrics->adv_report_pool_stat;
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "adv_report_pool_checkout_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_checkout);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "adv_report_pool_exhausted_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_exhausted);
+    str_buf_printf(p_str_buf, METRICS_PREFIX "adv_report_pool_in_use %lu\n", (printf_ulong_t)p_stat->num_in_use);
+    str_buf_printf(p_str_buf, METRICS_PREFIX "adv_report_pool_max_in_use %lu\n", (printf_ulong_t)p_stat->max_in_use);
+}
+
+static void
+metrics_print_adv_live_stream_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    const adv_live_stream_stat_t* const p_stat = &p_metrics->adv_live_stream_stat;
+    str_buf_printf(p_str_buf, METRICS_PREFIX "live_stream_clients %lu\n", (printf_ulong_t)p_stat->num_clients);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "live_stream_subscribed_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_subscribed);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "live_stream_rejected_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_rejected);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "live_stream_expired_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_expired);
+    str_buf_printf(p_str_buf, METRICS_PREFIX "live_stream_polls_total %lu\n", (printf_ulong_t)p_stat->cnt_polls);
+    str_buf_printf(p_str_buf, METRICS_PREFIX "live_stream_advs_total %lu\n", (printf_ulong_t)p_stat->cnt_advs);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "live_stream_max_advs_per_poll %lu\n",
+        (printf_ulong_t)p_stat->max_advs_per_poll);
+}
+
+static void
+metrics_print_adv_log_ring_stat(str_buf_t* const p_str_buf, const metrics_info_t* const p_metrics)
+{
+    const adv_log_ring_stat_t* const p_stat = &p_metrics->adv_log_ring_stat;
+    str_buf_printf(p_str_buf, METRICS_PREFIX "adv_log_records_total %lu\n", (printf_ulong_t)p_stat->cnt_put);
+    str_buf_printf(
+        p_str_buf,
+        METRICS_PREFIX "adv_log_overwritten_total %lu\n",
+        (printf_ulong_t)p_stat->cnt_overwritten);
+    str_buf_printf(p_str_buf, METRICS_PREFIX "adv_log_dropped_total %lu\n", (printf_ulong_t)p_stat->cnt_dropped);
+}
+
 static void
 metrics_print(str_buf_t* p_str_buf, const metrics_info_t* p_metrics)
 {
@@ -506,10 +888,21 @@ metrics_print(str_buf_t* p_str_buf, const metrics_info_t* p_metrics)
         METRICS_PREFIX "received_coded_advertisements %lld\n",
         (printf_long_long_t)p_metrics->received_coded_advertisements);
     str_buf_printf(p_str_buf, METRICS_PREFIX "uptime_us %lld\n", (printf_long_long_t)p_metrics->uptime_us);
+    metrics_print_boot_timeline(p_str_buf, p_metrics);
     metrics_print_total_free_bytes(p_str_buf, p_metrics);
     metrics_print_largest_free_blk(p_str_buf, p_metrics);
     metrics_print_gwinfo(p_str_buf, p_metrics);
     metrics_print_gw_cfg_info(p_str_buf, p_metrics);
+    metrics_print_event_mgr_stat(p_str_buf, p_metrics);
+    metrics_print_mqtt_stat(p_str_buf, p_metrics);
+    metrics_print_adv_post_sched_stat(p_str_buf, p_metrics);
+    metrics_print_http_async_gov_stat(p_str_buf, p_metrics);
+    metrics_print_http_mem_budget_stat(p_str_buf, p_metrics);
+    metrics_print_runtime_stat(p_str_buf, p_metrics);
+    metrics_print_heap_prof_stat(p_str_buf, p_metrics);
+    metrics_print_adv_report_pool_stat(p_str_buf, p_metrics);
+    metrics_print_adv_live_stream_stat(p_str_buf, p_metrics);
+    metrics_print_adv_log_ring_stat(p_str_buf, p_metrics);
 }
 
 char*
@@ -7,6 +7,8 @@
 
 #include "mqtt.h"
 #include <esp_task_wdt.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "esp_err.h"
 #include "cJSON.h"
 #include "cjson_wrap.h"
@@ -24,6 +26,7 @@
 #include "snprintf_with_esp_err_desc.h"
 #include "gw_cfg_storage.h"
 #include "event_mgr.h"
+#include "mqtt_in_flight.h"
 
 #define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
 #include "log.h"
@@ -32,8 +35,6 @@
 #warning Debug log level prints out the passwords as a "plaintext".
 #endif
 
-#define MQTT_QOS 0
-
 #define TOPIC_LEN 512
 
 /**
@@ -61,14 +62,34 @@ typedef struct mqtt_topic_buf_t
     char buf[TOPIC_LEN];
 } mqtt_topic_buf_t;
 
+_Static_assert(
+    (GW_CFG_MAX_MQTT_PREFIX_LEN + sizeof(((mac_address_str_t*)NULL)->str_buf)) <= TOPIC_LEN,
+    "TOPIC_LEN is too small for the topic of advs");
+
+/**
+ * @brief The topic of the advs is "<prefix><tag MAC>", the prefix is rendered only when the config is applied,
+ *        so publishing an adv just appends the MAC string which is already cached in adv_report_t.
+ */
+typedef struct mqtt_adv_topic_cache_t
+{
+    mqtt_topic_buf_t topic;
+    size_t           prefix_len;
+    uint32_t         cnt_hits;
+    uint32_t         cnt_rebuilds;
+    uint64_t         topic_bytes_total;
+    uint64_t         saved_bytes_total; //!< The prefix bytes which were reused instead of being formatted again
+} mqtt_adv_topic_cache_t;
+
 #define MQTT_PROTECTED_DATA_ERR_MSG_SIZE 120
 
 typedef struct mqtt_protected_data_t
 {
     esp_mqtt_client_handle_t   p_mqtt_client;
     mqtt_topic_buf_t           mqtt_topic;
+    mqtt_adv_topic_cache_t     adv_topic_cache;
     ruuvi_gw_cfg_mqtt_prefix_t mqtt_prefix;
     bool                       mqtt_disable_retained_messages;
+    gw_cfg_mqtt_qos_t          mqtt_qos;
     char                       err_msg[MQTT_PROTECTED_DATA_ERR_MSG_SIZE];
     str_buf_t                  str_buf_server_cert_mqtt;
     str_buf_t                  str_buf_client_cert;
@@ -123,85 +144,266 @@ mqtt_create_full_topic(
     }
 }
 
-bool
-mqtt_is_buffer_available_for_publish(void)
+static void
+mqtt_adv_topic_cache_rebuild(mqtt_adv_topic_cache_t* const p_cache, const char* const p_prefix_str)
 {
-    if (0 == MQTT_QOS)
+    mqtt_create_full_topic(&p_cache->topic, p_prefix_str, "");
+    p_cache->prefix_len = strlen(p_cache->topic.buf);
+    p_cache->cnt_rebuilds += 1;
+}
+
+/**
+ * @brief Complete the cached topic prefix with the MAC address of the tag.
+ * @param p_cache - pointer to the cache.
+ * @param p_tag_mac_str - pointer to the MAC address of the tag.
+ * @param[out] p_topic_len - length of the full topic.
+ * @return pointer to the full topic, it's valid until the next call.
+ */
+static const char*
+mqtt_adv_topic_cache_get(
+    mqtt_adv_topic_cache_t* const  p_cache,
+    const mac_address_str_t* const p_tag_mac_str,
+    size_t* const                  p_topic_len)
+{
+    memcpy(&p_cache->topic.buf[p_cache->prefix_len], p_tag_mac_str->str_buf, sizeof(p_tag_mac_str->str_buf));
+    *p_topic_len = p_cache->prefix_len + strlen(p_tag_mac_str->str_buf);
+    p_cache->cnt_hits += 1;
+    p_cache->saved_bytes_total += p_cache->prefix_len;
+    return p_cache->topic.buf;
+}
+
+static uint32_t
+mqtt_get_timestamp_ms(void)
+{
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+/**
+ * @brief Check if there is a room in the outbox for one more message.
+ * @note QoS>0 messages stay in the outbox until PUBACK/PUBCOMP is received (also while the connection is lost),
+ *       so when the outbox is almost full, the draining of the retransmission list must be paused,
+ *       otherwise esp_mqtt_client_publish fails and the advs are lost.
+ */
+static bool
+mqtt_is_outbox_available_unsafe(const mqtt_protected_data_t* const p_mqtt_data)
+{
+    if (0 == p_mqtt_data->mqtt_qos)
     {
         return true;
     }
+    const int32_t outbox_size = esp_mqtt_client_get_outbox_size(p_mqtt_data->p_mqtt_client);
+    return (outbox_size < (CONFIG_MQTT_OUTBOX_MAX_SIZE - CONFIG_MQTT_BUFFER_SIZE)) ? true : false;
+}
+
+static mqtt_message_id_t
+mqtt_publish_unsafe(
+    const mqtt_protected_data_t* const p_mqtt_data,
+    const char* const                  p_topic,
+    const char* const                  p_data,
+    const esp_mqtt_client_data_len_t   data_len,
+    const int32_t                      flag_retain)
+{
+    const mqtt_message_id_t msg_id = esp_mqtt_client_publish(
+        p_mqtt_data->p_mqtt_client,
+        p_topic,
+        p_data,
+        data_len,
+        p_mqtt_data->mqtt_qos,
+        flag_retain);
+    if (msg_id > 0)
+    {
+        mqtt_in_flight_on_publish(msg_id, mqtt_get_timestamp_ms());
+    }
+    return msg_id;
+}
+
+bool
+mqtt_is_buffer_available_for_publish(void)
+{
     mqtt_protected_data_t* p_mqtt_data = mqtt_mutex_lock();
-    const int32_t          outbox_size = esp_mqtt_client_get_outbox_size(p_mqtt_data->p_mqtt_client);
-    const bool is_ready = (outbox_size < (CONFIG_MQTT_OUTBOX_MAX_SIZE - CONFIG_MQTT_BUFFER_SIZE)) ? true : false;
+    const bool             is_ready    = mqtt_is_outbox_available_unsafe(p_mqtt_data);
     mqtt_mutex_unlock(&p_mqtt_data);
     return is_ready;
 }
 
+void
+mqtt_get_stat(mqtt_stat_t* const p_stat)
+{
+    mqtt_protected_data_t* p_mqtt_data = mqtt_mutex_lock();
+    p_stat->qos                        = p_mqtt_data->mqtt_qos;
+    p_stat->outbox_size                = (uint32_t)esp_mqtt_client_get_outbox_size(p_mqtt_data->p_mqtt_client);
+    p_stat->cnt_topic_cache_hits       = p_mqtt_data->adv_topic_cache.cnt_hits;
+    p_stat->cnt_topic_cache_rebuilds   = p_mqtt_data->adv_topic_cache.cnt_rebuilds;
+    p_stat->topic_bytes_total          = p_mqtt_data->adv_topic_cache.topic_bytes_total;
+    p_stat->topic_cache_saved_bytes    = p_mqtt_data->adv_topic_cache.saved_bytes_total;
+    mqtt_mutex_unlock(&p_mqtt_data);
+    mqtt_in_flight_get_stat(&p_stat->in_flight, mqtt_get_timestamp_ms());
+}
+
 bool
-mqtt_publish_adv(const adv_report_t* const p_adv, const bool flag_use_timestamps, const time_t timestamp)
+mqtt_publish_adv(
+    mqtt_json_gen_t* const    p_json_gen,
+    const adv_report_t* const p_adv,
+    const bool                flag_use_timestamps,
+    const time_t              timestamp)
 {
-    const gw_cfg_t*              p_gw_cfg       = gw_cfg_lock_ro();
-    const json_stream_gen_size_t max_chunk_size = 1024U;
+    const gw_cfg_t* p_gw_cfg = gw_cfg_lock_ro();
 
-    str_buf_t str_buf_json = mqtt_create_json_str(
+    size_t            json_len = 0;
+    const char* const p_json   = mqtt_json_gen_generate(
+        p_json_gen,
         p_adv,
         flag_use_timestamps,
         timestamp,
         gw_cfg_get_nrf52_mac_addr(),
         p_gw_cfg->ruuvi_cfg.coordinates.buf,
         p_gw_cfg->ruuvi_cfg.mqtt.mqtt_data_format,
-        max_chunk_size);
+        &json_len);
     gw_cfg_unlock_ro(&p_gw_cfg);
 
-    if (NULL == str_buf_json.buf)
+    if (NULL == p_json)
     {
-        LOG_ERR("Failed to create MQTT message JSON string, insufficient buffer size (%u bytes)", max_chunk_size);
+        LOG_ERR(
+            "Failed to create MQTT message JSON string, insufficient buffer size (%u bytes)",
+            MQTT_JSON_GEN_MAX_JSON_LEN);
         return false;
     }
 
-    const mac_address_str_t tag_mac_str = mac_address_to_str(&p_adv->tag_mac);
+    mac_address_str_t              tag_mac_str_tmp;
+    const mac_address_str_t* const p_tag_mac_str = adv_decoded_get_mac_str(
+        &p_adv->tag_mac_str,
+        &p_adv->tag_mac,
+        &tag_mac_str_tmp);
 
     mqtt_protected_data_t* p_mqtt_data = mqtt_mutex_lock();
     if (NULL == p_mqtt_data->p_mqtt_client)
     {
         LOG_ERR("Can't send advs - MQTT was stopped");
         mqtt_mutex_unlock(&p_mqtt_data);
-        str_buf_free_buf(&str_buf_json);
         return false;
     }
-    mqtt_create_full_topic(&p_mqtt_data->mqtt_topic, p_mqtt_data->mqtt_prefix.buf, tag_mac_str.str_buf);
+    size_t            topic_len = 0;
+    const char* const p_topic   = mqtt_adv_topic_cache_get(&p_mqtt_data->adv_topic_cache, p_tag_mac_str, &topic_len);
 
-    const size_t msg_len = strlen(p_mqtt_data->mqtt_topic.buf) + 2U + 2U + strlen(str_buf_json.buf) + 2U;
+    const size_t msg_len = topic_len + 2U + 2U + json_len + 2U;
     if (msg_len > CONFIG_MQTT_BUFFER_SIZE)
     {
         LOG_ERR("MQTT message len is %u bytes which is bigger than buffer size %u", msg_len, CONFIG_MQTT_BUFFER_SIZE);
         mqtt_mutex_unlock(&p_mqtt_data);
-        str_buf_free_buf(&str_buf_json);
         return false;
     }
 
-    LOG_DBG("publish msg with len=%u: topic: %s, data: %s", msg_len, p_mqtt_data->mqtt_topic.buf, str_buf_json.buf);
-    const int32_t mqtt_len              = 0;
+    LOG_DBG("publish msg with len=%u: topic: %s, data: %s", msg_len, p_topic, p_json);
     const int32_t mqtt_flag_retain      = 0;
     bool          is_publish_successful = false;
 
-    if (esp_mqtt_client_publish(
-            p_mqtt_data->p_mqtt_client,
-            p_mqtt_data->mqtt_topic.buf,
-            str_buf_json.buf,
-            mqtt_len,
-            MQTT_QOS,
-            mqtt_flag_retain)
+    if (mqtt_publish_unsafe(p_mqtt_data, p_topic, p_json, (esp_mqtt_client_data_len_t)json_len, mqtt_flag_retain)
         >= 0)
     {
+        p_mqtt_data->adv_topic_cache.topic_bytes_total += topic_len;
         is_publish_successful = true;
     }
     mqtt_mutex_unlock(&p_mqtt_data);
 
-    str_buf_free_buf(&str_buf_json);
     return is_publish_successful;
 }
 
+uint32_t
+mqtt_publish_advs(
+    mqtt_json_gen_t* const    p_json_gen,
+    const adv_report_t* const p_advs,
+    const uint32_t            num_advs,
+    const bool                flag_use_timestamps,
+    const time_t              timestamp,
+    const os_delta_ticks_t    time_budget_ticks,
+    uint32_t* const           p_num_published)
+{
+    const TickType_t tick_start = xTaskGetTickCount();
+
+    *p_num_published = 0;
+
+    const gw_cfg_t*                  p_gw_cfg         = gw_cfg_lock_ro();
+    const ruuvi_gw_cfg_coordinates_t coordinates      = p_gw_cfg->ruuvi_cfg.coordinates;
+    const gw_cfg_mqtt_data_format_e  mqtt_data_format = p_gw_cfg->ruuvi_cfg.mqtt.mqtt_data_format;
+    gw_cfg_unlock_ro(&p_gw_cfg);
+
+    mqtt_protected_data_t* p_mqtt_data = mqtt_mutex_lock();
+    if (NULL == p_mqtt_data->p_mqtt_client)
+    {
+        LOG_ERR("Can't send advs - MQTT was stopped");
+        mqtt_mutex_unlock(&p_mqtt_data);
+        return num_advs;
+    }
+    uint32_t num_processed = 0;
+    while (num_processed < num_advs)
+    {
+        if (!mqtt_is_outbox_available_unsafe(p_mqtt_data))
+        {
+            LOG_DBG("MQTT outbox is full - pause publishing, num_processed=%u", (printf_uint_t)num_processed);
+            break;
+        }
+        const adv_report_t* const p_adv = &p_advs[num_processed];
+        num_processed += 1;
+
+        size_t            json_len = 0;
+        const char* const p_json   = mqtt_json_gen_generate(
+            p_json_gen,
+            p_adv,
+            flag_use_timestamps,
+            timestamp,
+            gw_cfg_get_nrf52_mac_addr(),
+            coordinates.buf,
+            mqtt_data_format,
+            &json_len);
+        if (NULL == p_json)
+        {
+            LOG_ERR(
+                "Failed to create MQTT message JSON string, insufficient buffer size (%u bytes)",
+                MQTT_JSON_GEN_MAX_JSON_LEN);
+            continue;
+        }
+        mac_address_str_t              tag_mac_str_tmp;
+        const mac_address_str_t* const p_tag_mac_str = adv_decoded_get_mac_str(
+            &p_adv->tag_mac_str,
+            &p_adv->tag_mac,
+            &tag_mac_str_tmp);
+        size_t            topic_len = 0;
+        const char* const p_topic   = mqtt_adv_topic_cache_get(
+            &p_mqtt_data->adv_topic_cache,
+            p_tag_mac_str,
+            &topic_len);
+
+        const size_t msg_len = topic_len + 2U + 2U + json_len + 2U;
+        if (msg_len > CONFIG_MQTT_BUFFER_SIZE)
+        {
+            LOG_ERR(
+                "MQTT message len is %u bytes which is bigger than buffer size %u",
+                msg_len,
+                CONFIG_MQTT_BUFFER_SIZE);
+            continue;
+        }
+        LOG_DBG("publish msg with len=%u: topic: %s, data: %s", msg_len, p_topic, p_json);
+        const int32_t mqtt_flag_retain = 0;
+        if (mqtt_publish_unsafe(p_mqtt_data, p_topic, p_json, (esp_mqtt_client_data_len_t)json_len, mqtt_flag_retain)
+            >= 0)
+        {
+            p_mqtt_data->adv_topic_cache.topic_bytes_total += topic_len;
+            *p_num_published += 1;
+        }
+        else
+        {
+            LOG_ERR("%s failed", "esp_mqtt_client_publish");
+        }
+        if ((xTaskGetTickCount() - tick_start) >= time_budget_ticks)
+        {
+            break;
+        }
+    }
+    mqtt_mutex_unlock(&p_mqtt_data);
+
+    return num_processed;
+}
+
 void
 mqtt_publish_connect(void)
 {
@@ -212,12 +414,11 @@ mqtt_publish_connect(void)
     LOG_INFO("esp_mqtt_client_publish: topic:'%s', message:'%s'", p_mqtt_data->mqtt_topic.buf, p_message);
     const int32_t mqtt_flag_retain = !p_mqtt_data->mqtt_disable_retained_messages;
 
-    const mqtt_message_id_t message_id = esp_mqtt_client_publish(
-        p_mqtt_data->p_mqtt_client,
+    const mqtt_message_id_t message_id = mqtt_publish_unsafe(
+        p_mqtt_data,
         p_mqtt_data->mqtt_topic.buf,
         p_message,
         (esp_mqtt_client_data_len_t)strlen(p_message),
-        MQTT_QOS,
         mqtt_flag_retain);
 
     mqtt_mutex_unlock(&p_mqtt_data);
@@ -241,12 +442,11 @@ mqtt_publish_state_offline(mqtt_protected_data_t* const p_mqtt_data)
     LOG_INFO("esp_mqtt_client_publish: topic:'%s', message:'%s'", p_mqtt_data->mqtt_topic.buf, p_message);
     const int32_t mqtt_flag_retain = !p_mqtt_data->mqtt_disable_retained_messages;
 
-    const mqtt_message_id_t message_id = esp_mqtt_client_publish(
-        p_mqtt_data->p_mqtt_client,
+    const mqtt_message_id_t message_id = mqtt_publish_unsafe(
+        p_mqtt_data,
         p_mqtt_data->mqtt_topic.buf,
         p_message,
         (esp_mqtt_client_data_len_t)strlen(p_message),
-        MQTT_QOS,
         mqtt_flag_retain);
 
     if (-1 == message_id)
@@ -388,7 +588,13 @@ mqtt_event_handler(esp_mqtt_event_handle_t h_event)
     switch (h_event->event_id)
     {
         case MQTT_EVENT_CONNECTED:
-            LOG_INFO("MQTT_EVENT_CONNECTED");
+            LOG_INFO("MQTT_EVENT_CONNECTED, session_present=%d", h_event->session_present);
+            if (0 == h_event->session_present)
+            {
+                // The broker has not kept the session, so the messages of the previous connection are lost.
+                // Don't lock the MQTT mutex here - it's held by mqtt_app_stop while waiting for this task to stop.
+                mqtt_in_flight_clear();
+            }
             gw_status_set_mqtt_connected();
             event_mgr_notify(EVENT_MGR_EV_MQTT_CONNECTED);
             leds_notify_mqtt1_connected();
@@ -402,6 +608,8 @@ mqtt_event_handler(esp_mqtt_event_handle_t h_event)
             LOG_INFO("MQTT_EVENT_DISCONNECTED");
             gw_status_clear_mqtt_connected();
             leds_notify_mqtt1_disconnected();
+            // Only QoS>0 messages are tracked, and the session is kept on the broker for them
+            // (disable_clean_session), so they are still in flight until the reconnection shows whether it was kept.
             break;
 
         case MQTT_EVENT_SUBSCRIBED:
@@ -414,6 +622,8 @@ mqtt_event_handler(esp_mqtt_event_handle_t h_event)
 
         case MQTT_EVENT_PUBLISHED:
             LOG_DBG("MQTT_EVENT_PUBLISHED, msg_id=%d", h_event->msg_id);
+            // Don't lock the MQTT mutex here - it's held by mqtt_app_stop while waiting for this task to stop.
+            (void)mqtt_in_flight_on_ack(h_event->msg_id, mqtt_get_timestamp_ms());
             break;
 
         case MQTT_EVENT_DATA:
@@ -491,7 +701,8 @@ mqtt_generate_client_config(
     p_cli_cfg->lwt_qos           = 1;
     p_cli_cfg->lwt_retain        = !p_mqtt_cfg->mqtt_disable_retained_messages;
     p_cli_cfg->lwt_msg_len       = 0;
-    p_cli_cfg->disable_clean_session       = 0;
+    // Keep the session on the broker for QoS>0, so that the unacknowledged messages survive reconnects
+    p_cli_cfg->disable_clean_session       = (0 != p_mqtt_cfg->mqtt_qos) ? 1 : 0;
     p_cli_cfg->keepalive                   = 0;
     p_cli_cfg->disable_auto_reconnect      = false;
     p_cli_cfg->user_context                = p_user_context;
@@ -535,16 +746,23 @@ mqtt_create_client_config(mqtt_protected_data_t* p_mqtt_data, const ruuvi_gw_cfg
         return NULL;
     }
     mqtt_create_full_topic(&p_mqtt_data->mqtt_topic, p_mqtt_cfg->mqtt_prefix.buf, "gw_status");
+    if (0 != strcmp(p_mqtt_data->mqtt_prefix.buf, p_mqtt_cfg->mqtt_prefix.buf))
+    {
+        // The cache is initially empty, which matches the empty prefix, so it needs to be rebuilt only on change
+        mqtt_adv_topic_cache_rebuild(&p_mqtt_data->adv_topic_cache, p_mqtt_cfg->mqtt_prefix.buf);
+    }
     p_mqtt_data->mqtt_prefix                    = p_mqtt_cfg->mqtt_prefix;
     p_mqtt_data->mqtt_disable_retained_messages = p_mqtt_cfg->mqtt_disable_retained_messages;
+    p_mqtt_data->mqtt_qos                       = p_mqtt_cfg->mqtt_qos;
     const char* const p_lwt_message             = "{\"state\": \"offline\"}";
 
     LOG_INFO(
-        "Using server: %s, client id: '%s', topic prefix: '%s', port: %u",
+        "Using server: %s, client id: '%s', topic prefix: '%s', port: %u, QoS: %u",
         p_mqtt_cfg->mqtt_server.buf,
         p_mqtt_cfg->mqtt_client_id.buf,
         p_mqtt_cfg->mqtt_prefix.buf,
-        p_mqtt_cfg->mqtt_port);
+        p_mqtt_cfg->mqtt_port,
+        (printf_uint_t)p_mqtt_cfg->mqtt_qos);
     LOG_INFO(
         "Authentication: user: '%s', password: '%s'",
         p_mqtt_cfg->mqtt_user.buf,
@@ -650,6 +868,7 @@ mqtt_app_start(const ruuvi_gw_cfg_mqtt_t* const p_mqtt_cfg)
     }
     else
     {
+        mqtt_in_flight_init();
         mqtt_app_start_internal(p_mqtt_data, p_mqtt_cfg);
     }
     mqtt_mutex_unlock(&p_mqtt_data);
@@ -708,6 +927,7 @@ mqtt_app_stop(void)
         }
 
         p_mqtt_data->p_mqtt_client = NULL;
+        mqtt_in_flight_clear();
     }
     gw_status_clear_mqtt_connected_and_error();
     gw_status_clear_mqtt_started();
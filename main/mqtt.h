@@ -11,11 +11,25 @@
 #include "adv_table.h"
 #include "gw_cfg.h"
 #include "str_buf.h"
+#include "os_wrapper_types.h"
+#include "mqtt_in_flight.h"
+#include "mqtt_json.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+typedef struct mqtt_stat_t
+{
+    gw_cfg_mqtt_qos_t     qos;
+    uint32_t              outbox_size;
+    mqtt_in_flight_stat_t in_flight;
+    uint32_t              cnt_topic_cache_hits;     // The topic of the adv was taken from the cache without formatting
+    uint32_t              cnt_topic_cache_rebuilds; // The topic prefix was changed
+    uint64_t              topic_bytes_total;        // The length of the topics of the published advs
+    uint64_t              topic_cache_saved_bytes;  // The length of the cached prefixes which were not formatted again
+} mqtt_stat_t;
+
 void
 mqtt_app_start(const ruuvi_gw_cfg_mqtt_t* const p_mqtt);
 
@@ -28,11 +42,53 @@ mqtt_app_stop(void);
 bool
 mqtt_app_is_working(void);
 
+/**
+ * @brief Check if there is a room for one more message in the outbox of the MQTT client.
+ * @note For QoS 0 it always returns true, for QoS>0 the messages stay in the outbox until they are acknowledged.
+ * @return true if the next message can be published.
+ */
 bool
 mqtt_is_buffer_available_for_publish(void);
 
+/**
+ * @brief Get the current QoS level, the outbox size (in bytes) and the statistics of the in-flight messages.
+ */
+void
+mqtt_get_stat(mqtt_stat_t* const p_stat);
+
+/**
+ * @brief Publish one adv.
+ * @param p_json_gen - pointer to the JSON generator owned by the caller, it's reused for all messages.
+ */
 bool
-mqtt_publish_adv(const adv_report_t* const p_adv, const bool flag_use_timestamps, const time_t timestamp);
+mqtt_publish_adv(
+    mqtt_json_gen_t* const    p_json_gen,
+    const adv_report_t* const p_adv,
+    const bool                flag_use_timestamps,
+    const time_t              timestamp);
+
+/**
+ * @brief Publish a burst of advs back-to-back.
+ * @note gw_cfg and MQTT data are locked only once, the JSON generator and the topic prefix are reused for all advs.
+ * @param p_json_gen - pointer to the JSON generator owned by the caller, it's reused for all messages.
+ * @param p_advs - pointer to the array of advs.
+ * @param num_advs - number of advs in the array.
+ * @param flag_use_timestamps - true if timestamps are used.
+ * @param timestamp - timestamp (or counter of the received advs if NTP is not used).
+ * @param time_budget_ticks - publishing is stopped after this time to keep the task watchdog fed.
+ * @param[out] p_num_published - number of advs which were successfully published.
+ * @return number of processed advs (published or dropped due to an error),
+ *         the remaining advs should be published later.
+ */
+uint32_t
+mqtt_publish_advs(
+    mqtt_json_gen_t* const    p_json_gen,
+    const adv_report_t* const p_advs,
+    const uint32_t            num_advs,
+    const bool                flag_use_timestamps,
+    const time_t              timestamp,
+    const os_delta_ticks_t    time_budget_ticks,
+    uint32_t* const           p_num_published);
 
 void
 mqtt_publish_connect(void);
@@ -0,0 +1,175 @@
+/**
+ * @file mqtt_in_flight.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "mqtt_in_flight.h"
+#include <stddef.h>
+#include <string.h>
+#include "os_mutex.h"
+
+typedef struct mqtt_in_flight_msg_t
+{
+    mqtt_in_flight_msg_id_t msg_id; // 0 means that the slot is free (esp-mqtt never uses msg_id=0 for QoS>0)
+    uint32_t                timestamp_ms;
+} mqtt_in_flight_msg_t;
+
+static mqtt_in_flight_msg_t  g_mqtt_in_flight_msgs[MQTT_IN_FLIGHT_MAX_NUM_MSGS];
+static mqtt_in_flight_stat_t g_mqtt_in_flight_stat;
+static os_mutex_t            g_p_mqtt_in_flight_mutex;
+static os_mutex_static_t     g_mqtt_in_flight_mutex_mem;
+
+static void
+mqtt_in_flight_lock(void)
+{
+    if (NULL == g_p_mqtt_in_flight_mutex)
+    {
+        g_p_mqtt_in_flight_mutex = os_mutex_create_static(&g_mqtt_in_flight_mutex_mem);
+    }
+    os_mutex_lock(g_p_mqtt_in_flight_mutex);
+}
+
+static void
+mqtt_in_flight_unlock(void)
+{
+    os_mutex_unlock(g_p_mqtt_in_flight_mutex);
+}
+
+void
+mqtt_in_flight_init(void)
+{
+    mqtt_in_flight_lock();
+    memset(g_mqtt_in_flight_msgs, 0, sizeof(g_mqtt_in_flight_msgs));
+    memset(&g_mqtt_in_flight_stat, 0, sizeof(g_mqtt_in_flight_stat));
+    mqtt_in_flight_unlock();
+}
+
+void
+mqtt_in_flight_deinit(void)
+{
+    os_mutex_delete(&g_p_mqtt_in_flight_mutex);
+}
+
+static void
+mqtt_in_flight_drop_msg_unsafe(mqtt_in_flight_msg_t* const p_msg)
+{
+    p_msg->msg_id = 0;
+    g_mqtt_in_flight_stat.num_in_flight -= 1;
+    g_mqtt_in_flight_stat.cnt_lost += 1;
+}
+
+static void
+mqtt_in_flight_drop_expired_unsafe(const uint32_t timestamp_ms)
+{
+    for (uint32_t i = 0; i < MQTT_IN_FLIGHT_MAX_NUM_MSGS; ++i)
+    {
+        mqtt_in_flight_msg_t* const p_msg = &g_mqtt_in_flight_msgs[i];
+        if ((0 != p_msg->msg_id) && ((uint32_t)(timestamp_ms - p_msg->timestamp_ms) >= MQTT_IN_FLIGHT_EXPIRATION_MS))
+        {
+            mqtt_in_flight_drop_msg_unsafe(p_msg);
+        }
+    }
+}
+
+static mqtt_in_flight_msg_t*
+mqtt_in_flight_find_slot_unsafe(const mqtt_in_flight_msg_id_t msg_id)
+{
+    for (uint32_t i = 0; i < MQTT_IN_FLIGHT_MAX_NUM_MSGS; ++i)
+    {
+        if (msg_id == g_mqtt_in_flight_msgs[i].msg_id)
+        {
+            return &g_mqtt_in_flight_msgs[i];
+        }
+    }
+    return NULL;
+}
+
+static mqtt_in_flight_msg_t*
+mqtt_in_flight_find_oldest_unsafe(const uint32_t timestamp_ms)
+{
+    mqtt_in_flight_msg_t* p_oldest = &g_mqtt_in_flight_msgs[0];
+    for (uint32_t i = 1; i < MQTT_IN_FLIGHT_MAX_NUM_MSGS; ++i)
+    {
+        mqtt_in_flight_msg_t* const p_msg = &g_mqtt_in_flight_msgs[i];
+        if ((uint32_t)(timestamp_ms - p_msg->timestamp_ms) > (uint32_t)(timestamp_ms - p_oldest->timestamp_ms))
+        {
+            p_oldest = p_msg;
+        }
+    }
+    return p_oldest;
+}
+
+void
+mqtt_in_flight_on_publish(const mqtt_in_flight_msg_id_t msg_id, const uint32_t timestamp_ms)
+{
+    if (msg_id <= 0)
+    {
+        return;
+    }
+    mqtt_in_flight_lock();
+    mqtt_in_flight_drop_expired_unsafe(timestamp_ms);
+    mqtt_in_flight_msg_t* p_msg = mqtt_in_flight_find_slot_unsafe(0);
+    if (NULL == p_msg)
+    {
+        p_msg = mqtt_in_flight_find_oldest_unsafe(timestamp_ms);
+        mqtt_in_flight_drop_msg_unsafe(p_msg);
+    }
+    p_msg->msg_id       = msg_id;
+    p_msg->timestamp_ms = timestamp_ms;
+    g_mqtt_in_flight_stat.num_in_flight += 1;
+    g_mqtt_in_flight_stat.cnt_published += 1;
+    mqtt_in_flight_unlock();
+}
+
+bool
+mqtt_in_flight_on_ack(const mqtt_in_flight_msg_id_t msg_id, const uint32_t timestamp_ms)
+{
+    if (msg_id <= 0)
+    {
+        return false;
+    }
+    mqtt_in_flight_lock();
+    mqtt_in_flight_msg_t* const p_msg = mqtt_in_flight_find_slot_unsafe(msg_id);
+    if (NULL == p_msg)
+    {
+        mqtt_in_flight_unlock();
+        return false;
+    }
+    const uint32_t latency_ms = timestamp_ms - p_msg->timestamp_ms;
+    p_msg->msg_id             = 0;
+    g_mqtt_in_flight_stat.num_in_flight -= 1;
+    g_mqtt_in_flight_stat.cnt_acked += 1;
+    g_mqtt_in_flight_stat.ack_latency_ms_sum += latency_ms;
+    if (latency_ms > g_mqtt_in_flight_stat.ack_latency_ms_max)
+    {
+        g_mqtt_in_flight_stat.ack_latency_ms_max = latency_ms;
+    }
+    mqtt_in_flight_unlock();
+    return true;
+}
+
+void
+mqtt_in_flight_clear(void)
+{
+    mqtt_in_flight_lock();
+    for (uint32_t i = 0; i < MQTT_IN_FLIGHT_MAX_NUM_MSGS; ++i)
+    {
+        mqtt_in_flight_msg_t* const p_msg = &g_mqtt_in_flight_msgs[i];
+        if (0 != p_msg->msg_id)
+        {
+            mqtt_in_flight_drop_msg_unsafe(p_msg);
+        }
+    }
+    mqtt_in_flight_unlock();
+}
+
+void
+mqtt_in_flight_get_stat(mqtt_in_flight_stat_t* const p_stat, const uint32_t timestamp_ms)
+{
+    mqtt_in_flight_lock();
+    mqtt_in_flight_drop_expired_unsafe(timestamp_ms);
+    *p_stat = g_mqtt_in_flight_stat;
+    mqtt_in_flight_unlock();
+}
@@ -0,0 +1,84 @@
+/**
+ * @file mqtt_in_flight.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_MQTT_IN_FLIGHT_H
+#define RUUVI_GATEWAY_ESP_MQTT_IN_FLIGHT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Max number of QoS>0 messages which are tracked until PUBACK/PUBCOMP is received.
+ * @note The outbox of esp-mqtt is limited by CONFIG_MQTT_OUTBOX_MAX_SIZE (4 KiB),
+ *       so it can't contain more messages than this.
+ */
+#define MQTT_IN_FLIGHT_MAX_NUM_MSGS (32U)
+
+/**
+ * @brief Messages are considered as lost after this timeout (the same as OUTBOX_EXPIRED_TIMEOUT_MS in esp-mqtt).
+ */
+#define MQTT_IN_FLIGHT_EXPIRATION_MS (30U * 1000U)
+
+typedef int32_t mqtt_in_flight_msg_id_t;
+
+typedef struct mqtt_in_flight_stat_t
+{
+    uint32_t num_in_flight;
+    uint32_t cnt_published;
+    uint32_t cnt_acked;
+    uint32_t cnt_lost;
+    uint64_t ack_latency_ms_sum;
+    uint32_t ack_latency_ms_max;
+} mqtt_in_flight_stat_t;
+
+/**
+ * @brief Reset the tracked messages and the statistics, it's called when the MQTT client is started.
+ */
+void
+mqtt_in_flight_init(void);
+
+void
+mqtt_in_flight_deinit(void);
+
+/**
+ * @brief Start tracking the message which was enqueued by esp_mqtt_client_publish.
+ * @param msg_id - message ID returned by esp_mqtt_client_publish (0 for QoS 0, it's ignored).
+ * @param timestamp_ms - current time in milliseconds.
+ */
+void
+mqtt_in_flight_on_publish(const mqtt_in_flight_msg_id_t msg_id, const uint32_t timestamp_ms);
+
+/**
+ * @brief Stop tracking the message on MQTT_EVENT_PUBLISHED and update the statistics of the acknowledge latency.
+ * @param msg_id - message ID from MQTT_EVENT_PUBLISHED.
+ * @param timestamp_ms - current time in milliseconds.
+ * @return true if the message was tracked.
+ */
+bool
+mqtt_in_flight_on_ack(const mqtt_in_flight_msg_id_t msg_id, const uint32_t timestamp_ms);
+
+/**
+ * @brief Drop all the tracked messages (they are counted as lost),
+ *        it's called when the MQTT client is destroyed and when the broker has not kept the session on reconnection.
+ * @note The messages are kept on disconnection, because they are delivered after reconnection
+ *       if the session is present on the broker.
+ */
+void
+mqtt_in_flight_clear(void);
+
+void
+mqtt_in_flight_get_stat(mqtt_in_flight_stat_t* const p_stat, const uint32_t timestamp_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_MQTT_IN_FLIGHT_H
@@ -6,9 +6,9 @@
  */
 
 #include "mqtt_json.h"
+#include <string.h>
 #include "os_malloc.h"
-#include "ruuvi_endpoint_5.h"
-#include "ruuvi_endpoint_6.h"
+#include "heap_prof.h"
 #include "adv_decode.h"
 #if defined(RUUVI_TESTS_MQTT_JSON) && RUUVI_TESTS_MQTT_JSON
 #define LOG_LOCAL_DISABLED 1
@@ -19,7 +19,7 @@
 #include "log.h"
 static const char TAG[] = "mqtt";
 
-typedef struct mqtt_json_stream_gen_adv_ctx_t
+struct mqtt_json_stream_gen_adv_ctx_t
 {
     const adv_report_t*       p_adv;
     bool                      flag_use_timestamps;
@@ -27,12 +27,14 @@ typedef struct mqtt_json_stream_gen_adv_ctx_t
     const mac_address_str_t*  p_mac_addr;
     const char*               p_coordinates_str;
     gw_cfg_mqtt_data_format_e mqtt_data_format;
-} mqtt_json_stream_gen_adv_ctx_t;
+    adv_decoded_t             decoded; //!< The payload is decoded at publish time, once per message
+};
 
 static json_stream_gen_callback_result_t
 mqtt_cb_json_stream_gen_adv(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
 {
     const mqtt_json_stream_gen_adv_ctx_t* const p_ctx = p_user_ctx;
+    const adv_decoded_t* const                  p_decoded = &p_ctx->decoded;
     JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
 
     JSON_STREAM_GEN_ADD_STRING(p_gen, "gw_mac", p_ctx->p_mac_addr->str_buf);
@@ -56,30 +58,54 @@ mqtt_cb_json_stream_gen_adv(json_stream_gen_t* const p_gen, const void* const p_
     if ((GW_CFG_MQTT_DATA_FORMAT_RUUVI_RAW_AND_DECODED == p_ctx->mqtt_data_format)
         || (GW_CFG_MQTT_DATA_FORMAT_RUUVI_DECODED == p_ctx->mqtt_data_format))
     {
-        if (re_5_check_format(p_ctx->p_adv->data_buf))
+        if (ADV_DECODED_DATA_FORMAT_5 == p_decoded->data_format)
         {
-            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_df5_cb_json_stream_gen, p_gen, p_ctx->p_adv);
+            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_df5_cb_json_stream_gen, p_gen, &p_decoded->data.df5);
         }
-        if (re_6_check_format(p_ctx->p_adv->data_buf))
+        if (ADV_DECODED_DATA_FORMAT_6 == p_decoded->data_format)
         {
-            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_df6_cb_json_stream_gen, p_gen, p_ctx->p_adv);
+            JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_df6_cb_json_stream_gen, p_gen, &p_decoded->data.df6);
         }
     }
+    if (0 != p_ctx->p_adv->aggr.num_samples)
+    {
+        JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(adv_decode_aggr_cb_json_stream_gen, p_gen, &p_ctx->p_adv->aggr);
+    }
 
     JSON_STREAM_GEN_ADD_STRING(p_gen, "coords", p_ctx->p_coordinates_str);
 
     JSON_STREAM_GEN_END_GENERATOR_FUNC();
 }
 
-str_buf_t
-mqtt_create_json_str(
-    const adv_report_t* const       p_adv,
-    const bool                      flag_use_timestamps,
-    const time_t                    timestamp,
-    const mac_address_str_t* const  p_mac_addr,
-    const char* const               p_coordinates_str,
-    const gw_cfg_mqtt_data_format_e mqtt_data_format,
-    const json_stream_gen_size_t    max_chunk_size)
+static void
+mqtt_json_set_ctx(
+    mqtt_json_stream_gen_adv_ctx_t* const p_ctx,
+    const adv_report_t* const             p_adv,
+    const bool                            flag_use_timestamps,
+    const time_t                          timestamp,
+    const mac_address_str_t* const        p_mac_addr,
+    const char* const                     p_coordinates_str,
+    const gw_cfg_mqtt_data_format_e       mqtt_data_format)
+{
+    p_ctx->p_adv               = p_adv;
+    p_ctx->flag_use_timestamps = flag_use_timestamps;
+    p_ctx->timestamp           = timestamp;
+    p_ctx->p_mac_addr          = p_mac_addr;
+    p_ctx->p_coordinates_str   = p_coordinates_str;
+    p_ctx->mqtt_data_format    = mqtt_data_format;
+    if ((GW_CFG_MQTT_DATA_FORMAT_RUUVI_RAW_AND_DECODED == mqtt_data_format)
+        || (GW_CFG_MQTT_DATA_FORMAT_RUUVI_DECODED == mqtt_data_format))
+    {
+        adv_decoded_decode(p_adv->data_buf, &p_ctx->decoded);
+    }
+    else
+    {
+        p_ctx->decoded.data_format = ADV_DECODED_DATA_FORMAT_UNKNOWN;
+    }
+}
+
+static json_stream_gen_t*
+mqtt_json_create_gen(const json_stream_gen_size_t max_chunk_size, mqtt_json_stream_gen_adv_ctx_t** const p_p_ctx)
 {
     const json_stream_gen_cfg_t cfg = {
         .max_chunk_size      = max_chunk_size,
@@ -87,27 +113,78 @@ mqtt_create_json_str(
         .indentation_mark    = ' ',
         .indentation         = 0,
         .max_nesting_level   = 2,
-        .p_malloc            = &os_malloc,
-        .p_free              = &os_free_internal,
+        .p_malloc            = HEAP_PROF_FN_MALLOC_JSON_STREAM_GEN,
+        .p_free              = HEAP_PROF_FN_FREE,
         .p_localeconv        = NULL,
     };
-    mqtt_json_stream_gen_adv_ctx_t* p_ctx = NULL;
-    json_stream_gen_t*              p_gen = json_stream_gen_create(
+    json_stream_gen_t* p_gen = json_stream_gen_create(
         &cfg,
         &mqtt_cb_json_stream_gen_adv,
-        sizeof(*p_ctx),
-        (void**)&p_ctx);
+        sizeof(mqtt_json_stream_gen_adv_ctx_t),
+        (void**)p_p_ctx);
     if (NULL == p_gen)
     {
         LOG_ERR("Not enough memory");
+        return NULL;
+    }
+    return p_gen;
+}
+
+/**
+ * @brief Generate JSON (it must fit into one chunk) and copy it to the buffer.
+ * @note The chunk can't be used directly because the next call of json_stream_gen_get_next_chunk,
+ *       which is needed to check that the generation is finished, overwrites it.
+ */
+static bool
+mqtt_json_gen_to_buf(
+    json_stream_gen_t* const     p_gen,
+    const json_stream_gen_size_t max_chunk_size,
+    char* const                  p_buf,
+    size_t* const                p_len)
+{
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    if (NULL == p_chunk) // Check if there is any errors
+    {
+        LOG_ERR("Error while json generation (exceeding the nesting level, etc.)");
+        return false;
+    }
+    const size_t len = strlen(p_chunk);
+    memcpy(p_buf, p_chunk, len + 1);
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    if (NULL == p_chunk) // Check if there is any errors
+    {
+        LOG_ERR("Error while json generation (exceeding the nesting level, etc.)");
+        return false;
+    }
+    if ('\0' != *p_chunk)
+    {
+        json_stream_gen_reset(p_gen);
+        const size_t json_len = json_stream_gen_calc_size(p_gen);
+        LOG_ERR("Json length %u exceeds the maximum chunk size %u", json_len, max_chunk_size);
+        return false;
+    }
+    *p_len = len;
+    return true;
+}
+
+str_buf_t
+mqtt_create_json_str(
+    const adv_report_t* const       p_adv,
+    const bool                      flag_use_timestamps,
+    const time_t                    timestamp,
+    const mac_address_str_t* const  p_mac_addr,
+    const char* const               p_coordinates_str,
+    const gw_cfg_mqtt_data_format_e mqtt_data_format,
+    const json_stream_gen_size_t    max_chunk_size)
+{
+    mqtt_json_stream_gen_adv_ctx_t* p_ctx = NULL;
+    json_stream_gen_t*              p_gen = mqtt_json_create_gen(max_chunk_size, &p_ctx);
+    if (NULL == p_gen)
+    {
         return str_buf_init_null();
     }
-    p_ctx->p_adv               = p_adv;
-    p_ctx->flag_use_timestamps = flag_use_timestamps;
-    p_ctx->timestamp           = timestamp;
-    p_ctx->p_mac_addr          = p_mac_addr;
-    p_ctx->p_coordinates_str   = p_coordinates_str;
-    p_ctx->mqtt_data_format    = mqtt_data_format;
+    mqtt_json_set_ctx(p_ctx, p_adv, flag_use_timestamps, timestamp, p_mac_addr, p_coordinates_str, mqtt_data_format);
 
     const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
     if (NULL == p_chunk) // Check if there is any errors
@@ -117,7 +194,8 @@ mqtt_create_json_str(
         return str_buf_init_null();
     }
     str_buf_t str_buf = str_buf_printf_with_alloc("%s", p_chunk);
-    p_chunk           = json_stream_gen_get_next_chunk(p_gen);
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
     if (NULL == p_chunk) // Check if there is any errors
     {
         json_stream_gen_delete(&p_gen);
@@ -125,17 +203,15 @@ mqtt_create_json_str(
         LOG_ERR("Error while json generation (exceeding the nesting level, etc.)");
         return str_buf_init_null();
     }
-
     if ('\0' != *p_chunk)
     {
         json_stream_gen_reset(p_gen);
         const size_t json_len = json_stream_gen_calc_size(p_gen);
         json_stream_gen_delete(&p_gen);
         str_buf_free_buf(&str_buf);
-        LOG_ERR("Json length %u exceeds the maximum chunk size %u", json_len, cfg.max_chunk_size);
+        LOG_ERR("Json length %u exceeds the maximum chunk size %u", json_len, max_chunk_size);
         return str_buf_init_null();
     }
-
     json_stream_gen_delete(&p_gen);
     if (NULL == str_buf.buf)
     {
@@ -144,3 +220,51 @@ mqtt_create_json_str(
     }
     return str_buf;
 }
+
+const char*
+mqtt_json_gen_generate(
+    mqtt_json_gen_t* const          p_json_gen,
+    const adv_report_t* const       p_adv,
+    const bool                      flag_use_timestamps,
+    const time_t                    timestamp,
+    const mac_address_str_t* const  p_mac_addr,
+    const char* const               p_coordinates_str,
+    const gw_cfg_mqtt_data_format_e mqtt_data_format,
+    size_t* const                   p_json_len)
+{
+    if (NULL == p_json_gen->p_gen)
+    {
+        p_json_gen->p_gen = mqtt_json_create_gen(MQTT_JSON_GEN_MAX_JSON_LEN, &p_json_gen->p_ctx);
+        if (NULL == p_json_gen->p_gen)
+        {
+            p_json_gen->p_ctx = NULL;
+            return NULL;
+        }
+    }
+    mqtt_json_set_ctx(
+        p_json_gen->p_ctx,
+        p_adv,
+        flag_use_timestamps,
+        timestamp,
+        p_mac_addr,
+        p_coordinates_str,
+        mqtt_data_format);
+    json_stream_gen_reset(p_json_gen->p_gen);
+
+    if (!mqtt_json_gen_to_buf(p_json_gen->p_gen, MQTT_JSON_GEN_MAX_JSON_LEN, p_json_gen->json_buf, p_json_len))
+    {
+        return NULL;
+    }
+    return p_json_gen->json_buf;
+}
+
+void
+mqtt_json_gen_deinit(mqtt_json_gen_t* const p_json_gen)
+{
+    if (NULL != p_json_gen->p_gen)
+    {
+        json_stream_gen_delete(&p_json_gen->p_gen);
+    }
+    p_json_gen->p_gen = NULL;
+    p_json_gen->p_ctx = NULL;
+}
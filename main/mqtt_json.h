@@ -26,6 +26,48 @@ mqtt_create_json_str(
     const gw_cfg_mqtt_data_format_e mqtt_data_format,
     const json_stream_gen_size_t    max_chunk_size);
 
+/**
+ * @brief Maximum length of JSON generated by mqtt_json_gen_generate.
+ */
+#define MQTT_JSON_GEN_MAX_JSON_LEN (1024U)
+
+typedef struct mqtt_json_stream_gen_adv_ctx_t mqtt_json_stream_gen_adv_ctx_t;
+
+/**
+ * @brief The JSON generator for MQTT messages which is reused for all messages published by its owner.
+ * @note It must be zero-initialized before the first use, the generator is created on the first call
+ *       of mqtt_json_gen_generate, so the next messages are generated without allocating memory from the heap.
+ */
+typedef struct mqtt_json_gen_t
+{
+    json_stream_gen_t*              p_gen;
+    mqtt_json_stream_gen_adv_ctx_t* p_ctx;
+    char                            json_buf[MQTT_JSON_GEN_MAX_JSON_LEN + 1U];
+} mqtt_json_gen_t;
+
+/**
+ * @brief Re-target the generator at the adv and generate JSON for MQTT message.
+ * @param p_json_gen - pointer to the reusable generator.
+ * @param[out] p_json_len - length of the generated JSON.
+ * @return pointer to JSON in the buffer of the generator (it's valid until the next call) or NULL on error.
+ */
+const char*
+mqtt_json_gen_generate(
+    mqtt_json_gen_t* const          p_json_gen,
+    const adv_report_t* const       p_adv,
+    const bool                      flag_use_timestamps,
+    const time_t                    timestamp,
+    const mac_address_str_t* const  p_mac_addr,
+    const char* const               p_coordinates_str,
+    const gw_cfg_mqtt_data_format_e mqtt_data_format,
+    size_t* const                   p_json_len);
+
+/**
+ * @brief Delete the generator created by mqtt_json_gen_generate.
+ */
+void
+mqtt_json_gen_deinit(mqtt_json_gen_t* const p_json_gen);
+
 #ifdef __cplusplus
 }
 #endif
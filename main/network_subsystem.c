@@ -23,6 +23,7 @@
 #include "gw_status.h"
 #include "event_mgr.h"
 #include "ruuvi_gateway.h"
+#include "boot_timeline.h"
 
 #define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
 #include "log.h"
@@ -80,6 +81,7 @@ ethernet_connection_ok_cb(const esp_netif_ip_info_t* p_ip_info)
         p_ip_info,
         (NULL != p_dhcp) ? &dhcp_ip : NULL);
     gw_status_set_eth_connected();
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NETWORK_CONNECTED);
     event_mgr_notify(EVENT_MGR_EV_ETH_CONNECTED);
 }
 
@@ -89,6 +91,7 @@ wifi_connection_ok_cb(void* p_param) // NOSONAR
     (void)p_param;
     LOG_INFO("### Wi-Fi connected");
     gw_status_set_wifi_connected();
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NETWORK_CONNECTED);
     event_mgr_notify(EVENT_MGR_EV_WIFI_CONNECTED);
 
     if (gw_status_is_waiting_auto_cfg_by_wps())
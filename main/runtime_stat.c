@@ -6,11 +6,12 @@
  */
 
 #include "runtime_stat.h"
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos_task_stack_size.h"
-#include "os_malloc.h"
 #include "os_mutex.h"
 
 #define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
@@ -19,15 +20,15 @@ static const char TAG[] = "runtime_stat";
 
 typedef int qsort_int_t;
 
-enum
-{
-    RUNTIME_STAT_MAX_NUM_TASKS = 24,
-};
+_Static_assert(RUNTIME_STAT_TASK_NAME_MAX_LEN == configMAX_TASK_NAME_LEN, "RUNTIME_STAT_TASK_NAME_MAX_LEN");
 
 typedef struct runtime_stat_task_info_t
 {
-    UBaseType_t task_number;
-    uint32_t    runtime_counter;
+    UBaseType_t                 task_number;
+    uint32_t                    runtime_counter;
+    uint32_t                    runtime_counter_window[RUNTIME_STAT_CPU_USAGE_WINDOW_SIZE];
+    uint32_t                    num_samples;
+    runtime_stat_task_metrics_t metrics;
 } runtime_stat_task_info_t;
 
 typedef struct runtime_stat_accumulated_task_info_t
@@ -42,6 +43,27 @@ static runtime_stat_accumulated_task_info_t g_runtime_stat_accumulated[RUNTIME_S
 static os_mutex_t                           g_runtime_stat_accumulated_mutex;
 static os_mutex_static_t                    g_runtime_stat_accumulated_mutex_mem;
 static runtime_stat_task_info_t             g_tasks_info[RUNTIME_STAT_MAX_NUM_TASKS] = { 0 };
+static TaskStatus_t                         g_runtime_stat_arr_of_tasks[RUNTIME_STAT_MAX_NUM_TASKS];
+static uint32_t                             g_runtime_stat_total_time_window[RUNTIME_STAT_CPU_USAGE_WINDOW_SIZE];
+static uint32_t                             g_runtime_stat_window_idx;
+static os_mutex_t                           g_runtime_stat_mutex;
+static os_mutex_static_t                    g_runtime_stat_mutex_mem;
+
+static void
+runtime_stat_lock(void)
+{
+    if (NULL == g_runtime_stat_mutex)
+    {
+        g_runtime_stat_mutex = os_mutex_create_static(&g_runtime_stat_mutex_mem);
+    }
+    os_mutex_lock(g_runtime_stat_mutex);
+}
+
+static void
+runtime_stat_unlock(void)
+{
+    os_mutex_unlock(g_runtime_stat_mutex);
+}
 
 static void
 runtime_stat_lock_accumulated_info(void)
@@ -140,6 +162,7 @@ runtime_stat_add_task_info(
         runtime_stat_task_info_t* const p_task_info = &p_arr_of_tasks[i];
         if (0 == p_task_info->task_number)
         {
+            memset(p_task_info, 0, sizeof(*p_task_info));
             p_task_info->task_number     = task_num;
             p_task_info->runtime_counter = runtime_counter;
             return i;
@@ -159,8 +182,7 @@ runtime_stat_remove_deleted_tasks_info(
         runtime_stat_task_info_t* const p_task_info = &p_arr_of_tasks[i];
         if (0 == (task_info_bit_mask & (1U << i)))
         {
-            p_task_info->task_number     = 0;
-            p_task_info->runtime_counter = 0;
+            memset(p_task_info, 0, sizeof(*p_task_info));
         }
     }
 }
@@ -201,6 +223,54 @@ conv_task_state_to_str(const eTaskState task_state)
     }
 }
 
+/**
+ * @brief Add the runtime counter delta to the rolling window of the task and calculate the average CPU usage.
+ * @note g_runtime_stat_total_time_window must be already updated for the current sample.
+ */
+static uint32_t
+runtime_stat_update_cpu_usage_window(runtime_stat_task_info_t* const p_task_info, const uint32_t runtime_counter_delta)
+{
+    p_task_info->runtime_counter_window[g_runtime_stat_window_idx] = runtime_counter_delta;
+    if (p_task_info->num_samples < RUNTIME_STAT_CPU_USAGE_WINDOW_SIZE)
+    {
+        p_task_info->num_samples += 1;
+    }
+    uint64_t runtime_sum    = 0;
+    uint64_t total_time_sum = 0;
+    uint32_t idx            = g_runtime_stat_window_idx;
+    for (uint32_t i = 0; i < p_task_info->num_samples; ++i)
+    {
+        runtime_sum += p_task_info->runtime_counter_window[idx];
+        total_time_sum += g_runtime_stat_total_time_window[idx];
+        idx = (0 != idx) ? (idx - 1) : (RUNTIME_STAT_CPU_USAGE_WINDOW_SIZE - 1);
+    }
+    if (0 == total_time_sum)
+    {
+        return RUNTIME_STAT_CPU_USAGE_UNKNOWN;
+    }
+    return (uint32_t)(((runtime_sum * 100) + (total_time_sum / 2)) / total_time_sum);
+}
+
+static void
+runtime_stat_update_task_metrics(
+    runtime_stat_task_info_t* const p_task_info,
+    const TaskStatus_t* const       p_task_status,
+    const bool                      flag_new_task,
+    const uint32_t                  runtime_counter_delta,
+    const uint32_t                  stack_size)
+{
+    runtime_stat_task_metrics_t* const p_metrics = &p_task_info->metrics;
+    (void)snprintf(p_metrics->task_name, sizeof(p_metrics->task_name), "%s", p_task_status->pcTaskName);
+    p_metrics->task_number = (uint32_t)p_task_status->xTaskNumber;
+    p_metrics->p_state = conv_task_state_to_str(p_task_status->eCurrentState);
+    // The runtime counter of the new task is accumulated since its creation, so it is not added to the window
+    p_metrics->cpu_usage_percent   = flag_new_task
+                                         ? RUNTIME_STAT_CPU_USAGE_UNKNOWN
+                                         : runtime_stat_update_cpu_usage_window(p_task_info, runtime_counter_delta);
+    p_metrics->stack_size          = stack_size;
+    p_metrics->min_free_stack_size = p_task_status->usStackHighWaterMark;
+}
+
 static void
 log_runtime_statistics_handle_task(
     const TaskStatus_t* const p_task_status,
@@ -230,13 +300,19 @@ log_runtime_statistics_handle_task(
             p_task_status->xTaskNumber,
             p_task_status->ulRunTimeCounter);
     }
+    const UBaseType_t stack_size = uxTaskGetStackSize(p_task_status->xHandle);
+
     if (UINT32_MAX != task_info_idx)
     {
         *p_task_info_bit_mask |= 1U << task_info_idx;
+        runtime_stat_update_task_metrics(
+            &g_tasks_info[task_info_idx],
+            p_task_status,
+            (NULL == p_task_info),
+            runtime_counter_delta,
+            (uint32_t)stack_size);
     }
 
-    const UBaseType_t stack_size = uxTaskGetStackSize(p_task_status->xHandle);
-
     const uint32_t percentage_of_cpu_usage = (0 != total_time_delta)
                                                  ? (((runtime_counter_delta * 100) + (total_time_delta / 2))
                                                     / total_time_delta)
@@ -301,12 +377,9 @@ log_runtime_statistics_handle_task(
 void
 log_runtime_statistics(void)
 {
-    TaskStatus_t* p_arr_of_tasks = os_calloc(RUNTIME_STAT_MAX_NUM_TASKS, sizeof(*p_arr_of_tasks));
-    if (NULL == p_arr_of_tasks)
-    {
-        LOG_ERR("Can't allocate memory");
-        return;
-    }
+    // log_runtime_statistics is called from different tasks, the static buffer is protected by the mutex
+    runtime_stat_lock();
+    TaskStatus_t* const p_arr_of_tasks = g_runtime_stat_arr_of_tasks;
 
     static uint32_t prev_total_time = 0;
     uint32_t        total_time      = 0;
@@ -316,6 +389,9 @@ log_runtime_statistics(void)
     const uint32_t total_time_delta = total_time - prev_total_time;
     prev_total_time                 = total_time;
 
+    g_runtime_stat_window_idx = (g_runtime_stat_window_idx + 1) % RUNTIME_STAT_CPU_USAGE_WINDOW_SIZE;
+    g_runtime_stat_total_time_window[g_runtime_stat_window_idx] = total_time_delta;
+
     LOG_INFO(
         "======== totalTime %8u ==============================================================",
         (printf_uint_t)total_time_delta);
@@ -325,7 +401,7 @@ log_runtime_statistics(void)
     if (0 == num_tasks)
     {
         LOG_ERR("The arr of tasks is too small");
-        os_free(p_arr_of_tasks);
+        runtime_stat_unlock();
         return;
     }
     log_runtime_sort_tasks(p_arr_of_tasks, num_tasks);
@@ -339,5 +415,24 @@ log_runtime_statistics(void)
         sizeof(g_tasks_info) / sizeof(*g_tasks_info),
         task_info_bit_mask);
     LOG_INFO("==========================================================================================");
-    os_free(p_arr_of_tasks);
+    runtime_stat_unlock();
+}
+
+uint32_t
+runtime_stat_get_tasks_metrics(runtime_stat_task_metrics_t* const p_arr_of_tasks, const uint32_t max_num_tasks)
+{
+    uint32_t num_tasks = 0;
+    runtime_stat_lock();
+    for (uint32_t i = 0; (i < (sizeof(g_tasks_info) / sizeof(*g_tasks_info))) && (num_tasks < max_num_tasks); ++i)
+    {
+        const runtime_stat_task_info_t* const p_task_info = &g_tasks_info[i];
+        if (0 == p_task_info->task_number)
+        {
+            continue;
+        }
+        p_arr_of_tasks[num_tasks] = p_task_info->metrics;
+        num_tasks += 1;
+    }
+    runtime_stat_unlock();
+    return num_tasks;
 }
@@ -15,14 +15,44 @@
 extern "C" {
 #endif
 
+#define RUNTIME_STAT_MAX_NUM_TASKS (24U)
+
+#define RUNTIME_STAT_TASK_NAME_MAX_LEN (16U)
+
+/**
+ * @brief Number of the last calls of log_runtime_statistics used to calculate the average CPU usage.
+ */
+#define RUNTIME_STAT_CPU_USAGE_WINDOW_SIZE (8U)
+
+#define RUNTIME_STAT_CPU_USAGE_UNKNOWN (UINT32_MAX)
+
 typedef bool (*runtime_stat_cb_t)(const char* const p_task_name, const uint32_t min_free_stack_size, void* p_userdata);
 
+typedef struct runtime_stat_task_metrics_t
+{
+    char        task_name[RUNTIME_STAT_TASK_NAME_MAX_LEN];
+    uint32_t    task_number;         //!< xTaskNumber, unique even if the names match (e.g. "IDLE" on each core)
+    const char* p_state;             //!< "Rdy", "Blk", "Sus", "Del"
+    uint32_t    cpu_usage_percent;   //!< Average over the rolling window or RUNTIME_STAT_CPU_USAGE_UNKNOWN
+    uint32_t    stack_size;          //!< Stack size in bytes
+    uint32_t    min_free_stack_size; //!< Stack high water mark
+} runtime_stat_task_metrics_t;
+
 void
 log_runtime_statistics(void);
 
 bool
 runtime_stat_for_each_accumulated_info(runtime_stat_cb_t p_cb, void* p_userdata);
 
+/**
+ * @brief Get the per-task metrics collected during the last call of log_runtime_statistics.
+ * @param p_arr_of_tasks - pointer to the array for the output.
+ * @param max_num_tasks - max number of items in the array.
+ * @return number of tasks copied to the array.
+ */
+uint32_t
+runtime_stat_get_tasks_metrics(runtime_stat_task_metrics_t* const p_arr_of_tasks, const uint32_t max_num_tasks);
+
 #ifdef __cplusplus
 }
 #endif
@@ -137,18 +137,6 @@ main_loop(void);
 void
 sleep_with_task_watchdog_feeding(const int32_t delay_seconds);
 
-void
-http_server_mutex_activate(void);
-
-void
-http_server_mutex_deactivate(void);
-
-bool
-http_server_mutex_try_lock(void);
-
-void
-http_server_mutex_unlock(void);
-
 void
 start_wifi_ap(void);
 
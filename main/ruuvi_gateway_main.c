@@ -44,6 +44,16 @@
 #include "reset_info.h"
 #include "network_subsystem.h"
 #include "gw_cfg_storage.h"
+#include "boot_timeline.h"
+#include "http_mem_budget.h"
+#include "heap_prof.h"
+#include "adv_report_pool.h"
+#include "adv_live_stream.h"
+#include "adv_log_ring.h"
+#include "freertos/event_groups.h"
+#if RUUVI_HEAP_PROF
+#include "mbedtls/platform.h"
+#endif
 
 #define LOG_LOCAL_LEVEL LOG_LEVEL_INFO
 #include "log.h"
@@ -61,34 +71,23 @@ static const char TAG[] = "ruuvi_gateway";
 
 #define RUUVI_GATEWAY_DELAY_AFTER_NRF52_UPDATING_SECONDS (5)
 
-uint32_t volatile g_network_disconnect_cnt;
-
-static os_mutex_t        g_http_server_mutex_incoming_connection;
-static os_mutex_static_t g_http_server_mutex_incoming_connection_mem;
+#define RUUVI_GATEWAY_DELAY_FOR_LEDS_MS (750)
 
-void
-http_server_mutex_activate(void)
-{
-    http_server_use_mutex_for_incoming_connection_handling(g_http_server_mutex_incoming_connection);
-}
+#define NRF52_CHECK_TASK_STACK_SIZE (4U * 1024U)
+#define NRF52_CHECK_TASK_PRIORITY   (5)
+#define NRF52_CHECK_DONE_BIT        (1U << 0U)
 
-void
-http_server_mutex_deactivate(void)
+typedef struct nrf52_check_result_t
 {
-    http_server_use_mutex_for_incoming_connection_handling(NULL);
-}
+    bool                 flag_success;
+    ruuvi_nrf52_fw_ver_t nrf52_fw_ver;
+} nrf52_check_result_t;
 
-bool
-http_server_mutex_try_lock(void)
-{
-    return os_mutex_try_lock(g_http_server_mutex_incoming_connection);
-}
+uint32_t volatile g_network_disconnect_cnt;
 
-void
-http_server_mutex_unlock(void)
-{
-    os_mutex_unlock(g_http_server_mutex_incoming_connection);
-}
+static nrf52_check_result_t g_nrf52_check_result;
+static EventGroupHandle_t   g_p_ev_grp_nrf52_check;
+static StaticEventGroup_t   g_ev_grp_nrf52_check_mem;
 
 static void
 ruuvi_cb_on_change_cfg(const gw_cfg_t* const p_gw_cfg);
@@ -277,7 +276,14 @@ ruuvi_init_gw_cfg(
 
     gw_cfg_init((NULL != p_nrf52_fw_ver) ? &ruuvi_cb_on_change_cfg : NULL);
 
-    const bool               flag_allow_cfg_updating = (NULL != p_nrf52_fw_ver) ? true : false;
+    if (NULL == p_nrf52_fw_ver)
+    {
+        // The preliminary gw_cfg (before the nRF52 is checked) contains only the default settings,
+        // so there is no need to read and parse the configuration from flash here.
+        return true;
+    }
+
+    const bool               flag_allow_cfg_updating = true;
     settings_in_nvs_status_e settings_status         = SETTINGS_IN_NVS_STATUS_NOT_EXIST;
 
     const gw_cfg_t* p_gw_cfg_tmp = settings_get_from_flash(flag_allow_cfg_updating, &settings_status);
@@ -286,23 +292,20 @@ ruuvi_init_gw_cfg(
         LOG_ERR("Can't get settings from flash");
         return false;
     }
-    if (NULL != p_nrf52_fw_ver)
+    gw_cfg_log(p_gw_cfg_tmp, "Gateway SETTINGS (from flash)", false);
+    switch (settings_status)
     {
-        gw_cfg_log(p_gw_cfg_tmp, "Gateway SETTINGS (from flash)", false);
-        switch (settings_status)
-        {
-            case SETTINGS_IN_NVS_STATUS_OK:
-                LOG_INFO("##### Config exists in NVS");
-                break;
-            case SETTINGS_IN_NVS_STATUS_NOT_EXIST:
-                LOG_INFO("##### Config not exists in NVS");
-                break;
-            case SETTINGS_IN_NVS_STATUS_EMPTY:
-                LOG_INFO("##### Config is empty in NVS");
-                break;
-        }
-        (void)gw_cfg_update((SETTINGS_IN_NVS_STATUS_OK == settings_status) ? p_gw_cfg_tmp : NULL);
+        case SETTINGS_IN_NVS_STATUS_OK:
+            LOG_INFO("##### Config exists in NVS");
+            break;
+        case SETTINGS_IN_NVS_STATUS_NOT_EXIST:
+            LOG_INFO("##### Config not exists in NVS");
+            break;
+        case SETTINGS_IN_NVS_STATUS_EMPTY:
+            LOG_INFO("##### Config is empty in NVS");
+            break;
     }
+    (void)gw_cfg_update((SETTINGS_IN_NVS_STATUS_OK == settings_status) ? p_gw_cfg_tmp : NULL);
     os_free(p_gw_cfg_tmp);
     return true;
 }
@@ -438,14 +441,73 @@ ruuvi_cb_on_change_cfg(const gw_cfg_t* const p_gw_cfg)
     }
 }
 
+static void
+nrf52_check_task(void)
+{
+    vTaskDelay(pdMS_TO_TICKS(RUUVI_GATEWAY_DELAY_FOR_LEDS_MS)); // give time for leds_task to turn off the red LED
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NRF52_CHECK_STARTED);
+    g_nrf52_check_result.flag_success = nrf52fw_update_fw_if_necessary(
+        fw_update_get_current_fatfs_nrf52_partition_name(),
+        &fw_update_nrf52fw_cb_progress,
+        NULL,
+        &cb_before_nrf52_fw_updating,
+        &cb_after_nrf52_fw_updating,
+        &g_nrf52_check_result.nrf52_fw_ver);
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NRF52_CHECK_FINISHED);
+    xEventGroupSetBits(g_p_ev_grp_nrf52_check, NRF52_CHECK_DONE_BIT);
+}
+
+/**
+ * @brief Start checking (and updating if necessary) the nRF52 firmware in a separate task.
+ * @note The check takes a noticeable time (SWD access and the delay for LEDs),
+ *       so the main task continues the initialization of the subsystems which don't depend on nRF52
+ *       and then waits for the result with @ref nrf52_check_wait.
+ * @return true if the task was created successfully.
+ */
+static bool
+nrf52_check_start(void)
+{
+    g_p_ev_grp_nrf52_check = xEventGroupCreateStatic(&g_ev_grp_nrf52_check_mem);
+    if (!os_task_create_finite_without_param(
+            &nrf52_check_task,
+            "nrf52_check",
+            NRF52_CHECK_TASK_STACK_SIZE,
+            NRF52_CHECK_TASK_PRIORITY))
+    {
+        LOG_ERR("Can't create thread");
+        return false;
+    }
+    return true;
+}
+
+static const nrf52_check_result_t*
+nrf52_check_wait(void)
+{
+    (void)xEventGroupWaitBits(g_p_ev_grp_nrf52_check, NRF52_CHECK_DONE_BIT, pdFALSE, pdTRUE, portMAX_DELAY);
+    return &g_nrf52_check_result;
+}
+
 static bool
 main_task_initial_initialization(void)
 {
     reset_info_init();
+    heap_prof_init();
+#if RUUVI_HEAP_PROF
+    // The allocator of mbedTLS must be replaced before the first TLS session is created
+    mbedtls_platform_set_calloc_free(&heap_prof_calloc_mbedtls, &heap_prof_free);
+#endif
     cjson_wrap_init();
     partition_table_update_init_mutex();
 
-    g_http_server_mutex_incoming_connection = os_mutex_create_static(&g_http_server_mutex_incoming_connection_mem);
+    http_mem_budget_init();
+    adv_report_pool_init();
+    adv_live_stream_init();
+
+    if (!adv_log_ring_init())
+    {
+        LOG_ERR("%s failed", "adv_log_ring_init");
+        return false;
+    }
 
     if (!main_loop_init())
     {
@@ -479,6 +541,7 @@ main_task_initial_initialization(void)
 static bool
 main_task_init(void)
 {
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_APP_MAIN);
     esp_log_level_set(TAG, ESP_LOG_INFO);
 
     if (!main_task_initial_initialization())
@@ -498,6 +561,7 @@ main_task_init(void)
 
     ruuvi_nvs_init();
     ruuvi_nvs_init_gw_cfg_storage();
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NVS_READY);
 
     LOG_INFO(
         "Checking the state of CONFIGURE button during startup: is_pressed: %s",
@@ -521,19 +585,23 @@ main_task_init(void)
         LOG_ERR("%s failed", "ruuvi_init_gw_cfg");
         return false;
     }
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_GW_CFG_DEFAULT_READY);
 
+    leds_notify_nrf52_fw_check();
+    if (!nrf52_check_start())
+    {
+        LOG_ERR("%s failed", "nrf52_check_start");
+        return false;
+    }
+
+    // The following initialization does not depend on nRF52, so it runs in parallel with the nRF52 check.
     main_task_init_timers();
+    adv_mqtt_init();
+    adv_post_init();
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_ADV_TASKS_STARTED);
 
-    leds_notify_nrf52_fw_check();
-    vTaskDelay(pdMS_TO_TICKS(750)); // give time for leds_task to turn off the red LED
-    ruuvi_nrf52_fw_ver_t nrf52_fw_ver = { 0 };
-    if (!nrf52fw_update_fw_if_necessary(
-            fw_update_get_current_fatfs_nrf52_partition_name(),
-            &fw_update_nrf52fw_cb_progress,
-            NULL,
-            &cb_before_nrf52_fw_updating,
-            &cb_after_nrf52_fw_updating,
-            &nrf52_fw_ver))
+    const nrf52_check_result_t* const p_nrf52_check_result = nrf52_check_wait();
+    if (!p_nrf52_check_result->flag_success)
     {
         LOG_ERR("%s failed", "nrf52fw_update_fw_if_necessary");
         if (esp_ota_check_rollback_is_possible())
@@ -551,14 +619,17 @@ main_task_init(void)
         leds_notify_nrf52_ready();
     }
 
-    adv_mqtt_init();
-    adv_post_init();
     terminal_open(NULL, true, NRF52_COMM_TASK_PRIORITY);
     api_process(true);
     const nrf52_device_info_t nrf52_device_info = ruuvi_device_id_request_and_wait();
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NRF52_DEVICE_ID_RECEIVED);
 
     ruuvi_deinit_gw_cfg();
-    ruuvi_init_gw_cfg(&nrf52_fw_ver, &nrf52_device_info);
+    if (!ruuvi_init_gw_cfg(&p_nrf52_check_result->nrf52_fw_ver, &nrf52_device_info))
+    {
+        LOG_ERR("%s failed", "ruuvi_init_gw_cfg");
+    }
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_GW_CFG_READY);
     LOG_INFO("### Config is empty: %s", gw_cfg_is_empty() ? "true" : "false");
 
     hmac_sha256_set_key_for_http_ruuvi(gw_cfg_get_nrf52_device_id()->str_buf);  // set default encryption key
@@ -579,6 +650,7 @@ main_task_init(void)
         return false;
     }
     gw_cfg_unlock_ro(&p_gw_cfg);
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NETWORK_INIT_FINISHED);
 
     return true;
 }
@@ -7,15 +7,14 @@
 
 #include "settings.h"
 #include <string.h>
-#include "cJSON.h"
 #include "nvs.h"
-#include "cjson_wrap.h"
 #include "gw_cfg.h"
 #include "gw_cfg_default.h"
 #include "gw_cfg_blob.h"
 #include "gw_cfg_json_parse.h"
-#include "gw_cfg_json_generate.h"
+#include "gw_cfg_json_stream_gen.h"
 #include "gw_cfg_log.h"
+#include "gw_cfg_snapshot.h"
 #include "os_malloc.h"
 #include "wifi_manager.h"
 #include "ruuvi_nvs.h"
@@ -29,6 +28,9 @@
 
 #define RUUVI_GATEWAY_NVS_CFG_BLOB_KEY "ruuvi_config" /* deprecated */
 #define RUUVI_GATEWAY_NVS_CFG_JSON_KEY "ruuvi_cfg_json"
+#define RUUVI_GATEWAY_NVS_CFG_ID_KEY   "ruuvi_cfg_id"
+#define RUUVI_GATEWAY_NVS_CFG_SNAP_KEY "ruuvi_cfg_snap"
+#define RUUVI_GATEWAY_NVS_NO_SNAP_KEY  "ruuvi_cfg_nosnp"
 #define RUUVI_GATEWAY_NVS_MAC_ADDR_KEY "ruuvi_mac_addr"
 
 #define RUUVI_GATEWAY_NVS_FLAG_REBOOTING_AFTER_AUTO_UPDATE_KEY   "ruuvi_auto_udp"
@@ -81,10 +83,41 @@ settings_read_gw_cfg_json_from_nvs(nvs_handle handle)
     return p_cfg_json;
 }
 
+static bool
+settings_read_gw_cfg_json_id_from_nvs(nvs_handle handle, gw_cfg_snapshot_json_id_t* const p_json_id)
+{
+    size_t          sz      = sizeof(*p_json_id);
+    const esp_err_t esp_err = nvs_get_blob(handle, RUUVI_GATEWAY_NVS_CFG_ID_KEY, p_json_id, &sz);
+    if (ESP_OK != esp_err)
+    {
+        LOG_WARN_ESP(esp_err, "Can't find config key '%s' in flash", RUUVI_GATEWAY_NVS_CFG_ID_KEY);
+        return false;
+    }
+    if (sizeof(*p_json_id) != sz)
+    {
+        LOG_WARN("Size of config-json ID in flash differs");
+        return false;
+    }
+    return true;
+}
+
+static void
+settings_erase_key(nvs_handle handle, const char* const p_key)
+{
+    const esp_err_t esp_err = nvs_erase_key(handle, p_key);
+    if ((ESP_OK != esp_err) && (ESP_ERR_NVS_NOT_FOUND != esp_err))
+    {
+        LOG_WARN_ESP(esp_err, "Failed to erase key '%s' in NVS", p_key);
+    }
+}
+
 static esp_err_t
 settings_save_to_flash_cjson_ret_err(const char* const p_json_str)
 {
-    LOG_DBG("Save config to NVS: %s", (NULL != p_json_str) ? p_json_str : "");
+    const char* const p_json = (NULL != p_json_str) ? p_json_str : "";
+    LOG_DBG("Save config to NVS: %s", p_json);
+
+    const gw_cfg_snapshot_json_id_t json_id = gw_cfg_snapshot_calc_json_id(p_json);
 
     nvs_handle handle = 0;
     if (!ruuvi_nvs_open(NVS_READWRITE, &handle))
@@ -93,30 +126,42 @@ settings_save_to_flash_cjson_ret_err(const char* const p_json_str)
         return ESP_FAIL;
     }
 
-    char* p_gw_cfg_prev = settings_read_gw_cfg_json_from_nvs(handle);
-    if (NULL == p_gw_cfg_prev)
+    gw_cfg_snapshot_json_id_t json_id_prev = { 0 };
+    if (!settings_read_gw_cfg_json_id_from_nvs(handle, &json_id_prev))
     {
-        LOG_WARN("%s failed", "settings_read_gw_cfg_json_from_nvs");
+        LOG_WARN("%s failed", "settings_read_gw_cfg_json_id_from_nvs");
+    }
+    else if (gw_cfg_snapshot_is_json_id_equal(&json_id_prev, &json_id))
+    {
+        nvs_close(handle);
+        LOG_INFO("### Save config to NVS: not needed (gw_cfg was not modified)");
+        return ESP_OK;
     }
     else
     {
-        const bool flag_is_cfg_equal = (0 == strcmp(p_gw_cfg_prev, p_json_str)) ? true : false;
-        os_free(p_gw_cfg_prev);
-        if (flag_is_cfg_equal)
-        {
-            nvs_close(handle);
-            LOG_INFO("### Save config to NVS: not needed (gw_cfg was not modified)");
-            return ESP_OK;
-        }
+        // MISRA C:2012, 15.7 - All if...else if constructs shall be terminated with an else statement
     }
 
-    esp_err_t err = nvs_set_str(handle, RUUVI_GATEWAY_NVS_CFG_JSON_KEY, (NULL != p_json_str) ? p_json_str : "");
+    // The snapshot is re-created from the new config-json on the next boot,
+    // erase it first to free space in NVS and to avoid using the outdated one if the next steps fail.
+    // The ID of config-json is erased too, so if writing config-json fails, it's parsed on the next boot.
+    settings_erase_key(handle, RUUVI_GATEWAY_NVS_CFG_SNAP_KEY);
+    settings_erase_key(handle, RUUVI_GATEWAY_NVS_CFG_ID_KEY);
+
+    esp_err_t err = nvs_set_str(handle, RUUVI_GATEWAY_NVS_CFG_JSON_KEY, p_json);
     if (ESP_OK != err)
     {
         LOG_ERR_ESP(err, "%s failed", "nvs_set_str");
         nvs_close(handle);
         return err;
     }
+    err = nvs_set_blob(handle, RUUVI_GATEWAY_NVS_CFG_ID_KEY, &json_id, sizeof(json_id));
+    if (ESP_OK != err)
+    {
+        LOG_ERR_ESP(err, "%s failed", "nvs_set_blob");
+        nvs_close(handle);
+        return err;
+    }
     err = nvs_commit(handle);
     if (ESP_OK != err)
     {
@@ -159,15 +204,137 @@ settings_save_to_flash(const gw_cfg_t* const p_gw_cfg)
         settings_save_to_flash_cjson("");
         return;
     }
-    cjson_wrap_str_t cjson_str = { 0 };
-    if (!gw_cfg_json_generate_for_saving(p_gw_cfg, &cjson_str))
+    json_stream_gen_t* p_gen = gw_cfg_json_stream_gen_create_for_saving(p_gw_cfg);
+    if (NULL == p_gen)
+    {
+        LOG_ERR("%s failed", "gw_cfg_json_stream_gen_create_for_saving");
+        return;
+    }
+    str_buf_t json_str = gw_cfg_json_stream_gen_to_str(p_gen);
+    json_stream_gen_delete(&p_gen);
+    if (NULL == json_str.buf)
+    {
+        LOG_ERR("%s failed", "gw_cfg_json_stream_gen_to_str");
+        return;
+    }
+    settings_save_to_flash_cjson(json_str.buf);
+
+    str_buf_free_buf(&json_str);
+}
+
+static bool
+settings_get_gw_cfg_from_snapshot(
+    nvs_handle                             handle,
+    const uint32_t                         defaults_crc32,
+    const gw_cfg_snapshot_json_id_t* const p_json_id,
+    gw_cfg_t* const                        p_gw_cfg)
+{
+    gw_cfg_snapshot_t* p_snapshot = os_malloc(sizeof(*p_snapshot));
+    if (NULL == p_snapshot)
+    {
+        LOG_ERR("Can't allocate %lu bytes for cfg snapshot", (printf_ulong_t)sizeof(*p_snapshot));
+        return false;
+    }
+    size_t          sz      = sizeof(*p_snapshot);
+    const esp_err_t esp_err = nvs_get_blob(handle, RUUVI_GATEWAY_NVS_CFG_SNAP_KEY, p_snapshot, &sz);
+    if (ESP_OK != esp_err)
+    {
+        LOG_INFO("There is no cfg snapshot in NVS");
+        os_free(p_snapshot);
+        return false;
+    }
+    const gw_cfg_snapshot_status_e status = gw_cfg_snapshot_check(p_snapshot, sz, defaults_crc32, p_json_id);
+    if (GW_CFG_SNAPSHOT_STATUS_OK != status)
+    {
+        LOG_WARN("Cfg snapshot in NVS is not valid: %s", gw_cfg_snapshot_status_to_str(status));
+        os_free(p_snapshot);
+        return false;
+    }
+    gw_cfg_snapshot_apply(p_snapshot, p_gw_cfg);
+    os_free(p_snapshot);
+    return true;
+}
+
+static bool
+settings_is_gw_cfg_snapshot_unsupported(nvs_handle handle, const uint32_t defaults_crc32)
+{
+    uint32_t        no_snap_crc32 = 0;
+    size_t          sz            = sizeof(no_snap_crc32);
+    const esp_err_t esp_err       = nvs_get_blob(handle, RUUVI_GATEWAY_NVS_NO_SNAP_KEY, &no_snap_crc32, &sz);
+    if ((ESP_OK != esp_err) || (sizeof(no_snap_crc32) != sz))
+    {
+        return false;
+    }
+    return (defaults_crc32 == no_snap_crc32) ? true : false;
+}
+
+static void
+settings_save_gw_cfg_snapshot(
+    nvs_handle                             handle,
+    const uint32_t                         defaults_crc32,
+    const gw_cfg_snapshot_json_id_t* const p_json_id,
+    const gw_cfg_t* const                  p_gw_cfg)
+{
+    if (settings_is_gw_cfg_snapshot_unsupported(handle, defaults_crc32))
+    {
+        LOG_INFO("Cfg snapshot is not supported: there is not enough space in NVS");
+        return;
+    }
+    gw_cfg_snapshot_t* p_snapshot = os_malloc(sizeof(*p_snapshot));
+    if (NULL == p_snapshot)
     {
-        LOG_ERR("%s failed", "gw_cfg_json_generate_for_saving");
+        LOG_ERR("Can't allocate %lu bytes for cfg snapshot", (printf_ulong_t)sizeof(*p_snapshot));
         return;
     }
-    settings_save_to_flash_cjson(cjson_str.p_str);
+    gw_cfg_snapshot_create(p_gw_cfg, defaults_crc32, p_json_id, p_snapshot);
+    esp_err_t esp_err = nvs_set_blob(handle, RUUVI_GATEWAY_NVS_CFG_SNAP_KEY, p_snapshot, sizeof(*p_snapshot));
+    os_free(p_snapshot);
+    const bool flag_saved = (ESP_OK == esp_err) ? true : false;
+    if (!flag_saved)
+    {
+        // The snapshot is only an optimization, config-json is parsed on every boot if there is no space for it.
+        LOG_WARN_ESP(esp_err, "Failed to save cfg snapshot to NVS");
+        settings_erase_key(handle, RUUVI_GATEWAY_NVS_CFG_SNAP_KEY);
+        if (ESP_ERR_NVS_NOT_ENOUGH_SPACE == esp_err)
+        {
+            // Don't try to save the snapshot on every boot, try again only after the firmware update
+            // (the default configuration includes the firmware versions).
+            esp_err = nvs_set_blob(handle, RUUVI_GATEWAY_NVS_NO_SNAP_KEY, &defaults_crc32, sizeof(defaults_crc32));
+            if (ESP_OK != esp_err)
+            {
+                LOG_WARN_ESP(esp_err, "Failed to mark cfg snapshot as unsupported");
+            }
+        }
+    }
+    esp_err = nvs_commit(handle);
+    if (ESP_OK != esp_err)
+    {
+        LOG_WARN_ESP(esp_err, "%s failed", "nvs_commit");
+        return;
+    }
+    if (flag_saved)
+    {
+        LOG_INFO("Cfg snapshot saved to NVS");
+    }
+}
 
-    cjson_wrap_free_json_str(&cjson_str);
+static void
+settings_update_gw_cfg_json_id_in_nvs(
+    nvs_handle                             handle,
+    const gw_cfg_snapshot_json_id_t* const p_json_id_prev,
+    const gw_cfg_snapshot_json_id_t* const p_json_id)
+{
+    if ((NULL != p_json_id_prev) && gw_cfg_snapshot_is_json_id_equal(p_json_id_prev, p_json_id))
+    {
+        return;
+    }
+    // The ID is missing or outdated if config-json was saved by a firmware version which did not support snapshots.
+    LOG_INFO("Update config-json ID in NVS");
+    const esp_err_t esp_err = nvs_set_blob(handle, RUUVI_GATEWAY_NVS_CFG_ID_KEY, p_json_id, sizeof(*p_json_id));
+    if (ESP_OK != esp_err)
+    {
+        LOG_WARN_ESP(esp_err, "Failed to save config-json ID to NVS");
+    }
 }
 
 static settings_in_nvs_status_e
@@ -175,28 +342,52 @@ settings_get_gw_cfg_from_nvs(nvs_handle handle, gw_cfg_t* const p_gw_cfg)
 {
     gw_cfg_default_get(p_gw_cfg);
 
-    char* p_cfg_json = settings_read_gw_cfg_json_from_nvs(handle);
-    if (NULL == p_cfg_json)
+    size_t          cfg_json_size = 0;
+    const esp_err_t esp_err       = nvs_get_str(handle, RUUVI_GATEWAY_NVS_CFG_JSON_KEY, NULL, &cfg_json_size);
+    if (ESP_OK != esp_err)
     {
-        LOG_ERR("%s failed", "settings_read_gw_cfg_json_from_nvs");
+        LOG_ERR_ESP(esp_err, "Can't find config key '%s' in flash", RUUVI_GATEWAY_NVS_CFG_JSON_KEY);
         return SETTINGS_IN_NVS_STATUS_NOT_EXIST;
     }
+    if (cfg_json_size <= 1U)
+    {
+        return SETTINGS_IN_NVS_STATUS_EMPTY;
+    }
 
-    LOG_DBG("Save config to NVS: %s", p_cfg_json);
+    // The snapshot is used only if it was made from the config-json with the same ID and with the same defaults.
+    // The ID is written together with config-json, so it's enough to compare the size of config-json in NVS with it,
+    // there is no need to read config-json.
+    const uint32_t            defaults_crc32      = gw_cfg_snapshot_calc_defaults_crc32(p_gw_cfg);
+    gw_cfg_snapshot_json_id_t json_id_prev        = { 0 };
+    const bool                flag_json_id_in_nvs = settings_read_gw_cfg_json_id_from_nvs(handle, &json_id_prev);
+    if (flag_json_id_in_nvs && (cfg_json_size == json_id_prev.json_size)
+        && settings_get_gw_cfg_from_snapshot(handle, defaults_crc32, &json_id_prev, p_gw_cfg))
+    {
+        gw_cfg_log(p_gw_cfg, "Read config from NVS snapshot:", false);
+        return SETTINGS_IN_NVS_STATUS_OK;
+    }
 
-    if ('\0' == *p_cfg_json)
+    char* p_cfg_json = settings_read_gw_cfg_json_from_nvs(handle);
+    if (NULL == p_cfg_json)
     {
-        return SETTINGS_IN_NVS_STATUS_EMPTY;
+        LOG_ERR("%s failed", "settings_read_gw_cfg_json_from_nvs");
+        return SETTINGS_IN_NVS_STATUS_NOT_EXIST;
     }
 
+    LOG_DBG("Read config from NVS: %s", p_cfg_json);
+
     if (!gw_cfg_json_parse("NVS", "Read config from NVS:", p_cfg_json, p_gw_cfg))
     {
         LOG_ERR("Failed to parse config-json or no memory");
         os_free(p_cfg_json);
         return SETTINGS_IN_NVS_STATUS_NOT_EXIST;
     }
+    const gw_cfg_snapshot_json_id_t json_id = gw_cfg_snapshot_calc_json_id(p_cfg_json);
     os_free(p_cfg_json);
 
+    settings_update_gw_cfg_json_id_in_nvs(handle, flag_json_id_in_nvs ? &json_id_prev : NULL, &json_id);
+    settings_save_gw_cfg_snapshot(handle, defaults_crc32, &json_id, p_gw_cfg);
+
     return SETTINGS_IN_NVS_STATUS_OK;
 }
 
@@ -0,0 +1,185 @@
+/**
+ * @file uart_capture.c
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "uart_capture.h"
+#include <string.h>
+#if RUUVI_UART_CAPTURE
+#include "esp_timer.h"
+#include "os_mutex.h"
+#include "os_malloc.h"
+#endif
+
+#define UART_CAPTURE_BITS_PER_BYTE (8U)
+#define UART_CAPTURE_BYTE_MASK     (0xFFU)
+#define UART_CAPTURE_MAC_LEN       (6U)
+
+static uint8_t*
+uart_capture_put_u32(uint8_t* p_buf, const uint32_t val)
+{
+    for (uint32_t i = 0; i < sizeof(val); ++i)
+    {
+        *p_buf++ = (uint8_t)((val >> (UART_CAPTURE_BITS_PER_BYTE * i)) & UART_CAPTURE_BYTE_MASK);
+    }
+    return p_buf;
+}
+
+static const uint8_t*
+uart_capture_get_u32(const uint8_t* p_buf, uint32_t* const p_val)
+{
+    uint32_t val = 0;
+    for (uint32_t i = 0; i < sizeof(val); ++i)
+    {
+        val |= (uint32_t)*p_buf++ << (UART_CAPTURE_BITS_PER_BYTE * i);
+    }
+    *p_val = val;
+    return p_buf;
+}
+
+size_t
+uart_capture_serialize(
+    const re_ca_uart_payload_t* const p_msg,
+    const uint32_t                    time_ms,
+    uint8_t* const                    p_buf,
+    const size_t                      buf_size)
+{
+    if ((RE_CA_UART_ADV_RPRT != p_msg->cmd) && (RE_CA_UART_ADV_RPRT2 != p_msg->cmd))
+    {
+        return 0;
+    }
+    const re_ca_uart_ble_adv_t* const p_report = &p_msg->params.adv;
+    if (p_report->adv_len > UART_CAPTURE_ADV_MAX_LEN)
+    {
+        return 0;
+    }
+    const size_t rec_size = UART_CAPTURE_REC_HDR_SIZE + p_report->adv_len;
+    if (rec_size > buf_size)
+    {
+        return 0;
+    }
+    uint8_t* p_dst = uart_capture_put_u32(p_buf, time_ms);
+    *p_dst++       = (uint8_t)p_msg->cmd;
+    memcpy(p_dst, p_report->mac, UART_CAPTURE_MAC_LEN);
+    p_dst += UART_CAPTURE_MAC_LEN;
+    *p_dst++ = (uint8_t)p_report->rssi_db;
+    *p_dst++ = (uint8_t)p_report->primary_phy;
+    *p_dst++ = (uint8_t)p_report->secondary_phy;
+    *p_dst++ = (uint8_t)p_report->ch_index;
+    *p_dst++ = p_report->is_coded_phy ? 1U : 0U;
+    *p_dst++ = (uint8_t)p_report->tx_power;
+    *p_dst++ = (uint8_t)p_report->adv_len;
+    memcpy(p_dst, p_report->adv, p_report->adv_len);
+    return rec_size;
+}
+
+size_t
+uart_capture_deserialize(
+    const uint8_t* const        p_buf,
+    const size_t                len,
+    uint32_t* const             p_time_ms,
+    re_ca_uart_payload_t* const p_msg)
+{
+    if (len < UART_CAPTURE_REC_HDR_SIZE)
+    {
+        return 0;
+    }
+    const uint8_t adv_len  = p_buf[UART_CAPTURE_REC_HDR_SIZE - 1];
+    const size_t  rec_size = UART_CAPTURE_REC_HDR_SIZE + adv_len;
+    if ((adv_len > UART_CAPTURE_ADV_MAX_LEN) || (rec_size > len))
+    {
+        return 0;
+    }
+    memset(p_msg, 0, sizeof(*p_msg));
+    re_ca_uart_ble_adv_t* const p_report = &p_msg->params.adv;
+
+    const uint8_t* p_src = uart_capture_get_u32(p_buf, p_time_ms);
+    p_msg->cmd           = (re_ca_uart_cmd_t)*p_src++;
+    if ((RE_CA_UART_ADV_RPRT != p_msg->cmd) && (RE_CA_UART_ADV_RPRT2 != p_msg->cmd))
+    {
+        return 0;
+    }
+    memcpy(p_report->mac, p_src, UART_CAPTURE_MAC_LEN);
+    p_src += UART_CAPTURE_MAC_LEN;
+    p_report->rssi_db       = (int8_t)*p_src++;
+    p_report->primary_phy   = (re_ca_uart_ble_phy_e)*p_src++;
+    p_report->secondary_phy = (re_ca_uart_ble_phy_e)*p_src++;
+    p_report->ch_index      = *p_src++;
+    p_report->is_coded_phy  = (0 != *p_src++);
+    p_report->tx_power      = (int8_t)*p_src++;
+    p_report->adv_len       = *p_src++;
+    memcpy(p_report->adv, p_src, adv_len);
+    return rec_size;
+}
+
+#if RUUVI_UART_CAPTURE
+
+typedef struct uart_capture_buf_t
+{
+    uint8_t  buf[UART_CAPTURE_BUF_SIZE];
+    size_t   len;
+    uint32_t cnt_dropped;
+} uart_capture_buf_t;
+
+static uart_capture_buf_t g_uart_capture_buf;
+static os_mutex_t         g_p_uart_capture_mutex;
+static os_mutex_static_t  g_uart_capture_mutex_mem;
+
+static void
+uart_capture_lock(void)
+{
+    if (NULL == g_p_uart_capture_mutex)
+    {
+        g_p_uart_capture_mutex = os_mutex_create_static(&g_uart_capture_mutex_mem);
+    }
+    os_mutex_lock(g_p_uart_capture_mutex);
+}
+
+static void
+uart_capture_unlock(void)
+{
+    os_mutex_unlock(g_p_uart_capture_mutex);
+}
+
+void
+uart_capture_put(const re_ca_uart_payload_t* const p_msg)
+{
+    const uint32_t time_ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+    uart_capture_lock();
+    const size_t rec_size = uart_capture_serialize(
+        p_msg,
+        time_ms,
+        &g_uart_capture_buf.buf[g_uart_capture_buf.len],
+        sizeof(g_uart_capture_buf.buf) - g_uart_capture_buf.len);
+    if (0 == rec_size)
+    {
+        g_uart_capture_buf.cnt_dropped += 1;
+    }
+    g_uart_capture_buf.len += rec_size;
+    uart_capture_unlock();
+}
+
+uint8_t*
+uart_capture_take(size_t* const p_len, uint32_t* const p_cnt_dropped)
+{
+    uart_capture_lock();
+    uint8_t* p_data = os_malloc((0 != g_uart_capture_buf.len) ? g_uart_capture_buf.len : 1U);
+    if (NULL == p_data)
+    {
+        uart_capture_unlock();
+        return NULL;
+    }
+    memcpy(p_data, g_uart_capture_buf.buf, g_uart_capture_buf.len);
+    *p_len         = g_uart_capture_buf.len;
+    *p_cnt_dropped = g_uart_capture_buf.cnt_dropped;
+
+    g_uart_capture_buf.len         = 0;
+    g_uart_capture_buf.cnt_dropped = 0;
+    uart_capture_unlock();
+    return p_data;
+}
+
+#endif // RUUVI_UART_CAPTURE
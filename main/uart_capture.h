@@ -0,0 +1,103 @@
+/**
+ * @file uart_capture.h
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#ifndef RUUVI_GATEWAY_ESP_UART_CAPTURE_H
+#define RUUVI_GATEWAY_ESP_UART_CAPTURE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ruuvi_endpoint_ca_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Capturing of the advertisements received from nRF52 is disabled by default,
+ *        it can be enabled with cmake option RUUVI_UART_CAPTURE, then the captured records can be downloaded
+ *        with GET /uart_capture (see scripts/ruuvi_gw_uart_capture.py) and replayed by tests/uart_replay.
+ */
+#if !defined(RUUVI_UART_CAPTURE)
+#define RUUVI_UART_CAPTURE (0)
+#endif
+
+/**
+ * @brief The capture file starts with this signature, it's followed by the records.
+ */
+#define UART_CAPTURE_FILE_SIGNATURE     "RGWUCAP1"
+#define UART_CAPTURE_FILE_SIGNATURE_LEN (8U)
+
+/**
+ * @brief The record is serialized field by field in little-endian order, so the capture file does not depend
+ *        on the layout of re_ca_uart_payload_t: time_ms(4), cmd(1), mac(6), rssi(1), primary_phy(1),
+ *        secondary_phy(1), ch_index(1), is_coded_phy(1), tx_power(1), adv_len(1), adv(adv_len).
+ */
+#define UART_CAPTURE_REC_HDR_SIZE (18U)
+#define UART_CAPTURE_ADV_MAX_LEN  (sizeof(((re_ca_uart_ble_adv_t*)NULL)->adv))
+#define UART_CAPTURE_REC_MAX_SIZE (UART_CAPTURE_REC_HDR_SIZE + UART_CAPTURE_ADV_MAX_LEN)
+
+/**
+ * @brief Size of the RAM buffer for the captured records when RUUVI_UART_CAPTURE is enabled.
+ */
+#define UART_CAPTURE_BUF_SIZE (16U * 1024U)
+
+/**
+ * @brief Serialize the advertisement report.
+ * @param p_msg - pointer to the message received from nRF52 (RE_CA_UART_ADV_RPRT or RE_CA_UART_ADV_RPRT2).
+ * @param time_ms - the time of receiving the message in milliseconds.
+ * @param p_buf - pointer to the output buffer.
+ * @param buf_size - size of the output buffer.
+ * @return the size of the serialized record or 0 if the message is not an advertisement or the buffer is too small.
+ */
+size_t
+uart_capture_serialize(
+    const re_ca_uart_payload_t* const p_msg,
+    const uint32_t                    time_ms,
+    uint8_t* const                    p_buf,
+    const size_t                      buf_size);
+
+/**
+ * @brief Deserialize the record.
+ * @param p_buf - pointer to the serialized record.
+ * @param len - number of bytes available in the buffer.
+ * @param[out] p_time_ms - pointer to the output variable for the time of receiving the message.
+ * @param[out] p_msg - pointer to the output message.
+ * @return the size of the record or 0 if the record is incomplete or invalid.
+ */
+size_t
+uart_capture_deserialize(
+    const uint8_t* const        p_buf,
+    const size_t                len,
+    uint32_t* const             p_time_ms,
+    re_ca_uart_payload_t* const p_msg);
+
+#if RUUVI_UART_CAPTURE
+
+/**
+ * @brief Save the advertisement report into the capture buffer, if the buffer is full, the report is dropped.
+ * @param p_msg - pointer to the message received from nRF52.
+ */
+void
+uart_capture_put(const re_ca_uart_payload_t* const p_msg);
+
+/**
+ * @brief Move all the captured records into the allocated buffer and clear the capture buffer.
+ * @param[out] p_len - pointer to the output variable for the number of bytes in the returned buffer.
+ * @param[out] p_cnt_dropped - pointer to the output variable for the number of records dropped since the last call.
+ * @return pointer to the allocated buffer (it must be freed by the caller) or NULL if there is not enough memory.
+ */
+uint8_t*
+uart_capture_take(size_t* const p_len, uint32_t* const p_cnt_dropped);
+
+#endif // RUUVI_UART_CAPTURE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUUVI_GATEWAY_ESP_UART_CAPTURE_H
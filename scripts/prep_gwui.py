@@ -11,8 +11,24 @@ import subprocess
 import sys
 import shutil
 import gzip
+import re
 from datetime import datetime
 
+GWUI_MANIFEST_FILE_NAME = 'gwui_manifest.txt'
+# Asset names produced by the bundler contain a content hash, e.g. 'index.3f2a9c1b.js'
+RE_HASHED_ASSET_NAME = re.compile(r'.*\.[0-9a-fA-F]{8,}\.[^.]+$')
+
+
+def write_manifest(output_dir, list_of_files):
+    manifest_path = os.path.join(output_dir, GWUI_MANIFEST_FILE_NAME)
+    print('Create manifest: %s' % manifest_path)
+    with open(manifest_path, 'w') as f_out:
+        for src_name, dst_file in list_of_files:
+            rel_path = os.path.relpath(dst_file, start=output_dir).replace(os.sep, '/')
+            file_size = os.path.getsize(dst_file)
+            flag_immutable = 1 if RE_HASHED_ASSET_NAME.match(src_name) else 0
+            f_out.write('%s %d %d\n' % (rel_path, file_size, flag_immutable))
+
 
 def main():
     parser = argparse.ArgumentParser(description='This tool prepares GWUI')
@@ -30,6 +46,7 @@ def main():
     print('Create dir: %s' % output_dir)
     os.mkdir(output_dir)
     timestamp = datetime(2000, 1, 1, 0, 0, 0).timestamp()
+    list_of_files = list()
     for root, dirs, files in os.walk(input_dir):
         rel_root = os.path.relpath(root, start=input_dir)
         target_dir = os.path.join(output_dir, rel_root)
@@ -44,15 +61,18 @@ def main():
                     print('%s -> %s' % (src_file, dst_file))
                     with gzip.GzipFile(filename=dst_file, mode='wb', mtime=timestamp) as f_out:
                         shutil.copyfileobj(f_in, f_out)
+                list_of_files.append((file, dst_file))
             elif (file_ext == '.ico' or file_ext == '.woff' or file_ext == '.woff2' or file_ext == '.png' or
                   file_ext == '.svg' or file_ext == '.jpg' or file_ext == '.jpeg' or file_ext == '.gif'):
                 src_file = os.path.join(root, file)
                 dst_file = os.path.join(target_dir, file)
                 print('%s -> %s' % (src_file, dst_file))
                 shutil.copy(src_file, dst_file)
+                list_of_files.append((file, dst_file))
             else:
                 src_file = os.path.join(root, file)
                 print('Skip %s' % src_file)
+    write_manifest(output_dir, sorted(list_of_files))
 
 
 if __name__ == '__main__':
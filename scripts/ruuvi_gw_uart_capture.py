@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+# -----------------------------------------------------------------------------------
+# File: ruuvi_gw_uart_capture.py
+# Copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+# Author: TheSomeMan
+#
+# Description: This script periodically downloads the advertisements captured by Ruuvi Gateway
+#              and saves them into the capture file for tests/uart_replay.
+# -----------------------------------------------------------------------------------
+
+import argparse
+import sys
+import time
+import urllib.request
+import urllib.error
+
+UART_CAPTURE_FILE_SIGNATURE = b'RGWUCAP1'
+
+description = """
+This script periodically downloads the advertisements captured by Ruuvi Gateway (GET /uart_capture)
+and appends them to the capture file which can be replayed by tests/uart_replay.
+
+The firmware must be built with the cmake option RUUVI_UART_CAPTURE=ON.
+The capture buffer in the gateway is limited, so the polling period should be short enough for the site
+(the number of records dropped by the gateway is printed to its log).
+"""
+
+
+def download(url: str, token: str | None, timeout: float) -> bytes:
+    req = urllib.request.Request(url)
+    if token is not None:
+        req.add_header('Authorization', f'Bearer {token}')
+    with urllib.request.urlopen(req, timeout=timeout) as resp:
+        return resp.read()
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=description, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('host', help='IP address or hostname of Ruuvi Gateway')
+    parser.add_argument('-o', '--output', required=True, help='Path to the capture file')
+    parser.add_argument('-p', '--period', type=float, default=1.0, help='Polling period in seconds (default: 1.0)')
+    parser.add_argument('-d', '--duration', type=float, default=0.0,
+                        help='Capture duration in seconds, 0 - until interrupted (default: 0)')
+    parser.add_argument('-t', '--token', default=None, help='Bearer token for the access to the gateway')
+    args = parser.parse_args()
+
+    url = f'http://{args.host}/uart_capture'
+    time_start = time.monotonic()
+    total_len = 0
+    with open(args.output, 'wb') as fd:
+        fd.write(UART_CAPTURE_FILE_SIGNATURE)
+        try:
+            while (args.duration == 0.0) or ((time.monotonic() - time_start) < args.duration):
+                time_poll = time.monotonic()
+                try:
+                    data = download(url, args.token, timeout=max(args.period, 5.0))
+                except urllib.error.URLError as ex:
+                    print(f'Failed to download {url}: {ex}', file=sys.stderr)
+                    data = b''
+                fd.write(data)
+                fd.flush()
+                total_len += len(data)
+                print(f'Received {len(data)} bytes, total {total_len} bytes')
+                time.sleep(max(0.0, args.period - (time.monotonic() - time_poll)))
+        except KeyboardInterrupt:
+            pass
+    print(f'Saved {total_len} bytes of records to {args.output}')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
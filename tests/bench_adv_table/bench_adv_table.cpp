@@ -0,0 +1,157 @@
+/**
+ * @file bench_adv_table.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ *
+ * @brief Benchmark for draining the MQTT retransmission list in instant mode:
+ *        the advs are dequeued one by one (as it was done before) and by bursts,
+ *        then the MQTT topic and the hex payload are formatted for every adv (the host part of the publishing).
+ *        The table is protected by a real mutex, so the cost of locking is included.
+ *
+ * Usage: ruuvi_gateway_esp-bench_adv_table [num_iterations]
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include "adv_table.h"
+#include "fmt_fast.h"
+#include "os_mutex.h"
+
+using namespace std;
+
+#define BENCH_ADV_LEN        (24U)
+#define BENCH_BURST_NUM_ADVS (8U)
+#define BENCH_DEFAULT_CNT    (2000U)
+
+static volatile uint32_t g_checksum;
+
+extern "C" {
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    (void)p_mutex_static;
+    return reinterpret_cast<os_mutex_t>(new std::mutex());
+}
+
+void
+os_mutex_delete(os_mutex_t* const ph_mutex)
+{
+    delete reinterpret_cast<std::mutex*>(*ph_mutex);
+    *ph_mutex = nullptr;
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    reinterpret_cast<std::mutex*>(h_mutex)->lock();
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    reinterpret_cast<std::mutex*>(h_mutex)->unlock();
+}
+
+} // extern "C"
+
+static void
+bench_fill_table(const uint32_t iter)
+{
+    for (uint32_t i = 0; i < MAX_ADVS_TABLE; ++i)
+    {
+        adv_report_t adv = {};
+        adv.timestamp    = (time_t)(1611154440 + iter);
+        adv.tag_mac      = { { 0x11U, 0x22U, 0x33U, 0x44U, (uint8_t)(i >> 8U), (uint8_t)i } };
+        adv.rssi         = -50;
+        adv.data_len     = BENCH_ADV_LEN;
+        for (uint32_t j = 0; j < BENCH_ADV_LEN; ++j)
+        {
+            adv.data_buf[j] = (uint8_t)(iter + i + j);
+        }
+        (void)adv_table_put(&adv);
+    }
+}
+
+static void
+bench_publish(const adv_report_t* const p_adv)
+{
+    char                    topic[64];
+    char                    hex_buf[ADV_DATA_MAX_LEN * 2 + 1];
+    const mac_address_str_t mac_str = fmt_fast_mac_to_str(&p_adv->tag_mac);
+    (void)snprintf(topic, sizeof(topic), "ruuvi/AA:BB:CC:DD:EE:FF/%s", mac_str.str_buf);
+    (void)fmt_fast_hex(hex_buf, sizeof(hex_buf), p_adv->data_buf, p_adv->data_len);
+    g_checksum += (uint32_t)topic[sizeof("ruuvi/AA:BB:CC:DD:EE:FF/")] + (uint32_t)hex_buf[0];
+}
+
+static uint32_t
+bench_drain_one_by_one(void)
+{
+    uint32_t     num_advs = 0;
+    adv_report_t adv      = {};
+    while (adv_table_read_retransmission_list3_head(&adv))
+    {
+        bench_publish(&adv);
+        num_advs += 1;
+    }
+    return num_advs;
+}
+
+static uint32_t
+bench_drain_by_bursts(void)
+{
+    uint32_t     num_advs = 0;
+    adv_report_t advs[BENCH_BURST_NUM_ADVS];
+    uint32_t     num_burst = 0;
+    while (0 != (num_burst = adv_table_read_retransmission_list3_head_batch(advs, BENCH_BURST_NUM_ADVS)))
+    {
+        for (uint32_t i = 0; i < num_burst; ++i)
+        {
+            bench_publish(&advs[i]);
+        }
+        num_advs += num_burst;
+    }
+    return num_advs;
+}
+
+static double
+bench_run(const char* const p_name, uint32_t (*p_cb_drain)(void), const uint32_t cnt)
+{
+    uint64_t num_advs    = 0;
+    int64_t  duration_ns = 0;
+    for (uint32_t iter = 0; iter < cnt; ++iter)
+    {
+        bench_fill_table(iter);
+        const auto time_start = chrono::steady_clock::now();
+        num_advs += p_cb_drain();
+        duration_ns += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - time_start).count();
+    }
+    const double advs_per_sec = (double)num_advs * 1e9 / (double)duration_ns;
+    printf("%-12s: %" PRIu64 " advs, %10.0f publishes/s\n", p_name, num_advs, advs_per_sec);
+    return advs_per_sec;
+}
+
+int
+main(int argc, char** argv)
+{
+    const uint32_t cnt = (argc > 1) ? (uint32_t)strtoul(argv[1], nullptr, 0) : BENCH_DEFAULT_CNT;
+    if (0 == cnt)
+    {
+        fprintf(stderr, "Usage: %s [num_iterations]\n", argv[0]);
+        return 1;
+    }
+    adv_table_init();
+    printf("Draining of %u advs from the MQTT retransmission list x %" PRIu32 " iterations\n",
+           (unsigned)MAX_ADVS_TABLE,
+           cnt);
+    const double rate_single = bench_run("one by one", &bench_drain_one_by_one, cnt);
+    const double rate_burst  = bench_run("by bursts", &bench_drain_by_bursts, cnt);
+    printf("Speed-up    : %8.2f x\n", rate_burst / rate_single);
+    adv_table_deinit();
+    return 0;
+}
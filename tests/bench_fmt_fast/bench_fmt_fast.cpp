@@ -0,0 +1,133 @@
+/**
+ * @file bench_fmt_fast.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ *
+ * @brief Micro-benchmark for the formatting of one tag in the HTTP/MQTT JSON:
+ *        the MAC address and the hex dump of a typical 24-byte advertisement,
+ *        printed with snprintf (as it was done before) and with fmt_fast.
+ *
+ * Usage: ruuvi_gateway_esp-bench_fmt_fast [num_iterations]
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "fmt_fast.h"
+#include "mac_addr.h"
+
+using namespace std;
+
+#define BENCH_NUM_TAGS    (100U)
+#define BENCH_ADV_LEN     (24U)
+#define BENCH_DEFAULT_CNT (10000U)
+
+typedef struct bench_tag_t
+{
+    mac_address_bin_t mac;
+    uint8_t           adv[BENCH_ADV_LEN];
+} bench_tag_t;
+
+static bench_tag_t g_tags[BENCH_NUM_TAGS];
+
+static volatile uint32_t g_checksum;
+
+static void
+bench_init_tags(void)
+{
+    uint32_t seed = 12345U;
+    for (uint32_t i = 0; i < BENCH_NUM_TAGS; ++i)
+    {
+        for (uint32_t j = 0; j < MAC_ADDRESS_NUM_BYTES; ++j)
+        {
+            seed                 = seed * 1103515245U + 12345U;
+            g_tags[i].mac.mac[j] = (uint8_t)(seed >> 16U);
+        }
+        for (uint32_t j = 0; j < BENCH_ADV_LEN; ++j)
+        {
+            seed             = seed * 1103515245U + 12345U;
+            g_tags[i].adv[j] = (uint8_t)(seed >> 16U);
+        }
+    }
+}
+
+static void
+bench_format_tag_printf(const bench_tag_t* const p_tag)
+{
+    const mac_address_str_t mac_str = mac_address_to_str(&p_tag->mac);
+    char                    hex_buf[BENCH_ADV_LEN * 2 + 1];
+    for (uint32_t i = 0; i < BENCH_ADV_LEN; ++i)
+    {
+        (void)snprintf(&hex_buf[i * 2], sizeof(hex_buf) - i * 2, "%02X", p_tag->adv[i]);
+    }
+    g_checksum += (uint32_t)mac_str.str_buf[0] + (uint32_t)hex_buf[BENCH_ADV_LEN * 2 - 1];
+}
+
+static void
+bench_format_tag_fmt_fast(const bench_tag_t* const p_tag)
+{
+    const mac_address_str_t mac_str = fmt_fast_mac_to_str(&p_tag->mac);
+    char                    hex_buf[BENCH_ADV_LEN * 2 + 1];
+    (void)fmt_fast_hex(hex_buf, sizeof(hex_buf), p_tag->adv, BENCH_ADV_LEN);
+    g_checksum += (uint32_t)mac_str.str_buf[0] + (uint32_t)hex_buf[BENCH_ADV_LEN * 2 - 1];
+}
+
+static double
+bench_run(const char* const p_name, void (*p_cb_format)(const bench_tag_t* const p_tag), const uint32_t cnt)
+{
+    const auto time_start = chrono::steady_clock::now();
+    for (uint32_t iter = 0; iter < cnt; ++iter)
+    {
+        for (uint32_t i = 0; i < BENCH_NUM_TAGS; ++i)
+        {
+            p_cb_format(&g_tags[i]);
+        }
+    }
+    const auto   time_end = chrono::steady_clock::now();
+    const double ns_per_tag
+        = (double)chrono::duration_cast<chrono::nanoseconds>(time_end - time_start).count() / (cnt * BENCH_NUM_TAGS);
+    printf("%-10s: %8.1f ns per tag\n", p_name, ns_per_tag);
+    return ns_per_tag;
+}
+
+int
+main(int argc, char** argv)
+{
+    const uint32_t cnt = (argc > 1) ? (uint32_t)strtoul(argv[1], nullptr, 0) : BENCH_DEFAULT_CNT;
+    if (0 == cnt)
+    {
+        fprintf(stderr, "Usage: %s [num_iterations]\n", argv[0]);
+        return 1;
+    }
+    bench_init_tags();
+
+    for (uint32_t i = 0; i < BENCH_NUM_TAGS; ++i)
+    {
+        char                    hex_buf1[BENCH_ADV_LEN * 2 + 1];
+        char                    hex_buf2[BENCH_ADV_LEN * 2 + 1];
+        const mac_address_str_t mac_str1 = mac_address_to_str(&g_tags[i].mac);
+        const mac_address_str_t mac_str2 = fmt_fast_mac_to_str(&g_tags[i].mac);
+        for (uint32_t j = 0; j < BENCH_ADV_LEN; ++j)
+        {
+            (void)snprintf(&hex_buf1[j * 2], sizeof(hex_buf1) - j * 2, "%02X", g_tags[i].adv[j]);
+        }
+        (void)fmt_fast_hex(hex_buf2, sizeof(hex_buf2), g_tags[i].adv, BENCH_ADV_LEN);
+        if ((0 != strcmp(mac_str1.str_buf, mac_str2.str_buf)) || (0 != strcmp(hex_buf1, hex_buf2)))
+        {
+            fprintf(stderr, "Output of fmt_fast differs from snprintf: %s %s\n", mac_str2.str_buf, hex_buf2);
+            return 1;
+        }
+    }
+
+    printf("Formatting of MAC + %u-byte advertisement, %u tags x %" PRIu32 " iterations\n",
+           (unsigned)BENCH_ADV_LEN,
+           (unsigned)BENCH_NUM_TAGS,
+           cnt);
+    const double ns_printf   = bench_run("snprintf", &bench_format_tag_printf, cnt);
+    const double ns_fmt_fast = bench_run("fmt_fast", &bench_format_tag_fmt_fast, cnt);
+    printf("Speed-up  : %8.1f x\n", ns_printf / ns_fmt_fast);
+    return 0;
+}
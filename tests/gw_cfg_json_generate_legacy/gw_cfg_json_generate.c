@@ -9,6 +9,7 @@
 #include <string.h>
 #include "gw_cfg_default.h"
 #include "gw_cfg_storage.h"
+#include "fmt_fast.h"
 
 #if !defined(RUUVI_TESTS_HTTP_SERVER_CB)
 #define RUUVI_TESTS_HTTP_SERVER_CB 0
@@ -641,6 +642,10 @@ gw_cfg_json_add_items_mqtt(
             }
             break;
     }
+    if (!gw_cfg_json_add_number(p_json_root, "mqtt_qos", p_cfg_mqtt->mqtt_qos))
+    {
+        return false;
+    }
     if (!gw_cfg_json_add_string(p_json_root, "mqtt_server", p_cfg_mqtt->mqtt_server.buf))
     {
         return false;
@@ -896,6 +901,136 @@ gw_cfg_json_add_items_scan_filter(cJSON* const p_json_root, const ruuvi_gw_cfg_s
     return true;
 }
 
+static bool
+gw_cfg_json_add_hex_buf(
+    cJSON* const         p_json_root,
+    const char* const    p_item_name,
+    const uint8_t* const p_buf,
+    const size_t         buf_len)
+{
+    char hex_str[(GW_CFG_ADV_FILTER_PREFIX_MAX_LEN * 2U) + 1U];
+    (void)fmt_fast_hex(hex_str, sizeof(hex_str), p_buf, buf_len);
+    return gw_cfg_json_add_string(p_json_root, p_item_name, hex_str);
+}
+
+static bool
+gw_cfg_json_add_adv_filter_rule(cJSON* const p_json_rule, const ruuvi_gw_cfg_adv_filter_rule_t* const p_rule)
+{
+    if (p_rule->use_manufacturer_id
+        && (!gw_cfg_json_add_number(p_json_rule, "manufacturer_id", p_rule->manufacturer_id)))
+    {
+        return false;
+    }
+    if (p_rule->use_data_format && (!gw_cfg_json_add_number(p_json_rule, "data_format", p_rule->data_format)))
+    {
+        return false;
+    }
+    if (p_rule->use_rssi_min && (!gw_cfg_json_add_number(p_json_rule, "rssi_min", p_rule->rssi_min)))
+    {
+        return false;
+    }
+    if (p_rule->use_mac_oui
+        && (!gw_cfg_json_add_hex_buf(p_json_rule, "mac_oui", p_rule->mac_oui, sizeof(p_rule->mac_oui))))
+    {
+        return false;
+    }
+    if (0 != p_rule->payload_prefix_len)
+    {
+        if (!gw_cfg_json_add_hex_buf(
+                p_json_rule,
+                "payload_prefix",
+                p_rule->payload_prefix,
+                p_rule->payload_prefix_len))
+        {
+            return false;
+        }
+        if (!gw_cfg_json_add_hex_buf(p_json_rule, "payload_mask", p_rule->payload_mask, p_rule->payload_prefix_len))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+gw_cfg_json_add_items_adv_filter(cJSON* const p_json_root, const ruuvi_gw_cfg_adv_filter_t* const p_cfg_adv_filter)
+{
+    if (0 == p_cfg_adv_filter->num_rules)
+    {
+        // The rules are optional, so the key is omitted if there are no rules
+        return true;
+    }
+    cJSON* const p_array_of_rules = cJSON_AddArrayToObject(p_json_root, "adv_filter_rules");
+    if (NULL == p_array_of_rules)
+    {
+        LOG_ERR("Can't add json item: %s", "adv_filter_rules");
+        return false;
+    }
+    for (uint32_t i = 0; i < p_cfg_adv_filter->num_rules; ++i)
+    {
+        cJSON* const p_json_rule = cJSON_CreateObject();
+        if (NULL == p_json_rule)
+        {
+            LOG_ERR("Can't add rule to adv_filter_rules array");
+            return false;
+        }
+        cJSON_AddItemToArray(p_array_of_rules, p_json_rule);
+        if (!gw_cfg_json_add_adv_filter_rule(p_json_rule, &p_cfg_adv_filter->rules[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+gw_cfg_json_add_items_adv_aggr(cJSON* const p_json_root, const ruuvi_gw_cfg_adv_aggr_t* const p_cfg_adv_aggr)
+{
+    const char* p_mode_str = NULL;
+    switch (p_cfg_adv_aggr->mode)
+    {
+        case GW_CFG_ADV_AGGR_MODE_NONE:
+            // The aggregation is optional, so the keys are omitted if it's not in use
+            return true;
+        case GW_CFG_ADV_AGGR_MODE_DOWNSAMPLE:
+            p_mode_str = GW_CFG_ADV_AGGR_MODE_STR_DOWNSAMPLE;
+            break;
+        case GW_CFG_ADV_AGGR_MODE_WINDOW:
+            p_mode_str = GW_CFG_ADV_AGGR_MODE_STR_WINDOW;
+            break;
+    }
+    if (!gw_cfg_json_add_string(p_json_root, "adv_aggr_mode", p_mode_str))
+    {
+        return false;
+    }
+    if (!gw_cfg_json_add_number(p_json_root, "adv_aggr_period", p_cfg_adv_aggr->period_seconds))
+    {
+        return false;
+    }
+    return true;
+}
+
+static bool
+gw_cfg_json_add_items_adv_trigger(cJSON* const p_json_root, const ruuvi_gw_cfg_adv_trigger_t* const p_cfg_adv_trigger)
+{
+    // The rules are optional, so the keys are omitted for the rules which are not in use
+    if (p_cfg_adv_trigger->on_movement && (!gw_cfg_json_add_bool(p_json_root, "adv_trigger_movement", true)))
+    {
+        return false;
+    }
+    if (p_cfg_adv_trigger->use_temperature_low
+        && (!gw_cfg_json_add_number(p_json_root, "adv_trigger_temperature_low", p_cfg_adv_trigger->temperature_low)))
+    {
+        return false;
+    }
+    if (p_cfg_adv_trigger->use_temperature_high
+        && (!gw_cfg_json_add_number(p_json_root, "adv_trigger_temperature_high", p_cfg_adv_trigger->temperature_high)))
+    {
+        return false;
+    }
+    return true;
+}
+
 static bool
 gw_cfg_json_add_items_fw_update(cJSON* const p_json_root, const ruuvi_gw_cfg_fw_update_t* const p_cfg_fw_update)
 {
@@ -977,6 +1112,18 @@ gw_cfg_json_add_items(
     {
         return false;
     }
+    if (!gw_cfg_json_add_items_adv_filter(p_json_root, &p_cfg->ruuvi_cfg.adv_filter))
+    {
+        return false;
+    }
+    if (!gw_cfg_json_add_items_adv_aggr(p_json_root, &p_cfg->ruuvi_cfg.adv_aggr))
+    {
+        return false;
+    }
+    if (!gw_cfg_json_add_items_adv_trigger(p_json_root, &p_cfg->ruuvi_cfg.adv_trigger))
+    {
+        return false;
+    }
     if (!gw_cfg_json_add_string(p_json_root, "coordinates", p_cfg->ruuvi_cfg.coordinates.buf))
     {
         return false;
@@ -3,6 +3,10 @@
  * @author TheSomeMan
  * @date 2022-05-18
  * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ *
+ * The cJSON serializer of gw_cfg which was removed from the firmware.
+ * It is kept only for the tests as the reference for gw_cfg_json_stream_gen:
+ * the generator output must be byte-identical to the unformatted output of this serializer.
  */
 
 #ifndef RUUVI_GATEWAY_GW_CFG_JSON_GENERATE_H
@@ -0,0 +1,167 @@
+/**
+ * @file test_adv_aggr.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_aggr.h"
+#include <cstring>
+#include <cmath>
+#include "gtest/gtest.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestAdvAggr : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        memset(&this->m_aggr, 0, sizeof(this->m_aggr));
+        memset(&this->m_stat, 0, sizeof(this->m_stat));
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    TestAdvAggr();
+
+    ~TestAdvAggr() override;
+
+    adv_aggr_t      m_aggr {};
+    adv_aggr_stat_t m_stat {};
+
+    void
+    init(const gw_cfg_adv_aggr_mode_e mode, const uint32_t period_seconds)
+    {
+        const ruuvi_gw_cfg_adv_aggr_t cfg = {
+            .mode           = mode,
+            .period_seconds = period_seconds,
+        };
+        adv_aggr_init(&this->m_aggr, &cfg);
+    }
+
+    bool
+    put(const mac_address_bin_t& mac, const float temperature, const adv_aggr_time_ms_t now)
+    {
+        adv_decoded_t decoded          = {};
+        decoded.data_format            = ADV_DECODED_DATA_FORMAT_5;
+        decoded.data.df5.temperature_c = temperature;
+        decoded.data.df5.humidity_rh   = NAN;
+        decoded.data.df5.pressure_pa   = 100000.0f;
+        return adv_aggr_put(&this->m_aggr, &mac, &decoded, now, &this->m_stat);
+    }
+};
+
+TestAdvAggr::TestAdvAggr()
+    : Test()
+{
+}
+
+TestAdvAggr::~TestAdvAggr() = default;
+
+static const mac_address_bin_t g_mac1 = { { 0xC9U, 0x12U, 0x34U, 0x56U, 0x78U, 0x9AU } };
+static const mac_address_bin_t g_mac2 = { { 0xD0U, 0x12U, 0x34U, 0x56U, 0x78U, 0x9AU } };
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestAdvAggr, test_mode_none) // NOLINT
+{
+    this->init(GW_CFG_ADV_AGGR_MODE_NONE, 10);
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(this->put(g_mac1, 20.0f, i * 1000U));
+        ASSERT_EQ(0, this->m_stat.num_samples);
+    }
+}
+
+TEST_F(TestAdvAggr, test_downsample) // NOLINT
+{
+    this->init(GW_CFG_ADV_AGGR_MODE_DOWNSAMPLE, 10);
+
+    // The first adv of the tag is forwarded immediately
+    ASSERT_TRUE(this->put(g_mac1, 20.0f, 1000));
+    ASSERT_EQ(0, this->m_stat.num_samples);
+    ASSERT_TRUE(this->put(g_mac2, 20.0f, 1500));
+
+    for (uint32_t now = 2000; now < 11000; now += 1000)
+    {
+        ASSERT_FALSE(this->put(g_mac1, 20.0f, now));
+    }
+    ASSERT_TRUE(this->put(g_mac1, 20.0f, 11000));
+    ASSERT_EQ(0, this->m_stat.num_samples);
+    ASSERT_FALSE(this->put(g_mac1, 20.0f, 12000));
+
+    // The tags are downsampled independently
+    ASSERT_FALSE(this->put(g_mac2, 20.0f, 11000));
+    ASSERT_TRUE(this->put(g_mac2, 20.0f, 11500));
+}
+
+TEST_F(TestAdvAggr, test_window) // NOLINT
+{
+    this->init(GW_CFG_ADV_AGGR_MODE_WINDOW, 10);
+
+    ASSERT_TRUE(this->put(g_mac1, 20.0f, 1000));
+    ASSERT_EQ(1, this->m_stat.num_samples);
+
+    ASSERT_FALSE(this->put(g_mac1, 25.0f, 3000));
+    ASSERT_FALSE(this->put(g_mac1, 15.0f, 5000));
+    ASSERT_TRUE(this->put(g_mac1, 21.0f, 11000));
+
+    ASSERT_EQ(3, this->m_stat.num_samples);
+    ASSERT_EQ(
+        (1U << ADV_AGGR_MEAS_TEMPERATURE) | (1U << ADV_AGGR_MEAS_PRESSURE),
+        (uint32_t)this->m_stat.meas_mask);
+    ASSERT_FLOAT_EQ(15.0f, this->m_stat.meas[ADV_AGGR_MEAS_TEMPERATURE].min);
+    ASSERT_FLOAT_EQ(25.0f, this->m_stat.meas[ADV_AGGR_MEAS_TEMPERATURE].max);
+    ASSERT_FLOAT_EQ(61.0f / 3.0f, this->m_stat.meas[ADV_AGGR_MEAS_TEMPERATURE].mean);
+    ASSERT_FLOAT_EQ(100000.0f, this->m_stat.meas[ADV_AGGR_MEAS_PRESSURE].mean);
+
+    // The next window starts after the forwarded adv
+    ASSERT_FALSE(this->put(g_mac1, 30.0f, 12000));
+    ASSERT_TRUE(this->put(g_mac1, 29.0f, 21000));
+    ASSERT_EQ(2, this->m_stat.num_samples);
+    ASSERT_FLOAT_EQ(29.0f, this->m_stat.meas[ADV_AGGR_MEAS_TEMPERATURE].min);
+    ASSERT_FLOAT_EQ(30.0f, this->m_stat.meas[ADV_AGGR_MEAS_TEMPERATURE].max);
+}
+
+TEST_F(TestAdvAggr, test_uptime_wrap_around) // NOLINT
+{
+    this->init(GW_CFG_ADV_AGGR_MODE_DOWNSAMPLE, 10);
+    ASSERT_TRUE(this->put(g_mac1, 20.0f, UINT32_MAX - 4999U));
+    ASSERT_FALSE(this->put(g_mac1, 20.0f, 4000));
+    ASSERT_TRUE(this->put(g_mac1, 20.0f, 5000));
+}
+
+TEST_F(TestAdvAggr, test_table_overflow) // NOLINT
+{
+    this->init(GW_CFG_ADV_AGGR_MODE_DOWNSAMPLE, 10);
+    for (uint32_t i = 0; i < ADV_AGGR_MAX_NUM_TAGS; ++i)
+    {
+        mac_address_bin_t mac = g_mac1;
+        mac.mac[5]            = (uint8_t)i;
+        ASSERT_TRUE(this->put(mac, 20.0f, 1000));
+    }
+    for (uint32_t i = 0; i < ADV_AGGR_MAX_NUM_TAGS; ++i)
+    {
+        mac_address_bin_t mac = g_mac1;
+        mac.mac[5]            = (uint8_t)i;
+        ASSERT_FALSE(this->put(mac, 20.0f, 2000));
+    }
+    // The least recently seen tag is forgotten, so it's treated as a new one
+    ASSERT_TRUE(this->put(g_mac2, 20.0f, 3000));
+    mac_address_bin_t mac = g_mac1;
+    mac.mac[5]            = 0;
+    ASSERT_TRUE(this->put(mac, 20.0f, 3000));
+    mac.mac[5] = 2;
+    ASSERT_FALSE(this->put(mac, 20.0f, 3000));
+}
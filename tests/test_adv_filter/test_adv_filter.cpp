@@ -0,0 +1,174 @@
+/**
+ * @file test_adv_filter.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_filter.h"
+#include <cstring>
+#include "gtest/gtest.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestAdvFilter : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        memset(&this->m_cfg, 0, sizeof(this->m_cfg));
+        memset(&this->m_filter, 0, sizeof(this->m_filter));
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    TestAdvFilter();
+
+    ~TestAdvFilter() override;
+
+    ruuvi_gw_cfg_adv_filter_t m_cfg {};
+    adv_filter_t              m_filter {};
+
+    ruuvi_gw_cfg_adv_filter_rule_t*
+    add_rule()
+    {
+        ruuvi_gw_cfg_adv_filter_rule_t* const p_rule = &this->m_cfg.rules[this->m_cfg.num_rules];
+        this->m_cfg.num_rules += 1;
+        return p_rule;
+    }
+
+    bool
+    check(const mac_address_bin_t& mac, const int8_t rssi, const uint8_t* const p_data, const uint32_t data_len)
+    {
+        adv_filter_compile(&this->m_filter, &this->m_cfg);
+        return adv_filter_check(&this->m_filter, &mac, rssi, p_data, data_len);
+    }
+};
+
+TestAdvFilter::TestAdvFilter()
+    : Test()
+{
+}
+
+TestAdvFilter::~TestAdvFilter() = default;
+
+static const mac_address_bin_t g_mac1 = { { 0xC9U, 0x12U, 0x34U, 0x56U, 0x78U, 0x9AU } };
+static const mac_address_bin_t g_mac2 = { { 0xD0U, 0x12U, 0x34U, 0x56U, 0x78U, 0x9AU } };
+
+// Flags, then the manufacturer specific data of Ruuvi (0x0499) with data format 0x05
+static const uint8_t g_adv_df5[] = {
+    0x02U, 0x01U, 0x06U, 0x1BU, 0xFFU, 0x99U, 0x04U, 0x05U, 0x12U, 0xFCU, 0x53U, 0x94U, 0xC3U, 0x7CU, 0x00U, 0x04U,
+    0xFFU, 0xFCU, 0x04U, 0x0CU, 0xACU, 0x36U, 0x42U, 0x00U, 0xCDU, 0xCBU, 0xB8U, 0x33U, 0x4CU, 0x88U, 0x4FU,
+};
+
+static const uint8_t g_adv_df6[] = {
+    0x02U, 0x01U, 0x06U, 0x0AU, 0xFFU, 0x99U, 0x04U, 0x06U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U,
+};
+
+static const uint8_t g_adv_other_company[] = {
+    0x02U, 0x01U, 0x06U, 0x06U, 0xFFU, 0x4CU, 0x00U, 0x05U, 0x01U, 0x02U,
+};
+
+static const uint8_t g_adv_without_manufacturer_data[] = {
+    0x02U, 0x01U, 0x06U, 0x03U, 0x03U, 0xAAU, 0xFEU,
+};
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestAdvFilter, test_no_rules_accept_all) // NOLINT
+{
+    ASSERT_TRUE(this->check(g_mac1, -100, g_adv_df5, sizeof(g_adv_df5)));
+    ASSERT_TRUE(this->check(g_mac2, -10, g_adv_without_manufacturer_data, sizeof(g_adv_without_manufacturer_data)));
+    ASSERT_TRUE(this->check(g_mac2, -10, g_adv_df5, 0));
+}
+
+TEST_F(TestAdvFilter, test_data_format) // NOLINT
+{
+    ruuvi_gw_cfg_adv_filter_rule_t* const p_rule = this->add_rule();
+    p_rule->use_manufacturer_id                  = true;
+    p_rule->manufacturer_id                      = 0x0499U;
+    p_rule->use_data_format                      = true;
+    p_rule->data_format                          = 0x05U;
+
+    ASSERT_TRUE(this->check(g_mac1, -70, g_adv_df5, sizeof(g_adv_df5)));
+    ASSERT_FALSE(this->check(g_mac1, -70, g_adv_df6, sizeof(g_adv_df6)));
+    ASSERT_FALSE(this->check(g_mac1, -70, g_adv_other_company, sizeof(g_adv_other_company)));
+    ASSERT_FALSE(this->check(g_mac1, -70, g_adv_without_manufacturer_data, sizeof(g_adv_without_manufacturer_data)));
+}
+
+TEST_F(TestAdvFilter, test_any_of_rules) // NOLINT
+{
+    ruuvi_gw_cfg_adv_filter_rule_t* p_rule = this->add_rule();
+    p_rule->use_data_format                = true;
+    p_rule->data_format                    = 0x05U;
+    p_rule                                 = this->add_rule();
+    p_rule->use_data_format                = true;
+    p_rule->data_format                    = 0x06U;
+
+    ASSERT_TRUE(this->check(g_mac1, -70, g_adv_df5, sizeof(g_adv_df5)));
+    ASSERT_TRUE(this->check(g_mac1, -70, g_adv_df6, sizeof(g_adv_df6)));
+    // The data format is checked for any manufacturer if the manufacturer ID is not in use
+    ASSERT_TRUE(this->check(g_mac1, -70, g_adv_other_company, sizeof(g_adv_other_company)));
+    ASSERT_FALSE(this->check(g_mac1, -70, g_adv_without_manufacturer_data, sizeof(g_adv_without_manufacturer_data)));
+}
+
+TEST_F(TestAdvFilter, test_rssi_min_and_mac_oui) // NOLINT
+{
+    ruuvi_gw_cfg_adv_filter_rule_t* const p_rule = this->add_rule();
+    p_rule->use_rssi_min                         = true;
+    p_rule->rssi_min                             = -80;
+    p_rule->use_mac_oui                          = true;
+    p_rule->mac_oui[0]                           = 0xC9U;
+    p_rule->mac_oui[1]                           = 0x12U;
+    p_rule->mac_oui[2]                           = 0x34U;
+
+    ASSERT_TRUE(this->check(g_mac1, -80, g_adv_df5, sizeof(g_adv_df5)));
+    ASSERT_TRUE(this->check(g_mac1, 127, g_adv_df5, sizeof(g_adv_df5)));
+    ASSERT_FALSE(this->check(g_mac1, -81, g_adv_df5, sizeof(g_adv_df5)));
+    ASSERT_FALSE(this->check(g_mac1, -128, g_adv_df5, sizeof(g_adv_df5)));
+    ASSERT_FALSE(this->check(g_mac2, -70, g_adv_df5, sizeof(g_adv_df5)));
+    // The rule does not check the manufacturer data
+    ASSERT_TRUE(this->check(g_mac1, -70, g_adv_without_manufacturer_data, sizeof(g_adv_without_manufacturer_data)));
+}
+
+TEST_F(TestAdvFilter, test_payload_prefix_with_mask) // NOLINT
+{
+    ruuvi_gw_cfg_adv_filter_rule_t* const p_rule = this->add_rule();
+    p_rule->use_manufacturer_id                  = true;
+    p_rule->manufacturer_id                      = 0x0499U;
+    p_rule->payload_prefix_len                   = 3;
+    p_rule->payload_prefix[0]                    = 0x05U;
+    p_rule->payload_prefix[1]                    = 0x10U;
+    p_rule->payload_prefix[2]                    = 0xFFU;
+    p_rule->payload_mask[0]                      = 0xFFU;
+    p_rule->payload_mask[1]                      = 0xF0U;
+    p_rule->payload_mask[2]                      = 0x00U;
+
+    ASSERT_TRUE(this->check(g_mac1, -70, g_adv_df5, sizeof(g_adv_df5)));
+    ASSERT_FALSE(this->check(g_mac1, -70, g_adv_df6, sizeof(g_adv_df6)));
+
+    // The manufacturer data is shorter than the prefix
+    uint8_t adv_short[] = { 0x02U, 0x01U, 0x06U, 0x04U, 0xFFU, 0x99U, 0x04U, 0x05U };
+    ASSERT_FALSE(this->check(g_mac1, -70, adv_short, sizeof(adv_short)));
+}
+
+TEST_F(TestAdvFilter, test_malformed_adv) // NOLINT
+{
+    ruuvi_gw_cfg_adv_filter_rule_t* const p_rule = this->add_rule();
+    p_rule->use_data_format                      = true;
+    p_rule->data_format                          = 0x05U;
+
+    // The length of the AD structure exceeds the advertisement
+    ASSERT_FALSE(this->check(g_mac1, -70, g_adv_df5, sizeof(g_adv_df5) - 1));
+    ASSERT_FALSE(this->check(g_mac1, -70, g_adv_df5, 0));
+}
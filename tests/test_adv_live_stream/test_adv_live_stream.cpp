@@ -0,0 +1,263 @@
+/**
+ * @file test_adv_live_stream.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_live_stream.h"
+#include <vector>
+#include "gtest/gtest.h"
+#include "os_mutex.h"
+
+using namespace std;
+
+class TestAdvLiveStream;
+
+static TestAdvLiveStream* g_pTestClass;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestAdvLiveStream : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass               = this;
+        this->m_cnt_mutex_locked   = 0;
+        this->m_cnt_mutex_unlocked = 0;
+        this->m_reset_targets.clear();
+        this->m_read_targets.clear();
+        this->m_num_dirty_advs = 0;
+        this->m_last_ticket    = ADV_TABLE_TICKET_NONE;
+        this->m_committed_tickets.clear();
+        this->m_rolled_back_tickets.clear();
+        adv_live_stream_init();
+    }
+
+    void
+    TearDown() override
+    {
+        ASSERT_EQ(this->m_cnt_mutex_locked, this->m_cnt_mutex_unlocked);
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestAdvLiveStream();
+
+    ~TestAdvLiveStream() override;
+
+    uint32_t                   m_cnt_mutex_locked { 0 };
+    uint32_t                   m_cnt_mutex_unlocked { 0 };
+    vector<adv_table_target_e> m_reset_targets {};
+    vector<adv_table_target_e> m_read_targets {};
+    num_of_advs_t              m_num_dirty_advs { 0 };
+    adv_table_ticket_t         m_last_ticket { ADV_TABLE_TICKET_NONE };
+    vector<adv_table_ticket_t> m_committed_tickets {};
+    vector<adv_table_ticket_t> m_rolled_back_tickets {};
+};
+
+TestAdvLiveStream::TestAdvLiveStream()
+    : Test()
+{
+}
+
+TestAdvLiveStream::~TestAdvLiveStream() = default;
+
+extern "C" {
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_locked += 1;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_unlocked += 1;
+}
+
+void
+adv_table_target_reset(const adv_table_target_e target)
+{
+    g_pTestClass->m_reset_targets.push_back(target);
+}
+
+adv_table_ticket_t
+adv_table_read_dirty_begin(const adv_table_target_e target, adv_report_table_t* const p_reports)
+{
+    g_pTestClass->m_read_targets.push_back(target);
+    p_reports->num_of_advs         = g_pTestClass->m_num_dirty_advs;
+    g_pTestClass->m_num_dirty_advs = 0;
+    g_pTestClass->m_last_ticket += 1;
+    return g_pTestClass->m_last_ticket;
+}
+
+void
+adv_table_retransmission_commit(const adv_table_ticket_t ticket)
+{
+    if (ADV_TABLE_TICKET_NONE != ticket)
+    {
+        g_pTestClass->m_committed_tickets.push_back(ticket);
+    }
+}
+
+void
+adv_table_retransmission_rollback(const adv_table_ticket_t ticket)
+{
+    g_pTestClass->m_rolled_back_tickets.push_back(ticket);
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestAdvLiveStream, test_subscribe_read_unsubscribe) // NOLINT
+{
+    const adv_live_stream_client_id_t client1 = adv_live_stream_subscribe(1000);
+    ASSERT_NE(ADV_LIVE_STREAM_CLIENT_ID_INVALID, client1);
+    const adv_live_stream_client_id_t client2 = adv_live_stream_subscribe(1000);
+    ASSERT_NE(ADV_LIVE_STREAM_CLIENT_ID_INVALID, client2);
+    ASSERT_NE(client1, client2);
+    ASSERT_EQ(
+        vector<adv_table_target_e>({ ADV_TABLE_TARGET_LIVE_STREAM_FIRST,
+                                     (adv_table_target_e)(ADV_TABLE_TARGET_LIVE_STREAM_FIRST + 1) }),
+        this->m_reset_targets);
+
+    adv_report_table_t reports = {};
+    adv_table_ticket_t ticket  = ADV_TABLE_TICKET_NONE;
+    this->m_num_dirty_advs     = 3;
+    ASSERT_TRUE(adv_live_stream_read_begin(client2, 2000, &reports, &ticket));
+    ASSERT_EQ(3, reports.num_of_advs);
+    ASSERT_EQ(1, ticket);
+    adv_live_stream_read_commit(client2, ticket);
+    this->m_num_dirty_advs = 1;
+    ASSERT_TRUE(adv_live_stream_read_begin(client1, 2000, &reports, &ticket));
+    ASSERT_EQ(1, reports.num_of_advs);
+    ASSERT_EQ(2, ticket);
+    adv_live_stream_read_commit(client1, ticket);
+    ASSERT_EQ(
+        vector<adv_table_target_e>({ (adv_table_target_e)(ADV_TABLE_TARGET_LIVE_STREAM_FIRST + 1),
+                                     ADV_TABLE_TARGET_LIVE_STREAM_FIRST }),
+        this->m_read_targets);
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 1, 2 }), this->m_committed_tickets);
+    ASSERT_TRUE(this->m_rolled_back_tickets.empty());
+
+    adv_live_stream_unsubscribe(client1);
+    ASSERT_FALSE(adv_live_stream_read_begin(client1, 3000, &reports, &ticket));
+    ASSERT_EQ(0, reports.num_of_advs);
+    ASSERT_EQ(ADV_TABLE_TICKET_NONE, ticket);
+    ASSERT_FALSE(adv_live_stream_read_begin(ADV_LIVE_STREAM_CLIENT_ID_INVALID, 3000, &reports, &ticket));
+
+    adv_live_stream_stat_t stat = {};
+    adv_live_stream_get_stat(&stat);
+    ASSERT_EQ(1, stat.num_clients);
+    ASSERT_EQ(2, stat.cnt_subscribed);
+    ASSERT_EQ(0, stat.cnt_rejected);
+    ASSERT_EQ(0, stat.cnt_expired);
+    ASSERT_EQ(2, stat.cnt_polls);
+    ASSERT_EQ(4, stat.cnt_advs);
+    ASSERT_EQ(3, stat.max_advs_per_poll);
+}
+
+TEST_F(TestAdvLiveStream, test_no_free_slots) // NOLINT
+{
+    adv_live_stream_client_id_t clients[ADV_LIVE_STREAM_MAX_NUM_CLIENTS] = {};
+    for (uint32_t i = 0; i < ADV_LIVE_STREAM_MAX_NUM_CLIENTS; ++i)
+    {
+        clients[i] = adv_live_stream_subscribe(1000);
+        ASSERT_NE(ADV_LIVE_STREAM_CLIENT_ID_INVALID, clients[i]);
+    }
+    ASSERT_EQ(ADV_LIVE_STREAM_CLIENT_ID_INVALID, adv_live_stream_subscribe(1000));
+
+    // The slot of the unsubscribed client is reused, but the new client gets a new ID
+    adv_live_stream_unsubscribe(clients[1]);
+    const adv_live_stream_client_id_t client_new = adv_live_stream_subscribe(1000);
+    ASSERT_NE(ADV_LIVE_STREAM_CLIENT_ID_INVALID, client_new);
+    ASSERT_NE(clients[1], client_new);
+    ASSERT_EQ((adv_table_target_e)(ADV_TABLE_TARGET_LIVE_STREAM_FIRST + 1), this->m_reset_targets.back());
+
+    adv_live_stream_stat_t stat = {};
+    adv_live_stream_get_stat(&stat);
+    ASSERT_EQ(ADV_LIVE_STREAM_MAX_NUM_CLIENTS, stat.num_clients);
+    ASSERT_EQ(ADV_LIVE_STREAM_MAX_NUM_CLIENTS + 1, stat.cnt_subscribed);
+    ASSERT_EQ(1, stat.cnt_rejected);
+}
+
+TEST_F(TestAdvLiveStream, test_client_timeout) // NOLINT
+{
+    const adv_live_stream_time_ms_t   now0    = UINT32_MAX - 1000U;
+    const adv_live_stream_client_id_t client1 = adv_live_stream_subscribe(now0);
+    const adv_live_stream_client_id_t client2 = adv_live_stream_subscribe(now0);
+
+    // The client which keeps polling is not expired (also when the uptime wraps around)
+    adv_report_table_t reports = {};
+    adv_table_ticket_t ticket  = ADV_TABLE_TICKET_NONE;
+    ASSERT_TRUE(adv_live_stream_read_begin(client2, now0 + ADV_LIVE_STREAM_CLIENT_TIMEOUT_MS - 1, &reports, &ticket));
+    ASSERT_TRUE(adv_live_stream_read_begin(client2, now0 + ADV_LIVE_STREAM_CLIENT_TIMEOUT_MS, &reports, &ticket));
+    ASSERT_FALSE(adv_live_stream_read_begin(client1, now0 + ADV_LIVE_STREAM_CLIENT_TIMEOUT_MS, &reports, &ticket));
+
+    adv_live_stream_stat_t stat = {};
+    adv_live_stream_get_stat(&stat);
+    ASSERT_EQ(1, stat.num_clients);
+    ASSERT_EQ(1, stat.cnt_expired);
+}
+
+TEST_F(TestAdvLiveStream, test_read_rollback) // NOLINT
+{
+    const adv_live_stream_client_id_t client1 = adv_live_stream_subscribe(1000);
+
+    adv_report_table_t reports = {};
+    adv_table_ticket_t ticket  = ADV_TABLE_TICKET_NONE;
+    this->m_num_dirty_advs     = 5;
+    ASSERT_TRUE(adv_live_stream_read_begin(client1, 2000, &reports, &ticket));
+    ASSERT_EQ(5, reports.num_of_advs);
+    adv_live_stream_read_rollback(client1, ticket);
+    ASSERT_EQ(vector<adv_table_ticket_t>({ ticket }), this->m_rolled_back_tickets);
+
+    // The read is already finished, so the repeated commit or rollback is ignored
+    adv_live_stream_read_commit(client1, ticket);
+    adv_live_stream_read_rollback(client1, ticket);
+    ASSERT_TRUE(this->m_committed_tickets.empty());
+    ASSERT_EQ(vector<adv_table_ticket_t>({ ticket }), this->m_rolled_back_tickets);
+
+    adv_live_stream_stat_t stat = {};
+    adv_live_stream_get_stat(&stat);
+    ASSERT_EQ(1, stat.cnt_polls);
+    ASSERT_EQ(0, stat.cnt_advs);
+    ASSERT_EQ(0, stat.max_advs_per_poll);
+}
+
+TEST_F(TestAdvLiveStream, test_unsubscribe_with_read_in_flight) // NOLINT
+{
+    const adv_live_stream_client_id_t client1 = adv_live_stream_subscribe(1000);
+
+    adv_report_table_t reports = {};
+    adv_table_ticket_t ticket1 = ADV_TABLE_TICKET_NONE;
+    adv_table_ticket_t ticket2 = ADV_TABLE_TICKET_NONE;
+    ASSERT_TRUE(adv_live_stream_read_begin(client1, 2000, &reports, &ticket1));
+    // The next poll supersedes the read which was not finished
+    ASSERT_TRUE(adv_live_stream_read_begin(client1, 2000, &reports, &ticket2));
+    ASSERT_NE(ticket1, ticket2);
+    adv_live_stream_read_commit(client1, ticket1);
+    ASSERT_TRUE(this->m_committed_tickets.empty());
+
+    // The read in flight is dropped when the slot is released, so it's not returned to the next client of the slot
+    adv_live_stream_unsubscribe(client1);
+    ASSERT_EQ(vector<adv_table_ticket_t>({ ticket2 }), this->m_committed_tickets);
+    adv_live_stream_read_rollback(client1, ticket2);
+    ASSERT_TRUE(this->m_rolled_back_tickets.empty());
+}
@@ -0,0 +1,264 @@
+/**
+ * @file test_adv_log_ring.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_log_ring.h"
+#include <cstdlib>
+#include <string>
+#include "gtest/gtest.h"
+#include "esp_timer.h"
+#include "os_mutex.h"
+#include "os_task.h"
+#include "os_malloc.h"
+
+using namespace std;
+
+class TestAdvLogRing;
+
+static TestAdvLogRing* g_pTestClass;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestAdvLogRing : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass               = this;
+        this->m_time_us            = 0;
+        this->m_malloc_fail        = false;
+        this->m_cnt_os_malloc      = 0;
+        this->m_cnt_os_free        = 0;
+        this->m_cnt_mutex_locked   = 0;
+        this->m_cnt_mutex_unlocked = 0;
+        this->m_cnt_task_created   = 0;
+        this->m_cnt_cb_print       = 0;
+        ASSERT_TRUE(adv_log_ring_init());
+    }
+
+    void
+    TearDown() override
+    {
+        ASSERT_EQ(this->m_cnt_mutex_locked, this->m_cnt_mutex_unlocked);
+        ASSERT_EQ(this->m_cnt_os_malloc, this->m_cnt_os_free);
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestAdvLogRing();
+
+    ~TestAdvLogRing() override;
+
+    int64_t  m_time_us { 0 };
+    bool     m_malloc_fail { false };
+    uint32_t m_cnt_os_malloc { 0 };
+    uint32_t m_cnt_os_free { 0 };
+    uint32_t m_cnt_mutex_locked { 0 };
+    uint32_t m_cnt_mutex_unlocked { 0 };
+    uint32_t m_cnt_task_created { 0 };
+    uint32_t m_cnt_cb_print { 0 };
+};
+
+TestAdvLogRing::TestAdvLogRing()
+    : Test()
+{
+}
+
+TestAdvLogRing::~TestAdvLogRing() = default;
+
+extern "C" {
+
+void*
+os_malloc(const size_t size)
+{
+    if (g_pTestClass->m_malloc_fail)
+    {
+        return nullptr;
+    }
+    g_pTestClass->m_cnt_os_malloc += 1;
+    return malloc(size);
+}
+
+void*
+os_calloc(const size_t nmemb, const size_t size)
+{
+    if (g_pTestClass->m_malloc_fail)
+    {
+        return nullptr;
+    }
+    g_pTestClass->m_cnt_os_malloc += 1;
+    return calloc(nmemb, size);
+}
+
+void
+os_free_internal(void* p_mem)
+{
+    g_pTestClass->m_cnt_os_free += 1;
+    free(p_mem);
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_locked += 1;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_unlocked += 1;
+}
+
+bool
+os_task_create_without_param(
+    os_task_func_without_param_t p_func,
+    const char* const            p_name,
+    const uint32_t               stack_depth,
+    const os_task_priority_t     priority,
+    os_task_handle_t* const      ph_task)
+{
+    (void)p_func;
+    (void)p_name;
+    (void)stack_depth;
+    (void)priority;
+    g_pTestClass->m_cnt_task_created += 1;
+    *ph_task = reinterpret_cast<os_task_handle_t>(g_pTestClass);
+    return true;
+}
+
+void
+os_task_delay(const os_delta_ticks_t delay_ticks)
+{
+    (void)delay_ticks;
+}
+
+int64_t
+esp_timer_get_time(void)
+{
+    return g_pTestClass->m_time_us;
+}
+
+} // extern "C"
+
+static void
+test_cb_print_hdr(str_buf_t* const p_str_buf, const adv_log_ring_rec_t* const p_rec)
+{
+    g_pTestClass->m_cnt_cb_print += 1;
+    str_buf_printf(p_str_buf, "hdr: %s, num=%u", p_rec->p_str, (unsigned)p_rec->param);
+}
+
+static void
+test_cb_print_adv(str_buf_t* const p_str_buf, const adv_log_ring_rec_t* const p_rec)
+{
+    g_pTestClass->m_cnt_cb_print += 1;
+    str_buf_printf(
+        p_str_buf,
+        "%s: i=%u, rssi=%d, ts=%u",
+        p_rec->p_str,
+        (unsigned)p_rec->param,
+        p_rec->rssi,
+        (unsigned)p_rec->adv_timestamp);
+}
+
+static adv_report_t
+test_make_adv(const int8_t rssi)
+{
+    adv_report_t adv = {};
+    adv.timestamp    = 1612358929;
+    adv.tag_mac      = { 0xaa, 0xbb, 0xcc, 0x01, 0x02, 0x03 };
+    adv.rssi         = rssi;
+    adv.data_len     = 3;
+    adv.data_buf[0]  = 0x02;
+    adv.data_buf[1]  = 0x01;
+    adv.data_buf[2]  = 0xAB;
+    return adv;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestAdvLogRing, test_init_creates_task_once) // NOLINT
+{
+    // The task is created only by the first call of adv_log_ring_init
+    const uint32_t cnt_task_created = this->m_cnt_task_created;
+    ASSERT_TRUE(adv_log_ring_init());
+    ASSERT_EQ(cnt_task_created, this->m_cnt_task_created);
+}
+
+TEST_F(TestAdvLogRing, test_put_does_not_format) // NOLINT
+{
+    const adv_report_t adv = test_make_adv(-70);
+    adv_log_ring_put(&test_cb_print_hdr, "HTTP", 1, 0, nullptr);
+    adv_log_ring_put(&test_cb_print_adv, "timestamp", 0, 0, &adv);
+    ASSERT_EQ(0, this->m_cnt_cb_print);
+
+    ASSERT_EQ(2, adv_log_ring_flush());
+    ASSERT_EQ(2, this->m_cnt_cb_print);
+    ASSERT_EQ(0, adv_log_ring_flush());
+    ASSERT_EQ(2, this->m_cnt_cb_print);
+}
+
+TEST_F(TestAdvLogRing, test_generate_text) // NOLINT
+{
+    const adv_report_t adv = test_make_adv(-70);
+    this->m_time_us        = 1000000;
+    adv_log_ring_put(&test_cb_print_hdr, "HTTP", 1, 0, nullptr);
+    this->m_time_us = 1005000;
+    adv_log_ring_put(&test_cb_print_adv, "timestamp", 0, 0, &adv);
+
+    char* p_text = adv_log_ring_generate_text();
+    ASSERT_NE(nullptr, p_text);
+    ASSERT_EQ(
+        string("# records: total 2, kept 2, dropped from the log 0\n"
+               "0 [1000 ms] hdr: HTTP, num=1\n"
+               "1 [1005 ms] timestamp: i=0, rssi=-70, ts=1612358929, data: 0201AB\n"),
+        string(p_text));
+    os_free(p_text);
+}
+
+TEST_F(TestAdvLogRing, test_generate_text_malloc_failed) // NOLINT
+{
+    adv_log_ring_put(&test_cb_print_hdr, "HTTP", 0, 0, nullptr);
+    this->m_malloc_fail = true;
+    ASSERT_EQ(nullptr, adv_log_ring_generate_text());
+}
+
+TEST_F(TestAdvLogRing, test_overflow) // NOLINT
+{
+    for (uint32_t i = 0; i < ADV_LOG_RING_NUM_RECS + 5; ++i)
+    {
+        const adv_report_t adv = test_make_adv(-50);
+        adv_log_ring_put(&test_cb_print_adv, "counter", i, 0, &adv);
+    }
+    // The oldest records were overwritten before they were printed to the log
+    ASSERT_EQ(ADV_LOG_RING_NUM_RECS, adv_log_ring_flush());
+
+    char* p_text = adv_log_ring_generate_text();
+    ASSERT_NE(nullptr, p_text);
+    const string text(p_text);
+    os_free(p_text);
+
+    ASSERT_EQ(0, text.find(string("# records: total 133, kept 128, dropped from the log 5\n5 [0 ms] counter: i=5,")));
+    ASSERT_NE(string::npos, text.find(string("132 [0 ms] counter: i=132, rssi=-50, ts=1612358929, data: 0201AB\n")));
+    ASSERT_EQ(string::npos, text.find(string("\n4 [0 ms]")));
+
+    adv_log_ring_stat_t stat = {};
+    adv_log_ring_get_stat(&stat);
+    ASSERT_EQ(ADV_LOG_RING_NUM_RECS + 5, stat.cnt_put);
+    ASSERT_EQ(5, stat.cnt_overwritten);
+    ASSERT_EQ(5, stat.cnt_dropped);
+}
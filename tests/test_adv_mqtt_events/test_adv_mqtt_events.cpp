@@ -22,6 +22,7 @@ typedef struct
 {
     event_mgr_ev_e event;
     adv_mqtt_sig_e signal;
+    bool           flag_coalesce;
 } EventSignalPair;
 
 /*** Google-test class implementation
@@ -72,7 +73,19 @@ event_mgr_subscribe_sig_static(
 {
     assert(nullptr != p_ev_info_mem);
     assert(p_signal == g_pTestClass->m_p_signal);
-    g_pTestClass->m_subscribedEvents.emplace_back(EventSignalPair { event, (adv_mqtt_sig_e)sig_num });
+    g_pTestClass->m_subscribedEvents.emplace_back(EventSignalPair { event, (adv_mqtt_sig_e)sig_num, false });
+}
+
+void
+event_mgr_subscribe_sig_static_coalesced(
+    event_mgr_ev_info_static_t* const p_ev_info_mem,
+    const event_mgr_ev_e              event,
+    os_signal_t* const                p_signal,
+    const os_signal_num_e             sig_num)
+{
+    assert(nullptr != p_ev_info_mem);
+    assert(p_signal == g_pTestClass->m_p_signal);
+    g_pTestClass->m_subscribedEvents.emplace_back(EventSignalPair { event, (adv_mqtt_sig_e)sig_num, true });
 }
 
 void
@@ -117,6 +130,11 @@ TEST_F(TestAdvMqttEvents, test_1) // NOLINT
     EXPECT_EQ(this->m_subscribedEvents[4].event, EVENT_MGR_EV_RELAYING_MODE_CHANGED);
     EXPECT_EQ(this->m_subscribedEvents[5].event, EVENT_MGR_EV_CFG_MODE_ACTIVATED);
     EXPECT_EQ(this->m_subscribedEvents[6].event, EVENT_MGR_EV_CFG_MODE_DEACTIVATED);
+    EXPECT_TRUE(this->m_subscribedEvents[0].flag_coalesce);
+    for (size_t i = 1; i < this->m_subscribedEvents.size(); ++i)
+    {
+        EXPECT_FALSE(this->m_subscribedEvents[i].flag_coalesce);
+    }
 
     adv_mqtt_unsubscribe_events();
     ASSERT_EQ(this->m_subscribedEvents.size(), 0);
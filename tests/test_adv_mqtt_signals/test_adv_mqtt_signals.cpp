@@ -8,9 +8,12 @@
 #include "adv_mqtt_signals.h"
 #include "gtest/gtest.h"
 #include <string>
+#include <algorithm>
 #include "esp_err.h"
 #include "adv_table.h"
+#include "mqtt.h"
 #include "adv_mqtt_cfg_cache.h"
+#include "adv_mqtt_internal.h"
 #include "event_mgr.h"
 #include "gw_cfg_default.h"
 
@@ -59,6 +62,10 @@ typedef struct event_info_t
         {
             event_mgr_ev_e event;
         } event_mgr_notify;
+        struct
+        {
+            uint32_t num_advs;
+        } mqtt_publish_advs;
     };
 } event_info_t;
 
@@ -146,11 +153,13 @@ protected:
         this->m_gw_status_is_relaying_via_mqtt_enabled         = true;
         this->m_time_is_synchronized                           = true;
         this->m_metrics_received_advs                          = 0;
-        this->adv_table_read_retransmission_list3_head_res     = true;
-        this->adv_table_read_retransmission_list3_is_empty_res = true;
+        this->m_num_advs_in_list3                              = 0;
         this->m_adv_report                                     = {};
         this->mqtt_is_buffer_available_for_publish_res         = true;
         this->mqtt_publish_adv_res                             = true;
+        this->m_mqtt_publish_advs_max_num_processed            = ADV_MQTT_BURST_MAX_NUM_ADVS;
+        this->m_mqtt_publish_advs_ticks                        = 1;
+        this->m_tick_count                                     = 0;
         this->m_network_timeout_check_res                      = false;
         this->m_adv_mqtt_cfg_cache                             = {};
         this->m_gw_cfg                                         = {};
@@ -180,10 +189,12 @@ public:
 
     bool                      m_time_is_synchronized { true };
     uint64_t                  m_metrics_received_advs { 0 };
-    bool                      adv_table_read_retransmission_list3_head_res { true };
-    bool                      adv_table_read_retransmission_list3_is_empty_res { true };
+    uint32_t                  m_num_advs_in_list3 { 0 };
     adv_report_t              m_adv_report {};
     bool                      mqtt_publish_adv_res { true };
+    uint32_t                  m_mqtt_publish_advs_max_num_processed { ADV_MQTT_BURST_MAX_NUM_ADVS };
+    TickType_t                m_mqtt_publish_advs_ticks { 1 };
+    TickType_t                m_tick_count { 0 };
     bool                      mqtt_is_buffer_available_for_publish_res { true };
     bool                      m_network_timeout_check_res { false };
     adv_mqtt_cfg_cache_t      m_adv_mqtt_cfg_cache {};
@@ -390,17 +401,28 @@ metrics_received_advs_get(void)
     return g_pTestClass->m_metrics_received_advs;
 }
 
-bool
-adv_table_read_retransmission_list3_head(adv_report_t* const p_adv_report)
+uint32_t
+adv_table_read_retransmission_list3_head_batch(adv_report_t* const p_advs, const uint32_t max_num_advs)
 {
-    *p_adv_report = g_pTestClass->m_adv_report;
-    return g_pTestClass->adv_table_read_retransmission_list3_head_res;
+    const uint32_t num_advs = std::min(max_num_advs, g_pTestClass->m_num_advs_in_list3);
+    for (uint32_t i = 0; i < num_advs; ++i)
+    {
+        p_advs[i] = g_pTestClass->m_adv_report;
+    }
+    g_pTestClass->m_num_advs_in_list3 -= num_advs;
+    return num_advs;
 }
 
 bool
 adv_table_read_retransmission_list3_is_empty(void)
 {
-    return g_pTestClass->adv_table_read_retransmission_list3_is_empty_res;
+    return 0 == g_pTestClass->m_num_advs_in_list3;
+}
+
+TickType_t
+xTaskGetTickCount(void)
+{
+    return g_pTestClass->m_tick_count;
 }
 
 void
@@ -421,11 +443,28 @@ mqtt_publish_connect(void)
     g_pTestClass->m_events_history.push_back({ .event_type = EVENT_HISTORY_MQTT_PUBLISH_CONNECT });
 }
 
-bool
-mqtt_publish_adv(const adv_report_t* const p_adv, const bool flag_use_timestamps, const time_t timestamp)
+uint32_t
+mqtt_publish_advs(
+    mqtt_json_gen_t* const    p_json_gen,
+    const adv_report_t* const p_advs,
+    const uint32_t            num_advs,
+    const bool                flag_use_timestamps,
+    const time_t              timestamp,
+    const os_delta_ticks_t    time_budget_ticks,
+    uint32_t* const           p_num_published)
 {
-    g_pTestClass->m_events_history.push_back({ .event_type = EVENT_HISTORY_MQTT_PUBLISH_ADV });
-    return g_pTestClass->mqtt_publish_adv_res;
+    const uint32_t num_processed = std::min(num_advs, g_pTestClass->m_mqtt_publish_advs_max_num_processed);
+    g_pTestClass->m_events_history.push_back(
+        { .event_type = EVENT_HISTORY_MQTT_PUBLISH_ADV, .mqtt_publish_advs = { .num_advs = num_processed } });
+    g_pTestClass->m_tick_count += g_pTestClass->m_mqtt_publish_advs_ticks;
+    *p_num_published = g_pTestClass->mqtt_publish_adv_res ? num_processed : 0;
+    return num_processed;
+}
+
+void
+mqtt_json_gen_deinit(mqtt_json_gen_t* const p_json_gen)
+{
+    (void)p_json_gen;
 }
 
 void
@@ -468,6 +507,14 @@ event_mgr_notify(const event_mgr_ev_e event)
         { .event_type = EVENT_HISTORY_EVENT_MGR_NOTIFY, .event_mgr_notify = { .event = event } });
 }
 
+void
+event_mgr_clear_pending_sig(
+    const event_mgr_ev_e     event,
+    const os_signal_t* const p_signal,
+    const os_signal_num_e    sig_num)
+{
+}
+
 } // extern "C"
 
 /*** Unit-Tests
@@ -961,10 +1008,9 @@ TEST_F(TestAdvMqttSignals, test_adv_mqtt_handle_sig_on_recv_adv) // NOLINT
     this->m_adv_mqtt_cfg_cache.flag_use_ntp                  = true;
     this->m_adv_mqtt_cfg_cache.flag_mqtt_instant_mode_active = true;
 
-    this->adv_table_read_retransmission_list3_head_res     = true;
-    this->adv_table_read_retransmission_list3_is_empty_res = false;
-    this->m_time_is_synchronized                           = true;
-    this->m_metrics_received_advs                          = 123;
+    this->m_num_advs_in_list3     = 1;
+    this->m_time_is_synchronized  = true;
+    this->m_metrics_received_advs = 123;
 
     ASSERT_FALSE(adv_mqtt_handle_sig(ADV_MQTT_SIG_ON_RECV_ADV, &adv_mqtt_state));
     ASSERT_FALSE(adv_mqtt_state.flag_stop);
@@ -985,51 +1031,72 @@ TEST_F(TestAdvMqttSignals, test_adv_mqtt_handle_sig_on_recv_adv) // NOLINT
 
     this->m_gw_status_is_mqtt_connected = true;
 
+    // One adv in the retransmission list
     ASSERT_FALSE(adv_mqtt_handle_sig(ADV_MQTT_SIG_ON_RECV_ADV, &adv_mqtt_state));
     ASSERT_FALSE(adv_mqtt_state.flag_stop);
-    ASSERT_EQ(5, this->m_events_history.size());
+    ASSERT_EQ(4, this->m_events_history.size());
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_LOCK, this->m_events_history[0].event_type);
     ASSERT_EQ(EVENT_HISTORY_MQTT_PUBLISH_ADV, this->m_events_history[1].event_type);
+    ASSERT_EQ(1, this->m_events_history[1].mqtt_publish_advs.num_advs);
     ASSERT_EQ(EVENT_HISTORY_NETWORK_TIMEOUT_UPDATE_TIMESTAMP, this->m_events_history[2].event_type);
-    ASSERT_EQ(EVENT_HISTORY_OS_SIGNAL_SEND, this->m_events_history[3].event_type);
-    ASSERT_EQ(ADV_MQTT_SIG_ON_RECV_ADV, this->m_events_history[3].os_signal_send.sig_num);
-    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[4].event_type);
+    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[3].event_type);
+    ASSERT_EQ(0, this->m_num_advs_in_list3);
     this->m_events_history.clear();
 
-    this->adv_table_read_retransmission_list3_is_empty_res = true;
-
+    // Drain the retransmission list in bursts
+    this->m_num_advs_in_list3 = ADV_MQTT_BURST_MAX_NUM_ADVS + 3;
     ASSERT_FALSE(adv_mqtt_handle_sig(ADV_MQTT_SIG_ON_RECV_ADV, &adv_mqtt_state));
     ASSERT_FALSE(adv_mqtt_state.flag_stop);
-    ASSERT_EQ(4, this->m_events_history.size());
+    ASSERT_EQ(6, this->m_events_history.size());
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_LOCK, this->m_events_history[0].event_type);
     ASSERT_EQ(EVENT_HISTORY_MQTT_PUBLISH_ADV, this->m_events_history[1].event_type);
+    ASSERT_EQ(ADV_MQTT_BURST_MAX_NUM_ADVS, this->m_events_history[1].mqtt_publish_advs.num_advs);
     ASSERT_EQ(EVENT_HISTORY_NETWORK_TIMEOUT_UPDATE_TIMESTAMP, this->m_events_history[2].event_type);
-    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[3].event_type);
+    ASSERT_EQ(EVENT_HISTORY_MQTT_PUBLISH_ADV, this->m_events_history[3].event_type);
+    ASSERT_EQ(3, this->m_events_history[3].mqtt_publish_advs.num_advs);
+    ASSERT_EQ(EVENT_HISTORY_NETWORK_TIMEOUT_UPDATE_TIMESTAMP, this->m_events_history[4].event_type);
+    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[5].event_type);
+    ASSERT_EQ(0, this->m_num_advs_in_list3);
     this->m_events_history.clear();
 
-    this->m_time_is_synchronized = false;
-
+    // The time budget is exceeded - the rest of the burst is published after re-sending the signal
+    this->m_num_advs_in_list3                   = ADV_MQTT_BURST_MAX_NUM_ADVS + 1;
+    this->m_mqtt_publish_advs_max_num_processed = 2;
+    this->m_mqtt_publish_advs_ticks             = ADV_MQTT_BURST_TIME_BUDGET_TICKS;
     ASSERT_FALSE(adv_mqtt_handle_sig(ADV_MQTT_SIG_ON_RECV_ADV, &adv_mqtt_state));
     ASSERT_FALSE(adv_mqtt_state.flag_stop);
-    ASSERT_EQ(4, this->m_events_history.size());
+    ASSERT_EQ(5, this->m_events_history.size());
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_LOCK, this->m_events_history[0].event_type);
     ASSERT_EQ(EVENT_HISTORY_MQTT_PUBLISH_ADV, this->m_events_history[1].event_type);
+    ASSERT_EQ(2, this->m_events_history[1].mqtt_publish_advs.num_advs);
     ASSERT_EQ(EVENT_HISTORY_NETWORK_TIMEOUT_UPDATE_TIMESTAMP, this->m_events_history[2].event_type);
-    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[3].event_type);
+    ASSERT_EQ(EVENT_HISTORY_OS_SIGNAL_SEND, this->m_events_history[3].event_type);
+    ASSERT_EQ(
+        adv_mqtt_conv_to_sig_num(ADV_MQTT_SIG_ON_RECV_ADV),
+        this->m_events_history[3].os_signal_send.sig_num);
+    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[4].event_type);
+    ASSERT_EQ(1, this->m_num_advs_in_list3);
     this->m_events_history.clear();
 
-    this->m_adv_mqtt_cfg_cache.flag_use_ntp = false;
-
+    this->m_mqtt_publish_advs_max_num_processed = ADV_MQTT_BURST_MAX_NUM_ADVS;
+    this->m_mqtt_publish_advs_ticks             = 1;
     ASSERT_FALSE(adv_mqtt_handle_sig(ADV_MQTT_SIG_ON_RECV_ADV, &adv_mqtt_state));
     ASSERT_FALSE(adv_mqtt_state.flag_stop);
-    ASSERT_EQ(4, this->m_events_history.size());
+    ASSERT_EQ(6, this->m_events_history.size());
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_LOCK, this->m_events_history[0].event_type);
     ASSERT_EQ(EVENT_HISTORY_MQTT_PUBLISH_ADV, this->m_events_history[1].event_type);
+    ASSERT_EQ(ADV_MQTT_BURST_MAX_NUM_ADVS - 2, this->m_events_history[1].mqtt_publish_advs.num_advs);
     ASSERT_EQ(EVENT_HISTORY_NETWORK_TIMEOUT_UPDATE_TIMESTAMP, this->m_events_history[2].event_type);
-    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[3].event_type);
+    ASSERT_EQ(EVENT_HISTORY_MQTT_PUBLISH_ADV, this->m_events_history[3].event_type);
+    ASSERT_EQ(1, this->m_events_history[3].mqtt_publish_advs.num_advs);
+    ASSERT_EQ(EVENT_HISTORY_NETWORK_TIMEOUT_UPDATE_TIMESTAMP, this->m_events_history[4].event_type);
+    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[5].event_type);
+    ASSERT_EQ(0, this->m_num_advs_in_list3);
     this->m_events_history.clear();
 
-    this->m_time_is_synchronized = true;
+    this->m_time_is_synchronized            = false;
+    this->m_adv_mqtt_cfg_cache.flag_use_ntp = false;
+    this->m_num_advs_in_list3               = 1;
 
     ASSERT_FALSE(adv_mqtt_handle_sig(ADV_MQTT_SIG_ON_RECV_ADV, &adv_mqtt_state));
     ASSERT_FALSE(adv_mqtt_state.flag_stop);
@@ -1040,19 +1107,18 @@ TEST_F(TestAdvMqttSignals, test_adv_mqtt_handle_sig_on_recv_adv) // NOLINT
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[3].event_type);
     this->m_events_history.clear();
 
+    this->m_time_is_synchronized            = true;
     this->m_adv_mqtt_cfg_cache.flag_use_ntp = true;
 
-    this->adv_table_read_retransmission_list3_head_res = false;
-
+    // The retransmission list is empty
     ASSERT_FALSE(adv_mqtt_handle_sig(ADV_MQTT_SIG_ON_RECV_ADV, &adv_mqtt_state));
     ASSERT_FALSE(adv_mqtt_state.flag_stop);
     ASSERT_EQ(2, this->m_events_history.size());
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_LOCK, this->m_events_history[0].event_type);
-    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[3].event_type);
+    ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[1].event_type);
     this->m_events_history.clear();
 
-    this->adv_table_read_retransmission_list3_head_res = true;
-
+    this->m_num_advs_in_list3  = 1;
     this->mqtt_publish_adv_res = false;
 
     ASSERT_FALSE(adv_mqtt_handle_sig(ADV_MQTT_SIG_ON_RECV_ADV, &adv_mqtt_state));
@@ -1063,6 +1129,7 @@ TEST_F(TestAdvMqttSignals, test_adv_mqtt_handle_sig_on_recv_adv) // NOLINT
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[2].event_type);
     this->m_events_history.clear();
 
+    this->m_num_advs_in_list3                      = 1;
     this->mqtt_publish_adv_res                     = true;
     this->mqtt_is_buffer_available_for_publish_res = false;
 
@@ -1072,6 +1139,7 @@ TEST_F(TestAdvMqttSignals, test_adv_mqtt_handle_sig_on_recv_adv) // NOLINT
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_LOCK, this->m_events_history[0].event_type);
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_TIMER_SIG_RETRY_SENDING_ADVS, this->m_events_history[1].event_type);
     ASSERT_EQ(EVENT_HISTORY_ADV_MQTT_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[2].event_type);
+    ASSERT_EQ(1, this->m_num_advs_in_list3);
     this->m_events_history.clear();
 
     this->mqtt_is_buffer_available_for_publish_res = true;
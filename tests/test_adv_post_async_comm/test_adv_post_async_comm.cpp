@@ -9,7 +9,15 @@
 #include "gtest/gtest.h"
 #include "gw_cfg.h"
 #include "adv_table.h"
+#include "adv_report_pool.h"
 #include "adv_post_signals.h"
+#include "adv_post_sched.h"
+#include "http_async_gov.h"
+#include "http_mem_budget.h"
+#include "http.h"
+#include "mqtt.h"
+#include "adv_log_ring.h"
+#include "os_mutex.h"
 #include <string>
 
 using namespace std;
@@ -74,8 +82,8 @@ protected:
         this->m_cfg_http                                = {};
         this->m_gw_cfg_get_ntp_use_res                  = false;
         this->m_flag_time_is_synchronized               = false;
-        this->m_http_server_mutex_try_lock_res          = false;
-        this->m_http_server_mutex_locked                = false;
+        this->m_http_mem_budget_reserve_result          = false;
+        this->m_http_mem_budget_reserved_mask           = 0;
         this->m_gw_cfg_get_http_stat_use_http_stat_res  = false;
         this->m_gw_cfg_get_mqtt_use_mqtt_res            = false;
         this->m_hmac_sha256_set_key_for_http_ruuvi_res  = false;
@@ -87,7 +95,13 @@ protected:
         this->m_adv_post_statistics_do_send_res         = false;
         this->m_adv_post_statistics_do_send_call_cnt    = 0;
         this->m_gw_status_is_mqtt_connected_res         = false;
+        this->m_gw_cfg_get_http_use_http_res            = false;
+        this->m_gw_cfg_get_mqtt_sending_interval_res    = 0;
 
+        this->m_triggered_reports                     = {};
+        this->m_adv_post_read_triggered_advs_call_cnt = 0;
+
+        this->m_mqtt_is_buffer_available_for_publish_res = true;
         this->m_mqtt_publish_adv_res                     = false;
         this->m_mqtt_publish_adv_call_cnt                = 0;
         this->m_mqtt_publish_adv_arg_adv                 = {};
@@ -96,6 +110,12 @@ protected:
 
         this->m_http_async_poll_res                           = false;
         this->m_http_async_poll_malloc_fail_cnt               = 0;
+        this->m_http_async_poll_flag_success                  = true;
+        this->m_http_async_poll_use_res_for_custom_slot       = false;
+        this->m_http_async_poll_res_for_custom_slot           = false;
+        this->m_http_async_poll_slots.clear();
+        this->m_http_async_poll_actions.clear();
+        this->m_time_us                                       = 0;
         this->m_esp_get_free_heap_size_res                    = 0;
         this->m_default_period_for_http_ruuvi                 = 60 * 1000;
         this->m_default_period_for_http_custom                = 65 * 1000;
@@ -104,11 +124,17 @@ protected:
 
         this->m_reports = {};
 
+        this->m_adv_table_last_ticket = ADV_TABLE_TICKET_NONE;
+        this->m_adv_table_committed_tickets.clear();
+        this->m_adv_table_rolled_back_tickets.clear();
+
         this->m_leds_notify_http1_data_sent_fail = false;
         this->m_leds_notify_http2_data_sent_fail = false;
 
         this->m_send_sig_restart_services = 0;
 
+        http_async_gov_init();
+        http_async_gov_set_concurrent_mode(false);
         adv_post_async_comm_init();
     }
 
@@ -130,8 +156,8 @@ public:
     ruuvi_gw_cfg_http_t m_cfg_http {};
     bool                m_gw_cfg_get_ntp_use_res { true };
     bool                m_flag_time_is_synchronized { true };
-    bool                m_http_server_mutex_try_lock_res { true };
-    bool                m_http_server_mutex_locked { false };
+    bool                m_http_mem_budget_reserve_result { true };
+    uint32_t            m_http_mem_budget_reserved_mask { 0 };
     bool                m_gw_cfg_get_http_stat_use_http_stat_res { false };
     bool                m_gw_cfg_get_mqtt_use_mqtt_res { true };
     bool                m_hmac_sha256_set_key_for_http_ruuvi_res { false };
@@ -143,6 +169,9 @@ public:
     bool                m_adv_post_statistics_do_send_res { true };
     uint32_t            m_adv_post_statistics_do_send_call_cnt { 0 };
     bool                m_gw_status_is_mqtt_connected_res { true };
+    bool                m_gw_cfg_get_http_use_http_res { false };
+    uint32_t            m_gw_cfg_get_mqtt_sending_interval_res { 0 };
+    bool                m_mqtt_is_buffer_available_for_publish_res { true };
     bool                m_mqtt_publish_adv_res { true };
     uint32_t            m_mqtt_publish_adv_call_cnt { 0 };
     adv_report_t        m_mqtt_publish_adv_arg_adv {};
@@ -150,11 +179,24 @@ public:
     time_t              m_mqtt_publish_adv_arg_timestamp {};
     bool                m_http_async_poll_res { true };
     uint32_t            m_http_async_poll_malloc_fail_cnt { 0 };
+    bool                m_http_async_poll_flag_success { true };
+    bool                m_http_async_poll_use_res_for_custom_slot { false };
+    bool                m_http_async_poll_res_for_custom_slot { false };
+    int64_t             m_time_us { 0 };
     uint32_t            m_esp_get_free_heap_size_res { 0 };
     adv_post_sig_e      m_adv_post_signals_send_sig {};
     bool                m_adv_post_timers_start_timer_sig_do_async_comm {};
 
     adv_report_table_t m_reports;
+    adv_report_table_t m_triggered_reports;
+    uint32_t           m_adv_post_read_triggered_advs_call_cnt { 0 };
+
+    vector<http_async_slot_e> m_http_async_poll_slots {};
+    vector<adv_post_action_e> m_http_async_poll_actions {};
+
+    adv_table_ticket_t         m_adv_table_last_ticket { ADV_TABLE_TICKET_NONE };
+    vector<adv_table_ticket_t> m_adv_table_committed_tickets {};
+    vector<adv_table_ticket_t> m_adv_table_rolled_back_tickets {};
 
     bool                m_http_post_advs_res {};
     uint32_t            m_http_post_advs_call_cnt { 0 };
@@ -255,6 +297,27 @@ gw_cfg_get_mqtt_use_mqtt(void)
     return g_pTestClass->m_gw_cfg_get_mqtt_use_mqtt_res;
 }
 
+bool
+gw_cfg_get_http_use_http(void)
+{
+    return g_pTestClass->m_gw_cfg_get_http_use_http_res;
+}
+
+uint32_t
+gw_cfg_get_mqtt_sending_interval(void)
+{
+    return g_pTestClass->m_gw_cfg_get_mqtt_sending_interval_res;
+}
+
+uint32_t
+adv_post_read_triggered_advs(adv_report_table_t* const p_reports)
+{
+    g_pTestClass->m_adv_post_read_triggered_advs_call_cnt += 1;
+    *p_reports                        = g_pTestClass->m_triggered_reports;
+    g_pTestClass->m_triggered_reports = {};
+    return p_reports->num_of_advs;
+}
+
 bool
 http_post_advs(
     const adv_report_table_t* const  p_reports,
@@ -277,21 +340,53 @@ http_post_advs(
 }
 
 void
-adv_table_read_retransmission_list1_and_clear(adv_report_table_t* const p_reports)
+adv_table_read_retransmission_list3_and_clear(adv_report_table_t* const p_reports)
 {
     *p_reports = g_pTestClass->m_reports;
 }
 
-void
-adv_table_read_retransmission_list2_and_clear(adv_report_table_t* const p_reports)
+adv_table_ticket_t
+adv_table_read_retransmission_list1_begin(adv_report_table_t* const p_reports)
 {
     *p_reports = g_pTestClass->m_reports;
+    g_pTestClass->m_adv_table_last_ticket += 1;
+    return g_pTestClass->m_adv_table_last_ticket;
 }
 
-void
-adv_table_read_retransmission_list3_and_clear(adv_report_table_t* const p_reports)
+adv_table_ticket_t
+adv_table_read_retransmission_list2_begin(adv_report_table_t* const p_reports)
 {
     *p_reports = g_pTestClass->m_reports;
+    g_pTestClass->m_adv_table_last_ticket += 1;
+    return g_pTestClass->m_adv_table_last_ticket;
+}
+
+void
+adv_table_retransmission_commit(const adv_table_ticket_t ticket)
+{
+    g_pTestClass->m_adv_table_committed_tickets.push_back(ticket);
+}
+
+void
+adv_table_retransmission_rollback(const adv_table_ticket_t ticket)
+{
+    g_pTestClass->m_adv_table_rolled_back_tickets.push_back(ticket);
+}
+
+adv_report_table_t*
+adv_report_pool_checkout(void)
+{
+    // The pool itself is tested in test_adv_report_pool, here the buffers are taken from the heap to trace them
+    return static_cast<adv_report_table_t*>(os_calloc(1, sizeof(adv_report_table_t)));
+}
+
+void
+adv_report_pool_return(adv_report_table_t* p_reports)
+{
+    if (nullptr != p_reports)
+    {
+        os_free(p_reports);
+    }
 }
 
 void
@@ -313,21 +408,24 @@ time_is_synchronized(void)
 }
 
 bool
-http_server_mutex_try_lock(void)
+http_mem_budget_reserve(const http_mem_budget_client_e client, const uint32_t mem_size)
 {
-    if (g_pTestClass->m_http_server_mutex_try_lock_res)
+    assert(
+        ((HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH == client) ? HTTP_MEM_BUDGET_MQTT_PUBLISH : HTTP_MEM_BUDGET_HTTP_POST)
+        == mem_size);
+    if (g_pTestClass->m_http_mem_budget_reserve_result)
     {
-        assert(!g_pTestClass->m_http_server_mutex_locked);
-        g_pTestClass->m_http_server_mutex_locked = true;
+        assert(0 == (g_pTestClass->m_http_mem_budget_reserved_mask & (1U << client)));
+        g_pTestClass->m_http_mem_budget_reserved_mask |= 1U << client;
     }
-    return g_pTestClass->m_http_server_mutex_try_lock_res;
+    return g_pTestClass->m_http_mem_budget_reserve_result;
 }
 
 void
-http_server_mutex_unlock(void)
+http_mem_budget_release(const http_mem_budget_client_e client)
 {
-    assert(g_pTestClass->m_http_server_mutex_locked);
-    g_pTestClass->m_http_server_mutex_locked = false;
+    assert(0 != (g_pTestClass->m_http_mem_budget_reserved_mask & (1U << client)));
+    g_pTestClass->m_http_mem_budget_reserved_mask &= ~(1U << client);
 }
 
 bool
@@ -371,7 +469,17 @@ adv_post_signals_send_sig(const adv_post_sig_e adv_post_sig)
 }
 
 bool
-mqtt_publish_adv(const adv_report_t* const p_adv, const bool flag_use_timestamps, const time_t timestamp)
+mqtt_is_buffer_available_for_publish(void)
+{
+    return g_pTestClass->m_mqtt_is_buffer_available_for_publish_res;
+}
+
+bool
+mqtt_publish_adv(
+    mqtt_json_gen_t* const    p_json_gen,
+    const adv_report_t* const p_adv,
+    const bool                flag_use_timestamps,
+    const time_t              timestamp)
 {
     g_pTestClass->m_mqtt_publish_adv_arg_adv                 = *p_adv;
     g_pTestClass->m_mqtt_publish_adv_arg_flag_use_timestamps = flag_use_timestamps;
@@ -387,12 +495,43 @@ adv_post_timers_start_timer_sig_do_async_comm(void)
 }
 
 bool
-http_async_poll(uint32_t* const p_malloc_fail_cnt)
+http_async_poll(const http_async_slot_e slot, uint32_t* const p_malloc_fail_cnt, bool* const p_flag_success)
 {
+    g_pTestClass->m_http_async_poll_slots.push_back(slot);
+    g_pTestClass->m_http_async_poll_actions.push_back(adv_post_get_adv_post_action());
     *p_malloc_fail_cnt = g_pTestClass->m_http_async_poll_malloc_fail_cnt;
+    *p_flag_success    = g_pTestClass->m_http_async_poll_flag_success;
+    if ((HTTP_ASYNC_SLOT_CUSTOM == slot) && g_pTestClass->m_http_async_poll_use_res_for_custom_slot)
+    {
+        return g_pTestClass->m_http_async_poll_res_for_custom_slot;
+    }
     return g_pTestClass->m_http_async_poll_res;
 }
 
+int64_t
+esp_timer_get_time(void)
+{
+    return g_pTestClass->m_time_us;
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+}
+
 uint32_t
 esp_get_free_heap_size(void)
 {
@@ -417,6 +556,21 @@ main_task_send_sig_restart_services(void)
     g_pTestClass->m_send_sig_restart_services++;
 }
 
+void
+adv_log_ring_put(
+    const adv_log_ring_cb_print_t p_cb_print,
+    const char* const             p_str,
+    const uint32_t                param,
+    const time_t                  timestamp,
+    const adv_report_t* const     p_adv)
+{
+    (void)p_cb_print;
+    (void)p_str;
+    (void)param;
+    (void)timestamp;
+    (void)p_adv;
+}
+
 } // extern "C"
 
 /*** Unit-Tests
@@ -425,7 +579,7 @@ main_task_send_sig_restart_services(void)
 TEST_F(TestAdvPostAsyncComm, test_regular_sequence) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -474,7 +628,7 @@ TEST_F(TestAdvPostAsyncComm, test_regular_sequence) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -493,7 +647,7 @@ TEST_F(TestAdvPostAsyncComm, test_regular_sequence) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -501,12 +655,14 @@ TEST_F(TestAdvPostAsyncComm, test_regular_sequence) // NOLINT
     ASSERT_EQ(0, this->m_mqtt_publish_adv_call_cnt);
     this->m_http_async_poll_res = false;
     ASSERT_EQ(ADV_POST_ACTION_NONE, adv_post_get_adv_post_action());
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 1 }), this->m_adv_table_committed_tickets);
+    ASSERT_TRUE(this->m_adv_table_rolled_back_tickets.empty());
 
     adv_post_state.flag_need_to_send_advs1          = false;
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -520,19 +676,21 @@ TEST_F(TestAdvPostAsyncComm, test_regular_sequence) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
     ASSERT_EQ(0, this->m_adv_post_statistics_do_send_call_cnt);
     ASSERT_EQ(0, this->m_mqtt_publish_adv_call_cnt);
     this->m_http_async_poll_res = false;
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 1, 2 }), this->m_adv_table_committed_tickets);
+    ASSERT_TRUE(this->m_adv_table_rolled_back_tickets.empty());
 
     adv_post_state.flag_need_to_send_advs2      = false;
     adv_post_state.flag_need_to_send_statistics = true;
     this->m_hmac_sha256_set_key_for_stats_res   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -547,19 +705,20 @@ TEST_F(TestAdvPostAsyncComm, test_regular_sequence) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
     ASSERT_EQ(1, this->m_adv_post_statistics_do_send_call_cnt);
     ASSERT_EQ(0, this->m_mqtt_publish_adv_call_cnt);
     this->m_http_async_poll_res = false;
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 1, 2 }), this->m_adv_table_committed_tickets);
 
     adv_post_state.flag_need_to_send_statistics    = false;
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -573,7 +732,7 @@ TEST_F(TestAdvPostAsyncComm, test_regular_sequence) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -616,7 +775,7 @@ TEST_F(TestAdvPostAsyncComm, test_regular_sequence) // NOLINT
     this->m_mqtt_publish_adv_arg_timestamp = 0;
     this->m_http_async_poll_res            = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -669,7 +828,7 @@ TEST_F(TestAdvPostAsyncComm, test_adv_post_set_adv_post_http_action) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -718,7 +877,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -736,7 +895,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -748,7 +907,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -762,7 +921,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -774,7 +933,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
     this->m_hmac_sha256_set_key_for_stats_res   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -789,7 +948,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -801,7 +960,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -815,7 +974,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -858,7 +1017,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
     this->m_mqtt_publish_adv_arg_timestamp = 0;
     this->m_http_async_poll_res            = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -902,7 +1061,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_timestamps) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -951,7 +1110,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -969,7 +1128,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -981,7 +1140,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -995,7 +1154,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1007,7 +1166,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
     this->m_hmac_sha256_set_key_for_stats_res   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1022,7 +1181,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1034,7 +1193,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1048,7 +1207,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1091,7 +1250,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
     this->m_mqtt_publish_adv_arg_timestamp = 0;
     this->m_http_async_poll_res            = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1135,7 +1294,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_time_sync) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_time_not_synchronized) // NOLINT
 {
     this->m_flag_time_is_synchronized              = false;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -1184,7 +1343,7 @@ TEST_F(TestAdvPostAsyncComm, test_time_not_synchronized) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -1196,7 +1355,7 @@ TEST_F(TestAdvPostAsyncComm, test_time_not_synchronized) // NOLINT
     adv_post_state.flag_need_to_send_advs2 = true;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -1208,7 +1367,7 @@ TEST_F(TestAdvPostAsyncComm, test_time_not_synchronized) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -1220,7 +1379,7 @@ TEST_F(TestAdvPostAsyncComm, test_time_not_synchronized) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -1234,7 +1393,7 @@ TEST_F(TestAdvPostAsyncComm, test_time_not_synchronized) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_no_network_connection) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -1283,7 +1442,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_network_connection) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -1295,7 +1454,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_network_connection) // NOLINT
     adv_post_state.flag_need_to_send_advs2 = true;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -1307,7 +1466,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_network_connection) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -1319,7 +1478,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_network_connection) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -1333,7 +1492,7 @@ TEST_F(TestAdvPostAsyncComm, test_no_network_connection) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_malloc_failed_1) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -1384,11 +1543,11 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_1) // NOLINT
     this->m_malloc_fail_on_cnt = 1;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_TRUE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_EQ(0, this->m_adv_post_statistics_do_send_call_cnt);
     ASSERT_EQ(0, this->m_mqtt_publish_adv_call_cnt);
     ASSERT_TRUE(this->m_adv_post_timers_start_timer_sig_do_async_comm);
@@ -1400,7 +1559,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_1) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_malloc_failed_2) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -1451,7 +1610,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_2) // NOLINT
     this->m_malloc_fail_on_cnt = 2;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_TRUE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -1466,7 +1625,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_2) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_malloc_failed_3) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -1517,7 +1676,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_3) // NOLINT
     this->m_malloc_fail_on_cnt = 3;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1535,7 +1694,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_3) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1547,7 +1706,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_3) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_TRUE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1560,7 +1719,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_3) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_malloc_failed_4) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -1611,7 +1770,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_4) // NOLINT
     this->m_malloc_fail_on_cnt = 4;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1629,7 +1788,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_4) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1641,7 +1800,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_4) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_TRUE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1654,7 +1813,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_4) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_malloc_failed_5) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -1705,7 +1864,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_5) // NOLINT
     this->m_malloc_fail_on_cnt = 5;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1723,7 +1882,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_5) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1735,7 +1894,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_5) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1749,7 +1908,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_5) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1761,7 +1920,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_5) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
     this->m_hmac_sha256_set_key_for_stats_res   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1776,7 +1935,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_5) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1790,7 +1949,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_5) // NOLINT
     ASSERT_EQ(0, this->m_send_sig_restart_services);
     adv_post_do_async_comm(&adv_post_state);
     ASSERT_EQ(1, this->m_send_sig_restart_services);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1808,7 +1967,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_5) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -1859,7 +2018,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
     this->m_malloc_fail_on_cnt = 6;
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1877,7 +2036,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -1889,7 +2048,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1903,7 +2062,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1915,7 +2074,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
     this->m_hmac_sha256_set_key_for_stats_res   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1930,7 +2089,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1942,7 +2101,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1956,7 +2115,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -1999,7 +2158,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
     this->m_mqtt_publish_adv_arg_timestamp = 0;
     this->m_http_async_poll_res            = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
@@ -2043,7 +2202,7 @@ TEST_F(TestAdvPostAsyncComm, test_malloc_failed_6) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_mqtt_interrupted_periodical_sending) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -2093,7 +2252,7 @@ TEST_F(TestAdvPostAsyncComm, test_mqtt_interrupted_periodical_sending) // NOLINT
 
     this->m_mqtt_publish_adv_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2110,7 +2269,7 @@ TEST_F(TestAdvPostAsyncComm, test_mqtt_interrupted_periodical_sending) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2123,10 +2282,82 @@ TEST_F(TestAdvPostAsyncComm, test_mqtt_interrupted_periodical_sending) // NOLINT
     ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
 }
 
+TEST_F(TestAdvPostAsyncComm, test_mqtt_periodical_sending_paused_when_outbox_is_full) // NOLINT
+{
+    this->m_http_mem_budget_reserve_result  = true;
+    this->m_flag_time_is_synchronized       = true;
+    this->m_gw_cfg_get_mqtt_use_mqtt_res    = true;
+    this->m_gw_cfg_get_ntp_use_res          = true;
+    this->m_gw_status_is_mqtt_connected_res = true;
+
+    adv_post_state_t adv_post_state = {
+        .flag_primary_time_sync_is_done  = false,
+        .flag_network_connected          = true,
+        .flag_async_comm_in_progress     = false,
+        .flag_need_to_send_advs1         = false,
+        .flag_need_to_send_advs2         = false,
+        .flag_need_to_send_statistics    = false,
+        .flag_need_to_send_mqtt_periodic = true,
+        .flag_relaying_enabled           = true,
+        .flag_use_timestamps             = true,
+        .flag_stop                       = false,
+    };
+    this->m_reports = {
+        .num_of_advs = 2,
+        .table = {
+            [0] = {
+                .timestamp = 100500,
+                .samples_counter = 301,
+                .tag_mac = { 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,},
+                .rssi = -49,
+                .data_len = 3,
+                .data_buf = { 0x21, 0x22, 0x23, },
+            },
+            [1] = {
+                .timestamp = 100501,
+                .samples_counter = 302,
+                .tag_mac = { 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,},
+                .rssi = -48,
+                .data_len = 3,
+                .data_buf = { 0x51, 0x52, 0x53, },
+            },
+        }
+    };
+
+    this->m_mqtt_publish_adv_res = true;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_EQ(0, this->m_mqtt_publish_adv_call_cnt);
+    this->m_adv_post_timers_start_timer_sig_do_async_comm = false;
+
+    // The outbox is full - the advs are not dropped, sending is postponed
+    this->m_mqtt_is_buffer_available_for_publish_res = false;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_EQ(0, this->m_mqtt_publish_adv_call_cnt);
+    ASSERT_TRUE(this->m_adv_post_timers_start_timer_sig_do_async_comm);
+    this->m_adv_post_timers_start_timer_sig_do_async_comm = false;
+
+    this->m_mqtt_is_buffer_available_for_publish_res = true;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_EQ(1, this->m_mqtt_publish_adv_call_cnt);
+    ASSERT_EQ(0x11, this->m_mqtt_publish_adv_arg_adv.tag_mac.mac[0]);
+    ASSERT_TRUE(this->m_adv_post_timers_start_timer_sig_do_async_comm);
+    this->m_adv_post_timers_start_timer_sig_do_async_comm = false;
+
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_EQ(2, this->m_mqtt_publish_adv_call_cnt);
+    ASSERT_EQ(0x21, this->m_mqtt_publish_adv_arg_adv.tag_mac.mac[0]);
+
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
 TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -2175,7 +2406,7 @@ TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2186,7 +2417,7 @@ TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2198,7 +2429,7 @@ TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2207,7 +2438,7 @@ TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2219,7 +2450,7 @@ TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
     this->m_hmac_sha256_set_key_for_stats_res   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2228,7 +2459,7 @@ TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2240,7 +2471,7 @@ TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2254,7 +2485,7 @@ TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2270,7 +2501,7 @@ TEST_F(TestAdvPostAsyncComm, test_relaying_disabled) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = false;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -2319,7 +2550,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_TRUE(this->m_leds_notify_http1_data_sent_fail);
     this->m_leds_notify_http1_data_sent_fail = false;
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
@@ -2327,11 +2558,13 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
     ASSERT_EQ(0, this->m_adv_post_statistics_do_send_call_cnt);
     ASSERT_EQ(0, this->m_mqtt_publish_adv_call_cnt);
     ASSERT_TRUE(this->m_adv_post_timers_start_timer_sig_do_async_comm);
+    ASSERT_TRUE(this->m_adv_table_committed_tickets.empty());
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 1 }), this->m_adv_table_rolled_back_tickets);
     this->m_adv_post_timers_start_timer_sig_do_async_comm = false;
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_TRUE(this->m_leds_notify_http1_data_sent_fail);
     this->m_leds_notify_http1_data_sent_fail = false;
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
@@ -2344,7 +2577,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_TRUE(this->m_leds_notify_http2_data_sent_fail);
     this->m_leds_notify_http2_data_sent_fail = false;
@@ -2354,7 +2587,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_TRUE(this->m_leds_notify_http2_data_sent_fail);
     this->m_leds_notify_http2_data_sent_fail = false;
@@ -2367,7 +2600,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
     this->m_hmac_sha256_set_key_for_stats_res   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(4, this->m_http_post_advs_call_cnt);
@@ -2376,7 +2609,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(4, this->m_http_post_advs_call_cnt);
@@ -2388,7 +2621,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(4, this->m_http_post_advs_call_cnt);
@@ -2402,7 +2635,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(4, this->m_http_post_advs_call_cnt);
@@ -2445,7 +2678,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
     this->m_mqtt_publish_adv_arg_timestamp = 0;
     this->m_http_async_poll_res            = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(4, this->m_http_post_advs_call_cnt);
@@ -2486,10 +2719,10 @@ TEST_F(TestAdvPostAsyncComm, test_http_post_advs_failed) // NOLINT
     ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
 }
 
-TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
+TEST_F(TestAdvPostAsyncComm, test_http_mem_budget_reserve_false) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = false;
+    this->m_http_mem_budget_reserve_result         = false;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -2538,7 +2771,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2549,7 +2782,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2561,7 +2794,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2570,7 +2803,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2582,7 +2815,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
     this->m_hmac_sha256_set_key_for_stats_res   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2591,7 +2824,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2603,7 +2836,17 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_TRUE(adv_post_state.flag_need_to_send_mqtt_periodic);
+    ASSERT_EQ(0, this->m_adv_post_signals_send_sig);
+    ASSERT_EQ(0, this->m_mqtt_publish_adv_call_cnt);
+    this->m_adv_post_timers_start_timer_sig_do_async_comm = false;
+
+    // MQTT publishing is started when the memory budget is available
+    this->m_http_mem_budget_reserve_result = true;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2617,7 +2860,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH), this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2660,7 +2903,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
     this->m_mqtt_publish_adv_arg_timestamp = 0;
     this->m_http_async_poll_res            = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2701,10 +2944,113 @@ TEST_F(TestAdvPostAsyncComm, test_http_server_mutex_try_lock_false) // NOLINT
     ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
 }
 
+TEST_F(TestAdvPostAsyncComm, test_http_post_advs_rollback_on_http_error) // NOLINT
+{
+    this->m_flag_time_is_synchronized              = true;
+    this->m_http_mem_budget_reserve_result         = true;
+    this->m_http_post_advs_res                     = true;
+    this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
+    this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
+    this->m_gw_cfg_get_ntp_use_res                 = true;
+    this->m_adv_post_statistics_do_send_res        = true;
+    this->m_gw_status_is_mqtt_connected_res        = true;
+
+    adv_post_state_t adv_post_state = {
+        .flag_primary_time_sync_is_done  = false,
+        .flag_network_connected          = true,
+        .flag_async_comm_in_progress     = false,
+        .flag_need_to_send_advs1         = true,
+        .flag_need_to_send_advs2         = false,
+        .flag_need_to_send_statistics    = false,
+        .flag_need_to_send_mqtt_periodic = false,
+        .flag_relaying_enabled           = true,
+        .flag_use_timestamps             = true,
+        .flag_stop                       = false,
+    };
+
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
+    ASSERT_EQ(ADV_POST_ACTION_POST_ADVS_TO_RUUVI, adv_post_get_adv_post_action());
+    ASSERT_TRUE(this->m_adv_table_committed_tickets.empty());
+    ASSERT_TRUE(this->m_adv_table_rolled_back_tickets.empty());
+
+    // The request is completed, but the server responded with an error (or the connection was reset)
+    this->m_http_async_poll_res          = true;
+    this->m_http_async_poll_flag_success = false;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
+    ASSERT_EQ(ADV_POST_ACTION_NONE, adv_post_get_adv_post_action());
+    ASSERT_TRUE(this->m_adv_table_committed_tickets.empty());
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 1 }), this->m_adv_table_rolled_back_tickets);
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
+TEST_F(TestAdvPostAsyncComm, test_http_post_advs_rollback_on_abort_and_resend) // NOLINT
+{
+    this->m_flag_time_is_synchronized      = true;
+    this->m_http_mem_budget_reserve_result = true;
+    this->m_http_post_advs_res             = true;
+    this->m_esp_get_free_heap_size_res     = HTTP_ASYNC_GOV_MIN_FREE_HEAP_FOR_CONCURRENT;
+    http_async_gov_set_concurrent_mode(true);
+
+    adv_post_state_t adv_post_state = {
+        .flag_primary_time_sync_is_done         = false,
+        .flag_network_connected                 = true,
+        .flag_async_comm_in_progress            = false,
+        .flag_need_to_send_advs1                = true,
+        .flag_need_to_send_advs2                = true,
+        .flag_need_to_send_statistics           = false,
+        .flag_need_to_send_mqtt_periodic        = false,
+        .flag_relaying_enabled                  = true,
+        .flag_use_timestamps                    = true,
+        .flag_stop                              = false,
+        .flag_async_comm_in_progress_concurrent = false,
+    };
+
+    // Both targets are started in the same cycle
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(
+        (1U << HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN) | (1U << HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM),
+        this->m_http_mem_budget_reserved_mask);
+    ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress_concurrent);
+
+    // Both requests are aborted (e.g. relaying is disabled), the batches must be returned to the adv_table
+    adv_post_state.flag_async_comm_in_progress            = false;
+    adv_post_state.flag_async_comm_in_progress_concurrent = false;
+    adv_post_async_comm_on_abort();
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
+    ASSERT_TRUE(this->m_adv_table_committed_tickets.empty());
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 1, 2 }), this->m_adv_table_rolled_back_tickets);
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+
+    // The re-send picks up the rolled back advs and commits them on success
+    adv_post_state.flag_need_to_send_advs1 = true;
+    adv_post_state.flag_need_to_send_advs2 = true;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(4, this->m_http_post_advs_call_cnt);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress_concurrent);
+
+    this->m_http_async_poll_res                     = true;
+    this->m_http_async_poll_use_res_for_custom_slot = true;
+    this->m_http_async_poll_res_for_custom_slot     = true;
+    adv_post_do_async_comm(&adv_post_state);
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress_concurrent);
+    // The concurrent request to the custom server is polled first
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 4, 3 }), this->m_adv_table_committed_tickets);
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 1, 2 }), this->m_adv_table_rolled_back_tickets);
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
 TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = true;
@@ -2753,7 +3099,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -2771,7 +3117,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
 
     this->m_http_async_poll_res = false;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -2782,7 +3128,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
     adv_post_state.flag_need_to_send_advs2          = true;
     this->m_hmac_sha256_set_key_for_http_custom_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -2791,7 +3137,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
 
     this->m_http_async_poll_res = false;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -2802,7 +3148,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
     adv_post_state.flag_need_to_send_statistics = true;
     this->m_hmac_sha256_set_key_for_stats_res   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -2811,7 +3157,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
 
     this->m_http_async_poll_res = false;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -2822,7 +3168,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -2836,7 +3182,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
 
     this->m_http_async_poll_res = false;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -2848,7 +3194,7 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
     this->m_mqtt_publish_adv_arg_timestamp = 0;
     this->m_http_async_poll_res            = false;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_TRUE(this->m_http_server_mutex_locked);
+    ASSERT_NE(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
@@ -2857,13 +3203,18 @@ TEST_F(TestAdvPostAsyncComm, test_http_async_poll_failed) // NOLINT
 
     ASSERT_TRUE(this->m_adv_post_timers_start_timer_sig_do_async_comm);
 
+    // Complete the request to release the buffer with advs held by the JSON generator
+    adv_post_state.flag_relaying_enabled = false;
+    this->m_http_async_poll_res          = true;
+    adv_post_do_async_comm(&adv_post_state);
+
     ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
 }
 
 TEST_F(TestAdvPostAsyncComm, test_disable_sending_statistics) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = false;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = false;
@@ -2912,7 +3263,7 @@ TEST_F(TestAdvPostAsyncComm, test_disable_sending_statistics) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2921,7 +3272,7 @@ TEST_F(TestAdvPostAsyncComm, test_disable_sending_statistics) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2933,7 +3284,7 @@ TEST_F(TestAdvPostAsyncComm, test_disable_sending_statistics) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -2951,7 +3302,7 @@ TEST_F(TestAdvPostAsyncComm, test_disable_sending_statistics) // NOLINT
 TEST_F(TestAdvPostAsyncComm, test_adv_post_statistics_do_send_failed) // NOLINT
 {
     this->m_flag_time_is_synchronized              = true;
-    this->m_http_server_mutex_try_lock_res         = true;
+    this->m_http_mem_budget_reserve_result         = true;
     this->m_http_post_advs_res                     = true;
     this->m_gw_cfg_get_http_stat_use_http_stat_res = true;
     this->m_gw_cfg_get_mqtt_use_mqtt_res           = false;
@@ -3000,7 +3351,7 @@ TEST_F(TestAdvPostAsyncComm, test_adv_post_statistics_do_send_failed) // NOLINT
     };
 
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -3009,7 +3360,7 @@ TEST_F(TestAdvPostAsyncComm, test_adv_post_statistics_do_send_failed) // NOLINT
 
     this->m_http_async_poll_res = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -3021,7 +3372,7 @@ TEST_F(TestAdvPostAsyncComm, test_adv_post_statistics_do_send_failed) // NOLINT
     adv_post_state.flag_need_to_send_mqtt_periodic = true;
     this->m_mqtt_publish_adv_res                   = true;
     adv_post_do_async_comm(&adv_post_state);
-    ASSERT_FALSE(this->m_http_server_mutex_locked);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
     ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
     ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
     ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
@@ -3034,4 +3385,325 @@ TEST_F(TestAdvPostAsyncComm, test_adv_post_statistics_do_send_failed) // NOLINT
     ASSERT_EQ(0, this->m_mqtt_publish_adv_arg_timestamp);
 
     ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
-}
\ No newline at end of file
+}
+
+TEST_F(TestAdvPostAsyncComm, test_concurrent_upload_to_ruuvi_and_custom) // NOLINT
+{
+    this->m_flag_time_is_synchronized      = true;
+    this->m_http_mem_budget_reserve_result = true;
+    this->m_http_post_advs_res             = true;
+    this->m_esp_get_free_heap_size_res     = HTTP_ASYNC_GOV_MIN_FREE_HEAP_FOR_CONCURRENT;
+    http_async_gov_set_concurrent_mode(true);
+
+    adv_post_state_t adv_post_state = {
+        .flag_primary_time_sync_is_done         = false,
+        .flag_network_connected                 = true,
+        .flag_async_comm_in_progress            = false,
+        .flag_need_to_send_advs1                = true,
+        .flag_need_to_send_advs2                = true,
+        .flag_need_to_send_statistics           = false,
+        .flag_need_to_send_mqtt_periodic        = false,
+        .flag_relaying_enabled                  = true,
+        .flag_use_timestamps                    = true,
+        .flag_stop                              = false,
+        .flag_async_comm_in_progress_concurrent = false,
+    };
+    this->m_reports = {
+        .num_of_advs = 1,
+        .table = {
+            [0] = {
+                .timestamp = 100500,
+                .samples_counter = 301,
+                .tag_mac = { 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,},
+                .rssi = -49,
+                .data_len = 3,
+                .data_buf = { 0x21, 0x22, 0x23, },
+            },
+        }
+    };
+
+    // Both targets are started in the same cycle
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(
+        (1U << HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN) | (1U << HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM),
+        this->m_http_mem_budget_reserved_mask);
+    ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
+    ASSERT_FALSE(this->m_http_post_advs_arg_flag_post_to_ruuvi);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress_concurrent);
+    ASSERT_FALSE(adv_post_state.flag_need_to_send_advs1);
+    ASSERT_FALSE(adv_post_state.flag_need_to_send_advs2);
+    ASSERT_EQ(ADV_POST_ACTION_POST_ADVS_TO_RUUVI, adv_post_get_adv_post_action());
+    ASSERT_TRUE(this->m_adv_post_timers_start_timer_sig_do_async_comm);
+    this->m_adv_post_timers_start_timer_sig_do_async_comm = false;
+
+    // Both requests are still in progress, the HTTP response headers are routed to the corresponding targets
+    this->m_http_async_poll_res = false;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(
+        vector<http_async_slot_e>({ HTTP_ASYNC_SLOT_CUSTOM, HTTP_ASYNC_SLOT_MAIN }),
+        this->m_http_async_poll_slots);
+    ASSERT_EQ(
+        vector<adv_post_action_e>({ ADV_POST_ACTION_POST_ADVS_TO_CUSTOM, ADV_POST_ACTION_POST_ADVS_TO_RUUVI }),
+        this->m_http_async_poll_actions);
+    ASSERT_EQ(ADV_POST_ACTION_POST_ADVS_TO_RUUVI, adv_post_get_adv_post_action());
+    ASSERT_TRUE(this->m_adv_post_timers_start_timer_sig_do_async_comm);
+    this->m_adv_post_timers_start_timer_sig_do_async_comm = false;
+
+    // The request to Ruuvi is completed and its memory budget is released, the concurrent request is in progress
+    this->m_http_async_poll_res                     = true;
+    this->m_http_async_poll_use_res_for_custom_slot = true;
+    this->m_http_async_poll_res_for_custom_slot     = false;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM), this->m_http_mem_budget_reserved_mask);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress_concurrent);
+    ASSERT_EQ(ADV_POST_ACTION_NONE, adv_post_get_adv_post_action());
+    ASSERT_TRUE(this->m_adv_post_timers_start_timer_sig_do_async_comm);
+    this->m_adv_post_timers_start_timer_sig_do_async_comm = false;
+
+    // The concurrent request is completed
+    this->m_http_async_poll_res_for_custom_slot = true;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress_concurrent);
+    ASSERT_FALSE(this->m_adv_post_timers_start_timer_sig_do_async_comm);
+    ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
+    ASSERT_FALSE(this->m_leds_notify_http1_data_sent_fail);
+    ASSERT_FALSE(this->m_leds_notify_http2_data_sent_fail);
+
+    adv_post_sched_stat_t sched_stat = {};
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, &sched_stat);
+    ASSERT_EQ(1, sched_stat.cnt_started);
+    ASSERT_EQ(1, sched_stat.cnt_succeeded);
+
+    http_async_gov_stat_t gov_stat = {};
+    http_async_gov_get_stat(&gov_stat);
+    ASSERT_EQ(1, gov_stat.cnt_concurrent_admitted);
+    ASSERT_EQ(0, gov_stat.cnt_serial_fallback);
+
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
+TEST_F(TestAdvPostAsyncComm, test_concurrent_upload_fallback_to_serial_mode_on_low_memory) // NOLINT
+{
+    this->m_flag_time_is_synchronized      = true;
+    this->m_http_mem_budget_reserve_result = true;
+    this->m_http_post_advs_res             = true;
+    this->m_esp_get_free_heap_size_res     = HTTP_ASYNC_GOV_MIN_FREE_HEAP_FOR_CONCURRENT - 1;
+    http_async_gov_set_concurrent_mode(true);
+
+    adv_post_state_t adv_post_state = {
+        .flag_primary_time_sync_is_done         = false,
+        .flag_network_connected                 = true,
+        .flag_async_comm_in_progress            = false,
+        .flag_need_to_send_advs1                = true,
+        .flag_need_to_send_advs2                = true,
+        .flag_need_to_send_statistics           = false,
+        .flag_need_to_send_mqtt_periodic        = false,
+        .flag_relaying_enabled                  = true,
+        .flag_use_timestamps                    = true,
+        .flag_stop                              = false,
+        .flag_async_comm_in_progress_concurrent = false,
+    };
+
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN), this->m_http_mem_budget_reserved_mask);
+    ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
+    ASSERT_TRUE(this->m_http_post_advs_arg_flag_post_to_ruuvi);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress_concurrent);
+    ASSERT_TRUE(adv_post_state.flag_need_to_send_advs2);
+
+    // The custom target is sent after the completion of the request to Ruuvi
+    this->m_http_async_poll_res = true;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM), this->m_http_mem_budget_reserved_mask);
+    ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
+    ASSERT_FALSE(this->m_http_post_advs_arg_flag_post_to_ruuvi);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress_concurrent);
+    ASSERT_EQ(ADV_POST_ACTION_POST_ADVS_TO_CUSTOM, adv_post_get_adv_post_action());
+
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_EQ(
+        vector<http_async_slot_e>({ HTTP_ASYNC_SLOT_MAIN, HTTP_ASYNC_SLOT_CUSTOM }),
+        this->m_http_async_poll_slots);
+
+    http_async_gov_stat_t gov_stat = {};
+    http_async_gov_get_stat(&gov_stat);
+    ASSERT_EQ(0, gov_stat.cnt_concurrent_admitted);
+    ASSERT_EQ(1, gov_stat.cnt_serial_fallback);
+
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
+TEST_F(TestAdvPostAsyncComm, test_urgent_advs_to_custom_http_and_periodic_mqtt) // NOLINT
+{
+    this->m_flag_time_is_synchronized            = true;
+    this->m_http_mem_budget_reserve_result       = true;
+    this->m_http_post_advs_res                   = true;
+    this->m_gw_cfg_get_http_use_http_res         = true;
+    this->m_gw_cfg_get_mqtt_use_mqtt_res         = true;
+    this->m_gw_cfg_get_mqtt_sending_interval_res = 60;
+    this->m_gw_status_is_mqtt_connected_res      = true;
+    this->m_mqtt_publish_adv_res                 = true;
+
+    adv_post_state_t adv_post_state = {
+        .flag_primary_time_sync_is_done         = false,
+        .flag_network_connected                 = true,
+        .flag_async_comm_in_progress            = false,
+        .flag_need_to_send_advs1                = true,
+        .flag_need_to_send_advs2                = false,
+        .flag_need_to_send_statistics           = false,
+        .flag_need_to_send_mqtt_periodic        = false,
+        .flag_relaying_enabled                  = true,
+        .flag_use_timestamps                    = true,
+        .flag_stop                              = false,
+        .flag_async_comm_in_progress_concurrent = false,
+        .flag_need_to_send_urgent               = true,
+    };
+    this->m_triggered_reports = {
+        .num_of_advs = 1,
+        .table = {
+            [0] = {
+                .timestamp = 100500,
+                .samples_counter = 301,
+                .tag_mac = { 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,},
+                .rssi = -49,
+                .data_len = 3,
+                .data_buf = { 0x21, 0x22, 0x23, },
+            },
+        }
+    };
+
+    // The urgent advs are served before the periodic batch to Ruuvi
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(1, this->m_adv_post_read_triggered_advs_call_cnt);
+    ASSERT_EQ(1, this->m_mqtt_publish_adv_call_cnt);
+    ASSERT_EQ(0x16, this->m_mqtt_publish_adv_arg_adv.tag_mac.mac[5]);
+    ASSERT_EQ(1, this->m_http_post_advs_call_cnt);
+    ASSERT_FALSE(this->m_http_post_advs_arg_flag_post_to_ruuvi);
+    ASSERT_EQ(1, this->m_http_post_advs_arg_reports.num_of_advs);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM), this->m_http_mem_budget_reserved_mask);
+    ASSERT_EQ(ADV_POST_ACTION_POST_URGENT_ADVS, adv_post_get_adv_post_action());
+    ASSERT_FALSE(adv_post_state.flag_need_to_send_urgent);
+    ASSERT_TRUE(adv_post_state.flag_need_to_send_advs1);
+    ASSERT_TRUE(adv_post_state.flag_async_comm_in_progress);
+
+    // The response headers of the urgent request are applied to the custom target
+    adv_post_set_default_period(15 * 1000);
+    ASSERT_EQ(15 * 1000, this->m_default_period_for_http_custom);
+
+    // The urgent request is completed, then the periodic batch to Ruuvi is started
+    this->m_http_async_poll_res = true;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(vector<http_async_slot_e>({ HTTP_ASYNC_SLOT_CUSTOM }), this->m_http_async_poll_slots);
+    ASSERT_EQ(2, this->m_http_post_advs_call_cnt);
+    ASSERT_TRUE(this->m_http_post_advs_arg_flag_post_to_ruuvi);
+    ASSERT_EQ((1U << HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN), this->m_http_mem_budget_reserved_mask);
+    ASSERT_EQ(ADV_POST_ACTION_POST_ADVS_TO_RUUVI, adv_post_get_adv_post_action());
+    // The completion of the urgent request does not touch the retransmission lists
+    ASSERT_TRUE(this->m_adv_table_committed_tickets.empty());
+    ASSERT_TRUE(this->m_adv_table_rolled_back_tickets.empty());
+
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_EQ(vector<adv_table_ticket_t>({ 1 }), this->m_adv_table_committed_tickets);
+    ASSERT_TRUE(this->m_adv_table_rolled_back_tickets.empty());
+
+    adv_post_sched_stat_t sched_stat = {};
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_URGENT, &sched_stat);
+    ASSERT_EQ(1, sched_stat.cnt_started);
+    ASSERT_EQ(1, sched_stat.cnt_succeeded);
+
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
+TEST_F(TestAdvPostAsyncComm, test_urgent_advs_to_periodic_mqtt_only) // NOLINT
+{
+    this->m_http_mem_budget_reserve_result       = true;
+    this->m_flag_time_is_synchronized            = true;
+    this->m_gw_cfg_get_mqtt_use_mqtt_res         = true;
+    this->m_gw_cfg_get_mqtt_sending_interval_res = 60;
+    this->m_gw_status_is_mqtt_connected_res      = true;
+    this->m_mqtt_publish_adv_res                 = true;
+
+    adv_post_state_t adv_post_state = {
+        .flag_primary_time_sync_is_done         = false,
+        .flag_network_connected                 = true,
+        .flag_async_comm_in_progress            = false,
+        .flag_need_to_send_advs1                = false,
+        .flag_need_to_send_advs2                = false,
+        .flag_need_to_send_statistics           = false,
+        .flag_need_to_send_mqtt_periodic        = false,
+        .flag_relaying_enabled                  = true,
+        .flag_use_timestamps                    = true,
+        .flag_stop                              = false,
+        .flag_async_comm_in_progress_concurrent = false,
+        .flag_need_to_send_urgent               = true,
+    };
+    this->m_triggered_reports.num_of_advs = 2;
+
+    // The advs are published synchronously, no HTTP request is started
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(2, this->m_mqtt_publish_adv_call_cnt);
+    ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
+    ASSERT_FALSE(adv_post_state.flag_need_to_send_urgent);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress);
+    ASSERT_EQ(ADV_POST_ACTION_NONE, adv_post_get_adv_post_action());
+
+    // The queue was already taken by the previous cycle
+    adv_post_state.flag_need_to_send_urgent = true;
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(2, this->m_mqtt_publish_adv_call_cnt);
+    ASSERT_FALSE(adv_post_state.flag_need_to_send_urgent);
+
+    adv_post_sched_stat_t sched_stat = {};
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_URGENT, &sched_stat);
+    ASSERT_EQ(1, sched_stat.cnt_started);
+    ASSERT_EQ(1, sched_stat.cnt_succeeded);
+
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
+TEST_F(TestAdvPostAsyncComm, test_urgent_advs_to_periodic_mqtt_without_mem_budget) // NOLINT
+{
+    this->m_http_mem_budget_reserve_result       = false;
+    this->m_flag_time_is_synchronized            = true;
+    this->m_gw_cfg_get_mqtt_use_mqtt_res         = true;
+    this->m_gw_cfg_get_mqtt_sending_interval_res = 60;
+    this->m_gw_status_is_mqtt_connected_res      = true;
+    this->m_mqtt_publish_adv_res                 = true;
+
+    adv_post_state_t adv_post_state = {
+        .flag_primary_time_sync_is_done         = false,
+        .flag_network_connected                 = true,
+        .flag_async_comm_in_progress            = false,
+        .flag_need_to_send_advs1                = false,
+        .flag_need_to_send_advs2                = false,
+        .flag_need_to_send_statistics           = false,
+        .flag_need_to_send_mqtt_periodic        = false,
+        .flag_relaying_enabled                  = true,
+        .flag_use_timestamps                    = true,
+        .flag_stop                              = false,
+        .flag_async_comm_in_progress_concurrent = false,
+        .flag_need_to_send_urgent               = true,
+    };
+    this->m_triggered_reports.num_of_advs = 2;
+
+    // The urgent advs are not published, they will be sent with the periodic batch
+    adv_post_do_async_comm(&adv_post_state);
+    ASSERT_EQ(0, this->m_mqtt_publish_adv_call_cnt);
+    ASSERT_EQ(0, this->m_http_post_advs_call_cnt);
+    ASSERT_EQ(0, this->m_http_mem_budget_reserved_mask);
+    ASSERT_FALSE(adv_post_state.flag_need_to_send_urgent);
+    ASSERT_FALSE(adv_post_state.flag_async_comm_in_progress);
+
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
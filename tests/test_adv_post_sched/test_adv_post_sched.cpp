@@ -0,0 +1,271 @@
+/**
+ * @file test_adv_post_sched.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_post_sched.h"
+#include "gtest/gtest.h"
+#include <string>
+#include "os_mutex.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestAdvPostSched : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        adv_post_sched_init(0);
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    TestAdvPostSched();
+
+    ~TestAdvPostSched() override;
+};
+
+TestAdvPostSched::TestAdvPostSched()
+    : Test()
+{
+}
+
+TestAdvPostSched::~TestAdvPostSched() = default;
+
+extern "C" {
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+}
+
+} // extern "C"
+
+static void
+send_successfully(const adv_post_sched_target_e target, const adv_post_sched_time_ms_t now_ms)
+{
+    adv_post_sched_on_started(target, now_ms);
+    adv_post_sched_set_pending(target, false, now_ms);
+    adv_post_sched_on_finished(target, true, now_ms);
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestAdvPostSched, test_nothing_pending) // NOLINT
+{
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_NONE, adv_post_sched_select(1000));
+    for (uint32_t i = 0; i < ADV_POST_SCHED_TARGET_LAST; ++i)
+    {
+        ASSERT_FALSE(adv_post_sched_is_pending((adv_post_sched_target_e)i));
+    }
+}
+
+TEST_F(TestAdvPostSched, test_priority_order_when_pending_simultaneously) // NOLINT
+{
+    for (uint32_t i = 0; i < ADV_POST_SCHED_TARGET_LAST; ++i)
+    {
+        adv_post_sched_set_pending((adv_post_sched_target_e)i, true, 1000);
+    }
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_URGENT, adv_post_sched_select(1000));
+    send_successfully(ADV_POST_SCHED_TARGET_URGENT, 1000);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_RUUVI, adv_post_sched_select(1000));
+    send_successfully(ADV_POST_SCHED_TARGET_HTTP_RUUVI, 1000);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, adv_post_sched_select(1000));
+    send_successfully(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, 1000);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_STAT, adv_post_sched_select(1000));
+    send_successfully(ADV_POST_SCHED_TARGET_HTTP_STAT, 1000);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_MQTT, adv_post_sched_select(1000));
+    send_successfully(ADV_POST_SCHED_TARGET_MQTT, 1000);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_NONE, adv_post_sched_select(1000));
+}
+
+TEST_F(TestAdvPostSched, test_waiting_target_is_not_starved) // NOLINT
+{
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_STAT, true, 1000);
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_RUUVI, true, 9000);
+    // Statistics waits for 8 seconds with weight 2, Ruuvi target waits for 0 seconds with weight 4
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_STAT, adv_post_sched_select(9000));
+    send_successfully(ADV_POST_SCHED_TARGET_HTTP_STAT, 9000);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_RUUVI, adv_post_sched_select(9000));
+
+    adv_post_sched_stat_t stat = {};
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_HTTP_STAT, &stat);
+    ASSERT_EQ(1, stat.cnt_started);
+    ASSERT_EQ(1, stat.cnt_succeeded);
+    ASSERT_EQ(8000, stat.queueing_delay_ms_sum);
+    ASSERT_EQ(8000, stat.queueing_delay_ms_max);
+    ASSERT_EQ(0, stat.cnt_deadline_missed);
+}
+
+TEST_F(TestAdvPostSched, test_deadline_missed) // NOLINT
+{
+    const adv_post_sched_target_cfg_t* const p_cfg = adv_post_sched_get_target_cfg(ADV_POST_SCHED_TARGET_HTTP_CUSTOM);
+    ASSERT_NE(nullptr, p_cfg);
+
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, true, 1000);
+    // Repeated calls while the target is still pending do not restart the measurement of the queueing delay
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, true, 2000);
+    const adv_post_sched_time_ms_t now_ms = 1000 + p_cfg->deadline_ms + 1;
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, adv_post_sched_select(now_ms));
+    send_successfully(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, now_ms);
+
+    adv_post_sched_stat_t stat = {};
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, &stat);
+    ASSERT_EQ(1, stat.cnt_deadline_missed);
+    ASSERT_EQ(p_cfg->deadline_ms + 1, stat.queueing_delay_ms_max);
+}
+
+TEST_F(TestAdvPostSched, test_token_bucket) // NOLINT
+{
+    const adv_post_sched_target_cfg_t* const p_cfg = adv_post_sched_get_target_cfg(ADV_POST_SCHED_TARGET_HTTP_RUUVI);
+    ASSERT_NE(nullptr, p_cfg);
+
+    for (uint32_t i = 0; i < p_cfg->bucket_capacity; ++i)
+    {
+        adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_RUUVI, true, 0);
+        ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_RUUVI, adv_post_sched_select(0));
+        send_successfully(ADV_POST_SCHED_TARGET_HTTP_RUUVI, 0);
+    }
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_RUUVI, true, 0);
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_MQTT, true, 0);
+    // The bucket of the Ruuvi target is empty, so the other targets are served
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_MQTT, adv_post_sched_select(0));
+    send_successfully(ADV_POST_SCHED_TARGET_MQTT, 0);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_NONE, adv_post_sched_select(p_cfg->bucket_refill_ms - 1));
+
+    // The target is polled on every scheduling pass, but it is counted only once while it stays rate-limited
+    adv_post_sched_stat_t stat = {};
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_HTTP_RUUVI, &stat);
+    ASSERT_EQ(1, stat.cnt_rate_limited);
+
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_RUUVI, adv_post_sched_select(p_cfg->bucket_refill_ms));
+    send_successfully(ADV_POST_SCHED_TARGET_HTTP_RUUVI, p_cfg->bucket_refill_ms);
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_RUUVI, true, p_cfg->bucket_refill_ms);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_NONE, adv_post_sched_select(p_cfg->bucket_refill_ms));
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_NONE, adv_post_sched_select(p_cfg->bucket_refill_ms + 1));
+
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_HTTP_RUUVI, &stat);
+    ASSERT_EQ(2, stat.cnt_rate_limited);
+}
+
+TEST_F(TestAdvPostSched, test_backoff) // NOLINT
+{
+    const adv_post_sched_target_cfg_t* const p_cfg = adv_post_sched_get_target_cfg(ADV_POST_SCHED_TARGET_HTTP_CUSTOM);
+    ASSERT_NE(nullptr, p_cfg);
+
+    adv_post_sched_time_ms_t now_ms = 0;
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, true, now_ms);
+    for (uint32_t i = 0; i < ADV_POST_SCHED_BACKOFF_FAILURES_THRESHOLD; ++i)
+    {
+        now_ms += p_cfg->bucket_refill_ms;
+        ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, adv_post_sched_select(now_ms));
+        adv_post_sched_on_started(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, now_ms);
+        adv_post_sched_on_finished(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, false, now_ms);
+    }
+
+    adv_post_sched_stat_t stat = {};
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, &stat);
+    ASSERT_EQ(ADV_POST_SCHED_BACKOFF_FAILURES_THRESHOLD, stat.cnt_failed);
+    ASSERT_EQ(ADV_POST_SCHED_BACKOFF_FAILURES_THRESHOLD, stat.consecutive_failures);
+
+    // The failing target is skipped while it's in backoff, so it doesn't delay the other targets
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_STAT, true, now_ms);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_STAT, adv_post_sched_select(now_ms));
+    send_successfully(ADV_POST_SCHED_TARGET_HTTP_STAT, now_ms);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_NONE, adv_post_sched_select(now_ms + ADV_POST_SCHED_BACKOFF_MIN_MS - 1));
+    ASSERT_FALSE(adv_post_sched_check_aged_out(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, now_ms));
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, adv_post_sched_select(now_ms + ADV_POST_SCHED_BACKOFF_MIN_MS));
+
+    // The next failure doubles the backoff
+    now_ms += ADV_POST_SCHED_BACKOFF_MIN_MS;
+    adv_post_sched_on_started(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, now_ms);
+    adv_post_sched_on_finished(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, false, now_ms);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_NONE, adv_post_sched_select(now_ms + (2 * ADV_POST_SCHED_BACKOFF_MIN_MS) - 1));
+
+    // Each period of the backoff is counted once regardless of the number of the scheduling passes
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, &stat);
+    ASSERT_EQ(2, stat.cnt_skipped_backoff);
+
+    // Success resets the backoff
+    now_ms += 2 * ADV_POST_SCHED_BACKOFF_MIN_MS;
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, adv_post_sched_select(now_ms));
+    send_successfully(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, now_ms);
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, &stat);
+    ASSERT_EQ(0, stat.consecutive_failures);
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, true, now_ms);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_HTTP_CUSTOM, adv_post_sched_select(now_ms));
+}
+
+TEST_F(TestAdvPostSched, test_aged_out) // NOLINT
+{
+    const adv_post_sched_target_cfg_t* const p_cfg = adv_post_sched_get_target_cfg(ADV_POST_SCHED_TARGET_HTTP_RUUVI);
+    ASSERT_NE(nullptr, p_cfg);
+
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_HTTP_RUUVI, true, 0);
+    const adv_post_sched_time_ms_t now_ms = p_cfg->max_age_ms - 1;
+    for (uint32_t i = 0; i < ADV_POST_SCHED_BACKOFF_FAILURES_THRESHOLD; ++i)
+    {
+        adv_post_sched_on_started(ADV_POST_SCHED_TARGET_HTTP_RUUVI, now_ms);
+        adv_post_sched_on_finished(ADV_POST_SCHED_TARGET_HTTP_RUUVI, false, now_ms);
+    }
+    ASSERT_FALSE(adv_post_sched_check_aged_out(ADV_POST_SCHED_TARGET_HTTP_RUUVI, now_ms));
+    ASSERT_TRUE(adv_post_sched_is_pending(ADV_POST_SCHED_TARGET_HTTP_RUUVI));
+
+    // The target is dropped only if it's pending in backoff for too long
+    ASSERT_TRUE(adv_post_sched_check_aged_out(ADV_POST_SCHED_TARGET_HTTP_RUUVI, now_ms + 1));
+    ASSERT_FALSE(adv_post_sched_is_pending(ADV_POST_SCHED_TARGET_HTTP_RUUVI));
+    ASSERT_FALSE(adv_post_sched_check_aged_out(ADV_POST_SCHED_TARGET_HTTP_RUUVI, now_ms + 1));
+
+    adv_post_sched_stat_t stat = {};
+    adv_post_sched_get_stat(ADV_POST_SCHED_TARGET_HTTP_RUUVI, &stat);
+    ASSERT_EQ(1, stat.cnt_aged_out);
+}
+
+TEST_F(TestAdvPostSched, test_backoff_is_limited) // NOLINT
+{
+    adv_post_sched_time_ms_t now_ms = 0;
+    for (uint32_t i = 0; i < 40; ++i)
+    {
+        adv_post_sched_on_started(ADV_POST_SCHED_TARGET_MQTT, now_ms);
+        adv_post_sched_on_finished(ADV_POST_SCHED_TARGET_MQTT, false, now_ms);
+    }
+    adv_post_sched_set_pending(ADV_POST_SCHED_TARGET_MQTT, true, now_ms);
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_NONE, adv_post_sched_select(now_ms + ADV_POST_SCHED_BACKOFF_MAX_MS - 1));
+    ASSERT_EQ(ADV_POST_SCHED_TARGET_MQTT, adv_post_sched_select(now_ms + ADV_POST_SCHED_BACKOFF_MAX_MS));
+}
+
+TEST_F(TestAdvPostSched, test_get_target_name) // NOLINT
+{
+    ASSERT_EQ(string("urgent"), string(adv_post_sched_get_target_name(ADV_POST_SCHED_TARGET_URGENT)));
+    ASSERT_EQ(string("http_ruuvi"), string(adv_post_sched_get_target_name(ADV_POST_SCHED_TARGET_HTTP_RUUVI)));
+    ASSERT_EQ(string("http_custom"), string(adv_post_sched_get_target_name(ADV_POST_SCHED_TARGET_HTTP_CUSTOM)));
+    ASSERT_EQ(string("http_stat"), string(adv_post_sched_get_target_name(ADV_POST_SCHED_TARGET_HTTP_STAT)));
+    ASSERT_EQ(string("mqtt"), string(adv_post_sched_get_target_name(ADV_POST_SCHED_TARGET_MQTT)));
+    ASSERT_EQ(string("unknown"), string(adv_post_sched_get_target_name(ADV_POST_SCHED_TARGET_NONE)));
+    ASSERT_EQ(nullptr, adv_post_sched_get_target_cfg(ADV_POST_SCHED_TARGET_NONE));
+}
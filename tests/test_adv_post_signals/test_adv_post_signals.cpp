@@ -10,10 +10,12 @@
 #include <string>
 #include "esp_err.h"
 #include "adv_table.h"
+#include "mqtt.h"
 #include "adv_post_cfg_cache.h"
 #include "adv_post_green_led.h"
 #include "event_mgr.h"
 #include "gw_cfg_default.h"
+#include "http_mem_budget.h"
 
 using namespace std;
 
@@ -40,9 +42,9 @@ enum event_type_e
     EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM,
     EVENT_HISTORY_STOP_TIMER_SIG_DO_ASYNC_COMM,
     EVENT_HISTORY_HTTP_ABORT_ANY_REQ_DURING_PROCESSING,
-    EVENT_HISTORY_HTTP_SERVER_MUTEX_ACTIVATE,
-    EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE,
-    EVENT_HISTORY_HTTP_SERVER_MUTEX_UNLOCK,
+    EVENT_HISTORY_HTTP_MEM_BUDGET_SET_RESTRICTED_MODE,
+    EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE,
+    EVENT_HISTORY_ADV_POST_ASYNC_COMM_ON_ABORT,
     EVENT_HISTORY_LEDS_NOTIFY_HTTP1_DATA_SENT_FAIL,
     EVENT_HISTORY_LEDS_NOTIFY_HTTP2_DATA_SENT_FAIL,
     EVENT_HISTORY_GW_STATUS_CLEAR_HTTP_RELAYING_CMD,
@@ -496,7 +498,11 @@ adv_table_read_retransmission_list3_is_empty(void)
 }
 
 bool
-mqtt_publish_adv(const adv_report_t* const p_adv, const bool flag_use_timestamps, const time_t timestamp)
+mqtt_publish_adv(
+    mqtt_json_gen_t* const    p_json_gen,
+    const adv_report_t* const p_adv,
+    const bool                flag_use_timestamps,
+    const time_t              timestamp)
 {
     return g_pTestClass->mqtt_publish_adv_res;
 }
@@ -526,21 +532,11 @@ http_abort_any_req_during_processing(void)
 }
 
 void
-http_server_mutex_activate(void)
+http_mem_budget_set_restricted_mode(const bool flag_restricted)
 {
-    g_pTestClass->m_events_history.push_back({ .event_type = EVENT_HISTORY_HTTP_SERVER_MUTEX_ACTIVATE });
-}
-
-void
-http_server_mutex_deactivate(void)
-{
-    g_pTestClass->m_events_history.push_back({ .event_type = EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE });
-}
-
-void
-http_server_mutex_unlock(void)
-{
-    g_pTestClass->m_events_history.push_back({ .event_type = EVENT_HISTORY_HTTP_SERVER_MUTEX_UNLOCK });
+    g_pTestClass->m_events_history.push_back(
+        { .event_type = flag_restricted ? EVENT_HISTORY_HTTP_MEM_BUDGET_SET_RESTRICTED_MODE
+                                        : EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE });
 }
 
 void
@@ -664,6 +660,12 @@ adv_post_do_async_comm(adv_post_state_t* const p_adv_post_state)
     g_pTestClass->m_events_history.push_back({ .event_type = EVENT_HISTORY_DO_ASYNC_COMM });
 }
 
+void
+adv_post_async_comm_on_abort(void)
+{
+    g_pTestClass->m_events_history.push_back({ .event_type = EVENT_HISTORY_ADV_POST_ASYNC_COMM_ON_ABORT });
+}
+
 void
 adv_post_timers_postpone_sending_statistics(void)
 {
@@ -1369,7 +1371,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_relaying_mode_changed) // NO
         ASSERT_EQ(4, this->m_events_history.size());
         ASSERT_EQ(EVENT_HISTORY_STOP_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[0].event_type);
         ASSERT_EQ(EVENT_HISTORY_HTTP_ABORT_ANY_REQ_DURING_PROCESSING, this->m_events_history[1].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_UNLOCK, this->m_events_history[2].event_type);
+        ASSERT_EQ(EVENT_HISTORY_ADV_POST_ASYNC_COMM_ON_ABORT, this->m_events_history[2].event_type);
         ASSERT_EQ(EVENT_HISTORY_GW_STATUS_CLEAR_HTTP_RELAYING_CMD, this->m_events_history[3].event_type);
         this->m_events_history.clear();
     }
@@ -1477,7 +1479,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_ready) // NOLINT
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
 
@@ -1505,7 +1507,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_ready) // NOLINT
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1537,7 +1539,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_ready) // NOLINT
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1569,7 +1571,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_ready) // NOLINT
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_ACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_RESTRICTED_MODE, this->m_events_history[9].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1602,7 +1604,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_ready) // NOLINT
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_ACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_RESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1635,7 +1637,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_ready) // NOLINT
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_ACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_RESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1668,7 +1670,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_ready) // NOLINT
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1701,7 +1703,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_ready) // NOLINT
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
 
@@ -1750,7 +1752,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         this->m_events_history.clear();
     }
 
@@ -1778,7 +1780,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         this->m_events_history.clear();
     }
 
@@ -1807,7 +1809,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
 
@@ -1835,7 +1837,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1867,7 +1869,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1899,7 +1901,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_ACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_RESTRICTED_MODE, this->m_events_history[9].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1932,7 +1934,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_ACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_RESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1965,7 +1967,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_ACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_RESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
     {
@@ -1998,7 +2000,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
     {
@@ -2031,7 +2033,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[8].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[9].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[10].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[10].event_type);
         this->m_events_history.clear();
     }
     {
@@ -2063,7 +2065,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_ACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_RESTRICTED_MODE, this->m_events_history[9].event_type);
         this->m_events_history.clear();
     }
 
@@ -2095,7 +2097,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         ASSERT_EQ(2, this->m_adv_post_cfg_cache.scan_filter_length);
         ASSERT_EQ(false, this->m_adv_post_cfg_cache.scan_filter_allow_listed);
         ASSERT_EQ(
@@ -2132,7 +2134,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         ASSERT_EQ(1, this->m_adv_post_cfg_cache.scan_filter_length);
         ASSERT_EQ(true, this->m_adv_post_cfg_cache.scan_filter_allow_listed);
         ASSERT_EQ(
@@ -2168,7 +2170,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         ASSERT_EQ(0, this->m_adv_post_cfg_cache.scan_filter_length);
         ASSERT_EQ(true, this->m_adv_post_cfg_cache.scan_filter_allow_listed);
         ASSERT_EQ(nullptr, this->m_adv_post_cfg_cache.p_arr_of_scan_filter_mac);
@@ -2197,7 +2199,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_gw_cfg_changed_ruuvi) // NOL
         ASSERT_EQ(EVENT_HISTORY_RUUVI_SEND_NRF_SETTINGS_FROM_GW_CFG, this->m_events_history[0].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_LOCK, this->m_events_history[1].event_type);
         ASSERT_EQ(EVENT_HISTORY_GATEWAY_RESTART, this->m_events_history[2].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[3].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[3].event_type);
         ASSERT_EQ(0, this->m_adv_post_cfg_cache.scan_filter_length);
         ASSERT_EQ(true, this->m_adv_post_cfg_cache.scan_filter_allow_listed);
         ASSERT_EQ(nullptr, this->m_adv_post_cfg_cache.p_arr_of_scan_filter_mac);
@@ -2291,7 +2293,7 @@ TEST_F(TestAdvPostSignals, test_adv_post_handle_sig_activate_cfg_mode) // NOLINT
         ASSERT_EQ(EVENT_HISTORY_ADV_POST_CFG_CACHE_MUTEX_UNLOCK, this->m_events_history[6].event_type);
         ASSERT_EQ(EVENT_HISTORY_ADV_TABLE_CLEAR, this->m_events_history[7].event_type);
         ASSERT_EQ(EVENT_HISTORY_START_TIMER_SIG_DO_ASYNC_COMM, this->m_events_history[8].event_type);
-        ASSERT_EQ(EVENT_HISTORY_HTTP_SERVER_MUTEX_DEACTIVATE, this->m_events_history[9].event_type);
+        ASSERT_EQ(EVENT_HISTORY_HTTP_MEM_BUDGET_SET_UNRESTRICTED_MODE, this->m_events_history[9].event_type);
         ASSERT_EQ(2, this->m_adv_post_cfg_cache.scan_filter_length);
         ASSERT_EQ(false, this->m_adv_post_cfg_cache.scan_filter_allow_listed);
         ASSERT_EQ(
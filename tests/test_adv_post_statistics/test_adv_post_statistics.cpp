@@ -10,6 +10,7 @@
 #include <string>
 #include "esp_system.h"
 #include "os_malloc.h"
+#include "adv_report_pool.h"
 
 using namespace std;
 
@@ -261,6 +262,22 @@ adv_table_statistics_read(adv_report_table_t* const p_reports)
     *p_reports = g_pTestClass->m_adv_report_table;
 }
 
+adv_report_table_t*
+adv_report_pool_checkout(void)
+{
+    // The pool itself is tested in test_adv_report_pool, here the buffers are taken from the heap to trace them
+    return static_cast<adv_report_table_t*>(os_calloc(1, sizeof(adv_report_table_t)));
+}
+
+void
+adv_report_pool_return(adv_report_table_t* p_reports)
+{
+    if (nullptr != p_reports)
+    {
+        os_free(p_reports);
+    }
+}
+
 } // extern "C"
 
 /*** Unit-Tests
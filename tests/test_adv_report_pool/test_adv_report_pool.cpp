@@ -0,0 +1,214 @@
+/**
+ * @file test_adv_report_pool.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_report_pool.h"
+#include <cstdlib>
+#include "gtest/gtest.h"
+#include "os_mutex.h"
+
+using namespace std;
+
+class TestAdvReportPool;
+
+static TestAdvReportPool* g_pTestClass;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestAdvReportPool : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass               = this;
+        this->m_malloc_fail        = false;
+        this->m_cnt_os_malloc      = 0;
+        this->m_cnt_os_free        = 0;
+        this->m_cnt_mutex_locked   = 0;
+        this->m_cnt_mutex_unlocked = 0;
+        adv_report_pool_init();
+    }
+
+    void
+    TearDown() override
+    {
+        ASSERT_EQ(this->m_cnt_mutex_locked, this->m_cnt_mutex_unlocked);
+        ASSERT_EQ(this->m_cnt_os_malloc, this->m_cnt_os_free);
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestAdvReportPool();
+
+    ~TestAdvReportPool() override;
+
+    bool     m_malloc_fail { false };
+    uint32_t m_cnt_os_malloc { 0 };
+    uint32_t m_cnt_os_free { 0 };
+    uint32_t m_cnt_mutex_locked { 0 };
+    uint32_t m_cnt_mutex_unlocked { 0 };
+};
+
+TestAdvReportPool::TestAdvReportPool()
+    : Test()
+{
+}
+
+TestAdvReportPool::~TestAdvReportPool() = default;
+
+extern "C" {
+
+void*
+os_malloc(const size_t size)
+{
+    if (g_pTestClass->m_malloc_fail)
+    {
+        return nullptr;
+    }
+    g_pTestClass->m_cnt_os_malloc += 1;
+    return malloc(size);
+}
+
+void*
+os_calloc(const size_t nmemb, const size_t size)
+{
+    if (g_pTestClass->m_malloc_fail)
+    {
+        return nullptr;
+    }
+    g_pTestClass->m_cnt_os_malloc += 1;
+    return calloc(nmemb, size);
+}
+
+void
+os_free_internal(void* p_mem)
+{
+    g_pTestClass->m_cnt_os_free += 1;
+    free(p_mem);
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_locked += 1;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_unlocked += 1;
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestAdvReportPool, test_checkout_return) // NOLINT
+{
+    adv_report_table_t* p_reports1 = adv_report_pool_checkout();
+    ASSERT_NE(nullptr, p_reports1);
+    ASSERT_EQ(0, p_reports1->num_of_advs);
+    p_reports1->num_of_advs = 5;
+
+    adv_report_table_t* p_reports2 = adv_report_pool_checkout();
+    ASSERT_NE(nullptr, p_reports2);
+    ASSERT_NE(p_reports1, p_reports2);
+
+    adv_report_pool_stat_t stat = {};
+    adv_report_pool_get_stat(&stat);
+    ASSERT_EQ(2, stat.cnt_checkout);
+    ASSERT_EQ(0, stat.cnt_exhausted);
+    ASSERT_EQ(2, stat.num_in_use);
+    ASSERT_EQ(2, stat.max_in_use);
+
+    adv_report_pool_return(p_reports1);
+    adv_report_pool_get_stat(&stat);
+    ASSERT_EQ(1, stat.num_in_use);
+    ASSERT_EQ(2, stat.max_in_use);
+
+    // The released buffer is reused and its num_of_advs is reset
+    adv_report_table_t* p_reports3 = adv_report_pool_checkout();
+    ASSERT_EQ(p_reports1, p_reports3);
+    ASSERT_EQ(0, p_reports3->num_of_advs);
+
+    adv_report_pool_return(p_reports2);
+    adv_report_pool_return(p_reports3);
+    adv_report_pool_return(nullptr);
+    adv_report_pool_get_stat(&stat);
+    ASSERT_EQ(3, stat.cnt_checkout);
+    ASSERT_EQ(0, stat.num_in_use);
+    ASSERT_EQ(2, stat.max_in_use);
+    ASSERT_EQ(0, this->m_cnt_os_malloc);
+}
+
+TEST_F(TestAdvReportPool, test_exhausted) // NOLINT
+{
+    adv_report_table_t* arr_of_reports[ADV_REPORT_POOL_SIZE] = {};
+    for (uint32_t i = 0; i < ADV_REPORT_POOL_SIZE; ++i)
+    {
+        arr_of_reports[i] = adv_report_pool_checkout();
+        ASSERT_NE(nullptr, arr_of_reports[i]);
+    }
+    ASSERT_EQ(0, this->m_cnt_os_malloc);
+
+    adv_report_table_t* p_reports_from_heap = adv_report_pool_checkout();
+    ASSERT_NE(nullptr, p_reports_from_heap);
+    ASSERT_EQ(0, p_reports_from_heap->num_of_advs);
+    ASSERT_EQ(1, this->m_cnt_os_malloc);
+
+    adv_report_pool_stat_t stat = {};
+    adv_report_pool_get_stat(&stat);
+    ASSERT_EQ(ADV_REPORT_POOL_SIZE + 1, stat.cnt_checkout);
+    ASSERT_EQ(1, stat.cnt_exhausted);
+    ASSERT_EQ(ADV_REPORT_POOL_SIZE, stat.num_in_use);
+    ASSERT_EQ(ADV_REPORT_POOL_SIZE, stat.max_in_use);
+
+    adv_report_pool_return(p_reports_from_heap);
+    ASSERT_EQ(1, this->m_cnt_os_free);
+    adv_report_pool_get_stat(&stat);
+    ASSERT_EQ(ADV_REPORT_POOL_SIZE, stat.num_in_use);
+
+    this->m_malloc_fail = true;
+    ASSERT_EQ(nullptr, adv_report_pool_checkout());
+    adv_report_pool_get_stat(&stat);
+    ASSERT_EQ(2, stat.cnt_exhausted);
+    this->m_malloc_fail = false;
+
+    for (uint32_t i = 0; i < ADV_REPORT_POOL_SIZE; ++i)
+    {
+        adv_report_pool_return(arr_of_reports[i]);
+    }
+    adv_report_pool_get_stat(&stat);
+    ASSERT_EQ(0, stat.num_in_use);
+    ASSERT_EQ(ADV_REPORT_POOL_SIZE, stat.max_in_use);
+}
+
+TEST_F(TestAdvReportPool, test_init_resets_stat) // NOLINT
+{
+    adv_report_table_t* p_reports = adv_report_pool_checkout();
+    ASSERT_NE(nullptr, p_reports);
+    adv_report_pool_return(p_reports);
+
+    adv_report_pool_init();
+    adv_report_pool_stat_t stat = {};
+    adv_report_pool_get_stat(&stat);
+    ASSERT_EQ(0, stat.cnt_checkout);
+    ASSERT_EQ(0, stat.cnt_exhausted);
+    ASSERT_EQ(0, stat.num_in_use);
+    ASSERT_EQ(0, stat.max_in_use);
+}
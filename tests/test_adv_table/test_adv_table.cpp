@@ -8,10 +8,13 @@
 #include "adv_table.h"
 #include "gtest/gtest.h"
 #include <string>
+#include <vector>
 #include "os_mutex.h"
 
 using namespace std;
 
+static uint32_t g_mutex_lock_cnt;
+
 /*** Google-test class implementation
  * *********************************************************************************/
 
@@ -22,6 +25,7 @@ protected:
     void
     SetUp() override
     {
+        g_mutex_lock_cnt = 0;
         adv_table_init();
     }
 
@@ -62,6 +66,7 @@ void
 os_mutex_lock(os_mutex_t const h_mutex)
 {
     (void)h_mutex;
+    g_mutex_lock_cnt += 1;
 }
 
 void
@@ -699,3 +704,336 @@ TEST_F(TestAdvTable, test_3_with_the_same_hash_overwrite_2) // NOLINT
         ASSERT_EQ(0, reports.num_of_advs);
     }
 }
+
+TEST_F(TestAdvTable, test_tag_mac_str_formatted_once_on_put) // NOLINT
+{
+    const uint64_t    mac_addr       = 0x112233445566LLU;
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    DECL_ADV_REPORT(adv1, mac_addr, base_timestamp, rssi, data1, 0xAAU, 0xBBU);
+    DECL_ADV_REPORT(adv2, mac_addr, base_timestamp + 1, rssi, data2, 0xCCU, 0xDDU);
+    ASSERT_EQ('\0', adv1.tag_mac_str.str_buf[0]);
+    ASSERT_EQ('\0', adv2.tag_mac_str.str_buf[0]);
+
+    for (const adv_report_t* p_adv : { &adv1, &adv2 })
+    {
+        ASSERT_TRUE(adv_table_put(p_adv));
+        adv_report_table_t reports = {};
+        adv_table_read_retransmission_list3_and_clear(&reports);
+        ASSERT_EQ(1, reports.num_of_advs);
+        ASSERT_EQ(string("11:22:33:44:55:66"), string(reports.table[0].tag_mac_str.str_buf));
+
+        mac_address_str_t              mac_str_tmp = {};
+        const mac_address_str_t* const p_mac_str   = adv_decoded_get_mac_str(
+            &reports.table[0].tag_mac_str,
+            &reports.table[0].tag_mac,
+            &mac_str_tmp);
+        ASSERT_EQ(&reports.table[0].tag_mac_str, p_mac_str);
+    }
+
+    mac_address_str_t              mac_str_tmp = {};
+    const mac_address_str_t* const p_mac_str   = adv_decoded_get_mac_str(
+        &adv1.tag_mac_str,
+        &adv1.tag_mac,
+        &mac_str_tmp);
+    ASSERT_EQ(&mac_str_tmp, p_mac_str);
+    ASSERT_EQ(string("11:22:33:44:55:66"), string(p_mac_str->str_buf));
+}
+
+TEST_F(TestAdvTable, test_read_retransmission_list1_begin_commit) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    DECL_ADV_REPORT(adv1, 0x112233445501LLU, base_timestamp, rssi, data1, 0xAAU, 0xBBU);
+    DECL_ADV_REPORT(adv2, 0x112233445502LLU, base_timestamp, rssi, data2, 0xCCU, 0xDDU);
+    ASSERT_TRUE(adv_table_put(&adv1));
+    ASSERT_TRUE(adv_table_put(&adv2));
+
+    adv_report_table_t       reports = {};
+    const adv_table_ticket_t ticket  = adv_table_read_retransmission_list1_begin(&reports);
+    ASSERT_NE(ADV_TABLE_TICKET_NONE, ticket);
+    ASSERT_EQ(2, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv1, data1, &reports.table[0]);
+    CHECK_ADV_REPORT(adv2, data2, &reports.table[1]);
+
+    adv_table_retransmission_commit(ticket);
+    adv_table_read_retransmission_list1_and_clear(&reports);
+    ASSERT_EQ(0, reports.num_of_advs);
+
+    // The rollback of the committed ticket does nothing
+    adv_table_retransmission_rollback(ticket);
+    adv_table_read_retransmission_list1_and_clear(&reports);
+    ASSERT_EQ(0, reports.num_of_advs);
+}
+
+TEST_F(TestAdvTable, test_read_retransmission_list1_begin_rollback) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    DECL_ADV_REPORT(adv1, 0x112233445501LLU, base_timestamp, rssi, data1, 0xAAU, 0xBBU);
+    DECL_ADV_REPORT(adv2, 0x112233445502LLU, base_timestamp, rssi, data2, 0xCCU, 0xDDU);
+    ASSERT_TRUE(adv_table_put(&adv1));
+    ASSERT_TRUE(adv_table_put(&adv2));
+
+    adv_report_table_t       reports = {};
+    const adv_table_ticket_t ticket  = adv_table_read_retransmission_list1_begin(&reports);
+    ASSERT_EQ(2, reports.num_of_advs);
+    adv_table_read_retransmission_list1_and_clear(&reports);
+    ASSERT_EQ(0, reports.num_of_advs);
+
+    adv_table_retransmission_rollback(ticket);
+    adv_table_read_retransmission_list1_and_clear(&reports);
+    ASSERT_EQ(2, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv1, data1, &reports.table[0]);
+    CHECK_ADV_REPORT(adv2, data2, &reports.table[1]);
+
+    // list2 is not affected by the transaction on list1
+    adv_table_read_retransmission_list2_and_clear(&reports);
+    ASSERT_EQ(2, reports.num_of_advs);
+}
+
+TEST_F(TestAdvTable, test_read_retransmission_list2_rollback_keeps_newer_data) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    DECL_ADV_REPORT(adv1, 0x112233445501LLU, base_timestamp, rssi, data1, 0xAAU, 0xBBU);
+    DECL_ADV_REPORT(adv2, 0x112233445502LLU, base_timestamp, rssi, data2, 0xCCU, 0xDDU);
+    DECL_ADV_REPORT(adv1_new, 0x112233445501LLU, base_timestamp + 1, rssi, data1_new, 0xAAU, 0xBCU);
+    ASSERT_TRUE(adv_table_put(&adv1));
+    ASSERT_TRUE(adv_table_put(&adv2));
+
+    adv_report_table_t       reports = {};
+    const adv_table_ticket_t ticket  = adv_table_read_retransmission_list2_begin(&reports);
+    ASSERT_EQ(2, reports.num_of_advs);
+
+    // The tag is updated while the batch is in flight
+    ASSERT_TRUE(adv_table_put(&adv1_new));
+
+    // The updated tag is moved to the tail, the rolled back one keeps its place
+    adv_table_retransmission_rollback(ticket);
+    adv_table_read_retransmission_list2_and_clear(&reports);
+    ASSERT_EQ(2, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv2, data2, &reports.table[0]);
+    CHECK_ADV_REPORT(adv1_new, data1_new, &reports.table[1]);
+}
+
+TEST_F(TestAdvTable, test_read_retransmission_list1_begin_after_abandoned_batch) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    DECL_ADV_REPORT(adv1, 0x112233445501LLU, base_timestamp, rssi, data1, 0xAAU, 0xBBU);
+    DECL_ADV_REPORT(adv2, 0x112233445502LLU, base_timestamp, rssi, data2, 0xCCU, 0xDDU);
+    ASSERT_TRUE(adv_table_put(&adv1));
+
+    adv_report_table_t       reports = {};
+    const adv_table_ticket_t ticket1 = adv_table_read_retransmission_list1_begin(&reports);
+    ASSERT_EQ(1, reports.num_of_advs);
+
+    ASSERT_TRUE(adv_table_put(&adv2));
+
+    // The result of the first batch was never reported, so its advs are read again with the next batch
+    const adv_table_ticket_t ticket2 = adv_table_read_retransmission_list1_begin(&reports);
+    ASSERT_NE(ticket1, ticket2);
+    ASSERT_EQ(2, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv1, data1, &reports.table[0]);
+    CHECK_ADV_REPORT(adv2, data2, &reports.table[1]);
+
+    adv_table_retransmission_rollback(ticket1);
+    adv_table_retransmission_commit(ticket2);
+    adv_table_read_retransmission_list1_and_clear(&reports);
+    ASSERT_EQ(0, reports.num_of_advs);
+}
+
+TEST_F(TestAdvTable, test_read_dirty_targets_are_independent) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    DECL_ADV_REPORT(adv1, 0x112233445501LLU, base_timestamp, rssi, data1, 0xAAU, 0xBBU);
+    DECL_ADV_REPORT(adv2, 0x112233445502LLU, base_timestamp, rssi, data2, 0xCCU, 0xDDU);
+    DECL_ADV_REPORT(adv1_new, 0x112233445501LLU, base_timestamp + 1, rssi, data1_new, 0xAAU, 0xBCU);
+    ASSERT_TRUE(adv_table_put(&adv1));
+    ASSERT_TRUE(adv_table_put(&adv2));
+
+    adv_report_table_t reports = {};
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_RUUVI, &reports);
+    ASSERT_EQ(2, reports.num_of_advs);
+    ASSERT_FALSE(adv_table_is_dirty(ADV_TABLE_TARGET_HTTP_RUUVI));
+    ASSERT_TRUE(adv_table_is_dirty(ADV_TABLE_TARGET_HTTP_CUSTOM));
+    ASSERT_TRUE(adv_table_is_dirty(ADV_TABLE_TARGET_MQTT));
+
+    // The tag which is still unread by MQTT keeps its place for MQTT, but it's dirty again for HTTP Ruuvi
+    ASSERT_TRUE(adv_table_put(&adv1_new));
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_RUUVI, &reports);
+    ASSERT_EQ(1, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv1_new, data1_new, &reports.table[0]);
+
+    adv_report_t advs[1] = {};
+    ASSERT_EQ(1, adv_table_read_dirty_batch(ADV_TABLE_TARGET_MQTT, advs, 1));
+    CHECK_ADV_REPORT(adv2, data2, &advs[0]);
+    ASSERT_EQ(1, adv_table_read_dirty_batch(ADV_TABLE_TARGET_MQTT, advs, 1));
+    CHECK_ADV_REPORT(adv1_new, data1_new, &advs[0]);
+    ASSERT_FALSE(adv_table_is_dirty(ADV_TABLE_TARGET_MQTT));
+
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_CUSTOM, &reports);
+    ASSERT_EQ(2, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv2, data2, &reports.table[0]);
+    CHECK_ADV_REPORT(adv1_new, data1_new, &reports.table[1]);
+    ASSERT_FALSE(adv_table_is_dirty(ADV_TABLE_TARGET_HTTP_CUSTOM));
+}
+
+TEST_F(TestAdvTable, test_read_dirty_rollback_keeps_order) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    DECL_ADV_REPORT(adv1, 0x112233445501LLU, base_timestamp, rssi, data1, 0xAAU, 0xBBU);
+    DECL_ADV_REPORT(adv2, 0x112233445502LLU, base_timestamp, rssi, data2, 0xCCU, 0xDDU);
+    DECL_ADV_REPORT(adv3, 0x112233445503LLU, base_timestamp, rssi, data3, 0xEEU, 0xFFU);
+    ASSERT_TRUE(adv_table_put(&adv1));
+    ASSERT_TRUE(adv_table_put(&adv2));
+
+    adv_report_table_t       reports = {};
+    const adv_table_ticket_t ticket  = adv_table_read_dirty_begin(ADV_TABLE_TARGET_HTTP_CUSTOM, &reports);
+    ASSERT_EQ(2, reports.num_of_advs);
+    ASSERT_TRUE(adv_table_put(&adv3));
+
+    // The other targets have read nothing yet, so all the advs are still dirty for them
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_RUUVI, &reports);
+    ASSERT_EQ(3, reports.num_of_advs);
+
+    adv_table_retransmission_rollback(ticket);
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_CUSTOM, &reports);
+    ASSERT_EQ(3, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv1, data1, &reports.table[0]);
+    CHECK_ADV_REPORT(adv2, data2, &reports.table[1]);
+    CHECK_ADV_REPORT(adv3, data3, &reports.table[2]);
+
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_RUUVI, &reports);
+    ASSERT_EQ(0, reports.num_of_advs);
+}
+
+TEST_F(TestAdvTable, test_read_by_mac_keeps_dirty_state) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    DECL_ADV_REPORT(adv1, 0x112233445501LLU, base_timestamp, rssi, data1, 0xAAU, 0xBBU);
+    DECL_ADV_REPORT(adv2, 0x112233445502LLU, base_timestamp, rssi, data2, 0xCCU, 0xDDU);
+    ASSERT_TRUE(adv_table_put(&adv1));
+
+    adv_report_t adv = {};
+    ASSERT_TRUE(adv_table_read_by_mac(&adv1.tag_mac, &adv));
+    CHECK_ADV_REPORT(adv1, data1, &adv);
+    ASSERT_FALSE(adv_table_read_by_mac(&adv2.tag_mac, &adv));
+
+    adv_report_table_t reports = {};
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_CUSTOM, &reports);
+    ASSERT_EQ(1, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv1, data1, &reports.table[0]);
+}
+
+TEST_F(TestAdvTable, test_target_reset) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    DECL_ADV_REPORT(adv1, 0x112233445501LLU, base_timestamp, rssi, data1, 0xAAU, 0xBBU);
+    DECL_ADV_REPORT(adv2, 0x112233445502LLU, base_timestamp, rssi, data2, 0xCCU, 0xDDU);
+    DECL_ADV_REPORT(adv1_new, 0x112233445501LLU, base_timestamp + 1, rssi, data1_new, 0xAAU, 0xBCU);
+    ASSERT_TRUE(adv_table_put(&adv1));
+    ASSERT_TRUE(adv_table_put(&adv2));
+
+    adv_table_target_reset(ADV_TABLE_TARGET_LIVE_STREAM_FIRST);
+    ASSERT_FALSE(adv_table_is_dirty(ADV_TABLE_TARGET_LIVE_STREAM_FIRST));
+    ASSERT_TRUE(adv_table_is_dirty(ADV_TABLE_TARGET_LIVE_STREAM_LAST));
+    ASSERT_TRUE(adv_table_is_dirty(ADV_TABLE_TARGET_HTTP_RUUVI));
+
+    // adv1 is still unread by the other targets, but it must be read by the reset target after the update
+    ASSERT_TRUE(adv_table_put(&adv1_new));
+    adv_report_table_t reports = {};
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_LIVE_STREAM_FIRST, &reports);
+    ASSERT_EQ(1, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv1_new, data1_new, &reports.table[0]);
+    ASSERT_FALSE(adv_table_is_dirty(ADV_TABLE_TARGET_LIVE_STREAM_FIRST));
+
+    adv_table_read_dirty_and_clear(ADV_TABLE_TARGET_HTTP_RUUVI, &reports);
+    ASSERT_EQ(2, reports.num_of_advs);
+    CHECK_ADV_REPORT(adv2, data2, &reports.table[0]);
+    CHECK_ADV_REPORT(adv1_new, data1_new, &reports.table[1]);
+}
+
+TEST_F(TestAdvTable, test_read_retransmission_list3_head_batch) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    const uint32_t    num_advs       = 20;
+    for (uint32_t i = 0; i < num_advs; ++i)
+    {
+        DECL_ADV_REPORT(adv, 0x112233445500LLU + i, base_timestamp + i, rssi, data, 0xAAU, 0xBBU);
+        ASSERT_TRUE(adv_table_put(&adv));
+    }
+    ASSERT_FALSE(adv_table_read_retransmission_list3_is_empty());
+
+    std::array<adv_report_t, 8> advs {};
+    uint32_t                    num_read = 0;
+    g_mutex_lock_cnt                     = 0;
+    while (true)
+    {
+        const uint32_t num_batch = adv_table_read_retransmission_list3_head_batch(advs.data(), advs.size());
+        if (0 == num_batch)
+        {
+            break;
+        }
+        for (uint32_t i = 0; i < num_batch; ++i)
+        {
+            ASSERT_EQ(base_timestamp + num_read + i, advs[i].timestamp);
+            ASSERT_EQ((num_read + i) & 0xFFU, advs[i].tag_mac.mac[5]);
+        }
+        num_read += num_batch;
+    }
+    ASSERT_EQ(num_advs, num_read);
+    ASSERT_EQ(4, g_mutex_lock_cnt); // 3 batches (8 + 8 + 4) and one empty read
+    ASSERT_TRUE(adv_table_read_retransmission_list3_is_empty());
+}
+
+TEST_F(TestAdvTable, test_read_retransmission_list3_head_vs_batch) // NOLINT
+{
+    const time_t      base_timestamp = 1611154440;
+    const wifi_rssi_t rssi           = 50;
+    const uint32_t    num_advs       = MAX_ADVS_TABLE;
+
+    // The advs dequeued one by one and by batches must be the same and in the same order
+    std::vector<adv_report_t> advs_single {};
+    std::vector<adv_report_t> advs_batch {};
+    for (uint32_t iter = 0; iter < 2; ++iter)
+    {
+        for (uint32_t i = 0; i < num_advs; ++i)
+        {
+            DECL_ADV_REPORT(adv, 0x112233440000LLU + i, base_timestamp + i, rssi, data, 0xAAU, (uint8_t)iter);
+            ASSERT_TRUE(adv_table_put(&adv));
+        }
+        if (0 == iter)
+        {
+            adv_report_t adv = {};
+            while (adv_table_read_retransmission_list3_head(&adv))
+            {
+                advs_single.push_back(adv);
+            }
+        }
+        else
+        {
+            std::array<adv_report_t, 8> advs {};
+            uint32_t                    num_batch = 0;
+            while (0 != (num_batch = adv_table_read_retransmission_list3_head_batch(advs.data(), advs.size())))
+            {
+                advs_batch.insert(advs_batch.end(), advs.begin(), advs.begin() + num_batch);
+            }
+        }
+        ASSERT_TRUE(adv_table_read_retransmission_list3_is_empty());
+    }
+    ASSERT_EQ(num_advs, advs_single.size());
+    ASSERT_EQ(num_advs, advs_batch.size());
+    for (uint32_t i = 0; i < num_advs; ++i)
+    {
+        ASSERT_EQ(advs_single[i].timestamp, advs_batch[i].timestamp);
+        ASSERT_EQ(0, memcmp(advs_single[i].tag_mac.mac, advs_batch[i].tag_mac.mac, sizeof(advs_single[i].tag_mac.mac)));
+        ASSERT_EQ(advs_single[i].data_len, advs_batch[i].data_len);
+    }
+}
@@ -0,0 +1,180 @@
+/**
+ * @file test_adv_trigger.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "adv_trigger.h"
+#include <cstring>
+#include <cmath>
+#include "gtest/gtest.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestAdvTrigger : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        memset(&this->m_trigger, 0, sizeof(this->m_trigger));
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    TestAdvTrigger();
+
+    ~TestAdvTrigger() override;
+
+    adv_trigger_t m_trigger {};
+
+    void
+    init(const ruuvi_gw_cfg_adv_trigger_t& cfg)
+    {
+        adv_trigger_init(&this->m_trigger, &cfg);
+    }
+
+    bool
+    check(const mac_address_bin_t& mac, const float temperature, const float movement_counter)
+    {
+        adv_decoded_t decoded           = {};
+        decoded.data_format             = ADV_DECODED_DATA_FORMAT_5;
+        decoded.data.df5.temperature_c  = temperature;
+        decoded.data.df5.movement_count = movement_counter;
+        return adv_trigger_check(&this->m_trigger, &mac, &decoded);
+    }
+
+    uint32_t
+    take_pending(mac_address_bin_t* const p_macs, const uint32_t max_num_macs)
+    {
+        return adv_trigger_take_pending(&this->m_trigger, p_macs, max_num_macs);
+    }
+};
+
+TestAdvTrigger::TestAdvTrigger()
+    : Test()
+{
+}
+
+TestAdvTrigger::~TestAdvTrigger() = default;
+
+static const mac_address_bin_t g_mac1 = { { 0xC9U, 0x12U, 0x34U, 0x56U, 0x78U, 0x9AU } };
+static const mac_address_bin_t g_mac2 = { { 0xD0U, 0x12U, 0x34U, 0x56U, 0x78U, 0x9AU } };
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestAdvTrigger, test_disabled) // NOLINT
+{
+    this->init({});
+    ASSERT_FALSE(adv_trigger_is_enabled(&this->m_trigger));
+    ASSERT_FALSE(this->check(g_mac1, 20.0f, 1.0f));
+    ASSERT_FALSE(this->check(g_mac1, 90.0f, 2.0f));
+    mac_address_bin_t macs[ADV_TRIGGER_MAX_NUM_PENDING];
+    ASSERT_EQ(0, this->take_pending(macs, ADV_TRIGGER_MAX_NUM_PENDING));
+}
+
+TEST_F(TestAdvTrigger, test_movement) // NOLINT
+{
+    ruuvi_gw_cfg_adv_trigger_t cfg = {};
+    cfg.on_movement                = true;
+    this->init(cfg);
+    ASSERT_TRUE(adv_trigger_is_enabled(&this->m_trigger));
+
+    // The first advertisement of the tag only sets the reference value
+    ASSERT_FALSE(this->check(g_mac1, 20.0f, 10.0f));
+    ASSERT_FALSE(this->check(g_mac1, 20.0f, 10.0f));
+    ASSERT_TRUE(this->check(g_mac1, 20.0f, 11.0f));
+    ASSERT_FALSE(this->check(g_mac1, 20.0f, 11.0f));
+    // The invalid value does not change the reference
+    ASSERT_FALSE(this->check(g_mac1, 20.0f, NAN));
+    ASSERT_FALSE(this->check(g_mac1, 20.0f, 11.0f));
+    // Wrap-around of the counter
+    ASSERT_FALSE(this->check(g_mac2, 20.0f, 254.0f));
+    ASSERT_TRUE(this->check(g_mac2, 20.0f, 0.0f));
+
+    mac_address_bin_t macs[ADV_TRIGGER_MAX_NUM_PENDING];
+    ASSERT_EQ(2, this->take_pending(macs, ADV_TRIGGER_MAX_NUM_PENDING));
+    ASSERT_EQ(0, memcmp(g_mac1.mac, macs[0].mac, sizeof(g_mac1.mac)));
+    ASSERT_EQ(0, memcmp(g_mac2.mac, macs[1].mac, sizeof(g_mac2.mac)));
+    ASSERT_EQ(0, this->take_pending(macs, ADV_TRIGGER_MAX_NUM_PENDING));
+}
+
+TEST_F(TestAdvTrigger, test_temperature_limits) // NOLINT
+{
+    ruuvi_gw_cfg_adv_trigger_t cfg = {};
+    cfg.use_temperature_low        = true;
+    cfg.temperature_low            = 5;
+    cfg.use_temperature_high       = true;
+    cfg.temperature_high           = 30;
+    this->init(cfg);
+
+    ASSERT_FALSE(this->check(g_mac1, 20.0f, NAN));
+    ASSERT_FALSE(this->check(g_mac1, 30.0f, NAN));
+    ASSERT_TRUE(this->check(g_mac1, 30.1f, NAN));
+    ASSERT_FALSE(this->check(g_mac1, 31.0f, NAN));
+    // The hysteresis prevents firing on the noise around the limit
+    ASSERT_FALSE(this->check(g_mac1, 29.6f, NAN));
+    ASSERT_FALSE(this->check(g_mac1, 30.1f, NAN));
+    ASSERT_TRUE(this->check(g_mac1, 29.4f, NAN));
+    ASSERT_FALSE(this->check(g_mac1, 29.9f, NAN));
+
+    ASSERT_TRUE(this->check(g_mac1, 4.9f, NAN));
+    ASSERT_FALSE(this->check(g_mac1, 5.4f, NAN));
+    ASSERT_TRUE(this->check(g_mac1, 5.6f, NAN));
+
+    // The tag which is already out of the limits on the first advertisement does not fire
+    ASSERT_FALSE(this->check(g_mac2, 40.0f, NAN));
+    ASSERT_TRUE(this->check(g_mac2, 20.0f, NAN));
+
+    mac_address_bin_t macs[ADV_TRIGGER_MAX_NUM_PENDING];
+    ASSERT_EQ(2, this->take_pending(macs, ADV_TRIGGER_MAX_NUM_PENDING));
+}
+
+TEST_F(TestAdvTrigger, test_pending_queue_overflow) // NOLINT
+{
+    ruuvi_gw_cfg_adv_trigger_t cfg = {};
+    cfg.on_movement                = true;
+    this->init(cfg);
+
+    for (uint32_t i = 0; i < (ADV_TRIGGER_MAX_NUM_PENDING + 2); ++i)
+    {
+        mac_address_bin_t mac = g_mac1;
+        mac.mac[5]            = (uint8_t)i;
+        ASSERT_FALSE(this->check(mac, 20.0f, 1.0f));
+        ASSERT_TRUE(this->check(mac, 20.0f, 2.0f));
+        ASSERT_TRUE(this->check(mac, 20.0f, 3.0f));
+    }
+    ASSERT_EQ(4, this->m_trigger.cnt_pending_overflow); // Two tags which did not fit into the queue fired twice
+
+    mac_address_bin_t macs[ADV_TRIGGER_MAX_NUM_PENDING];
+    ASSERT_EQ(3, this->take_pending(macs, 3));
+    ASSERT_EQ(0, macs[0].mac[5]);
+    ASSERT_EQ(2, macs[2].mac[5]);
+    ASSERT_EQ(ADV_TRIGGER_MAX_NUM_PENDING - 3, this->take_pending(macs, ADV_TRIGGER_MAX_NUM_PENDING));
+    ASSERT_EQ(3, macs[0].mac[5]);
+    ASSERT_EQ(0, this->take_pending(macs, ADV_TRIGGER_MAX_NUM_PENDING));
+}
+
+TEST_F(TestAdvTrigger, test_init_clears_state) // NOLINT
+{
+    ruuvi_gw_cfg_adv_trigger_t cfg = {};
+    cfg.on_movement                = true;
+    this->init(cfg);
+    ASSERT_FALSE(this->check(g_mac1, 20.0f, 1.0f));
+    ASSERT_TRUE(this->check(g_mac1, 20.0f, 2.0f));
+
+    this->init(cfg);
+    mac_address_bin_t macs[ADV_TRIGGER_MAX_NUM_PENDING];
+    ASSERT_EQ(0, this->take_pending(macs, ADV_TRIGGER_MAX_NUM_PENDING));
+    ASSERT_FALSE(this->check(g_mac1, 20.0f, 3.0f));
+}
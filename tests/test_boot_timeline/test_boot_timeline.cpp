@@ -0,0 +1,137 @@
+/**
+ * @file test_boot_timeline.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "boot_timeline.h"
+#include "gtest/gtest.h"
+#include <string>
+#include "os_mutex.h"
+#include "esp_timer.h"
+
+using namespace std;
+
+class TestBootTimeline;
+static TestBootTimeline* g_pTestClass;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestBootTimeline : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass    = this;
+        this->m_time_us = 0;
+        boot_timeline_init();
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    int64_t m_time_us;
+
+    TestBootTimeline();
+
+    ~TestBootTimeline() override;
+};
+
+TestBootTimeline::TestBootTimeline()
+    : Test()
+    , m_time_us(0)
+{
+}
+
+TestBootTimeline::~TestBootTimeline() = default;
+
+extern "C" {
+
+int64_t
+esp_timer_get_time(void)
+{
+    return g_pTestClass->m_time_us;
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestBootTimeline, test_mark_and_get) // NOLINT
+{
+    boot_timeline_t timeline = {};
+    boot_timeline_get(&timeline);
+    for (uint32_t i = 0; i < BOOT_TIMELINE_STAGE_LAST; ++i)
+    {
+        ASSERT_EQ(0, timeline.stages[i]);
+    }
+
+    this->m_time_us = 312000;
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_APP_MAIN);
+    this->m_time_us = 1250000;
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NRF52_CHECK_FINISHED);
+    this->m_time_us = 2450000;
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NETWORK_CONNECTED);
+
+    boot_timeline_get(&timeline);
+    ASSERT_EQ(312000, timeline.stages[BOOT_TIMELINE_STAGE_APP_MAIN]);
+    ASSERT_EQ(0, timeline.stages[BOOT_TIMELINE_STAGE_NVS_READY]);
+    ASSERT_EQ(1250000, timeline.stages[BOOT_TIMELINE_STAGE_NRF52_CHECK_FINISHED]);
+    ASSERT_EQ(2450000, timeline.stages[BOOT_TIMELINE_STAGE_NETWORK_CONNECTED]);
+}
+
+TEST_F(TestBootTimeline, test_only_first_mark_is_recorded) // NOLINT
+{
+    this->m_time_us = 2450000;
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NETWORK_CONNECTED);
+    this->m_time_us = 95000000;
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_NETWORK_CONNECTED);
+    boot_timeline_mark(BOOT_TIMELINE_STAGE_LAST);
+
+    boot_timeline_t timeline = {};
+    boot_timeline_get(&timeline);
+    ASSERT_EQ(2450000, timeline.stages[BOOT_TIMELINE_STAGE_NETWORK_CONNECTED]);
+}
+
+TEST_F(TestBootTimeline, test_get_stage_name) // NOLINT
+{
+    ASSERT_EQ(string("app_main"), string(boot_timeline_get_stage_name(BOOT_TIMELINE_STAGE_APP_MAIN)));
+    ASSERT_EQ(
+        string("nrf52_check_finished"),
+        string(boot_timeline_get_stage_name(BOOT_TIMELINE_STAGE_NRF52_CHECK_FINISHED)));
+    ASSERT_EQ(
+        string("network_connected"),
+        string(boot_timeline_get_stage_name(BOOT_TIMELINE_STAGE_NETWORK_CONNECTED)));
+    ASSERT_EQ(string("unknown"), string(boot_timeline_get_stage_name(BOOT_TIMELINE_STAGE_LAST)));
+    for (uint32_t i = 0; i < BOOT_TIMELINE_STAGE_LAST; ++i)
+    {
+        ASSERT_NE(nullptr, boot_timeline_get_stage_name(static_cast<boot_timeline_stage_e>(i)));
+    }
+}
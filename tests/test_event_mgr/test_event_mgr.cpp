@@ -28,6 +28,8 @@ typedef enum MainTaskCmd_Tag
     MainTaskCmd_EventMgrNotifyWiFiDisconnected,
     MainTaskCmd_EventMgrNotifyEthConnected,
     MainTaskCmd_EventMgrNotifyEthDisconnected,
+    MainTaskCmd_EventMgrNotifyRecvAdv,
+    MainTaskCmd_EventMgrClearPendingRecvAdvTask2,
     MainTaskCmd_RunSignalHandlerTask1,
     MainTaskCmd_RunSignalHandlerTask2,
     MainTaskCmd_SendToTask1Signal0,
@@ -332,8 +334,14 @@ signalHandlerTask2(void* p_param)
     {
         assert(0);
     }
+    if (!os_signal_add(p_signal, OS_SIGNAL_NUM_3))
+    {
+        assert(0);
+    }
     static event_mgr_ev_info_static_t ev_info_mem;
     event_mgr_subscribe_sig_static(&ev_info_mem, EVENT_MGR_EV_ETH_DISCONNECTED, p_signal, OS_SIGNAL_NUM_1);
+    static event_mgr_ev_info_static_t ev_info_mem_recv_adv;
+    event_mgr_subscribe_sig_static_coalesced(&ev_info_mem_recv_adv, EVENT_MGR_EV_RECV_ADV, p_signal, OS_SIGNAL_NUM_3);
     os_signal_register_cur_thread(p_signal);
     bool flag_exit = false;
     while (!flag_exit)
@@ -397,6 +405,12 @@ cmdHandlerTask(void* p_param)
             case MainTaskCmd_EventMgrNotifyEthDisconnected:
                 event_mgr_notify(EVENT_MGR_EV_ETH_DISCONNECTED);
                 break;
+            case MainTaskCmd_EventMgrNotifyRecvAdv:
+                event_mgr_notify(EVENT_MGR_EV_RECV_ADV);
+                break;
+            case MainTaskCmd_EventMgrClearPendingRecvAdvTask2:
+                event_mgr_clear_pending_sig(EVENT_MGR_EV_RECV_ADV, pObj->p_signal2, OS_SIGNAL_NUM_3);
+                break;
 
             case MainTaskCmd_RunSignalHandlerTask1:
             {
@@ -569,3 +583,62 @@ TEST_F(TestEventMgr, test1) // NOLINT
 
     cmdQueue.push_and_wait(MainTaskCmd_EventMgrDeinit);
 }
+
+TEST_F(TestEventMgr, test_coalescing_of_high_rate_event) // NOLINT
+{
+    this->result_event_mgr_init = false;
+    cmdQueue.push_and_wait(MainTaskCmd_EventMgrInit);
+    ASSERT_TRUE(this->result_event_mgr_init);
+
+    this->result_run_signal_handler_task = false;
+    cmdQueue.push_and_wait(MainTaskCmd_RunSignalHandlerTask2);
+    ASSERT_TRUE(this->result_run_signal_handler_task);
+    ASSERT_TRUE(wait_until_thread2_registered(1000));
+
+    cmdQueue.push_and_wait(MainTaskCmd_EventMgrNotifyRecvAdv);
+    cmdQueue.push_and_wait(MainTaskCmd_EventMgrNotifyRecvAdv);
+    cmdQueue.push_and_wait(MainTaskCmd_EventMgrNotifyRecvAdv);
+    ASSERT_TRUE(wait_until_new_events_pushed(1, 1000));
+    sleep(1);
+    ASSERT_EQ(1, testEvents.size());
+    {
+        auto* pBaseEv = testEvents[0];
+        ASSERT_EQ(TestEventType_Signal, pBaseEv->eventType);
+        auto* pEv = reinterpret_cast<TestEventSignal*>(pBaseEv);
+        ASSERT_EQ(TEST_EVENT_THREAD_NUM_2, pEv->thread_num);
+        ASSERT_EQ(OS_SIGNAL_NUM_3, pEv->sig_num);
+    }
+    testEvents.clear();
+    {
+        event_mgr_ev_stat_t stat = {};
+        event_mgr_get_stat(EVENT_MGR_EV_RECV_ADV, &stat);
+        ASSERT_EQ(3, stat.cnt_notify);
+        ASSERT_EQ(1, stat.cnt_sent);
+        ASSERT_EQ(2, stat.cnt_coalesced);
+    }
+
+    cmdQueue.push_and_wait(MainTaskCmd_EventMgrClearPendingRecvAdvTask2);
+    cmdQueue.push_and_wait(MainTaskCmd_EventMgrNotifyRecvAdv);
+    ASSERT_TRUE(wait_until_new_events_pushed(1, 1000));
+    {
+        auto* pBaseEv = testEvents[0];
+        ASSERT_EQ(TestEventType_Signal, pBaseEv->eventType);
+        auto* pEv = reinterpret_cast<TestEventSignal*>(pBaseEv);
+        ASSERT_EQ(TEST_EVENT_THREAD_NUM_2, pEv->thread_num);
+        ASSERT_EQ(OS_SIGNAL_NUM_3, pEv->sig_num);
+    }
+    testEvents.clear();
+    {
+        event_mgr_ev_stat_t stat = {};
+        event_mgr_get_stat(EVENT_MGR_EV_RECV_ADV, &stat);
+        ASSERT_EQ(4, stat.cnt_notify);
+        ASSERT_EQ(2, stat.cnt_sent);
+        ASSERT_EQ(2, stat.cnt_coalesced);
+    }
+
+    cmdQueue.push_and_wait(MainTaskCmd_SendToTask2Signal2);
+    ASSERT_TRUE(wait_until_new_events_pushed(2, 1000));
+    testEvents.clear();
+
+    cmdQueue.push_and_wait(MainTaskCmd_EventMgrDeinit);
+}
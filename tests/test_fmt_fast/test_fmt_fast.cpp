@@ -0,0 +1,120 @@
+/**
+ * @file test_fmt_fast.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "fmt_fast.h"
+#include <cstdio>
+#include <string>
+#include "gtest/gtest.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestFmtFast : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    TestFmtFast();
+
+    ~TestFmtFast() override;
+};
+
+TestFmtFast::TestFmtFast()
+    : Test()
+{
+}
+
+TestFmtFast::~TestFmtFast() = default;
+
+static string
+test_hex_with_printf(const uint8_t* const p_buf, const size_t len)
+{
+    string str;
+    for (size_t i = 0; i < len; ++i)
+    {
+        char tmp[3];
+        (void)snprintf(tmp, sizeof(tmp), "%02X", p_buf[i]);
+        str += tmp;
+    }
+    return str;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestFmtFast, test_hex_all_byte_values) // NOLINT
+{
+    uint8_t bin_buf[256];
+    for (uint32_t i = 0; i < sizeof(bin_buf); ++i)
+    {
+        bin_buf[i] = (uint8_t)i;
+    }
+    char hex_buf[sizeof(bin_buf) * 2 + 1];
+    ASSERT_EQ(sizeof(bin_buf) * 2, fmt_fast_hex(hex_buf, sizeof(hex_buf), bin_buf, sizeof(bin_buf)));
+    ASSERT_EQ(test_hex_with_printf(bin_buf, sizeof(bin_buf)), string(hex_buf));
+}
+
+TEST_F(TestFmtFast, test_hex_empty) // NOLINT
+{
+    const uint8_t bin_buf[] = { 0x01 };
+    char          hex_buf[] = "XYZ";
+    ASSERT_EQ(0, fmt_fast_hex(hex_buf, sizeof(hex_buf), bin_buf, 0));
+    ASSERT_EQ(string(""), string(hex_buf));
+}
+
+TEST_F(TestFmtFast, test_hex_buffer_too_small) // NOLINT
+{
+    const uint8_t bin_buf[] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+    char          hex_buf[sizeof(bin_buf) * 2 + 1];
+
+    ASSERT_EQ(8, fmt_fast_hex(hex_buf, sizeof(hex_buf) - 1, bin_buf, sizeof(bin_buf)));
+    ASSERT_EQ(string("01020304"), string(hex_buf));
+
+    ASSERT_EQ(8, fmt_fast_hex(hex_buf, sizeof(hex_buf) - 2, bin_buf, sizeof(bin_buf)));
+    ASSERT_EQ(string("01020304"), string(hex_buf));
+
+    ASSERT_EQ(0, fmt_fast_hex(hex_buf, 2, bin_buf, sizeof(bin_buf)));
+    ASSERT_EQ(string(""), string(hex_buf));
+
+    hex_buf[0] = 'X';
+    ASSERT_EQ(0, fmt_fast_hex(hex_buf, 0, bin_buf, sizeof(bin_buf)));
+    ASSERT_EQ('X', hex_buf[0]);
+}
+
+TEST_F(TestFmtFast, test_mac_to_str) // NOLINT
+{
+    const mac_address_bin_t mac = { { 0xAA, 0xBB, 0xCC, 0x01, 0x02, 0xF3 } };
+    ASSERT_EQ(string("AA:BB:CC:01:02:F3"), string(fmt_fast_mac_to_str(&mac).str_buf));
+}
+
+TEST_F(TestFmtFast, test_mac_to_str_same_as_mac_address_to_str) // NOLINT
+{
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        const mac_address_bin_t mac = { {
+            (uint8_t)i,
+            (uint8_t)(i + 1),
+            (uint8_t)(i * 3),
+            (uint8_t)(255 - i),
+            (uint8_t)(i ^ 0x5AU),
+            (uint8_t)(i * 7),
+        } };
+        ASSERT_EQ(string(mac_address_to_str(&mac).str_buf), string(fmt_fast_mac_to_str(&mac).str_buf));
+    }
+}
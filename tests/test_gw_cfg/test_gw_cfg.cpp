@@ -376,6 +376,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_default) // NOLINT
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -511,6 +512,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_default_and_gw_cfg_stroage_is_ready) // NO
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -635,6 +637,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_default_with_http_custom) // NOLINT
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -748,6 +751,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_default_remote_enabled_auth_no) // NOLINT
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -871,6 +875,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_default_remote_enabled_auth_basic) // NOLI
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -989,6 +994,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_default_remote_enabled_auth_bearer) // NOL
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -1100,6 +1106,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_default_auto_update_cycle_beta_tester_and_
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -1210,6 +1217,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_default_auto_update_cycle_manual) // NOLIN
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -1320,6 +1328,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_default_auto_update_cycle_invalid) // NOLI
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -1436,6 +1445,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_ntp_changed) // NOLINT
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -1547,6 +1557,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_scan_non_default) // NOLINT
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -1660,6 +1671,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_scan_filter_1) // NOLINT
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -1776,6 +1788,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_scan_filter_2) // NOLINT
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -1891,6 +1904,7 @@ TEST_F(TestGwCfg, gw_cfg_print_to_log_fw_update_url) // NOLINT
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -0,0 +1,17 @@
+#ifndef ESP_CRC_H
+#define ESP_CRC_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t
+esp_crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ESP_CRC_H
@@ -0,0 +1,2093 @@
+/*
+ * Automatically generated file. DO NOT EDIT.
+ * Espressif IoT Development Framework (ESP-IDF) Configuration Header
+ */
+#pragma once
+#define CONFIG_IDF_TARGET_ESP32                        1
+#define CONFIG_IDF_CMAKE                               1
+#define CONFIG_IDF_TARGET                              "esp32"
+#define CONFIG_IDF_FIRMWARE_CHIP_ID                    0x0000
+#define CONFIG_SDK_TOOLPREFIX                          "xtensa-esp32-elf-"
+#define CONFIG_APP_COMPILE_TIME_DATE                   1
+#define CONFIG_APP_RETRIEVE_LEN_ELF_SHA                16
+#define CONFIG_BOOTLOADER_LOG_LEVEL_INFO               1
+#define CONFIG_BOOTLOADER_LOG_LEVEL                    3
+#define CONFIG_BOOTLOADER_VDDSDIO_BOOST_1_9V           1
+#define CONFIG_BOOTLOADER_WDT_ENABLE                   1
+#define CONFIG_BOOTLOADER_WDT_TIME_MS                  9000
+#define CONFIG_ESPTOOLPY_BAUD_OTHER_VAL                115200
+#define CONFIG_ESPTOOLPY_FLASHMODE_DIO                 1
+#define CONFIG_ESPTOOLPY_FLASHMODE                     "dio"
+#define CONFIG_ESPTOOLPY_FLASHFREQ_40M                 1
+#define CONFIG_ESPTOOLPY_FLASHFREQ                     "40m"
+#define CONFIG_ESPTOOLPY_FLASHSIZE_4MB                 1
+#define CONFIG_ESPTOOLPY_FLASHSIZE                     "4MB"
+#define CONFIG_ESPTOOLPY_FLASHSIZE_DETECT              1
+#define CONFIG_ESPTOOLPY_BEFORE_RESET                  1
+#define CONFIG_ESPTOOLPY_BEFORE                        "default_reset"
+#define CONFIG_ESPTOOLPY_AFTER_RESET                   1
+#define CONFIG_ESPTOOLPY_AFTER                         "hard_reset"
+#define CONFIG_ESPTOOLPY_MONITOR_BAUD_115200B          1
+#define CONFIG_ESPTOOLPY_MONITOR_BAUD_OTHER_VAL        115200
+#define CONFIG_ESPTOOLPY_MONITOR_BAUD                  115200
+#define CONFIG_PARTITION_TABLE_CUSTOM                  1
+#define CONFIG_PARTITION_TABLE_CUSTOM_FILENAME         "partitions.csv"
+#define CONFIG_PARTITION_TABLE_FILENAME                "partitions.csv"
+#define CONFIG_PARTITION_TABLE_OFFSET                  0x8000
+#define CONFIG_PARTITION_TABLE_MD5                     1
+#define CONFIG_COMPILER_OPTIMIZATION_LEVEL_DEBUG       1
+#define CONFIG_COMPILER_OPTIMIZATION_ASSERTIONS_ENABLE 1
+#define CONFIG_COMPILER_STACK_CHECK_MODE_NONE          1
+#define CONFIG_ESP32_APPTRACE_DEST_NONE                1
+#define CONFIG_ESP32_APPTRACE_LOCK_ENABLE              1
+#define CONFIG_BTDM_CTRL_BR_EDR_SCO_DATA_PATH_EFF      0
+#define CONFIG_BTDM_CTRL_BLE_MAX_CONN_EFF              0
+#define CONFIG_BTDM_CTRL_BR_EDR_MAX_ACL_CONN_EFF       0
+#define CONFIG_BTDM_CTRL_BR_EDR_MAX_SYNC_CONN_EFF      0
+#define CONFIG_BTDM_CTRL_PINNED_TO_CORE                0
+#define CONFIG_BTDM_BLE_SLEEP_CLOCK_ACCURACY_INDEX_EFF 1
+#define CONFIG_BT_RESERVE_DRAM                         0x0
+#define CONFIG_ADC_DISABLE_DAC                         1
+#define CONFIG_SPI_MASTER_ISR_IN_IRAM                  1
+#define CONFIG_SPI_SLAVE_ISR_IN_IRAM                   1
+#define CONFIG_EFUSE_CODE_SCHEME_COMPAT_3_4            1
+#define CONFIG_EFUSE_MAX_BLK_LEN                       192
+#define CONFIG_ESP32_REV_MIN_0                         1
+#define CONFIG_ESP32_REV_MIN                           0
+#define CONFIG_ESP32_DEFAULT_CPU_FREQ_160              1
+#define CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ              160
+#define CONFIG_ESP32_TRACEMEM_RESERVE_DRAM             0x0
+#define CONFIG_ESP32_UNIVERSAL_MAC_ADDRESSES_FOUR      1
+#define CONFIG_ESP32_UNIVERSAL_MAC_ADDRESSES           4
+#define CONFIG_ESP32_ULP_COPROC_RESERVE_MEM            0
+#define CONFIG_ESP32_PANIC_PRINT_REBOOT                1
+#define CONFIG_ESP32_DEBUG_OCDAWARE                    1
+#define CONFIG_ESP32_DEBUG_STUBS_ENABLE                1
+#define CONFIG_ESP32_BROWNOUT_DET                      1
+#define CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_0            1
+#define CONFIG_ESP32_BROWNOUT_DET_LVL                  0
+#define CONFIG_ESP32_REDUCE_PHY_TX_POWER               1
+#define CONFIG_ESP32_TIME_SYSCALL_USE_RTC_FRC1         1
+#define CONFIG_ESP32_RTC_CLK_SRC_INT_RC                1
+#define CONFIG_ESP32_RTC_CLK_CAL_CYCLES                1024
+#define CONFIG_ESP32_RTC_XTAL_CAL_RETRY                1
+#define CONFIG_ESP32_DEEP_SLEEP_WAKEUP_DELAY           2000
+#define CONFIG_ESP32_XTAL_FREQ_40                      1
+#define CONFIG_ESP32_XTAL_FREQ                         40
+#define CONFIG_ESP32_DPORT_DIS_INTERRUPT_LVL           5
+#define CONFIG_ADC_CAL_EFUSE_TP_ENABLE                 1
+#define CONFIG_ADC_CAL_EFUSE_VREF_ENABLE               1
+#define CONFIG_ADC_CAL_LUT_ENABLE                      1
+#define CONFIG_ESP_ERR_TO_NAME_LOOKUP                  1
+#define CONFIG_ESP_SYSTEM_EVENT_QUEUE_SIZE             32
+#define CONFIG_ESP_SYSTEM_EVENT_TASK_STACK_SIZE        2304
+#define CONFIG_ESP_MAIN_TASK_STACK_SIZE                3584
+#define CONFIG_ESP_IPC_TASK_STACK_SIZE                 1024
+#define CONFIG_ESP_TIMER_TASK_STACK_SIZE               3584
+#define CONFIG_ESP_CONSOLE_UART_DEFAULT                1
+#define CONFIG_ESP_CONSOLE_UART_NUM                    0
+#define CONFIG_ESP_CONSOLE_UART_BAUDRATE               115200
+#define CONFIG_ESP_INT_WDT                             1
+#define CONFIG_ESP_INT_WDT_TIMEOUT_MS                  300
+#define CONFIG_ESP_TASK_WDT                            1
+#define CONFIG_ESP_TASK_WDT_TIMEOUT_S                  5
+#define CONFIG_ESP_TASK_WDT_CHECK_IDLE_TASK_CPU0       1
+#define CONFIG_ETH_USE_ESP32_EMAC                      1
+#define CONFIG_ETH_PHY_INTERFACE_RMII                  1
+#define CONFIG_ETH_RMII_CLK_INPUT                      1
+#define CONFIG_ETH_RMII_CLK_IN_GPIO                    0
+#define CONFIG_ETH_DMA_BUFFER_SIZE                     512
+#define CONFIG_ETH_DMA_RX_BUFFER_NUM                   10
+#define CONFIG_ETH_DMA_TX_BUFFER_NUM                   10
+#define CONFIG_ETH_USE_SPI_ETHERNET                    1
+#define CONFIG_ETH_SPI_ETHERNET_DM9051                 1
+#define CONFIG_ESP_EVENT_POST_FROM_ISR                 1
+#define CONFIG_ESP_EVENT_POST_FROM_IRAM_ISR            1
+#define CONFIG_ESP_HTTP_CLIENT_ENABLE_HTTPS            1
+#define CONFIG_HTTPD_MAX_REQ_HDR_LEN                   512
+#define CONFIG_HTTPD_MAX_URI_LEN                       512
+#define CONFIG_HTTPD_ERR_RESP_NO_DELAY                 1
+#define CONFIG_HTTPD_PURGE_BUF_LEN                     32
+#define CONFIG_ESP32_WIFI_STATIC_RX_BUFFER_NUM         10
+#define CONFIG_ESP32_WIFI_DYNAMIC_RX_BUFFER_NUM        32
+#define CONFIG_ESP32_WIFI_DYNAMIC_TX_BUFFER            1
+#define CONFIG_ESP32_WIFI_TX_BUFFER_TYPE               1
+#define CONFIG_ESP32_WIFI_DYNAMIC_TX_BUFFER_NUM        32
+#define CONFIG_ESP32_WIFI_AMPDU_TX_ENABLED             1
+#define CONFIG_ESP32_WIFI_TX_BA_WIN                    6
+#define CONFIG_ESP32_WIFI_AMPDU_RX_ENABLED             1
+#define CONFIG_ESP32_WIFI_RX_BA_WIN                    6
+#define CONFIG_ESP32_WIFI_NVS_ENABLED                  1
+#define CONFIG_ESP32_WIFI_SOFTAP_BEACON_MAX_LEN        752
+#define CONFIG_ESP32_WIFI_MGMT_SBUF_NUM                32
+#define CONFIG_ESP32_WIFI_IRAM_OPT                     1
+#define CONFIG_ESP32_WIFI_RX_IRAM_OPT                  1
+#define CONFIG_ESP32_WIFI_ENABLE_WPA3_SAE              1
+#define CONFIG_ESP32_PHY_CALIBRATION_AND_DATA_STORAGE  1
+#define CONFIG_ESP32_PHY_MAX_WIFI_TX_POWER             20
+#define CONFIG_ESP32_PHY_MAX_TX_POWER                  20
+#define CONFIG_ESP32_ENABLE_COREDUMP_TO_NONE           1
+#define CONFIG_FATFS_CODEPAGE_437                      1
+#define CONFIG_FATFS_CODEPAGE                          437
+#define CONFIG_FATFS_LFN_HEAP                          1
+#define CONFIG_FATFS_MAX_LFN                           255
+#define CONFIG_FATFS_API_ENCODING_ANSI_OEM             1
+#define CONFIG_FATFS_FS_LOCK                           0
+#define CONFIG_FATFS_TIMEOUT_MS                        10000
+#define CONFIG_FMB_MASTER_TIMEOUT_MS_RESPOND           150
+#define CONFIG_FMB_MASTER_DELAY_MS_CONVERT             200
+#define CONFIG_FMB_QUEUE_LENGTH                        20
+#define CONFIG_FMB_SERIAL_TASK_STACK_SIZE              2048
+#define CONFIG_FMB_SERIAL_BUF_SIZE                     256
+#define CONFIG_FMB_SERIAL_TASK_PRIO                    10
+#define CONFIG_FMB_CONTROLLER_NOTIFY_TIMEOUT           20
+#define CONFIG_FMB_CONTROLLER_NOTIFY_QUEUE_SIZE        20
+#define CONFIG_FMB_CONTROLLER_STACK_SIZE               4096
+#define CONFIG_FMB_EVENT_QUEUE_TIMEOUT                 20
+#define CONFIG_FMB_TIMER_PORT_ENABLED                  1
+#define CONFIG_FMB_TIMER_GROUP                         0
+#define CONFIG_FMB_TIMER_INDEX                         0
+#define CONFIG_FREERTOS_UNICORE                        1
+#define CONFIG_FREERTOS_NO_AFFINITY                    0x7FFFFFFF
+#define CONFIG_FREERTOS_CORETIMER_0                    1
+#define CONFIG_FREERTOS_HZ                             100
+#define CONFIG_FREERTOS_ASSERT_ON_UNTESTED_FUNCTION    1
+#define CONFIG_FREERTOS_CHECK_STACKOVERFLOW_CANARY     1
+#define CONFIG_FREERTOS_INTERRUPT_BACKTRACE            1
+#define CONFIG_FREERTOS_THREAD_LOCAL_STORAGE_POINTERS  1
+#define CONFIG_FREERTOS_ASSERT_FAIL_ABORT              1
+#define CONFIG_FREERTOS_IDLE_TASK_STACKSIZE            1536
+#define CONFIG_FREERTOS_ISR_STACKSIZE                  1536
+#define CONFIG_FREERTOS_MAX_TASK_NAME_LEN              16
+#define CONFIG_FREERTOS_TIMER_TASK_PRIORITY            1
+#define CONFIG_FREERTOS_TIMER_TASK_STACK_DEPTH         2048
+#define CONFIG_FREERTOS_TIMER_QUEUE_LENGTH             10
+#define CONFIG_FREERTOS_QUEUE_REGISTRY_SIZE            0
+#define CONFIG_FREERTOS_TASK_FUNCTION_WRAPPER          1
+#define CONFIG_FREERTOS_CHECK_MUTEX_GIVEN_BY_OWNER     1
+#define CONFIG_HEAP_POISONING_DISABLED                 1
+#define CONFIG_HEAP_TRACING_OFF                        1
+#define CONFIG_LOG_DEFAULT_LEVEL_INFO                  1
+#define CONFIG_LOG_DEFAULT_LEVEL                       3
+#define CONFIG_LOG_COLORS                              1
+#define CONFIG_LWIP_LOCAL_HOSTNAME                     "espressif"
+#define CONFIG_LWIP_TIMERS_ONDEMAND                    1
+#define CONFIG_LWIP_MAX_SOCKETS                        10
+#define CONFIG_LWIP_SO_REUSE                           1
+#define CONFIG_LWIP_SO_REUSE_RXTOALL                   1
+#define CONFIG_LWIP_ESP_GRATUITOUS_ARP                 1
+#define CONFIG_LWIP_GARP_TMR_INTERVAL                  60
+#define CONFIG_LWIP_TCPIP_RECVMBOX_SIZE                32
+#define CONFIG_LWIP_DHCP_DOES_ARP_CHECK                1
+#define CONFIG_LWIP_DHCPS_LEASE_UNIT                   60
+#define CONFIG_LWIP_DHCPS_MAX_STATION_NUM              8
+#define CONFIG_LWIP_NETIF_LOOPBACK                     1
+#define CONFIG_LWIP_LOOPBACK_MAX_PBUFS                 8
+#define CONFIG_LWIP_MAX_ACTIVE_TCP                     16
+#define CONFIG_LWIP_MAX_LISTENING_TCP                  16
+#define CONFIG_LWIP_TCP_MAXRTX                         12
+#define CONFIG_LWIP_TCP_SYNMAXRTX                      6
+#define CONFIG_LWIP_TCP_MSS                            1440
+#define CONFIG_LWIP_TCP_MSL                            60000
+#define CONFIG_LWIP_TCP_SND_BUF_DEFAULT                5744
+#define CONFIG_LWIP_TCP_WND_DEFAULT                    5744
+#define CONFIG_LWIP_TCP_RECVMBOX_SIZE                  6
+#define CONFIG_LWIP_TCP_QUEUE_OOSEQ                    1
+#define CONFIG_LWIP_TCP_OVERSIZE_MSS                   1
+#define CONFIG_LWIP_MAX_UDP_PCBS                       16
+#define CONFIG_LWIP_UDP_RECVMBOX_SIZE                  6
+#define CONFIG_LWIP_TCPIP_TASK_STACK_SIZE              3072
+#define CONFIG_LWIP_TCPIP_TASK_AFFINITY_NO_AFFINITY    1
+#define CONFIG_LWIP_TCPIP_TASK_AFFINITY                0x7FFFFFFF
+#define CONFIG_LWIP_MAX_RAW_PCBS                       16
+#define CONFIG_LWIP_DHCP_MAX_NTP_SERVERS               1
+#define CONFIG_LWIP_SNTP_UPDATE_DELAY                  3600000
+#define CONFIG_MBEDTLS_INTERNAL_MEM_ALLOC              1
+#define CONFIG_MBEDTLS_ASYMMETRIC_CONTENT_LEN          1
+#define CONFIG_MBEDTLS_SSL_IN_CONTENT_LEN              16384
+#define CONFIG_MBEDTLS_SSL_OUT_CONTENT_LEN             4096
+#define CONFIG_MBEDTLS_HARDWARE_AES                    1
+#define CONFIG_MBEDTLS_HARDWARE_MPI                    1
+#define CONFIG_MBEDTLS_HARDWARE_SHA                    1
+#define CONFIG_MBEDTLS_HAVE_TIME                       1
+#define CONFIG_MBEDTLS_TLS_SERVER_AND_CLIENT           1
+#define CONFIG_MBEDTLS_TLS_SERVER                      1
+#define CONFIG_MBEDTLS_TLS_CLIENT                      1
+#define CONFIG_MBEDTLS_TLS_ENABLED                     1
+#define CONFIG_MBEDTLS_KEY_EXCHANGE_RSA                1
+#define CONFIG_MBEDTLS_KEY_EXCHANGE_DHE_RSA            1
+#define CONFIG_MBEDTLS_KEY_EXCHANGE_ELLIPTIC_CURVE     1
+#define CONFIG_MBEDTLS_KEY_EXCHANGE_ECDHE_RSA          1
+#define CONFIG_MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA        1
+#define CONFIG_MBEDTLS_KEY_EXCHANGE_ECDH_ECDSA         1
+#define CONFIG_MBEDTLS_KEY_EXCHANGE_ECDH_RSA           1
+#define CONFIG_MBEDTLS_SSL_RENEGOTIATION               1
+#define CONFIG_MBEDTLS_SSL_PROTO_TLS1                  1
+#define CONFIG_MBEDTLS_SSL_PROTO_TLS1_1                1
+#define CONFIG_MBEDTLS_SSL_PROTO_TLS1_2                1
+#define CONFIG_MBEDTLS_SSL_ALPN                        1
+#define CONFIG_MBEDTLS_CLIENT_SSL_SESSION_TICKETS      1
+#define CONFIG_MBEDTLS_SERVER_SSL_SESSION_TICKETS      1
+#define CONFIG_MBEDTLS_AES_C                           1
+#define CONFIG_MBEDTLS_RC4_DISABLED                    1
+#define CONFIG_MBEDTLS_CCM_C                           1
+#define CONFIG_MBEDTLS_GCM_C                           1
+#define CONFIG_MBEDTLS_PEM_PARSE_C                     1
+#define CONFIG_MBEDTLS_PEM_WRITE_C                     1
+#define CONFIG_MBEDTLS_X509_CRL_PARSE_C                1
+#define CONFIG_MBEDTLS_X509_CSR_PARSE_C                1
+#define CONFIG_MBEDTLS_ECP_C                           1
+#define CONFIG_MBEDTLS_ECDH_C                          1
+#define CONFIG_MBEDTLS_ECDSA_C                         1
+#define CONFIG_MBEDTLS_ECP_DP_SECP192R1_ENABLED        1
+#define CONFIG_MBEDTLS_ECP_DP_SECP224R1_ENABLED        1
+#define CONFIG_MBEDTLS_ECP_DP_SECP256R1_ENABLED        1
+#define CONFIG_MBEDTLS_ECP_DP_SECP384R1_ENABLED        1
+#define CONFIG_MBEDTLS_ECP_DP_SECP521R1_ENABLED        1
+#define CONFIG_MBEDTLS_ECP_DP_SECP192K1_ENABLED        1
+#define CONFIG_MBEDTLS_ECP_DP_SECP224K1_ENABLED        1
+#define CONFIG_MBEDTLS_ECP_DP_SECP256K1_ENABLED        1
+#define CONFIG_MBEDTLS_ECP_DP_BP256R1_ENABLED          1
+#define CONFIG_MBEDTLS_ECP_DP_BP384R1_ENABLED          1
+#define CONFIG_MBEDTLS_ECP_DP_BP512R1_ENABLED          1
+#define CONFIG_MBEDTLS_ECP_DP_CURVE25519_ENABLED       1
+#define CONFIG_MBEDTLS_ECP_NIST_OPTIM                  1
+#define CONFIG_MDNS_MAX_SERVICES                       10
+#define CONFIG_MQTT_PROTOCOL_311                       1
+#define CONFIG_MQTT_TRANSPORT_SSL                      1
+#define CONFIG_MQTT_TRANSPORT_WEBSOCKET                1
+#define CONFIG_MQTT_TRANSPORT_WEBSOCKET_SECURE         1
+#define CONFIG_NEWLIB_STDOUT_LINE_ENDING_CRLF          1
+#define CONFIG_NEWLIB_STDIN_LINE_ENDING_CR             1
+#define CONFIG_OPENSSL_ASSERT_EXIT                     1
+#define CONFIG_PTHREAD_TASK_PRIO_DEFAULT               5
+#define CONFIG_PTHREAD_TASK_STACK_SIZE_DEFAULT         3072
+#define CONFIG_PTHREAD_STACK_MIN                       768
+#define CONFIG_PTHREAD_TASK_CORE_DEFAULT               -1
+#define CONFIG_PTHREAD_TASK_NAME_DEFAULT               "pthread"
+#define CONFIG_SPI_FLASH_ROM_DRIVER_PATCH              1
+#define CONFIG_SPI_FLASH_DANGEROUS_WRITE_ABORTS        1
+#define CONFIG_SPI_FLASH_SUPPORT_ISSI_CHIP             1
+#define CONFIG_SPI_FLASH_SUPPORT_GD_CHIP               1
+#define CONFIG_SPIFFS_MAX_PARTITIONS                   3
+#define CONFIG_SPIFFS_CACHE                            1
+#define CONFIG_SPIFFS_CACHE_WR                         1
+#define CONFIG_SPIFFS_PAGE_CHECK                       1
+#define CONFIG_SPIFFS_GC_MAX_RUNS                      10
+#define CONFIG_SPIFFS_PAGE_SIZE                        256
+#define CONFIG_SPIFFS_OBJ_NAME_LEN                     32
+#define CONFIG_SPIFFS_USE_MAGIC                        1
+#define CONFIG_SPIFFS_USE_MAGIC_LENGTH                 1
+#define CONFIG_SPIFFS_META_LENGTH                      4
+#define CONFIG_SPIFFS_USE_MTIME                        1
+#define CONFIG_NETIF_IP_LOST_TIMER_INTERVAL            120
+#define CONFIG_TCPIP_LWIP                              1
+#define CONFIG_UNITY_ENABLE_FLOAT                      1
+#define CONFIG_UNITY_ENABLE_DOUBLE                     1
+#define CONFIG_UNITY_ENABLE_IDF_TEST_RUNNER            1
+#define CONFIG_VFS_SUPPRESS_SELECT_DEBUG_OUTPUT        1
+#define CONFIG_VFS_SUPPORT_TERMIOS                     1
+#define CONFIG_SEMIHOSTFS_MAX_MOUNT_POINTS             1
+#define CONFIG_SEMIHOSTFS_HOST_PATH_MAX_LEN            128
+#define CONFIG_WL_SECTOR_SIZE_512                      1
+#define CONFIG_WL_SECTOR_SIZE                          512
+#define CONFIG_WL_SECTOR_MODE_SAFE                     1
+#define CONFIG_WL_SECTOR_MODE                          1
+#define CONFIG_WIFI_PROV_SCAN_MAX_ENTRIES              16
+#define CONFIG_WIFI_PROV_AUTOSTOP_TIMEOUT              30
+#define CONFIG_WPA_MBEDTLS_CRYPTO                      1
+#define CONFIG_WIFI_MANAGER_TASK_PRIORITY              5
+#define CONFIG_WIFI_MANAGER_MAX_RETRY                  2
+#define CONFIG_DEFAULT_AP_SSID                         "RuuviGateway"
+#define CONFIG_DEFAULT_AP_PASSWORD                     ""
+#define CONFIG_DEFAULT_AP_CHANNEL                      1
+#define CONFIG_DEFAULT_AP_IP                           "10.10.0.1"
+#define CONFIG_DEFAULT_AP_GATEWAY                      "10.10.0.1"
+#define CONFIG_DEFAULT_AP_NETMASK                      "255.255.255.0"
+#define CONFIG_DEFAULT_AP_MAX_CONNECTIONS              4
+#define CONFIG_DEFAULT_AP_BEACON_INTERVAL              100
+
+/* List of deprecated options */
+#ifdef CONFIG_BT_A2DP_ENABLE
+#define CONFIG_A2DP_ENABLE CONFIG_BT_A2DP_ENABLE
+#endif
+
+#ifdef CONFIG_BT_LOG_A2D_TRACE_LEVEL
+#define CONFIG_A2D_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_A2D_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_A2D_TRACE_LEVEL_API
+#define CONFIG_A2D_TRACE_LEVEL_API CONFIG_BT_LOG_A2D_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_A2D_TRACE_LEVEL_DEBUG
+#define CONFIG_A2D_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_A2D_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_A2D_TRACE_LEVEL_ERROR
+#define CONFIG_A2D_TRACE_LEVEL_ERROR CONFIG_BT_LOG_A2D_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_A2D_TRACE_LEVEL_EVENT
+#define CONFIG_A2D_TRACE_LEVEL_EVENT CONFIG_BT_LOG_A2D_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_A2D_TRACE_LEVEL_NONE
+#define CONFIG_A2D_TRACE_LEVEL_NONE CONFIG_BT_LOG_A2D_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_A2D_TRACE_LEVEL_VERBOSE
+#define CONFIG_A2D_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_A2D_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_A2D_TRACE_LEVEL_WARNING
+#define CONFIG_A2D_TRACE_LEVEL_WARNING CONFIG_BT_LOG_A2D_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_ADC_DISABLE_DAC
+#define CONFIG_ADC2_DISABLE_DAC CONFIG_ADC_DISABLE_DAC
+#endif
+
+#ifdef CONFIG_BT_LOG_APPL_TRACE_LEVEL
+#define CONFIG_APPL_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_APPL_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_APPL_TRACE_LEVEL_API
+#define CONFIG_APPL_TRACE_LEVEL_API CONFIG_BT_LOG_APPL_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_APPL_TRACE_LEVEL_DEBUG
+#define CONFIG_APPL_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_APPL_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_APPL_TRACE_LEVEL_ERROR
+#define CONFIG_APPL_TRACE_LEVEL_ERROR CONFIG_BT_LOG_APPL_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_APPL_TRACE_LEVEL_EVENT
+#define CONFIG_APPL_TRACE_LEVEL_EVENT CONFIG_BT_LOG_APPL_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_APPL_TRACE_LEVEL_NONE
+#define CONFIG_APPL_TRACE_LEVEL_NONE CONFIG_BT_LOG_APPL_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_APPL_TRACE_LEVEL_VERBOSE
+#define CONFIG_APPL_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_APPL_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_APPL_TRACE_LEVEL_WARNING
+#define CONFIG_APPL_TRACE_LEVEL_WARNING CONFIG_BT_LOG_APPL_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BOOTLOADER_APP_ANTI_ROLLBACK
+#define CONFIG_APP_ANTI_ROLLBACK CONFIG_BOOTLOADER_APP_ANTI_ROLLBACK
+#endif
+
+#ifdef CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE
+#define CONFIG_APP_ROLLBACK_ENABLE CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE
+#endif
+
+#ifdef CONFIG_BOOTLOADER_APP_SECURE_VERSION
+#define CONFIG_APP_SECURE_VERSION CONFIG_BOOTLOADER_APP_SECURE_VERSION
+#endif
+
+#ifdef CONFIG_BOOTLOADER_APP_SEC_VER_SIZE_EFUSE_FIELD
+#define CONFIG_APP_SECURE_VERSION_SIZE_EFUSE_FIELD CONFIG_BOOTLOADER_APP_SEC_VER_SIZE_EFUSE_FIELD
+#endif
+
+#ifdef CONFIG_BT_LOG_AVCT_TRACE_LEVEL
+#define CONFIG_AVCT_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_AVCT_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_AVCT_TRACE_LEVEL_API
+#define CONFIG_AVCT_TRACE_LEVEL_API CONFIG_BT_LOG_AVCT_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_AVCT_TRACE_LEVEL_DEBUG
+#define CONFIG_AVCT_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_AVCT_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_AVCT_TRACE_LEVEL_ERROR
+#define CONFIG_AVCT_TRACE_LEVEL_ERROR CONFIG_BT_LOG_AVCT_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_AVCT_TRACE_LEVEL_EVENT
+#define CONFIG_AVCT_TRACE_LEVEL_EVENT CONFIG_BT_LOG_AVCT_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_AVCT_TRACE_LEVEL_NONE
+#define CONFIG_AVCT_TRACE_LEVEL_NONE CONFIG_BT_LOG_AVCT_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_AVCT_TRACE_LEVEL_VERBOSE
+#define CONFIG_AVCT_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_AVCT_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_AVCT_TRACE_LEVEL_WARNING
+#define CONFIG_AVCT_TRACE_LEVEL_WARNING CONFIG_BT_LOG_AVCT_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BT_LOG_AVDT_TRACE_LEVEL
+#define CONFIG_AVDT_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_AVDT_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_AVDT_TRACE_LEVEL_API
+#define CONFIG_AVDT_TRACE_LEVEL_API CONFIG_BT_LOG_AVDT_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_AVDT_TRACE_LEVEL_DEBUG
+#define CONFIG_AVDT_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_AVDT_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_AVDT_TRACE_LEVEL_ERROR
+#define CONFIG_AVDT_TRACE_LEVEL_ERROR CONFIG_BT_LOG_AVDT_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_AVDT_TRACE_LEVEL_EVENT
+#define CONFIG_AVDT_TRACE_LEVEL_EVENT CONFIG_BT_LOG_AVDT_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_AVDT_TRACE_LEVEL_NONE
+#define CONFIG_AVDT_TRACE_LEVEL_NONE CONFIG_BT_LOG_AVDT_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_AVDT_TRACE_LEVEL_VERBOSE
+#define CONFIG_AVDT_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_AVDT_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_AVDT_TRACE_LEVEL_WARNING
+#define CONFIG_AVDT_TRACE_LEVEL_WARNING CONFIG_BT_LOG_AVDT_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BT_LOG_AVRC_TRACE_LEVEL
+#define CONFIG_AVRC_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_AVRC_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_AVRC_TRACE_LEVEL_API
+#define CONFIG_AVRC_TRACE_LEVEL_API CONFIG_BT_LOG_AVRC_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_AVRC_TRACE_LEVEL_DEBUG
+#define CONFIG_AVRC_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_AVRC_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_AVRC_TRACE_LEVEL_ERROR
+#define CONFIG_AVRC_TRACE_LEVEL_ERROR CONFIG_BT_LOG_AVRC_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_AVRC_TRACE_LEVEL_EVENT
+#define CONFIG_AVRC_TRACE_LEVEL_EVENT CONFIG_BT_LOG_AVRC_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_AVRC_TRACE_LEVEL_NONE
+#define CONFIG_AVRC_TRACE_LEVEL_NONE CONFIG_BT_LOG_AVRC_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_AVRC_TRACE_LEVEL_VERBOSE
+#define CONFIG_AVRC_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_AVRC_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_AVRC_TRACE_LEVEL_WARNING
+#define CONFIG_AVRC_TRACE_LEVEL_WARNING CONFIG_BT_LOG_AVRC_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BT_BLE_ACT_SCAN_REP_ADV_SCAN
+#define CONFIG_BLE_ACTIVE_SCAN_REPORT_ADV_SCAN_RSP_INDIVIDUALLY CONFIG_BT_BLE_ACT_SCAN_REP_ADV_SCAN
+#endif
+
+#ifdef CONFIG_BTDM_BLE_ADV_REPORT_DISCARD_THRSHOLD
+#define CONFIG_BLE_ADV_REPORT_DISCARD_THRSHOLD CONFIG_BTDM_BLE_ADV_REPORT_DISCARD_THRSHOLD
+#endif
+
+#ifdef CONFIG_BTDM_BLE_ADV_REPORT_FLOW_CTRL_NUM
+#define CONFIG_BLE_ADV_REPORT_FLOW_CONTROL_NUM CONFIG_BTDM_BLE_ADV_REPORT_FLOW_CTRL_NUM
+#endif
+
+#ifdef CONFIG_BTDM_BLE_ADV_REPORT_FLOW_CTRL_SUPP
+#define CONFIG_BLE_ADV_REPORT_FLOW_CONTROL_SUPPORTED CONFIG_BTDM_BLE_ADV_REPORT_FLOW_CTRL_SUPP
+#endif
+
+#ifdef CONFIG_BT_BLE_ESTAB_LINK_CONN_TOUT
+#define CONFIG_BLE_ESTABLISH_LINK_CONNECTION_TIMEOUT CONFIG_BT_BLE_ESTAB_LINK_CONN_TOUT
+#endif
+
+#ifdef CONFIG_BT_BLE_HOST_QUEUE_CONG_CHECK
+#define CONFIG_BLE_HOST_QUEUE_CONGESTION_CHECK CONFIG_BT_BLE_HOST_QUEUE_CONG_CHECK
+#endif
+
+#ifdef CONFIG_BLE_MESH_GATT_PROXY_SERVER
+#define CONFIG_BLE_MESH_GATT_PROXY CONFIG_BLE_MESH_GATT_PROXY_SERVER
+#endif
+
+#ifdef CONFIG_BTDM_BLE_MESH_SCAN_DUPL_EN
+#define CONFIG_BLE_MESH_SCAN_DUPLICATE_EN CONFIG_BTDM_BLE_MESH_SCAN_DUPL_EN
+#endif
+
+#ifdef CONFIG_BTDM_BLE_SCAN_DUPL
+#define CONFIG_BLE_SCAN_DUPLICATE CONFIG_BTDM_BLE_SCAN_DUPL
+#endif
+
+#ifdef CONFIG_BT_BLE_SMP_ENABLE
+#define CONFIG_BLE_SMP_ENABLE CONFIG_BT_BLE_SMP_ENABLE
+#endif
+
+#ifdef CONFIG_BT_BLUEDROID_ENABLED
+#define CONFIG_BLUEDROID_ENABLED CONFIG_BT_BLUEDROID_ENABLED
+#endif
+
+#ifdef CONFIG_BT_BLUEDROID_MEM_DEBUG
+#define CONFIG_BLUEDROID_MEM_DEBUG CONFIG_BT_BLUEDROID_MEM_DEBUG
+#endif
+
+#ifdef CONFIG_BT_BLUEDROID_PINNED_TO_CORE
+#define CONFIG_BLUEDROID_PINNED_TO_CORE CONFIG_BT_BLUEDROID_PINNED_TO_CORE
+#endif
+
+#ifdef CONFIG_BT_BLUEDROID_PINNED_TO_CORE_0
+#define CONFIG_BLUEDROID_PINNED_TO_CORE_0 CONFIG_BT_BLUEDROID_PINNED_TO_CORE_0
+#endif
+
+#ifdef CONFIG_BT_BLUEDROID_PINNED_TO_CORE_1
+#define CONFIG_BLUEDROID_PINNED_TO_CORE_1 CONFIG_BT_BLUEDROID_PINNED_TO_CORE_1
+#endif
+
+#ifdef CONFIG_BT_BLUEDROID_PINNED_TO_CORE_CHOICE
+#define CONFIG_BLUEDROID_PINNED_TO_CORE_CHOICE CONFIG_BT_BLUEDROID_PINNED_TO_CORE_CHOICE
+#endif
+
+#ifdef CONFIG_BT_LOG_BLUFI_TRACE_LEVEL
+#define CONFIG_BLUFI_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_BLUFI_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_API
+#define CONFIG_BLUFI_TRACE_LEVEL_API CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_DEBUG
+#define CONFIG_BLUFI_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_ERROR
+#define CONFIG_BLUFI_TRACE_LEVEL_ERROR CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_EVENT
+#define CONFIG_BLUFI_TRACE_LEVEL_EVENT CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_NONE
+#define CONFIG_BLUFI_TRACE_LEVEL_NONE CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_VERBOSE
+#define CONFIG_BLUFI_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_WARNING
+#define CONFIG_BLUFI_TRACE_LEVEL_WARNING CONFIG_BT_LOG_BLUFI_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BT_LOG_BNEP_TRACE_LEVEL
+#define CONFIG_BNEP_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_BNEP_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET
+#define CONFIG_BROWNOUT_DET CONFIG_ESP32_BROWNOUT_DET
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL
+#define CONFIG_BROWNOUT_DET_LVL CONFIG_ESP32_BROWNOUT_DET_LVL
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL_SEL
+#define CONFIG_BROWNOUT_DET_LVL_SEL CONFIG_ESP32_BROWNOUT_DET_LVL_SEL
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_0
+#define CONFIG_BROWNOUT_DET_LVL_SEL_0 CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_0
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_1
+#define CONFIG_BROWNOUT_DET_LVL_SEL_1 CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_1
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_2
+#define CONFIG_BROWNOUT_DET_LVL_SEL_2 CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_2
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_3
+#define CONFIG_BROWNOUT_DET_LVL_SEL_3 CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_3
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_4
+#define CONFIG_BROWNOUT_DET_LVL_SEL_4 CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_4
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_5
+#define CONFIG_BROWNOUT_DET_LVL_SEL_5 CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_5
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_6
+#define CONFIG_BROWNOUT_DET_LVL_SEL_6 CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_6
+#endif
+
+#ifdef CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_7
+#define CONFIG_BROWNOUT_DET_LVL_SEL_7 CONFIG_ESP32_BROWNOUT_DET_LVL_SEL_7
+#endif
+
+#ifdef CONFIG_BT_LOG_BTC_TRACE_LEVEL
+#define CONFIG_BTC_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_BTC_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_BTC_TASK_STACK_SIZE
+#define CONFIG_BTC_TASK_STACK_SIZE CONFIG_BT_BTC_TASK_STACK_SIZE
+#endif
+
+#ifdef CONFIG_BT_LOG_BTC_TRACE_LEVEL_API
+#define CONFIG_BTC_TRACE_LEVEL_API CONFIG_BT_LOG_BTC_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_BTC_TRACE_LEVEL_DEBUG
+#define CONFIG_BTC_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_BTC_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_BTC_TRACE_LEVEL_ERROR
+#define CONFIG_BTC_TRACE_LEVEL_ERROR CONFIG_BT_LOG_BTC_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_BTC_TRACE_LEVEL_EVENT
+#define CONFIG_BTC_TRACE_LEVEL_EVENT CONFIG_BT_LOG_BTC_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_BTC_TRACE_LEVEL_NONE
+#define CONFIG_BTC_TRACE_LEVEL_NONE CONFIG_BT_LOG_BTC_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_BTC_TRACE_LEVEL_VERBOSE
+#define CONFIG_BTC_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_BTC_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_BTC_TRACE_LEVEL_WARNING
+#define CONFIG_BTC_TRACE_LEVEL_WARNING CONFIG_BT_LOG_BTC_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_BLE_MAX_CONN
+#define CONFIG_BTDM_CONTROLLER_BLE_MAX_CONN CONFIG_BTDM_CTRL_BLE_MAX_CONN
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_BLE_MAX_CONN_EFF
+#define CONFIG_BTDM_CONTROLLER_BLE_MAX_CONN_EFF CONFIG_BTDM_CTRL_BLE_MAX_CONN_EFF
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_BR_EDR_MAX_ACL_CONN
+#define CONFIG_BTDM_CONTROLLER_BR_EDR_MAX_ACL_CONN CONFIG_BTDM_CTRL_BR_EDR_MAX_ACL_CONN
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_BR_EDR_MAX_ACL_CONN_EFF
+#define CONFIG_BTDM_CONTROLLER_BR_EDR_MAX_ACL_CONN_EFF CONFIG_BTDM_CTRL_BR_EDR_MAX_ACL_CONN_EFF
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_BR_EDR_MAX_SYNC_CONN
+#define CONFIG_BTDM_CONTROLLER_BR_EDR_MAX_SYNC_CONN CONFIG_BTDM_CTRL_BR_EDR_MAX_SYNC_CONN
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_BR_EDR_MAX_SYNC_CONN_EFF
+#define CONFIG_BTDM_CONTROLLER_BR_EDR_MAX_SYNC_CONN_EFF CONFIG_BTDM_CTRL_BR_EDR_MAX_SYNC_CONN_EFF
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_FULL_SCAN_SUPPORTED
+#define CONFIG_BTDM_CONTROLLER_FULL_SCAN_SUPPORTED CONFIG_BTDM_CTRL_FULL_SCAN_SUPPORTED
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_HCI_MODE_CHOICE
+#define CONFIG_BTDM_CONTROLLER_HCI_MODE_CHOICE CONFIG_BTDM_CTRL_HCI_MODE_CHOICE
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_HCI_MODE_UART_H4
+#define CONFIG_BTDM_CONTROLLER_HCI_MODE_UART_H4 CONFIG_BTDM_CTRL_HCI_MODE_UART_H4
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_HCI_MODE_VHCI
+#define CONFIG_BTDM_CONTROLLER_HCI_MODE_VHCI CONFIG_BTDM_CTRL_HCI_MODE_VHCI
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_MODE
+#define CONFIG_BTDM_CONTROLLER_MODE CONFIG_BTDM_CTRL_MODE
+#endif
+
+#ifdef CONFIG_BTDM_MODEM_SLEEP
+#define CONFIG_BTDM_CONTROLLER_MODEM_SLEEP CONFIG_BTDM_MODEM_SLEEP
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_MODE_BLE_ONLY
+#define CONFIG_BTDM_CONTROLLER_MODE_BLE_ONLY CONFIG_BTDM_CTRL_MODE_BLE_ONLY
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_MODE_BR_EDR_ONLY
+#define CONFIG_BTDM_CONTROLLER_MODE_BR_EDR_ONLY CONFIG_BTDM_CTRL_MODE_BR_EDR_ONLY
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_MODE_BTDM
+#define CONFIG_BTDM_CONTROLLER_MODE_BTDM CONFIG_BTDM_CTRL_MODE_BTDM
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_PINNED_TO_CORE
+#define CONFIG_BTDM_CONTROLLER_PINNED_TO_CORE CONFIG_BTDM_CTRL_PINNED_TO_CORE
+#endif
+
+#ifdef CONFIG_BTDM_CTRL_PINNED_TO_CORE_CHOICE
+#define CONFIG_BTDM_CONTROLLER_PINNED_TO_CORE_CHOICE CONFIG_BTDM_CTRL_PINNED_TO_CORE_CHOICE
+#endif
+
+#ifdef CONFIG_BT_LOG_SDP_TRACE_LEVEL
+#define CONFIG_BTH_LOG_SDP_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_SDP_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_BTIF_TRACE_LEVEL
+#define CONFIG_BTIF_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_BTIF_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_BTIF_TRACE_LEVEL_API
+#define CONFIG_BTIF_TRACE_LEVEL_API CONFIG_BT_LOG_BTIF_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_BTIF_TRACE_LEVEL_DEBUG
+#define CONFIG_BTIF_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_BTIF_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_BTIF_TRACE_LEVEL_ERROR
+#define CONFIG_BTIF_TRACE_LEVEL_ERROR CONFIG_BT_LOG_BTIF_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_BTIF_TRACE_LEVEL_EVENT
+#define CONFIG_BTIF_TRACE_LEVEL_EVENT CONFIG_BT_LOG_BTIF_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_BTIF_TRACE_LEVEL_NONE
+#define CONFIG_BTIF_TRACE_LEVEL_NONE CONFIG_BT_LOG_BTIF_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_BTIF_TRACE_LEVEL_VERBOSE
+#define CONFIG_BTIF_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_BTIF_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_BTIF_TRACE_LEVEL_WARNING
+#define CONFIG_BTIF_TRACE_LEVEL_WARNING CONFIG_BT_LOG_BTIF_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BT_LOG_BTM_TRACE_LEVEL
+#define CONFIG_BTM_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_BTM_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_BTM_TRACE_LEVEL_API
+#define CONFIG_BTM_TRACE_LEVEL_API CONFIG_BT_LOG_BTM_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_BTM_TRACE_LEVEL_DEBUG
+#define CONFIG_BTM_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_BTM_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_BTM_TRACE_LEVEL_ERROR
+#define CONFIG_BTM_TRACE_LEVEL_ERROR CONFIG_BT_LOG_BTM_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_BTM_TRACE_LEVEL_EVENT
+#define CONFIG_BTM_TRACE_LEVEL_EVENT CONFIG_BT_LOG_BTM_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_BTM_TRACE_LEVEL_NONE
+#define CONFIG_BTM_TRACE_LEVEL_NONE CONFIG_BT_LOG_BTM_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_BTM_TRACE_LEVEL_VERBOSE
+#define CONFIG_BTM_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_BTM_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_BTM_TRACE_LEVEL_WARNING
+#define CONFIG_BTM_TRACE_LEVEL_WARNING CONFIG_BT_LOG_BTM_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BT_BTU_TASK_STACK_SIZE
+#define CONFIG_BTU_TASK_STACK_SIZE CONFIG_BT_BTU_TASK_STACK_SIZE
+#endif
+
+#ifdef CONFIG_BT_CLASSIC_ENABLED
+#define CONFIG_CLASSIC_BT_ENABLED CONFIG_BT_CLASSIC_ENABLED
+#endif
+
+#ifdef CONFIG_ESP32_COMPATIBLE_PRE_V2_1_BOOTLOADERS
+#define CONFIG_COMPATIBLE_PRE_V2_1_BOOTLOADERS CONFIG_ESP32_COMPATIBLE_PRE_V2_1_BOOTLOADERS
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART
+#define CONFIG_CONSOLE_UART CONFIG_ESP_CONSOLE_UART
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART_BAUDRATE
+#define CONFIG_CONSOLE_UART_BAUDRATE CONFIG_ESP_CONSOLE_UART_BAUDRATE
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART_CUSTOM
+#define CONFIG_CONSOLE_UART_CUSTOM CONFIG_ESP_CONSOLE_UART_CUSTOM
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART_CUSTOM_NUM_0
+#define CONFIG_CONSOLE_UART_CUSTOM_NUM_0 CONFIG_ESP_CONSOLE_UART_CUSTOM_NUM_0
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART_CUSTOM_NUM_1
+#define CONFIG_CONSOLE_UART_CUSTOM_NUM_1 CONFIG_ESP_CONSOLE_UART_CUSTOM_NUM_1
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART_DEFAULT
+#define CONFIG_CONSOLE_UART_DEFAULT CONFIG_ESP_CONSOLE_UART_DEFAULT
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART_NONE
+#define CONFIG_CONSOLE_UART_NONE CONFIG_ESP_CONSOLE_UART_NONE
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART_NUM
+#define CONFIG_CONSOLE_UART_NUM CONFIG_ESP_CONSOLE_UART_NUM
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART_RX_GPIO
+#define CONFIG_CONSOLE_UART_RX_GPIO CONFIG_ESP_CONSOLE_UART_RX_GPIO
+#endif
+
+#ifdef CONFIG_ESP_CONSOLE_UART_TX_GPIO
+#define CONFIG_CONSOLE_UART_TX_GPIO CONFIG_ESP_CONSOLE_UART_TX_GPIO
+#endif
+
+#ifdef CONFIG_COMPILER_CXX_EXCEPTIONS
+#define CONFIG_CXX_EXCEPTIONS CONFIG_COMPILER_CXX_EXCEPTIONS
+#endif
+
+#ifdef CONFIG_COMPILER_CXX_EXCEPTIONS_EMG_POOL_SIZE
+#define CONFIG_CXX_EXCEPTIONS_EMG_POOL_SIZE CONFIG_COMPILER_CXX_EXCEPTIONS_EMG_POOL_SIZE
+#endif
+
+#ifdef CONFIG_ESP32_DISABLE_BASIC_ROM_CONSOLE
+#define CONFIG_DISABLE_BASIC_ROM_CONSOLE CONFIG_ESP32_DISABLE_BASIC_ROM_CONSOLE
+#endif
+
+#ifdef CONFIG_COMPILER_DISABLE_GCC8_WARNINGS
+#define CONFIG_DISABLE_GCC8_WARNINGS CONFIG_COMPILER_DISABLE_GCC8_WARNINGS
+#endif
+
+#ifdef CONFIG_BTDM_SCAN_DUPL_CACHE_SIZE
+#define CONFIG_DUPLICATE_SCAN_CACHE_SIZE CONFIG_BTDM_SCAN_DUPL_CACHE_SIZE
+#endif
+
+#ifdef CONFIG_BOOTLOADER_EFUSE_SECURE_VERSION_EMULATE
+#define CONFIG_EFUSE_SECURE_VERSION_EMULATE CONFIG_BOOTLOADER_EFUSE_SECURE_VERSION_EMULATE
+#endif
+
+#ifdef CONFIG_FREERTOS_ENABLE_STATIC_TASK_CLEAN_UP
+#define CONFIG_ENABLE_STATIC_TASK_CLEAN_UP_HOOK CONFIG_FREERTOS_ENABLE_STATIC_TASK_CLEAN_UP
+#endif
+
+#ifdef CONFIG_ESP32_APPTRACE_POSTMORTEM_FLUSH_THRESH
+#define CONFIG_ESP32_APPTRACE_POSTMORTEM_FLUSH_TRAX_THRESH CONFIG_ESP32_APPTRACE_POSTMORTEM_FLUSH_THRESH
+#endif
+
+#ifdef CONFIG_PTHREAD_DEFAULT_CORE_0
+#define CONFIG_ESP32_DEFAULT_PTHREAD_CORE_0 CONFIG_PTHREAD_DEFAULT_CORE_0
+#endif
+
+#ifdef CONFIG_PTHREAD_DEFAULT_CORE_1
+#define CONFIG_ESP32_DEFAULT_PTHREAD_CORE_1 CONFIG_PTHREAD_DEFAULT_CORE_1
+#endif
+
+#ifdef CONFIG_PTHREAD_DEFAULT_CORE_NO_AFFINITY
+#define CONFIG_ESP32_DEFAULT_PTHREAD_CORE_NO_AFFINITY CONFIG_PTHREAD_DEFAULT_CORE_NO_AFFINITY
+#endif
+
+#ifdef CONFIG_PTHREAD_STACK_MIN
+#define CONFIG_ESP32_PTHREAD_STACK_MIN CONFIG_PTHREAD_STACK_MIN
+#endif
+
+#ifdef CONFIG_PTHREAD_TASK_CORE_DEFAULT
+#define CONFIG_ESP32_PTHREAD_TASK_CORE_DEFAULT CONFIG_PTHREAD_TASK_CORE_DEFAULT
+#endif
+
+#ifdef CONFIG_PTHREAD_TASK_NAME_DEFAULT
+#define CONFIG_ESP32_PTHREAD_TASK_NAME_DEFAULT CONFIG_PTHREAD_TASK_NAME_DEFAULT
+#endif
+
+#ifdef CONFIG_PTHREAD_TASK_PRIO_DEFAULT
+#define CONFIG_ESP32_PTHREAD_TASK_PRIO_DEFAULT CONFIG_PTHREAD_TASK_PRIO_DEFAULT
+#endif
+
+#ifdef CONFIG_PTHREAD_TASK_STACK_SIZE_DEFAULT
+#define CONFIG_ESP32_PTHREAD_TASK_STACK_SIZE_DEFAULT CONFIG_PTHREAD_TASK_STACK_SIZE_DEFAULT
+#endif
+
+#ifdef CONFIG_ESP32_RTC_CLK_SRC
+#define CONFIG_ESP32_RTC_CLOCK_SOURCE CONFIG_ESP32_RTC_CLK_SRC
+#endif
+
+#ifdef CONFIG_ESP32_RTC_CLK_SRC_EXT_CRYS
+#define CONFIG_ESP32_RTC_CLOCK_SOURCE_EXTERNAL_CRYSTAL CONFIG_ESP32_RTC_CLK_SRC_EXT_CRYS
+#endif
+
+#ifdef CONFIG_ESP32_RTC_CLK_SRC_EXT_OSC
+#define CONFIG_ESP32_RTC_CLOCK_SOURCE_EXTERNAL_OSC CONFIG_ESP32_RTC_CLK_SRC_EXT_OSC
+#endif
+
+#ifdef CONFIG_ESP32_RTC_CLK_SRC_INT_8MD256
+#define CONFIG_ESP32_RTC_CLOCK_SOURCE_INTERNAL_8MD256 CONFIG_ESP32_RTC_CLK_SRC_INT_8MD256
+#endif
+
+#ifdef CONFIG_ESP32_RTC_CLK_SRC_INT_RC
+#define CONFIG_ESP32_RTC_CLOCK_SOURCE_INTERNAL_RC CONFIG_ESP32_RTC_CLK_SRC_INT_RC
+#endif
+
+#ifdef CONFIG_ESP32_RTC_EXT_CRYST_ADDIT_CURRENT
+#define CONFIG_ESP32_RTC_EXTERNAL_CRYSTAL_ADDITIONAL_CURRENT CONFIG_ESP32_RTC_EXT_CRYST_ADDIT_CURRENT
+#endif
+
+#ifdef CONFIG_LWIP_ESP_GRATUITOUS_ARP
+#define CONFIG_ESP_GRATUITOUS_ARP CONFIG_LWIP_ESP_GRATUITOUS_ARP
+#endif
+
+#ifdef CONFIG_LWIP_TCP_KEEP_CONNECTION_WHEN_IP_CHANGES
+#define CONFIG_ESP_TCP_KEEP_CONNECTION_WHEN_IP_CHANGES CONFIG_LWIP_TCP_KEEP_CONNECTION_WHEN_IP_CHANGES
+#endif
+
+#ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
+#define CONFIG_EVENT_LOOP_PROFILING CONFIG_ESP_EVENT_LOOP_PROFILING
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_FLASHMODE_DIO
+#define CONFIG_FLASHMODE_DIO CONFIG_ESPTOOLPY_FLASHMODE_DIO
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_FLASHMODE_DOUT
+#define CONFIG_FLASHMODE_DOUT CONFIG_ESPTOOLPY_FLASHMODE_DOUT
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_FLASHMODE_QIO
+#define CONFIG_FLASHMODE_QIO CONFIG_ESPTOOLPY_FLASHMODE_QIO
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_FLASHMODE_QOUT
+#define CONFIG_FLASHMODE_QOUT CONFIG_ESPTOOLPY_FLASHMODE_QOUT
+#endif
+
+#ifdef CONFIG_SECURE_FLASH_ENC_ENABLED
+#define CONFIG_FLASH_ENCRYPTION_ENABLED CONFIG_SECURE_FLASH_ENC_ENABLED
+#endif
+
+#ifdef CONFIG_SECURE_FLASH_ENCRYPTION_MODE_DEVELOPMENT
+#define CONFIG_FLASH_ENCRYPTION_INSECURE CONFIG_SECURE_FLASH_ENCRYPTION_MODE_DEVELOPMENT
+#endif
+
+#ifdef CONFIG_SECURE_FLASH_UART_BOOTLOADER_ALLOW_CACHE
+#define CONFIG_FLASH_ENCRYPTION_UART_BOOTLOADER_ALLOW_CACHE CONFIG_SECURE_FLASH_UART_BOOTLOADER_ALLOW_CACHE
+#endif
+
+#ifdef CONFIG_SECURE_FLASH_UART_BOOTLOADER_ALLOW_DEC
+#define CONFIG_FLASH_ENCRYPTION_UART_BOOTLOADER_ALLOW_DECRYPT CONFIG_SECURE_FLASH_UART_BOOTLOADER_ALLOW_DEC
+#endif
+
+#ifdef CONFIG_SECURE_FLASH_UART_BOOTLOADER_ALLOW_ENC
+#define CONFIG_FLASH_ENCRYPTION_UART_BOOTLOADER_ALLOW_ENCRYPT CONFIG_SECURE_FLASH_UART_BOOTLOADER_ALLOW_ENC
+#endif
+
+#ifdef CONFIG_ESP32_UNIVERSAL_MAC_ADDRESSES_FOUR
+#define CONFIG_FOUR_UNIVERSAL_MAC_ADDRESS CONFIG_ESP32_UNIVERSAL_MAC_ADDRESSES_FOUR
+#endif
+
+#ifdef CONFIG_BT_LOG_GAP_TRACE_LEVEL
+#define CONFIG_GAP_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_GAP_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_GAP_TRACE_LEVEL_API
+#define CONFIG_GAP_TRACE_LEVEL_API CONFIG_BT_LOG_GAP_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_GAP_TRACE_LEVEL_DEBUG
+#define CONFIG_GAP_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_GAP_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_GAP_TRACE_LEVEL_ERROR
+#define CONFIG_GAP_TRACE_LEVEL_ERROR CONFIG_BT_LOG_GAP_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_GAP_TRACE_LEVEL_EVENT
+#define CONFIG_GAP_TRACE_LEVEL_EVENT CONFIG_BT_LOG_GAP_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_GAP_TRACE_LEVEL_NONE
+#define CONFIG_GAP_TRACE_LEVEL_NONE CONFIG_BT_LOG_GAP_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_GAP_TRACE_LEVEL_VERBOSE
+#define CONFIG_GAP_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_GAP_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_GAP_TRACE_LEVEL_WARNING
+#define CONFIG_GAP_TRACE_LEVEL_WARNING CONFIG_BT_LOG_GAP_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_LWIP_GARP_TMR_INTERVAL
+#define CONFIG_GARP_TMR_INTERVAL CONFIG_LWIP_GARP_TMR_INTERVAL
+#endif
+
+#ifdef CONFIG_BT_GATTC_CACHE_NVS_FLASH
+#define CONFIG_GATTC_CACHE_NVS_FLASH CONFIG_BT_GATTC_CACHE_NVS_FLASH
+#endif
+
+#ifdef CONFIG_BT_GATTC_ENABLE
+#define CONFIG_GATTC_ENABLE CONFIG_BT_GATTC_ENABLE
+#endif
+
+#ifdef CONFIG_BT_GATTS_ENABLE
+#define CONFIG_GATTS_ENABLE CONFIG_BT_GATTS_ENABLE
+#endif
+
+#ifdef CONFIG_BT_GATTS_SEND_SERVICE_CHANGE_AUTO
+#define CONFIG_GATTS_SEND_SERVICE_CHANGE_AUTO CONFIG_BT_GATTS_SEND_SERVICE_CHANGE_AUTO
+#endif
+
+#ifdef CONFIG_BT_GATTS_SEND_SERVICE_CHANGE_MANUAL
+#define CONFIG_GATTS_SEND_SERVICE_CHANGE_MANUAL CONFIG_BT_GATTS_SEND_SERVICE_CHANGE_MANUAL
+#endif
+
+#ifdef CONFIG_BT_GATTS_SEND_SERVICE_CHANGE_MODE
+#define CONFIG_GATTS_SEND_SERVICE_CHANGE_MODE CONFIG_BT_GATTS_SEND_SERVICE_CHANGE_MODE
+#endif
+
+#ifdef CONFIG_BT_LOG_GATT_TRACE_LEVEL
+#define CONFIG_GATT_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_GATT_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_GATT_TRACE_LEVEL_API
+#define CONFIG_GATT_TRACE_LEVEL_API CONFIG_BT_LOG_GATT_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_GATT_TRACE_LEVEL_DEBUG
+#define CONFIG_GATT_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_GATT_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_GATT_TRACE_LEVEL_ERROR
+#define CONFIG_GATT_TRACE_LEVEL_ERROR CONFIG_BT_LOG_GATT_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_GATT_TRACE_LEVEL_EVENT
+#define CONFIG_GATT_TRACE_LEVEL_EVENT CONFIG_BT_LOG_GATT_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_GATT_TRACE_LEVEL_NONE
+#define CONFIG_GATT_TRACE_LEVEL_NONE CONFIG_BT_LOG_GATT_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_GATT_TRACE_LEVEL_VERBOSE
+#define CONFIG_GATT_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_GATT_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_GATT_TRACE_LEVEL_WARNING
+#define CONFIG_GATT_TRACE_LEVEL_WARNING CONFIG_BT_LOG_GATT_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_ESP_GDBSTUB_MAX_TASKS
+#define CONFIG_GDBSTUB_MAX_TASKS CONFIG_ESP_GDBSTUB_MAX_TASKS
+#endif
+
+#ifdef CONFIG_ESP_GDBSTUB_SUPPORT_TASKS
+#define CONFIG_GDBSTUB_SUPPORT_TASKS CONFIG_ESP_GDBSTUB_SUPPORT_TASKS
+#endif
+
+#ifdef CONFIG_BT_LOG_HCI_TRACE_LEVEL
+#define CONFIG_HCI_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_HCI_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_HCI_TRACE_LEVEL_API
+#define CONFIG_HCI_TRACE_LEVEL_API CONFIG_BT_LOG_HCI_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_HCI_TRACE_LEVEL_DEBUG
+#define CONFIG_HCI_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_HCI_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_HCI_TRACE_LEVEL_ERROR
+#define CONFIG_HCI_TRACE_LEVEL_ERROR CONFIG_BT_LOG_HCI_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_HCI_TRACE_LEVEL_EVENT
+#define CONFIG_HCI_TRACE_LEVEL_EVENT CONFIG_BT_LOG_HCI_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_HCI_TRACE_LEVEL_NONE
+#define CONFIG_HCI_TRACE_LEVEL_NONE CONFIG_BT_LOG_HCI_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_HCI_TRACE_LEVEL_VERBOSE
+#define CONFIG_HCI_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_HCI_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_HCI_TRACE_LEVEL_WARNING
+#define CONFIG_HCI_TRACE_LEVEL_WARNING CONFIG_BT_LOG_HCI_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BT_HFP_AUDIO_DATA_PATH
+#define CONFIG_HFP_AUDIO_DATA_PATH CONFIG_BT_HFP_AUDIO_DATA_PATH
+#endif
+
+#ifdef CONFIG_BT_HFP_AUDIO_DATA_PATH_HCI
+#define CONFIG_HFP_AUDIO_DATA_PATH_HCI CONFIG_BT_HFP_AUDIO_DATA_PATH_HCI
+#endif
+
+#ifdef CONFIG_BT_HFP_AUDIO_DATA_PATH_PCM
+#define CONFIG_HFP_AUDIO_DATA_PATH_PCM CONFIG_BT_HFP_AUDIO_DATA_PATH_PCM
+#endif
+
+#ifdef CONFIG_BT_HFP_CLIENT_ENABLE
+#define CONFIG_HFP_CLIENT_ENABLE CONFIG_BT_HFP_CLIENT_ENABLE
+#endif
+
+#ifdef CONFIG_BT_HFP_ENABLE
+#define CONFIG_HFP_ENABLE CONFIG_BT_HFP_ENABLE
+#endif
+
+#ifdef CONFIG_BT_HFP_ROLE
+#define CONFIG_HFP_ROLE CONFIG_BT_HFP_ROLE
+#endif
+
+#ifdef CONFIG_BT_LOG_HID_TRACE_LEVEL
+#define CONFIG_HID_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_HID_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_HID_TRACE_LEVEL_API
+#define CONFIG_HID_TRACE_LEVEL_API CONFIG_BT_LOG_HID_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_HID_TRACE_LEVEL_DEBUG
+#define CONFIG_HID_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_HID_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_HID_TRACE_LEVEL_ERROR
+#define CONFIG_HID_TRACE_LEVEL_ERROR CONFIG_BT_LOG_HID_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_HID_TRACE_LEVEL_EVENT
+#define CONFIG_HID_TRACE_LEVEL_EVENT CONFIG_BT_LOG_HID_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_HID_TRACE_LEVEL_NONE
+#define CONFIG_HID_TRACE_LEVEL_NONE CONFIG_BT_LOG_HID_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_HID_TRACE_LEVEL_VERBOSE
+#define CONFIG_HID_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_HID_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_HID_TRACE_LEVEL_WARNING
+#define CONFIG_HID_TRACE_LEVEL_WARNING CONFIG_BT_LOG_HID_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_ESP_INT_WDT
+#define CONFIG_INT_WDT CONFIG_ESP_INT_WDT
+#endif
+
+#ifdef CONFIG_ESP_INT_WDT_CHECK_CPU1
+#define CONFIG_INT_WDT_CHECK_CPU1 CONFIG_ESP_INT_WDT_CHECK_CPU1
+#endif
+
+#ifdef CONFIG_ESP_INT_WDT_TIMEOUT_MS
+#define CONFIG_INT_WDT_TIMEOUT_MS CONFIG_ESP_INT_WDT_TIMEOUT_MS
+#endif
+
+#ifdef CONFIG_ESP_IPC_TASK_STACK_SIZE
+#define CONFIG_IPC_TASK_STACK_SIZE CONFIG_ESP_IPC_TASK_STACK_SIZE
+#endif
+
+#ifdef CONFIG_NETIF_IP_LOST_TIMER_INTERVAL
+#define CONFIG_IP_LOST_TIMER_INTERVAL CONFIG_NETIF_IP_LOST_TIMER_INTERVAL
+#endif
+
+#ifdef CONFIG_BT_LOG_L2CAP_TRACE_LEVEL
+#define CONFIG_L2CAP_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_L2CAP_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_API
+#define CONFIG_L2CAP_TRACE_LEVEL_API CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_DEBUG
+#define CONFIG_L2CAP_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_ERROR
+#define CONFIG_L2CAP_TRACE_LEVEL_ERROR CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_EVENT
+#define CONFIG_L2CAP_TRACE_LEVEL_EVENT CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_NONE
+#define CONFIG_L2CAP_TRACE_LEVEL_NONE CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_VERBOSE
+#define CONFIG_L2CAP_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_WARNING
+#define CONFIG_L2CAP_TRACE_LEVEL_WARNING CONFIG_BT_LOG_L2CAP_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_LWIP_L2_TO_L3_COPY
+#define CONFIG_L2_TO_L3_COPY CONFIG_LWIP_L2_TO_L3_COPY
+#endif
+
+#ifdef CONFIG_BOOTLOADER_LOG_LEVEL
+#define CONFIG_LOG_BOOTLOADER_LEVEL CONFIG_BOOTLOADER_LOG_LEVEL
+#endif
+
+#ifdef CONFIG_BOOTLOADER_LOG_LEVEL_DEBUG
+#define CONFIG_LOG_BOOTLOADER_LEVEL_DEBUG CONFIG_BOOTLOADER_LOG_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BOOTLOADER_LOG_LEVEL_ERROR
+#define CONFIG_LOG_BOOTLOADER_LEVEL_ERROR CONFIG_BOOTLOADER_LOG_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BOOTLOADER_LOG_LEVEL_INFO
+#define CONFIG_LOG_BOOTLOADER_LEVEL_INFO CONFIG_BOOTLOADER_LOG_LEVEL_INFO
+#endif
+
+#ifdef CONFIG_BOOTLOADER_LOG_LEVEL_NONE
+#define CONFIG_LOG_BOOTLOADER_LEVEL_NONE CONFIG_BOOTLOADER_LOG_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BOOTLOADER_LOG_LEVEL_VERBOSE
+#define CONFIG_LOG_BOOTLOADER_LEVEL_VERBOSE CONFIG_BOOTLOADER_LOG_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BOOTLOADER_LOG_LEVEL_WARN
+#define CONFIG_LOG_BOOTLOADER_LEVEL_WARN CONFIG_BOOTLOADER_LOG_LEVEL_WARN
+#endif
+
+#ifdef CONFIG_ESP_MAIN_TASK_STACK_SIZE
+#define CONFIG_MAIN_TASK_STACK_SIZE CONFIG_ESP_MAIN_TASK_STACK_SIZE
+#endif
+
+#ifdef CONFIG_SDK_MAKE_WARN_UNDEFINED_VARIABLES
+#define CONFIG_MAKE_WARN_UNDEFINED_VARIABLES CONFIG_SDK_MAKE_WARN_UNDEFINED_VARIABLES
+#endif
+
+#ifdef CONFIG_FMB_CONTROLLER_NOTIFY_QUEUE_SIZE
+#define CONFIG_MB_CONTROLLER_NOTIFY_QUEUE_SIZE CONFIG_FMB_CONTROLLER_NOTIFY_QUEUE_SIZE
+#endif
+
+#ifdef CONFIG_FMB_CONTROLLER_NOTIFY_TIMEOUT
+#define CONFIG_MB_CONTROLLER_NOTIFY_TIMEOUT CONFIG_FMB_CONTROLLER_NOTIFY_TIMEOUT
+#endif
+
+#ifdef CONFIG_FMB_CONTROLLER_SLAVE_ID
+#define CONFIG_MB_CONTROLLER_SLAVE_ID CONFIG_FMB_CONTROLLER_SLAVE_ID
+#endif
+
+#ifdef CONFIG_FMB_CONTROLLER_SLAVE_ID_SUPPORT
+#define CONFIG_MB_CONTROLLER_SLAVE_ID_SUPPORT CONFIG_FMB_CONTROLLER_SLAVE_ID_SUPPORT
+#endif
+
+#ifdef CONFIG_FMB_CONTROLLER_STACK_SIZE
+#define CONFIG_MB_CONTROLLER_STACK_SIZE CONFIG_FMB_CONTROLLER_STACK_SIZE
+#endif
+
+#ifdef CONFIG_FMB_EVENT_QUEUE_TIMEOUT
+#define CONFIG_MB_EVENT_QUEUE_TIMEOUT CONFIG_FMB_EVENT_QUEUE_TIMEOUT
+#endif
+
+#ifdef CONFIG_FMB_MASTER_DELAY_MS_CONVERT
+#define CONFIG_MB_MASTER_DELAY_MS_CONVERT CONFIG_FMB_MASTER_DELAY_MS_CONVERT
+#endif
+
+#ifdef CONFIG_FMB_MASTER_TIMEOUT_MS_RESPOND
+#define CONFIG_MB_MASTER_TIMEOUT_MS_RESPOND CONFIG_FMB_MASTER_TIMEOUT_MS_RESPOND
+#endif
+
+#ifdef CONFIG_FMB_QUEUE_LENGTH
+#define CONFIG_MB_QUEUE_LENGTH CONFIG_FMB_QUEUE_LENGTH
+#endif
+
+#ifdef CONFIG_FMB_SERIAL_BUF_SIZE
+#define CONFIG_MB_SERIAL_BUF_SIZE CONFIG_FMB_SERIAL_BUF_SIZE
+#endif
+
+#ifdef CONFIG_FMB_SERIAL_TASK_PRIO
+#define CONFIG_MB_SERIAL_TASK_PRIO CONFIG_FMB_SERIAL_TASK_PRIO
+#endif
+
+#ifdef CONFIG_FMB_SERIAL_TASK_STACK_SIZE
+#define CONFIG_MB_SERIAL_TASK_STACK_SIZE CONFIG_FMB_SERIAL_TASK_STACK_SIZE
+#endif
+
+#ifdef CONFIG_FMB_TIMER_GROUP
+#define CONFIG_MB_TIMER_GROUP CONFIG_FMB_TIMER_GROUP
+#endif
+
+#ifdef CONFIG_FMB_TIMER_INDEX
+#define CONFIG_MB_TIMER_INDEX CONFIG_FMB_TIMER_INDEX
+#endif
+
+#ifdef CONFIG_FMB_TIMER_PORT_ENABLED
+#define CONFIG_MB_TIMER_PORT_ENABLED CONFIG_FMB_TIMER_PORT_ENABLED
+#endif
+
+#ifdef CONFIG_BT_LOG_MCA_TRACE_LEVEL
+#define CONFIG_MCA_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_MCA_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_MCA_TRACE_LEVEL_API
+#define CONFIG_MCA_TRACE_LEVEL_API CONFIG_BT_LOG_MCA_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_MCA_TRACE_LEVEL_DEBUG
+#define CONFIG_MCA_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_MCA_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_MCA_TRACE_LEVEL_ERROR
+#define CONFIG_MCA_TRACE_LEVEL_ERROR CONFIG_BT_LOG_MCA_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_MCA_TRACE_LEVEL_EVENT
+#define CONFIG_MCA_TRACE_LEVEL_EVENT CONFIG_BT_LOG_MCA_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_MCA_TRACE_LEVEL_NONE
+#define CONFIG_MCA_TRACE_LEVEL_NONE CONFIG_BT_LOG_MCA_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_MCA_TRACE_LEVEL_VERBOSE
+#define CONFIG_MCA_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_MCA_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_MCA_TRACE_LEVEL_WARNING
+#define CONFIG_MCA_TRACE_LEVEL_WARNING CONFIG_BT_LOG_MCA_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_ESP32_MEMMAP_TRACEMEM
+#define CONFIG_MEMMAP_TRACEMEM CONFIG_ESP32_MEMMAP_TRACEMEM
+#endif
+
+#ifdef CONFIG_ESP32_MEMMAP_TRACEMEM_TWOBANKS
+#define CONFIG_MEMMAP_TRACEMEM_TWOBANKS CONFIG_ESP32_MEMMAP_TRACEMEM_TWOBANKS
+#endif
+
+#ifdef CONFIG_BTDM_MESH_DUPL_SCAN_CACHE_SIZE
+#define CONFIG_MESH_DUPLICATE_SCAN_CACHE_SIZE CONFIG_BTDM_MESH_DUPL_SCAN_CACHE_SIZE
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_MONITOR_BAUD
+#define CONFIG_MONITOR_BAUD CONFIG_ESPTOOLPY_MONITOR_BAUD
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_MONITOR_BAUD_115200B
+#define CONFIG_MONITOR_BAUD_115200B CONFIG_ESPTOOLPY_MONITOR_BAUD_115200B
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_MONITOR_BAUD_230400B
+#define CONFIG_MONITOR_BAUD_230400B CONFIG_ESPTOOLPY_MONITOR_BAUD_230400B
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_MONITOR_BAUD_2MB
+#define CONFIG_MONITOR_BAUD_2MB CONFIG_ESPTOOLPY_MONITOR_BAUD_2MB
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_MONITOR_BAUD_57600B
+#define CONFIG_MONITOR_BAUD_57600B CONFIG_ESPTOOLPY_MONITOR_BAUD_57600B
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_MONITOR_BAUD_921600B
+#define CONFIG_MONITOR_BAUD_921600B CONFIG_ESPTOOLPY_MONITOR_BAUD_921600B
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_MONITOR_BAUD_9600B
+#define CONFIG_MONITOR_BAUD_9600B CONFIG_ESPTOOLPY_MONITOR_BAUD_9600B
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_MONITOR_BAUD_OTHER
+#define CONFIG_MONITOR_BAUD_OTHER CONFIG_ESPTOOLPY_MONITOR_BAUD_OTHER
+#endif
+
+#ifdef CONFIG_ESPTOOLPY_MONITOR_BAUD_OTHER_VAL
+#define CONFIG_MONITOR_BAUD_OTHER_VAL CONFIG_ESPTOOLPY_MONITOR_BAUD_OTHER_VAL
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_ACL_BUF_COUNT
+#define CONFIG_NIMBLE_ACL_BUF_COUNT CONFIG_BT_NIMBLE_ACL_BUF_COUNT
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_ACL_BUF_SIZE
+#define CONFIG_NIMBLE_ACL_BUF_SIZE CONFIG_BT_NIMBLE_ACL_BUF_SIZE
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_ATT_PREFERRED_MTU
+#define CONFIG_NIMBLE_ATT_PREFERRED_MTU CONFIG_BT_NIMBLE_ATT_PREFERRED_MTU
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_CRYPTO_STACK_MBEDTLS
+#define CONFIG_NIMBLE_CRYPTO_STACK_MBEDTLS CONFIG_BT_NIMBLE_CRYPTO_STACK_MBEDTLS
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_DEBUG
+#define CONFIG_NIMBLE_DEBUG CONFIG_BT_NIMBLE_DEBUG
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_ENABLED
+#define CONFIG_NIMBLE_ENABLED CONFIG_BT_NIMBLE_ENABLED
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_GAP_DEVICE_NAME_MAX_LEN
+#define CONFIG_NIMBLE_GAP_DEVICE_NAME_MAX_LEN CONFIG_BT_NIMBLE_GAP_DEVICE_NAME_MAX_LEN
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_HCI_EVT_BUF_SIZE
+#define CONFIG_NIMBLE_HCI_EVT_BUF_SIZE CONFIG_BT_NIMBLE_HCI_EVT_BUF_SIZE
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_HCI_EVT_HI_BUF_COUNT
+#define CONFIG_NIMBLE_HCI_EVT_HI_BUF_COUNT CONFIG_BT_NIMBLE_HCI_EVT_HI_BUF_COUNT
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_HCI_EVT_LO_BUF_COUNT
+#define CONFIG_NIMBLE_HCI_EVT_LO_BUF_COUNT CONFIG_BT_NIMBLE_HCI_EVT_LO_BUF_COUNT
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_HS_FLOW_CTRL
+#define CONFIG_NIMBLE_HS_FLOW_CTRL CONFIG_BT_NIMBLE_HS_FLOW_CTRL
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_HS_FLOW_CTRL_ITVL
+#define CONFIG_NIMBLE_HS_FLOW_CTRL_ITVL CONFIG_BT_NIMBLE_HS_FLOW_CTRL_ITVL
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_HS_FLOW_CTRL_THRESH
+#define CONFIG_NIMBLE_HS_FLOW_CTRL_THRESH CONFIG_BT_NIMBLE_HS_FLOW_CTRL_THRESH
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_HS_FLOW_CTRL_TX_ON_DISCONNECT
+#define CONFIG_NIMBLE_HS_FLOW_CTRL_TX_ON_DISCONNECT CONFIG_BT_NIMBLE_HS_FLOW_CTRL_TX_ON_DISCONNECT
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_L2CAP_COC_MAX_NUM
+#define CONFIG_NIMBLE_L2CAP_COC_MAX_NUM CONFIG_BT_NIMBLE_L2CAP_COC_MAX_NUM
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MAX_BONDS
+#define CONFIG_NIMBLE_MAX_BONDS CONFIG_BT_NIMBLE_MAX_BONDS
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MAX_CCCDS
+#define CONFIG_NIMBLE_MAX_CCCDS CONFIG_BT_NIMBLE_MAX_CCCDS
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MAX_CONNECTIONS
+#define CONFIG_NIMBLE_MAX_CONNECTIONS CONFIG_BT_NIMBLE_MAX_CONNECTIONS
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MEM_ALLOC_MODE
+#define CONFIG_NIMBLE_MEM_ALLOC_MODE CONFIG_BT_NIMBLE_MEM_ALLOC_MODE
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MEM_ALLOC_MODE_DEFAULT
+#define CONFIG_NIMBLE_MEM_ALLOC_MODE_DEFAULT CONFIG_BT_NIMBLE_MEM_ALLOC_MODE_DEFAULT
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MEM_ALLOC_MODE_EXTERNAL
+#define CONFIG_NIMBLE_MEM_ALLOC_MODE_EXTERNAL CONFIG_BT_NIMBLE_MEM_ALLOC_MODE_EXTERNAL
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MEM_ALLOC_MODE_INTERNAL
+#define CONFIG_NIMBLE_MEM_ALLOC_MODE_INTERNAL CONFIG_BT_NIMBLE_MEM_ALLOC_MODE_INTERNAL
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH
+#define CONFIG_NIMBLE_MESH CONFIG_BT_NIMBLE_MESH
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH_DEVICE_NAME
+#define CONFIG_NIMBLE_MESH_DEVICE_NAME CONFIG_BT_NIMBLE_MESH_DEVICE_NAME
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH_FRIEND
+#define CONFIG_NIMBLE_MESH_FRIEND CONFIG_BT_NIMBLE_MESH_FRIEND
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH_GATT_PROXY
+#define CONFIG_NIMBLE_MESH_GATT_PROXY CONFIG_BT_NIMBLE_MESH_GATT_PROXY
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH_LOW_POWER
+#define CONFIG_NIMBLE_MESH_LOW_POWER CONFIG_BT_NIMBLE_MESH_LOW_POWER
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH_PB_ADV
+#define CONFIG_NIMBLE_MESH_PB_ADV CONFIG_BT_NIMBLE_MESH_PB_ADV
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH_PB_GATT
+#define CONFIG_NIMBLE_MESH_PB_GATT CONFIG_BT_NIMBLE_MESH_PB_GATT
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH_PROV
+#define CONFIG_NIMBLE_MESH_PROV CONFIG_BT_NIMBLE_MESH_PROV
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH_PROXY
+#define CONFIG_NIMBLE_MESH_PROXY CONFIG_BT_NIMBLE_MESH_PROXY
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MESH_RELAY
+#define CONFIG_NIMBLE_MESH_RELAY CONFIG_BT_NIMBLE_MESH_RELAY
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_MSYS1_BLOCK_COUNT
+#define CONFIG_NIMBLE_MSYS1_BLOCK_COUNT CONFIG_BT_NIMBLE_MSYS1_BLOCK_COUNT
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_NVS_PERSIST
+#define CONFIG_NIMBLE_NVS_PERSIST CONFIG_BT_NIMBLE_NVS_PERSIST
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_PINNED_TO_CORE
+#define CONFIG_NIMBLE_PINNED_TO_CORE CONFIG_BT_NIMBLE_PINNED_TO_CORE
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_PINNED_TO_CORE_0
+#define CONFIG_NIMBLE_PINNED_TO_CORE_0 CONFIG_BT_NIMBLE_PINNED_TO_CORE_0
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_PINNED_TO_CORE_1
+#define CONFIG_NIMBLE_PINNED_TO_CORE_1 CONFIG_BT_NIMBLE_PINNED_TO_CORE_1
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_PINNED_TO_CORE_CHOICE
+#define CONFIG_NIMBLE_PINNED_TO_CORE_CHOICE CONFIG_BT_NIMBLE_PINNED_TO_CORE_CHOICE
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_ROLE_BROADCASTER
+#define CONFIG_NIMBLE_ROLE_BROADCASTER CONFIG_BT_NIMBLE_ROLE_BROADCASTER
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_ROLE_CENTRAL
+#define CONFIG_NIMBLE_ROLE_CENTRAL CONFIG_BT_NIMBLE_ROLE_CENTRAL
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_ROLE_OBSERVER
+#define CONFIG_NIMBLE_ROLE_OBSERVER CONFIG_BT_NIMBLE_ROLE_OBSERVER
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
+#define CONFIG_NIMBLE_ROLE_PERIPHERAL CONFIG_BT_NIMBLE_ROLE_PERIPHERAL
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_RPA_TIMEOUT
+#define CONFIG_NIMBLE_RPA_TIMEOUT CONFIG_BT_NIMBLE_RPA_TIMEOUT
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_SM_LEGACY
+#define CONFIG_NIMBLE_SM_LEGACY CONFIG_BT_NIMBLE_SM_LEGACY
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_SM_SC
+#define CONFIG_NIMBLE_SM_SC CONFIG_BT_NIMBLE_SM_SC
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_SM_SC_DEBUG_KEYS
+#define CONFIG_NIMBLE_SM_SC_DEBUG_KEYS CONFIG_BT_NIMBLE_SM_SC_DEBUG_KEYS
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_SVC_GAP_APPEARANCE
+#define CONFIG_NIMBLE_SVC_GAP_APPEARANCE CONFIG_BT_NIMBLE_SVC_GAP_APPEARANCE
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_SVC_GAP_DEVICE_NAME
+#define CONFIG_NIMBLE_SVC_GAP_DEVICE_NAME CONFIG_BT_NIMBLE_SVC_GAP_DEVICE_NAME
+#endif
+
+#ifdef CONFIG_BT_NIMBLE_TASK_STACK_SIZE
+#define CONFIG_NIMBLE_TASK_STACK_SIZE CONFIG_BT_NIMBLE_TASK_STACK_SIZE
+#endif
+
+#ifdef CONFIG_ESP32_NO_BLOBS
+#define CONFIG_NO_BLOBS CONFIG_ESP32_NO_BLOBS
+#endif
+
+#ifdef CONFIG_ESP32_UNIVERSAL_MAC_ADDRESSES
+#define CONFIG_NUMBER_OF_UNIVERSAL_MAC_ADDRESS CONFIG_ESP32_UNIVERSAL_MAC_ADDRESSES
+#endif
+
+#ifdef CONFIG_COMPILER_OPTIMIZATION_ASSERTIONS_DISABLE
+#define CONFIG_OPTIMIZATION_ASSERTIONS_DISABLED CONFIG_COMPILER_OPTIMIZATION_ASSERTIONS_DISABLE
+#endif
+
+#ifdef CONFIG_COMPILER_OPTIMIZATION_ASSERTIONS_ENABLE
+#define CONFIG_OPTIMIZATION_ASSERTIONS_ENABLED CONFIG_COMPILER_OPTIMIZATION_ASSERTIONS_ENABLE
+#endif
+
+#ifdef CONFIG_COMPILER_OPTIMIZATION_ASSERTIONS_SILENT
+#define CONFIG_OPTIMIZATION_ASSERTIONS_SILENT CONFIG_COMPILER_OPTIMIZATION_ASSERTIONS_SILENT
+#endif
+
+#ifdef CONFIG_COMPILER_OPTIMIZATION_ASSERTION_LEVEL
+#define CONFIG_OPTIMIZATION_ASSERTION_LEVEL CONFIG_COMPILER_OPTIMIZATION_ASSERTION_LEVEL
+#endif
+
+#ifdef CONFIG_COMPILER_OPTIMIZATION
+#define CONFIG_OPTIMIZATION_COMPILER CONFIG_COMPILER_OPTIMIZATION
+#endif
+
+#ifdef CONFIG_COMPILER_OPTIMIZATION_LEVEL_DEBUG
+#define CONFIG_OPTIMIZATION_LEVEL_DEBUG CONFIG_COMPILER_OPTIMIZATION_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_COMPILER_OPTIMIZATION_LEVEL_RELEASE
+#define CONFIG_OPTIMIZATION_LEVEL_RELEASE CONFIG_COMPILER_OPTIMIZATION_LEVEL_RELEASE
+#endif
+
+#ifdef CONFIG_BT_LOG_OSI_TRACE_LEVEL
+#define CONFIG_OSI_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_OSI_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_OSI_TRACE_LEVEL_API
+#define CONFIG_OSI_TRACE_LEVEL_API CONFIG_BT_LOG_OSI_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_OSI_TRACE_LEVEL_DEBUG
+#define CONFIG_OSI_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_OSI_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_OSI_TRACE_LEVEL_ERROR
+#define CONFIG_OSI_TRACE_LEVEL_ERROR CONFIG_BT_LOG_OSI_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_OSI_TRACE_LEVEL_EVENT
+#define CONFIG_OSI_TRACE_LEVEL_EVENT CONFIG_BT_LOG_OSI_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_OSI_TRACE_LEVEL_NONE
+#define CONFIG_OSI_TRACE_LEVEL_NONE CONFIG_BT_LOG_OSI_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_OSI_TRACE_LEVEL_VERBOSE
+#define CONFIG_OSI_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_OSI_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_OSI_TRACE_LEVEL_WARNING
+#define CONFIG_OSI_TRACE_LEVEL_WARNING CONFIG_BT_LOG_OSI_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BT_LOG_PAN_TRACE_LEVEL
+#define CONFIG_PAN_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_PAN_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_PAN_TRACE_LEVEL_API
+#define CONFIG_PAN_TRACE_LEVEL_API CONFIG_BT_LOG_PAN_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_PAN_TRACE_LEVEL_DEBUG
+#define CONFIG_PAN_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_PAN_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_PAN_TRACE_LEVEL_ERROR
+#define CONFIG_PAN_TRACE_LEVEL_ERROR CONFIG_BT_LOG_PAN_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_PAN_TRACE_LEVEL_EVENT
+#define CONFIG_PAN_TRACE_LEVEL_EVENT CONFIG_BT_LOG_PAN_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_PAN_TRACE_LEVEL_NONE
+#define CONFIG_PAN_TRACE_LEVEL_NONE CONFIG_BT_LOG_PAN_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_PAN_TRACE_LEVEL_VERBOSE
+#define CONFIG_PAN_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_PAN_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_PAN_TRACE_LEVEL_WARNING
+#define CONFIG_PAN_TRACE_LEVEL_WARNING CONFIG_BT_LOG_PAN_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_ESP_EVENT_POST_FROM_IRAM_ISR
+#define CONFIG_POST_EVENTS_FROM_IRAM_ISR CONFIG_ESP_EVENT_POST_FROM_IRAM_ISR
+#endif
+
+#ifdef CONFIG_ESP_EVENT_POST_FROM_ISR
+#define CONFIG_POST_EVENTS_FROM_ISR CONFIG_ESP_EVENT_POST_FROM_ISR
+#endif
+
+#ifdef CONFIG_LWIP_PPP_CHAP_SUPPORT
+#define CONFIG_PPP_CHAP_SUPPORT CONFIG_LWIP_PPP_CHAP_SUPPORT
+#endif
+
+#ifdef CONFIG_LWIP_PPP_DEBUG_ON
+#define CONFIG_PPP_DEBUG_ON CONFIG_LWIP_PPP_DEBUG_ON
+#endif
+
+#ifdef CONFIG_LWIP_PPP_MPPE_SUPPORT
+#define CONFIG_PPP_MPPE_SUPPORT CONFIG_LWIP_PPP_MPPE_SUPPORT
+#endif
+
+#ifdef CONFIG_LWIP_PPP_MSCHAP_SUPPORT
+#define CONFIG_PPP_MSCHAP_SUPPORT CONFIG_LWIP_PPP_MSCHAP_SUPPORT
+#endif
+
+#ifdef CONFIG_LWIP_PPP_NOTIFY_PHASE_SUPPORT
+#define CONFIG_PPP_NOTIFY_PHASE_SUPPORT CONFIG_LWIP_PPP_NOTIFY_PHASE_SUPPORT
+#endif
+
+#ifdef CONFIG_LWIP_PPP_PAP_SUPPORT
+#define CONFIG_PPP_PAP_SUPPORT CONFIG_LWIP_PPP_PAP_SUPPORT
+#endif
+
+#ifdef CONFIG_LWIP_PPP_SUPPORT
+#define CONFIG_PPP_SUPPORT CONFIG_LWIP_PPP_SUPPORT
+#endif
+
+#ifdef CONFIG_SDK_PYTHON
+#define CONFIG_PYTHON CONFIG_SDK_PYTHON
+#endif
+
+#ifdef CONFIG_ESP32_REDUCE_PHY_TX_POWER
+#define CONFIG_REDUCE_PHY_TX_POWER CONFIG_ESP32_REDUCE_PHY_TX_POWER
+#endif
+
+#ifdef CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL
+#define CONFIG_RFCOMM_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_API
+#define CONFIG_RFCOMM_TRACE_LEVEL_API CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_DEBUG
+#define CONFIG_RFCOMM_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_ERROR
+#define CONFIG_RFCOMM_TRACE_LEVEL_ERROR CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_EVENT
+#define CONFIG_RFCOMM_TRACE_LEVEL_EVENT CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_NONE
+#define CONFIG_RFCOMM_TRACE_LEVEL_NONE CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_VERBOSE
+#define CONFIG_RFCOMM_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_WARNING
+#define CONFIG_RFCOMM_TRACE_LEVEL_WARNING CONFIG_BT_LOG_RFCOMM_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BTDM_SCAN_DUPL_TYPE_DATA
+#define CONFIG_SCAN_DUPLICATE_BY_ADV_DATA CONFIG_BTDM_SCAN_DUPL_TYPE_DATA
+#endif
+
+#ifdef CONFIG_BTDM_SCAN_DUPL_TYPE_DATA_DEVICE
+#define CONFIG_SCAN_DUPLICATE_BY_ADV_DATA_AND_DEVICE_ADDR CONFIG_BTDM_SCAN_DUPL_TYPE_DATA_DEVICE
+#endif
+
+#ifdef CONFIG_BTDM_SCAN_DUPL_TYPE_DEVICE
+#define CONFIG_SCAN_DUPLICATE_BY_DEVICE_ADDR CONFIG_BTDM_SCAN_DUPL_TYPE_DEVICE
+#endif
+
+#ifdef CONFIG_BTDM_SCAN_DUPL_TYPE
+#define CONFIG_SCAN_DUPLICATE_TYPE CONFIG_BTDM_SCAN_DUPL_TYPE
+#endif
+
+#ifdef CONFIG_BT_LOG_SDP_TRACE_LEVEL_API
+#define CONFIG_SDP_TRACE_LEVEL_API CONFIG_BT_LOG_SDP_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_SDP_TRACE_LEVEL_DEBUG
+#define CONFIG_SDP_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_SDP_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_SDP_TRACE_LEVEL_ERROR
+#define CONFIG_SDP_TRACE_LEVEL_ERROR CONFIG_BT_LOG_SDP_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_SDP_TRACE_LEVEL_EVENT
+#define CONFIG_SDP_TRACE_LEVEL_EVENT CONFIG_BT_LOG_SDP_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_SDP_TRACE_LEVEL_NONE
+#define CONFIG_SDP_TRACE_LEVEL_NONE CONFIG_BT_LOG_SDP_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_SDP_TRACE_LEVEL_VERBOSE
+#define CONFIG_SDP_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_SDP_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_SDP_TRACE_LEVEL_WARNING
+#define CONFIG_SDP_TRACE_LEVEL_WARNING CONFIG_BT_LOG_SDP_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_BT_SMP_ENABLE
+#define CONFIG_SMP_ENABLE CONFIG_BT_SMP_ENABLE
+#endif
+
+#ifdef CONFIG_BT_LOG_SMP_TRACE_LEVEL
+#define CONFIG_SMP_INITIAL_TRACE_LEVEL CONFIG_BT_LOG_SMP_TRACE_LEVEL
+#endif
+
+#ifdef CONFIG_BT_SMP_SLAVE_CON_PARAMS_UPD_ENABLE
+#define CONFIG_SMP_SLAVE_CON_PARAMS_UPD_ENABLE CONFIG_BT_SMP_SLAVE_CON_PARAMS_UPD_ENABLE
+#endif
+
+#ifdef CONFIG_BT_LOG_SMP_TRACE_LEVEL_API
+#define CONFIG_SMP_TRACE_LEVEL_API CONFIG_BT_LOG_SMP_TRACE_LEVEL_API
+#endif
+
+#ifdef CONFIG_BT_LOG_SMP_TRACE_LEVEL_DEBUG
+#define CONFIG_SMP_TRACE_LEVEL_DEBUG CONFIG_BT_LOG_SMP_TRACE_LEVEL_DEBUG
+#endif
+
+#ifdef CONFIG_BT_LOG_SMP_TRACE_LEVEL_ERROR
+#define CONFIG_SMP_TRACE_LEVEL_ERROR CONFIG_BT_LOG_SMP_TRACE_LEVEL_ERROR
+#endif
+
+#ifdef CONFIG_BT_LOG_SMP_TRACE_LEVEL_EVENT
+#define CONFIG_SMP_TRACE_LEVEL_EVENT CONFIG_BT_LOG_SMP_TRACE_LEVEL_EVENT
+#endif
+
+#ifdef CONFIG_BT_LOG_SMP_TRACE_LEVEL_NONE
+#define CONFIG_SMP_TRACE_LEVEL_NONE CONFIG_BT_LOG_SMP_TRACE_LEVEL_NONE
+#endif
+
+#ifdef CONFIG_BT_LOG_SMP_TRACE_LEVEL_VERBOSE
+#define CONFIG_SMP_TRACE_LEVEL_VERBOSE CONFIG_BT_LOG_SMP_TRACE_LEVEL_VERBOSE
+#endif
+
+#ifdef CONFIG_BT_LOG_SMP_TRACE_LEVEL_WARNING
+#define CONFIG_SMP_TRACE_LEVEL_WARNING CONFIG_BT_LOG_SMP_TRACE_LEVEL_WARNING
+#endif
+
+#ifdef CONFIG_ESP32_SPIRAM_SUPPORT
+#define CONFIG_SPIRAM_SUPPORT CONFIG_ESP32_SPIRAM_SUPPORT
+#endif
+
+#ifdef CONFIG_SPI_FLASH_DANGEROUS_WRITE
+#define CONFIG_SPI_FLASH_WRITING_DANGEROUS_REGIONS CONFIG_SPI_FLASH_DANGEROUS_WRITE
+#endif
+
+#ifdef CONFIG_SPI_FLASH_DANGEROUS_WRITE_ABORTS
+#define CONFIG_SPI_FLASH_WRITING_DANGEROUS_REGIONS_ABORTS CONFIG_SPI_FLASH_DANGEROUS_WRITE_ABORTS
+#endif
+
+#ifdef CONFIG_SPI_FLASH_DANGEROUS_WRITE_ALLOWED
+#define CONFIG_SPI_FLASH_WRITING_DANGEROUS_REGIONS_ALLOWED CONFIG_SPI_FLASH_DANGEROUS_WRITE_ALLOWED
+#endif
+
+#ifdef CONFIG_SPI_FLASH_DANGEROUS_WRITE_FAILS
+#define CONFIG_SPI_FLASH_WRITING_DANGEROUS_REGIONS_FAILS CONFIG_SPI_FLASH_DANGEROUS_WRITE_FAILS
+#endif
+
+#ifdef CONFIG_COMPILER_STACK_CHECK
+#define CONFIG_STACK_CHECK CONFIG_COMPILER_STACK_CHECK
+#endif
+
+#ifdef CONFIG_COMPILER_STACK_CHECK_MODE_ALL
+#define CONFIG_STACK_CHECK_ALL CONFIG_COMPILER_STACK_CHECK_MODE_ALL
+#endif
+
+#ifdef CONFIG_COMPILER_STACK_CHECK_MODE
+#define CONFIG_STACK_CHECK_MODE CONFIG_COMPILER_STACK_CHECK_MODE
+#endif
+
+#ifdef CONFIG_COMPILER_STACK_CHECK_MODE_NONE
+#define CONFIG_STACK_CHECK_NONE CONFIG_COMPILER_STACK_CHECK_MODE_NONE
+#endif
+
+#ifdef CONFIG_COMPILER_STACK_CHECK_MODE_NORM
+#define CONFIG_STACK_CHECK_NORM CONFIG_COMPILER_STACK_CHECK_MODE_NORM
+#endif
+
+#ifdef CONFIG_COMPILER_STACK_CHECK_MODE_STRONG
+#define CONFIG_STACK_CHECK_STRONG CONFIG_COMPILER_STACK_CHECK_MODE_STRONG
+#endif
+
+#ifdef CONFIG_FREERTOS_SUPPORT_STATIC_ALLOCATION
+#define CONFIG_SUPPORT_STATIC_ALLOCATION CONFIG_FREERTOS_SUPPORT_STATIC_ALLOCATION
+#endif
+
+#ifdef CONFIG_VFS_SUPPORT_TERMIOS
+#define CONFIG_SUPPORT_TERMIOS CONFIG_VFS_SUPPORT_TERMIOS
+#endif
+
+#ifdef CONFIG_VFS_SUPPRESS_SELECT_DEBUG_OUTPUT
+#define CONFIG_SUPPRESS_SELECT_DEBUG_OUTPUT CONFIG_VFS_SUPPRESS_SELECT_DEBUG_OUTPUT
+#endif
+
+#ifdef CONFIG_ESP32_WIFI_SW_COEXIST_ENABLE
+#define CONFIG_SW_COEXIST_ENABLE CONFIG_ESP32_WIFI_SW_COEXIST_ENABLE
+#endif
+
+#ifdef CONFIG_ESP_SYSTEM_EVENT_QUEUE_SIZE
+#define CONFIG_SYSTEM_EVENT_QUEUE_SIZE CONFIG_ESP_SYSTEM_EVENT_QUEUE_SIZE
+#endif
+
+#ifdef CONFIG_ESP_SYSTEM_EVENT_TASK_STACK_SIZE
+#define CONFIG_SYSTEM_EVENT_TASK_STACK_SIZE CONFIG_ESP_SYSTEM_EVENT_TASK_STACK_SIZE
+#endif
+
+#ifdef CONFIG_ESP_TASK_WDT
+#define CONFIG_TASK_WDT CONFIG_ESP_TASK_WDT
+#endif
+
+#ifdef CONFIG_ESP_TASK_WDT_CHECK_IDLE_TASK_CPU0
+#define CONFIG_TASK_WDT_CHECK_IDLE_TASK_CPU0 CONFIG_ESP_TASK_WDT_CHECK_IDLE_TASK_CPU0
+#endif
+
+#ifdef CONFIG_ESP_TASK_WDT_CHECK_IDLE_TASK_CPU1
+#define CONFIG_TASK_WDT_CHECK_IDLE_TASK_CPU1 CONFIG_ESP_TASK_WDT_CHECK_IDLE_TASK_CPU1
+#endif
+
+#ifdef CONFIG_ESP_TASK_WDT_PANIC
+#define CONFIG_TASK_WDT_PANIC CONFIG_ESP_TASK_WDT_PANIC
+#endif
+
+#ifdef CONFIG_ESP_TASK_WDT_TIMEOUT_S
+#define CONFIG_TASK_WDT_TIMEOUT_S CONFIG_ESP_TASK_WDT_TIMEOUT_S
+#endif
+
+#ifdef CONFIG_LWIP_TCPIP_RECVMBOX_SIZE
+#define CONFIG_TCPIP_RECVMBOX_SIZE CONFIG_LWIP_TCPIP_RECVMBOX_SIZE
+#endif
+
+#ifdef CONFIG_LWIP_TCPIP_TASK_AFFINITY
+#define CONFIG_TCPIP_TASK_AFFINITY CONFIG_LWIP_TCPIP_TASK_AFFINITY
+#endif
+
+#ifdef CONFIG_LWIP_TCPIP_TASK_AFFINITY_CPU0
+#define CONFIG_TCPIP_TASK_AFFINITY_CPU0 CONFIG_LWIP_TCPIP_TASK_AFFINITY_CPU0
+#endif
+
+#ifdef CONFIG_LWIP_TCPIP_TASK_AFFINITY_CPU1
+#define CONFIG_TCPIP_TASK_AFFINITY_CPU1 CONFIG_LWIP_TCPIP_TASK_AFFINITY_CPU1
+#endif
+
+#ifdef CONFIG_LWIP_TCPIP_TASK_AFFINITY_NO_AFFINITY
+#define CONFIG_TCPIP_TASK_AFFINITY_NO_AFFINITY CONFIG_LWIP_TCPIP_TASK_AFFINITY_NO_AFFINITY
+#endif
+
+#ifdef CONFIG_LWIP_TCPIP_TASK_STACK_SIZE
+#define CONFIG_TCPIP_TASK_STACK_SIZE CONFIG_LWIP_TCPIP_TASK_STACK_SIZE
+#endif
+
+#ifdef CONFIG_LWIP_TCP_MAXRTX
+#define CONFIG_TCP_MAXRTX CONFIG_LWIP_TCP_MAXRTX
+#endif
+
+#ifdef CONFIG_LWIP_TCP_MSL
+#define CONFIG_TCP_MSL CONFIG_LWIP_TCP_MSL
+#endif
+
+#ifdef CONFIG_LWIP_TCP_MSS
+#define CONFIG_TCP_MSS CONFIG_LWIP_TCP_MSS
+#endif
+
+#ifdef CONFIG_LWIP_TCP_OVERSIZE
+#define CONFIG_TCP_OVERSIZE CONFIG_LWIP_TCP_OVERSIZE
+#endif
+
+#ifdef CONFIG_LWIP_TCP_OVERSIZE_DISABLE
+#define CONFIG_TCP_OVERSIZE_DISABLE CONFIG_LWIP_TCP_OVERSIZE_DISABLE
+#endif
+
+#ifdef CONFIG_LWIP_TCP_OVERSIZE_MSS
+#define CONFIG_TCP_OVERSIZE_MSS CONFIG_LWIP_TCP_OVERSIZE_MSS
+#endif
+
+#ifdef CONFIG_LWIP_TCP_OVERSIZE_QUARTER_MSS
+#define CONFIG_TCP_OVERSIZE_QUARTER_MSS CONFIG_LWIP_TCP_OVERSIZE_QUARTER_MSS
+#endif
+
+#ifdef CONFIG_LWIP_TCP_QUEUE_OOSEQ
+#define CONFIG_TCP_QUEUE_OOSEQ CONFIG_LWIP_TCP_QUEUE_OOSEQ
+#endif
+
+#ifdef CONFIG_LWIP_TCP_RECVMBOX_SIZE
+#define CONFIG_TCP_RECVMBOX_SIZE CONFIG_LWIP_TCP_RECVMBOX_SIZE
+#endif
+
+#ifdef CONFIG_LWIP_TCP_SND_BUF_DEFAULT
+#define CONFIG_TCP_SND_BUF_DEFAULT CONFIG_LWIP_TCP_SND_BUF_DEFAULT
+#endif
+
+#ifdef CONFIG_LWIP_TCP_SYNMAXRTX
+#define CONFIG_TCP_SYNMAXRTX CONFIG_LWIP_TCP_SYNMAXRTX
+#endif
+
+#ifdef CONFIG_LWIP_TCP_WND_DEFAULT
+#define CONFIG_TCP_WND_DEFAULT CONFIG_LWIP_TCP_WND_DEFAULT
+#endif
+
+#ifdef CONFIG_FREERTOS_TIMER_QUEUE_LENGTH
+#define CONFIG_TIMER_QUEUE_LENGTH CONFIG_FREERTOS_TIMER_QUEUE_LENGTH
+#endif
+
+#ifdef CONFIG_FREERTOS_TIMER_TASK_PRIORITY
+#define CONFIG_TIMER_TASK_PRIORITY CONFIG_FREERTOS_TIMER_TASK_PRIORITY
+#endif
+
+#ifdef CONFIG_FREERTOS_TIMER_TASK_STACK_DEPTH
+#define CONFIG_TIMER_TASK_STACK_DEPTH CONFIG_FREERTOS_TIMER_TASK_STACK_DEPTH
+#endif
+
+#ifdef CONFIG_ESP_TIMER_TASK_STACK_SIZE
+#define CONFIG_TIMER_TASK_STACK_SIZE CONFIG_ESP_TIMER_TASK_STACK_SIZE
+#endif
+
+#ifdef CONFIG_SDK_TOOLPREFIX
+#define CONFIG_TOOLPREFIX CONFIG_SDK_TOOLPREFIX
+#endif
+
+#ifdef CONFIG_ESP32_TRACEMEM_RESERVE_DRAM
+#define CONFIG_TRACEMEM_RESERVE_DRAM CONFIG_ESP32_TRACEMEM_RESERVE_DRAM
+#endif
+
+#ifdef CONFIG_ESP32_UNIVERSAL_MAC_ADDRESSES_TWO
+#define CONFIG_TWO_UNIVERSAL_MAC_ADDRESS CONFIG_ESP32_UNIVERSAL_MAC_ADDRESSES_TWO
+#endif
+
+#ifdef CONFIG_LWIP_UDP_RECVMBOX_SIZE
+#define CONFIG_UDP_RECVMBOX_SIZE CONFIG_LWIP_UDP_RECVMBOX_SIZE
+#endif
+
+#ifdef CONFIG_ESP32_ULP_COPROC_ENABLED
+#define CONFIG_ULP_COPROC_ENABLED CONFIG_ESP32_ULP_COPROC_ENABLED
+#endif
+
+#ifdef CONFIG_ESP32_ULP_COPROC_RESERVE_MEM
+#define CONFIG_ULP_COPROC_RESERVE_MEM CONFIG_ESP32_ULP_COPROC_RESERVE_MEM
+#endif
+
+#ifdef CONFIG_LWIP_USE_ONLY_LWIP_SELECT
+#define CONFIG_USE_ONLY_LWIP_SELECT CONFIG_LWIP_USE_ONLY_LWIP_SELECT
+#endif
+
+#ifdef CONFIG_NETIF_USE_TCPIP_STACK_LIB
+#define CONFIG_USE_TCPIP_STACK_LIB CONFIG_NETIF_USE_TCPIP_STACK_LIB
+#endif
+
+#ifdef CONFIG_COMPILER_WARN_WRITE_STRINGS
+#define CONFIG_WARN_WRITE_STRINGS CONFIG_COMPILER_WARN_WRITE_STRINGS
+#endif
+
+#ifdef CONFIG_SPIRAM_TRY_ALLOCATE_WIFI_LWIP
+#define CONFIG_WIFI_LWIP_ALLOCATION_FROM_SPIRAM_FIRST CONFIG_SPIRAM_TRY_ALLOCATE_WIFI_LWIP
+#endif
@@ -0,0 +1,215 @@
+/**
+ * @file test_gw_cfg_snapshot.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "gw_cfg_snapshot.h"
+#include "gtest/gtest.h"
+#include <cstring>
+#include <string>
+#include "esp_crc.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestGwCfgSnapshot : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        memset(&this->m_gw_cfg_default, 0, sizeof(this->m_gw_cfg_default));
+        this->m_gw_cfg_default.ruuvi_cfg.mqtt.mqtt_port = 1883;
+
+        memset(&this->m_gw_cfg, 0, sizeof(this->m_gw_cfg));
+        memset(&this->m_gw_cfg.ruuvi_cfg, 0x11, sizeof(this->m_gw_cfg.ruuvi_cfg));
+        memset(&this->m_gw_cfg.eth_cfg, 0x22, sizeof(this->m_gw_cfg.eth_cfg));
+        memset(&this->m_gw_cfg.wifi_cfg.ap, 0x33, sizeof(this->m_gw_cfg.wifi_cfg.ap));
+        memset(&this->m_gw_cfg.wifi_cfg.sta, 0x44, sizeof(this->m_gw_cfg.wifi_cfg.sta));
+
+        this->m_json_id = gw_cfg_snapshot_calc_json_id("{\"use_mqtt\":true}");
+        this->m_defaults_crc32 = gw_cfg_snapshot_calc_defaults_crc32(&this->m_gw_cfg_default);
+        memset(&this->m_snapshot, 0, sizeof(this->m_snapshot));
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    gw_cfg_t                  m_gw_cfg_default;
+    gw_cfg_t                  m_gw_cfg;
+    gw_cfg_snapshot_json_id_t m_json_id;
+    uint32_t                  m_defaults_crc32;
+    gw_cfg_snapshot_t         m_snapshot;
+
+    TestGwCfgSnapshot();
+
+    ~TestGwCfgSnapshot() override;
+};
+
+TestGwCfgSnapshot::TestGwCfgSnapshot()
+    : Test()
+    , m_gw_cfg_default()
+    , m_gw_cfg()
+    , m_json_id()
+    , m_defaults_crc32(0)
+    , m_snapshot()
+{
+}
+
+TestGwCfgSnapshot::~TestGwCfgSnapshot() = default;
+
+extern "C" {
+
+uint32_t
+esp_crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len)
+{
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; ++i)
+    {
+        crc ^= buf[i];
+        for (uint32_t j = 0; j < 8; ++j)
+        {
+            crc = (crc >> 1U) ^ ((0 != (crc & 1U)) ? 0xEDB88320U : 0);
+        }
+    }
+    return ~crc;
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestGwCfgSnapshot, test_create_check_apply) // NOLINT
+{
+    gw_cfg_snapshot_create(&this->m_gw_cfg, this->m_defaults_crc32, &this->m_json_id, &this->m_snapshot);
+    ASSERT_EQ(GW_CFG_SNAPSHOT_MAGIC, this->m_snapshot.magic);
+    ASSERT_EQ(GW_CFG_SNAPSHOT_FMT_VERSION, this->m_snapshot.fmt_version);
+    ASSERT_EQ(sizeof(gw_cfg_snapshot_payload_t), this->m_snapshot.payload_size);
+    ASSERT_EQ(this->m_defaults_crc32, this->m_snapshot.defaults_crc32);
+
+    ASSERT_EQ(
+        GW_CFG_SNAPSHOT_STATUS_OK,
+        gw_cfg_snapshot_check(
+            &this->m_snapshot,
+            sizeof(this->m_snapshot),
+            this->m_defaults_crc32,
+            &this->m_json_id));
+
+    gw_cfg_t gw_cfg = this->m_gw_cfg_default;
+    gw_cfg_snapshot_apply(&this->m_snapshot, &gw_cfg);
+    ASSERT_EQ(0, memcmp(&this->m_gw_cfg.ruuvi_cfg, &gw_cfg.ruuvi_cfg, sizeof(gw_cfg.ruuvi_cfg)));
+    ASSERT_EQ(0, memcmp(&this->m_gw_cfg.eth_cfg, &gw_cfg.eth_cfg, sizeof(gw_cfg.eth_cfg)));
+    ASSERT_EQ(0, memcmp(&this->m_gw_cfg.wifi_cfg.ap, &gw_cfg.wifi_cfg.ap, sizeof(gw_cfg.wifi_cfg.ap)));
+    ASSERT_EQ(0, memcmp(&this->m_gw_cfg.wifi_cfg.sta, &gw_cfg.wifi_cfg.sta, sizeof(gw_cfg.wifi_cfg.sta)));
+    ASSERT_EQ(
+        0,
+        memcmp(&this->m_gw_cfg_default.device_info, &gw_cfg.device_info, sizeof(gw_cfg.device_info)));
+}
+
+TEST_F(TestGwCfgSnapshot, test_create_is_deterministic) // NOLINT
+{
+    gw_cfg_snapshot_t snapshot2 = {};
+    memset(&snapshot2, 0xFF, sizeof(snapshot2));
+    gw_cfg_snapshot_create(&this->m_gw_cfg, this->m_defaults_crc32, &this->m_json_id, &this->m_snapshot);
+    gw_cfg_snapshot_create(&this->m_gw_cfg, this->m_defaults_crc32, &this->m_json_id, &snapshot2);
+    ASSERT_EQ(0, memcmp(&this->m_snapshot, &snapshot2, sizeof(snapshot2)));
+}
+
+TEST_F(TestGwCfgSnapshot, test_check_invalid_size) // NOLINT
+{
+    gw_cfg_snapshot_create(&this->m_gw_cfg, this->m_defaults_crc32, &this->m_json_id, &this->m_snapshot);
+    ASSERT_EQ(
+        GW_CFG_SNAPSHOT_STATUS_INVALID_SIZE,
+        gw_cfg_snapshot_check(
+            &this->m_snapshot,
+            sizeof(this->m_snapshot) - 4,
+            this->m_defaults_crc32,
+            &this->m_json_id));
+}
+
+TEST_F(TestGwCfgSnapshot, test_check_invalid_header) // NOLINT
+{
+    gw_cfg_snapshot_create(&this->m_gw_cfg, this->m_defaults_crc32, &this->m_json_id, &this->m_snapshot);
+    this->m_snapshot.fmt_version += 1;
+    ASSERT_EQ(
+        GW_CFG_SNAPSHOT_STATUS_INVALID_HEADER,
+        gw_cfg_snapshot_check(
+            &this->m_snapshot,
+            sizeof(this->m_snapshot),
+            this->m_defaults_crc32,
+            &this->m_json_id));
+
+    gw_cfg_snapshot_create(&this->m_gw_cfg, this->m_defaults_crc32, &this->m_json_id, &this->m_snapshot);
+    this->m_snapshot.magic = 0;
+    ASSERT_EQ(
+        GW_CFG_SNAPSHOT_STATUS_INVALID_HEADER,
+        gw_cfg_snapshot_check(
+            &this->m_snapshot,
+            sizeof(this->m_snapshot),
+            this->m_defaults_crc32,
+            &this->m_json_id));
+}
+
+TEST_F(TestGwCfgSnapshot, test_check_invalid_crc) // NOLINT
+{
+    gw_cfg_snapshot_create(&this->m_gw_cfg, this->m_defaults_crc32, &this->m_json_id, &this->m_snapshot);
+    this->m_snapshot.payload.ruuvi_cfg.mqtt.mqtt_port += 1;
+    ASSERT_EQ(
+        GW_CFG_SNAPSHOT_STATUS_INVALID_CRC,
+        gw_cfg_snapshot_check(
+            &this->m_snapshot,
+            sizeof(this->m_snapshot),
+            this->m_defaults_crc32,
+            &this->m_json_id));
+}
+
+TEST_F(TestGwCfgSnapshot, test_check_defaults_changed) // NOLINT
+{
+    gw_cfg_snapshot_create(&this->m_gw_cfg, this->m_defaults_crc32, &this->m_json_id, &this->m_snapshot);
+    this->m_gw_cfg_default.ruuvi_cfg.mqtt.mqtt_port = 8883;
+    const uint32_t defaults_crc32 = gw_cfg_snapshot_calc_defaults_crc32(&this->m_gw_cfg_default);
+    ASSERT_NE(this->m_defaults_crc32, defaults_crc32);
+    ASSERT_EQ(
+        GW_CFG_SNAPSHOT_STATUS_DEFAULTS_CHANGED,
+        gw_cfg_snapshot_check(&this->m_snapshot, sizeof(this->m_snapshot), defaults_crc32, &this->m_json_id));
+}
+
+TEST_F(TestGwCfgSnapshot, test_check_json_changed) // NOLINT
+{
+    gw_cfg_snapshot_create(&this->m_gw_cfg, this->m_defaults_crc32, &this->m_json_id, &this->m_snapshot);
+    const gw_cfg_snapshot_json_id_t json_id = gw_cfg_snapshot_calc_json_id("{\"use_mqtt\":fals}");
+    ASSERT_EQ(this->m_json_id.json_size, json_id.json_size);
+    ASSERT_NE(this->m_json_id.json_crc32, json_id.json_crc32);
+    ASSERT_EQ(
+        GW_CFG_SNAPSHOT_STATUS_JSON_CHANGED,
+        gw_cfg_snapshot_check(&this->m_snapshot, sizeof(this->m_snapshot), this->m_defaults_crc32, &json_id));
+}
+
+TEST_F(TestGwCfgSnapshot, test_calc_json_id) // NOLINT
+{
+    const gw_cfg_snapshot_json_id_t json_id = gw_cfg_snapshot_calc_json_id("{}");
+    ASSERT_EQ(3, json_id.json_size);
+    ASSERT_EQ(esp_crc32_le(0, reinterpret_cast<const uint8_t*>("{}"), 3), json_id.json_crc32);
+    ASSERT_TRUE(gw_cfg_snapshot_is_json_id_equal(&json_id, &json_id));
+    ASSERT_FALSE(gw_cfg_snapshot_is_json_id_equal(&json_id, &this->m_json_id));
+}
+
+TEST_F(TestGwCfgSnapshot, test_status_to_str) // NOLINT
+{
+    ASSERT_EQ(string("OK"), string(gw_cfg_snapshot_status_to_str(GW_CFG_SNAPSHOT_STATUS_OK)));
+    ASSERT_EQ(
+        string("config-json changed"),
+        string(gw_cfg_snapshot_status_to_str(GW_CFG_SNAPSHOT_STATUS_JSON_CHANGED)));
+    ASSERT_EQ(
+        string("unknown"),
+        string(gw_cfg_snapshot_status_to_str(static_cast<gw_cfg_snapshot_status_e>(100))));
+}
@@ -0,0 +1,260 @@
+/**
+ * @file test_heap_prof.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "heap_prof.h"
+#include <cstdlib>
+#include <cstring>
+#include "gtest/gtest.h"
+#include "os_mutex.h"
+
+using namespace std;
+
+class TestHeapProf;
+
+static TestHeapProf* g_pTestClass;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestHeapProf : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass               = this;
+        this->m_malloc_fail        = false;
+        this->m_cnt_os_malloc      = 0;
+        this->m_cnt_os_free        = 0;
+        this->m_cnt_mutex_locked   = 0;
+        this->m_cnt_mutex_unlocked = 0;
+        heap_prof_init();
+    }
+
+    void
+    TearDown() override
+    {
+        ASSERT_EQ(this->m_cnt_mutex_locked, this->m_cnt_mutex_unlocked);
+        ASSERT_EQ(this->m_cnt_os_malloc, this->m_cnt_os_free);
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestHeapProf();
+
+    ~TestHeapProf() override;
+
+    bool     m_malloc_fail { false };
+    uint32_t m_cnt_os_malloc { 0 };
+    uint32_t m_cnt_os_free { 0 };
+    uint32_t m_cnt_mutex_locked { 0 };
+    uint32_t m_cnt_mutex_unlocked { 0 };
+};
+
+TestHeapProf::TestHeapProf()
+    : Test()
+{
+}
+
+TestHeapProf::~TestHeapProf() = default;
+
+extern "C" {
+
+void*
+os_malloc(const size_t size)
+{
+    if (g_pTestClass->m_malloc_fail)
+    {
+        return nullptr;
+    }
+    g_pTestClass->m_cnt_os_malloc += 1;
+    return malloc(size);
+}
+
+void*
+os_calloc(const size_t nmemb, const size_t size)
+{
+    if (g_pTestClass->m_malloc_fail)
+    {
+        return nullptr;
+    }
+    g_pTestClass->m_cnt_os_malloc += 1;
+    return calloc(nmemb, size);
+}
+
+void
+os_free_internal(void* p_mem)
+{
+    g_pTestClass->m_cnt_os_free += 1;
+    free(p_mem);
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_locked += 1;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_unlocked += 1;
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestHeapProf, test_malloc_free) // NOLINT
+{
+    void* p_mem1 = heap_prof_malloc(HEAP_PROF_TAG_ADV_TABLE, 100);
+    ASSERT_NE(nullptr, p_mem1);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(p_mem1) % 8);
+    memset(p_mem1, 0xAA, 100);
+    void* p_mem2 = heap_prof_malloc(HEAP_PROF_TAG_ADV_TABLE, 50);
+    ASSERT_NE(nullptr, p_mem2);
+    void* p_mem3 = heap_prof_malloc(HEAP_PROF_TAG_HTTP_CLIENT, 10);
+    ASSERT_NE(nullptr, p_mem3);
+
+    heap_prof_stat_t stat = {};
+    heap_prof_get_stat(&stat);
+    ASSERT_TRUE(stat.flag_enabled);
+    ASSERT_EQ(150, stat.tags[HEAP_PROF_TAG_ADV_TABLE].live_bytes);
+    ASSERT_EQ(150, stat.tags[HEAP_PROF_TAG_ADV_TABLE].peak_bytes);
+    ASSERT_EQ(2, stat.tags[HEAP_PROF_TAG_ADV_TABLE].cnt_alloc);
+    ASSERT_EQ(10, stat.tags[HEAP_PROF_TAG_HTTP_CLIENT].live_bytes);
+    ASSERT_EQ(1, stat.tags[HEAP_PROF_TAG_HTTP_CLIENT].cnt_alloc);
+    ASSERT_EQ(0, stat.tags[HEAP_PROF_TAG_MBEDTLS].cnt_alloc);
+
+    HEAP_PROF_FREE(p_mem1);
+    ASSERT_EQ(nullptr, p_mem1);
+    heap_prof_free(p_mem3);
+    heap_prof_free(nullptr);
+
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(50, stat.tags[HEAP_PROF_TAG_ADV_TABLE].live_bytes);
+    ASSERT_EQ(150, stat.tags[HEAP_PROF_TAG_ADV_TABLE].peak_bytes);
+    ASSERT_EQ(0, stat.tags[HEAP_PROF_TAG_HTTP_CLIENT].live_bytes);
+    ASSERT_EQ(10, stat.tags[HEAP_PROF_TAG_HTTP_CLIENT].peak_bytes);
+
+    HEAP_PROF_FREE(p_mem2);
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(0, stat.tags[HEAP_PROF_TAG_ADV_TABLE].live_bytes);
+    ASSERT_EQ(150, stat.tags[HEAP_PROF_TAG_ADV_TABLE].peak_bytes);
+}
+
+TEST_F(TestHeapProf, test_calloc) // NOLINT
+{
+    uint8_t* p_mem = static_cast<uint8_t*>(heap_prof_calloc(HEAP_PROF_TAG_HTTP_CLIENT, 4, 25));
+    ASSERT_NE(nullptr, p_mem);
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(0, p_mem[i]);
+    }
+    heap_prof_stat_t stat = {};
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(100, stat.tags[HEAP_PROF_TAG_HTTP_CLIENT].live_bytes);
+    ASSERT_EQ(1, stat.tags[HEAP_PROF_TAG_HTTP_CLIENT].cnt_alloc);
+
+    ASSERT_EQ(nullptr, heap_prof_calloc(HEAP_PROF_TAG_HTTP_CLIENT, 0x10000, 0x10000));
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(1, stat.tags[HEAP_PROF_TAG_HTTP_CLIENT].cnt_alloc_failed);
+
+    HEAP_PROF_FREE(p_mem);
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(0, stat.tags[HEAP_PROF_TAG_HTTP_CLIENT].live_bytes);
+}
+
+TEST_F(TestHeapProf, test_alloc_failed) // NOLINT
+{
+    this->m_malloc_fail = true;
+    ASSERT_EQ(nullptr, heap_prof_malloc(HEAP_PROF_TAG_JSON_STREAM_GEN, 100));
+    ASSERT_EQ(nullptr, heap_prof_calloc(HEAP_PROF_TAG_JSON_STREAM_GEN, 1, 100));
+
+    heap_prof_stat_t stat = {};
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(0, stat.tags[HEAP_PROF_TAG_JSON_STREAM_GEN].live_bytes);
+    ASSERT_EQ(0, stat.tags[HEAP_PROF_TAG_JSON_STREAM_GEN].cnt_alloc);
+    ASSERT_EQ(2, stat.tags[HEAP_PROF_TAG_JSON_STREAM_GEN].cnt_alloc_failed);
+}
+
+TEST_F(TestHeapProf, test_alloc_hooks) // NOLINT
+{
+    void* p_mem1 = heap_prof_malloc_json_stream_gen(11);
+    void* p_mem2 = heap_prof_calloc_mbedtls(2, 13);
+
+    heap_prof_stat_t stat = {};
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(11, stat.tags[HEAP_PROF_TAG_JSON_STREAM_GEN].live_bytes);
+    ASSERT_EQ(26, stat.tags[HEAP_PROF_TAG_MBEDTLS].live_bytes);
+
+    void (*p_free)(void*) = HEAP_PROF_FN_FREE;
+    p_free(p_mem1);
+    p_free(p_mem2);
+    heap_prof_get_stat(&stat);
+    for (uint32_t i = 0; i < HEAP_PROF_TAG_NUM; ++i)
+    {
+        ASSERT_EQ(0, stat.tags[i].live_bytes);
+    }
+}
+
+TEST_F(TestHeapProf, test_largest_free_block_trend) // NOLINT
+{
+    heap_prof_stat_t stat = {};
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(0, stat.largest_free_blk_cur);
+    ASSERT_EQ(0, stat.largest_free_blk_min);
+    ASSERT_EQ(0, stat.largest_free_blk_trend);
+
+    heap_prof_register_largest_free_block(50000);
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(50000, stat.largest_free_blk_cur);
+    ASSERT_EQ(50000, stat.largest_free_blk_min);
+    ASSERT_EQ(0, stat.largest_free_blk_trend);
+
+    heap_prof_register_largest_free_block(40000);
+    heap_prof_register_largest_free_block(45000);
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(45000, stat.largest_free_blk_cur);
+    ASSERT_EQ(40000, stat.largest_free_blk_min);
+    ASSERT_EQ(-5000, stat.largest_free_blk_trend);
+
+    // When the history is full, the trend is calculated over the last HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE samples
+    for (uint32_t i = 0; i < HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE; ++i)
+    {
+        heap_prof_register_largest_free_block(60000 + (i * 100));
+    }
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(60000 + ((HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE - 1) * 100), stat.largest_free_blk_cur);
+    ASSERT_EQ(40000, stat.largest_free_blk_min);
+    ASSERT_EQ((HEAP_PROF_LARGEST_FREE_BLK_HISTORY_SIZE - 1) * 100, stat.largest_free_blk_trend);
+
+    heap_prof_register_largest_free_block(30000);
+    heap_prof_get_stat(&stat);
+    ASSERT_EQ(30000, stat.largest_free_blk_cur);
+    ASSERT_EQ(30000, stat.largest_free_blk_min);
+    ASSERT_EQ(30000 - 60100, stat.largest_free_blk_trend);
+}
+
+TEST_F(TestHeapProf, test_get_tag_name) // NOLINT
+{
+    ASSERT_EQ(string("json_stream_gen"), string(heap_prof_get_tag_name(HEAP_PROF_TAG_JSON_STREAM_GEN)));
+    ASSERT_EQ(string("http_client"), string(heap_prof_get_tag_name(HEAP_PROF_TAG_HTTP_CLIENT)));
+    ASSERT_EQ(string("mbedtls"), string(heap_prof_get_tag_name(HEAP_PROF_TAG_MBEDTLS)));
+    ASSERT_EQ(string("adv_table"), string(heap_prof_get_tag_name(HEAP_PROF_TAG_ADV_TABLE)));
+    ASSERT_EQ(string("unknown"), string(heap_prof_get_tag_name(HEAP_PROF_TAG_NUM)));
+}
@@ -0,0 +1,173 @@
+/**
+ * @file test_http_async_gov.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "http_async_gov.h"
+#include "gtest/gtest.h"
+#include "os_mutex.h"
+
+using namespace std;
+
+class TestHttpAsyncGov;
+
+static TestHttpAsyncGov* g_pTestClass;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestHttpAsyncGov : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass               = this;
+        this->m_free_heap_size     = 0;
+        this->m_cnt_mutex_locked   = 0;
+        this->m_cnt_mutex_unlocked = 0;
+        http_async_gov_init();
+        http_async_gov_set_concurrent_mode(false);
+    }
+
+    void
+    TearDown() override
+    {
+        ASSERT_EQ(this->m_cnt_mutex_locked, this->m_cnt_mutex_unlocked);
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestHttpAsyncGov();
+
+    ~TestHttpAsyncGov() override;
+
+    uint32_t m_free_heap_size { 0 };
+    uint32_t m_cnt_mutex_locked { 0 };
+    uint32_t m_cnt_mutex_unlocked { 0 };
+};
+
+TestHttpAsyncGov::TestHttpAsyncGov()
+    : Test()
+{
+}
+
+TestHttpAsyncGov::~TestHttpAsyncGov() = default;
+
+extern "C" {
+
+uint32_t
+esp_get_free_heap_size(void)
+{
+    return g_pTestClass->m_free_heap_size;
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_locked += 1;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_unlocked += 1;
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestHttpAsyncGov, test_concurrent_mode_disabled) // NOLINT
+{
+    this->m_free_heap_size = 200 * 1024;
+    ASSERT_FALSE(http_async_gov_is_concurrent_mode_enabled());
+    ASSERT_FALSE(http_async_gov_check_concurrent());
+
+    http_async_gov_stat_t stat = {};
+    http_async_gov_get_stat(&stat);
+    ASSERT_EQ(0, stat.cnt_concurrent_admitted);
+    ASSERT_EQ(0, stat.cnt_serial_fallback);
+}
+
+TEST_F(TestHttpAsyncGov, test_check_concurrent) // NOLINT
+{
+    http_async_gov_set_concurrent_mode(true);
+    ASSERT_TRUE(http_async_gov_is_concurrent_mode_enabled());
+
+    // The budget of the request is the same as the one reserved in http_mem_budget
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_POST + HTTP_ASYNC_GOV_MEM_RESERVE, HTTP_ASYNC_GOV_MIN_FREE_HEAP_FOR_CONCURRENT);
+
+    this->m_free_heap_size = HTTP_ASYNC_GOV_MIN_FREE_HEAP_FOR_CONCURRENT;
+    ASSERT_TRUE(http_async_gov_check_concurrent());
+
+    this->m_free_heap_size = HTTP_ASYNC_GOV_MIN_FREE_HEAP_FOR_CONCURRENT - 1;
+    ASSERT_FALSE(http_async_gov_check_concurrent());
+    ASSERT_FALSE(http_async_gov_check_concurrent());
+
+    http_async_gov_stat_t stat = {};
+    http_async_gov_get_stat(&stat);
+    ASSERT_EQ(1, stat.cnt_concurrent_admitted);
+    ASSERT_EQ(2, stat.cnt_serial_fallback);
+
+    http_async_gov_init();
+    http_async_gov_get_stat(&stat);
+    ASSERT_EQ(0, stat.cnt_concurrent_admitted);
+    ASSERT_EQ(0, stat.cnt_serial_fallback);
+    ASSERT_TRUE(http_async_gov_is_concurrent_mode_enabled());
+}
+
+TEST_F(TestHttpAsyncGov, test_check_concurrent_with_exceeded_mem_budget) // NOLINT
+{
+    const uint32_t mem_usage = HTTP_MEM_BUDGET_HTTP_POST + 10 * 1024;
+    http_async_gov_set_concurrent_mode(true);
+    http_async_gov_register_mem_usage(200 * 1024, 200 * 1024 - mem_usage);
+
+    // The budget is increased to the max registered memory usage
+    this->m_free_heap_size = HTTP_ASYNC_GOV_MIN_FREE_HEAP_FOR_CONCURRENT;
+    ASSERT_FALSE(http_async_gov_check_concurrent());
+    this->m_free_heap_size = mem_usage + HTTP_ASYNC_GOV_MEM_RESERVE - 1;
+    ASSERT_FALSE(http_async_gov_check_concurrent());
+    this->m_free_heap_size = mem_usage + HTTP_ASYNC_GOV_MEM_RESERVE;
+    ASSERT_TRUE(http_async_gov_check_concurrent());
+
+    http_async_gov_stat_t stat = {};
+    http_async_gov_get_stat(&stat);
+    ASSERT_EQ(1, stat.cnt_concurrent_admitted);
+    ASSERT_EQ(2, stat.cnt_serial_fallback);
+    ASSERT_EQ(1, stat.cnt_mem_budget_exceeded);
+}
+
+TEST_F(TestHttpAsyncGov, test_register_mem_usage) // NOLINT
+{
+    http_async_gov_register_mem_usage(100 * 1024, 80 * 1024);
+    http_async_gov_register_mem_usage(100 * 1024, 90 * 1024);
+    // Heap can grow if some other task frees memory meanwhile, it's ignored
+    http_async_gov_register_mem_usage(100 * 1024, 110 * 1024);
+
+    http_async_gov_stat_t stat = {};
+    http_async_gov_get_stat(&stat);
+    ASSERT_EQ(20 * 1024, stat.max_mem_usage_per_req);
+    ASSERT_EQ(0, stat.cnt_mem_budget_exceeded);
+
+    http_async_gov_register_mem_usage(100 * 1024, 100 * 1024 - HTTP_MEM_BUDGET_HTTP_POST);
+    http_async_gov_get_stat(&stat);
+    ASSERT_EQ(0, stat.cnt_mem_budget_exceeded);
+
+    http_async_gov_register_mem_usage(100 * 1024, 100 * 1024 - HTTP_MEM_BUDGET_HTTP_POST - 1);
+    http_async_gov_get_stat(&stat);
+    ASSERT_EQ(1, stat.cnt_mem_budget_exceeded);
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_POST + 1, stat.max_mem_usage_per_req);
+}
@@ -244,6 +244,177 @@ TEST_F(TestHttpJson, test_1) // NOLINT
     ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
 }
 
+TEST_F(TestHttpJson, test_1_keep_ref_to_reports) // NOLINT
+{
+    const time_t                     timestamp   = 1612358920;
+    const mac_address_str_t          gw_mac_addr = { "AA:CC:EE:00:11:22" };
+    const ruuvi_gw_cfg_coordinates_t coordinates = { "170.112233,59.445566" };
+    const std::array<uint8_t, 31>    data        = {
+                  0x02U, 0x01U, 0x06U, 0x1BU, 0xFFU, 0x99U, 0x04U, 0x05U, 0x15U, 0x71U, 0x4DU, 0x9FU, 0xC5U, 0x6DU, 0xFFU, 0xF0U,
+                  0xFFU, 0xF8U, 0x03U, 0xE4U, 0xB5U, 0x16U, 0xE8U, 0x4DU, 0x7EU, 0xF4U, 0x1FU, 0x0CU, 0x28U, 0xCBU, 0xD6U,
+    };
+
+    adv_report_table_t adv_table = { .num_of_advs = 1,
+                                     .table       = { {
+                                               .timestamp     = 1612358929,
+                                               .tag_mac       = { 0xaa, 0xbb, 0xcc, 0x01, 0x02, 0x03 },
+                                               .rssi          = -70,
+                                               .primary_phy   = RE_CA_UART_BLE_PHY_1MBPS,
+                                               .secondary_phy = RE_CA_UART_BLE_PHY_NOT_SET,
+                                               .ch_index      = 37,
+                                               .is_coded_phy  = false,
+                                               .tx_power      = RE_CA_UART_BLE_GAP_POWER_LEVEL_INVALID,
+                                               .data_len      = data.size(),
+                                     } } };
+    memcpy(adv_table.table[0].data_buf, data.data(), data.size());
+
+    const bool     flag_raw_data       = true;
+    const bool     flag_decode         = false;
+    const bool     flag_use_timestamps = true;
+    const bool     flag_use_nonce      = true;
+    const uint32_t nonce               = 12345678;
+
+    const http_json_create_stream_gen_advs_params_t params = {
+        .flag_raw_data            = flag_raw_data,
+        .flag_decode              = flag_decode,
+        .flag_use_timestamps      = flag_use_timestamps,
+        .cur_time                 = timestamp,
+        .flag_use_nonce           = flag_use_nonce,
+        .nonce                    = nonce,
+        .p_mac_addr               = &gw_mac_addr,
+        .p_coordinates            = &coordinates,
+        .flag_keep_ref_to_reports = true,
+    };
+
+    json_stream_gen_t* p_gen = http_json_create_stream_gen_advs(&adv_table, &params);
+    ASSERT_NE(nullptr, p_gen);
+    // The table is not copied, so the changes made after creating the generator are visible in the output
+    adv_table.table[0].rssi = -60;
+
+    string json_str("");
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if (nullptr == p_chunk)
+        {
+            ASSERT_FALSE(nullptr == p_chunk);
+        }
+
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        json_str += string(p_chunk);
+    }
+
+    ASSERT_EQ(
+        string("{\n"
+               "  \"data\": {\n"
+               "    \"coordinates\": \"170.112233,59.445566\",\n"
+               "    \"timestamp\": 1612358920,\n"
+               "    \"nonce\": 12345678,\n"
+               "    \"gw_mac\": \"AA:CC:EE:00:11:22\",\n"
+               "    \"tags\": {\n"
+               "      \"AA:BB:CC:01:02:03\": {\n"
+               "        \"rssi\": -60,\n"
+               "        \"timestamp\": 1612358929,\n"
+               "        \"ble_phy\": \"1M\",\n"
+               "        \"ble_chan\": 37,\n"
+               "        \"data\": \"0201061BFF99040515714D9FC56DFFF0FFF803E4B516E84D7EF41F0C28CBD6\"\n"
+               "      }\n"
+               "    }\n"
+               "  }\n"
+               "}"),
+        json_str);
+    json_stream_gen_delete(&p_gen);
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
+TEST_F(TestHttpJson, test_reusable_gen_advs) // NOLINT
+{
+    const time_t                     timestamp   = 1612358920;
+    const mac_address_str_t          gw_mac_addr = { "AA:CC:EE:00:11:22" };
+    const ruuvi_gw_cfg_coordinates_t coordinates = { "" };
+    const std::array<uint8_t, 1>     data        = { 0xAAU };
+
+    adv_report_table_t adv_table = { .num_of_advs = 1,
+                                     .table       = { {
+                                               .timestamp     = 1612358929,
+                                               .tag_mac       = { 0xaa, 0xbb, 0xcc, 0x01, 0x02, 0x03 },
+                                               .rssi          = -70,
+                                               .primary_phy   = RE_CA_UART_BLE_PHY_1MBPS,
+                                               .secondary_phy = RE_CA_UART_BLE_PHY_NOT_SET,
+                                               .ch_index      = 37,
+                                               .is_coded_phy  = false,
+                                               .tx_power      = RE_CA_UART_BLE_GAP_POWER_LEVEL_INVALID,
+                                               .data_len      = data.size(),
+                                     } } };
+    memcpy(adv_table.table[0].data_buf, data.data(), data.size());
+
+    http_json_create_stream_gen_advs_params_t params = {
+        .flag_raw_data       = true,
+        .flag_decode         = false,
+        .flag_use_timestamps = true,
+        .cur_time            = timestamp,
+        .flag_use_nonce      = true,
+        .nonce               = 12345678,
+        .p_mac_addr          = &gw_mac_addr,
+        .p_coordinates       = &coordinates,
+    };
+
+    http_json_reusable_gen_advs_t reusable_gen = {};
+    for (int32_t i = 0; i < 2; ++i)
+    {
+        adv_table.table[0].rssi = (int8_t)(-70 + (i * 10));
+        params.nonce            = 12345678 + i;
+
+        json_stream_gen_t* p_gen = http_json_reusable_gen_advs_retarget(&reusable_gen, &adv_table, &params);
+        ASSERT_NE(nullptr, p_gen);
+        ASSERT_EQ(reusable_gen.p_gen, p_gen);
+
+        string json_str("");
+        while (true)
+        {
+            const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+            ASSERT_NE(nullptr, p_chunk);
+            if ('\0' == p_chunk[0])
+            {
+                break;
+            }
+            json_str += string(p_chunk);
+        }
+
+        ASSERT_EQ(
+            string("{\n"
+                   "  \"data\": {\n"
+                   "    \"coordinates\": \"\",\n"
+                   "    \"timestamp\": 1612358920,\n"
+                   "    \"nonce\": ")
+                + to_string(12345678 + i)
+                + string(",\n"
+                         "    \"gw_mac\": \"AA:CC:EE:00:11:22\",\n"
+                         "    \"tags\": {\n"
+                         "      \"AA:BB:CC:01:02:03\": {\n"
+                         "        \"rssi\": ")
+                + to_string(-70 + (i * 10))
+                + string(",\n"
+                         "        \"timestamp\": 1612358929,\n"
+                         "        \"ble_phy\": \"1M\",\n"
+                         "        \"ble_chan\": 37,\n"
+                         "        \"data\": \"AA\"\n"
+                         "      }\n"
+                         "    }\n"
+                         "  }\n"
+                         "}"),
+            json_str);
+        // The generator is created only once and then reused
+        ASSERT_EQ(1, this->m_malloc_cnt);
+    }
+    http_json_reusable_gen_advs_delete(&reusable_gen);
+    ASSERT_EQ(nullptr, reusable_gen.p_gen);
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
 TEST_F(TestHttpJson, test_1_with_raw_and_decoded) // NOLINT
 {
     const time_t                     timestamp   = 1612358920;
@@ -340,6 +511,71 @@ TEST_F(TestHttpJson, test_1_with_raw_and_decoded) // NOLINT
     ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
 }
 
+TEST_F(TestHttpJson, test_reusable_gen_advs_with_decoded) // NOLINT
+{
+    const time_t                     timestamp   = 1612358920;
+    const mac_address_str_t          gw_mac_addr = { "AA:CC:EE:00:11:22" };
+    const ruuvi_gw_cfg_coordinates_t coordinates = { "" };
+    const std::array<uint8_t, 31>    data        = {
+                  0x02U, 0x01U, 0x06U, 0x1BU, 0xFFU, 0x99U, 0x04U, 0x05U, 0x15U, 0x71U, 0x4DU, 0x9FU, 0xC5U, 0x6DU, 0xFFU, 0xF0U,
+                  0xFFU, 0xF8U, 0x03U, 0xE4U, 0xB5U, 0x16U, 0xE8U, 0x4DU, 0x7EU, 0xF4U, 0x1FU, 0x0CU, 0x28U, 0xCBU, 0xD6U,
+    };
+
+    adv_report_table_t adv_table = { .num_of_advs = 1,
+                                     .table       = { {
+                                               .timestamp     = 1612358929,
+                                               .tag_mac       = { 0xaa, 0xbb, 0xcc, 0x01, 0x02, 0x03 },
+                                               .rssi          = -70,
+                                               .primary_phy   = RE_CA_UART_BLE_PHY_1MBPS,
+                                               .secondary_phy = RE_CA_UART_BLE_PHY_NOT_SET,
+                                               .ch_index      = 37,
+                                               .is_coded_phy  = false,
+                                               .tx_power      = RE_CA_UART_BLE_GAP_POWER_LEVEL_INVALID,
+                                               .data_len      = data.size(),
+                                     } } };
+    memcpy(adv_table.table[0].data_buf, data.data(), data.size());
+
+    // The generator without the table for the decoded advs is re-created only once when decoding is enabled
+    const std::array<bool, 3>     flag_decode_seq = { false, true, false };
+    const std::array<uint32_t, 3> malloc_cnt_seq  = { 1, 2, 2 };
+
+    http_json_reusable_gen_advs_t reusable_gen = {};
+    for (size_t i = 0; i < flag_decode_seq.size(); ++i)
+    {
+        const http_json_create_stream_gen_advs_params_t params = {
+            .flag_raw_data       = true,
+            .flag_decode         = flag_decode_seq[i],
+            .flag_use_timestamps = true,
+            .cur_time            = timestamp,
+            .flag_use_nonce      = true,
+            .nonce               = 12345678,
+            .p_mac_addr          = &gw_mac_addr,
+            .p_coordinates       = &coordinates,
+        };
+
+        json_stream_gen_t* p_gen = http_json_reusable_gen_advs_retarget(&reusable_gen, &adv_table, &params);
+        ASSERT_NE(nullptr, p_gen);
+        ASSERT_EQ(reusable_gen.p_gen, p_gen);
+
+        string json_str("");
+        while (true)
+        {
+            const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+            ASSERT_NE(nullptr, p_chunk);
+            if ('\0' == p_chunk[0])
+            {
+                break;
+            }
+            json_str += string(p_chunk);
+        }
+        ASSERT_EQ(flag_decode_seq[i], string::npos != json_str.find("        \"temperature\": 27.445,\n"));
+        ASSERT_EQ(flag_decode_seq[i], string::npos != json_str.find("        \"id\": \"F4:1F:0C:28:CB:D6\"\n"));
+        ASSERT_EQ(malloc_cnt_seq[i], this->m_malloc_cnt);
+    }
+    http_json_reusable_gen_advs_delete(&reusable_gen);
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
+
 TEST_F(TestHttpJson, test_1_without_raw_and_with_decoded) // NOLINT
 {
     const time_t                     timestamp   = 1612358920;
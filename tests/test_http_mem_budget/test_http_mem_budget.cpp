@@ -0,0 +1,404 @@
+/**
+ * @file test_http_mem_budget.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "http_mem_budget.h"
+#include "gtest/gtest.h"
+#include "esp_timer.h"
+#include "os_mutex.h"
+
+using namespace std;
+
+class TestHttpMemBudget;
+
+static TestHttpMemBudget* g_pTestClass;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestHttpMemBudget : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass               = this;
+        this->m_time_us            = 0;
+        this->m_free_heap_size     = 0;
+        this->m_cnt_mutex_locked   = 0;
+        this->m_cnt_mutex_unlocked = 0;
+        http_mem_budget_init();
+        http_mem_budget_set_restricted_mode(false);
+    }
+
+    void
+    TearDown() override
+    {
+        ASSERT_EQ(this->m_cnt_mutex_locked, this->m_cnt_mutex_unlocked);
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestHttpMemBudget();
+
+    ~TestHttpMemBudget() override;
+
+    int64_t  m_time_us { 0 };
+    uint32_t m_free_heap_size { 0 };
+    uint32_t m_cnt_mutex_locked { 0 };
+    uint32_t m_cnt_mutex_unlocked { 0 };
+};
+
+TestHttpMemBudget::TestHttpMemBudget()
+    : Test()
+{
+}
+
+TestHttpMemBudget::~TestHttpMemBudget() = default;
+
+extern "C" {
+
+int64_t
+esp_timer_get_time(void)
+{
+    return g_pTestClass->m_time_us;
+}
+
+uint32_t
+esp_get_free_heap_size(void)
+{
+    return g_pTestClass->m_free_heap_size;
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_locked += 1;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+    g_pTestClass->m_cnt_mutex_unlocked += 1;
+}
+
+} // extern "C"
+
+/**
+ * @brief Simplified model of the gateway: the HTTP client posts advs to Ruuvi and to the custom server,
+ *        the HTTP server handles /history polling, the real heap consumption is a bit less than the estimation.
+ */
+class HttpMemBudgetSimulator
+{
+public:
+    static constexpr uint32_t heap_size_total          = 110U * 1024U;
+    static constexpr uint32_t heap_usage_http_post     = 36U * 1024U;
+    static constexpr uint32_t heap_usage_history       = 14U * 1024U;
+    static constexpr uint32_t mem_budget_history       = 16U * 1024U;
+    static constexpr int64_t  step_ms                  = 5;
+    static constexpr int64_t  http_post_period_ms      = 100;
+    static constexpr int64_t  http_post_duration_ms    = 300;
+    static constexpr int64_t  history_period_ms        = 50;
+    static constexpr int64_t  history_resp_duration_ms = 40;
+
+    struct http_post_t
+    {
+        http_mem_budget_client_e client;
+        bool                     flag_in_progress;
+        int64_t                  finish_time_ms;
+        int64_t                  next_start_time_ms;
+        uint32_t                 cnt_completed;
+        uint32_t                 cnt_postponed;
+    };
+
+    http_post_t http_posts[2] = {
+        { HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, false, 0, 0, 0, 0 },
+        { HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM, false, 0, 0, 0, 0 },
+    };
+    bool     flag_history_resp_in_progress { false };
+    int64_t  history_resp_finish_time_ms { 0 };
+    uint32_t cnt_history_served { 0 };
+    uint32_t cnt_history_rejected { 0 };
+    uint32_t heap_used { 0 };
+    uint32_t min_free_heap { heap_size_total };
+    uint32_t max_total_reserved { 0 };
+
+    /**
+     * @brief Number of posts which can be completed by one client if the posts are never postponed
+     *        (the next post is started on the next step after the completion of the previous one).
+     */
+    static constexpr int64_t
+    max_num_http_posts(const int64_t duration_ms)
+    {
+        return duration_ms / (http_post_duration_ms + step_ms);
+    }
+
+    void
+    run(TestHttpMemBudget* const p_test, const int64_t duration_ms)
+    {
+        for (int64_t now_ms = 0; now_ms < duration_ms; now_ms += step_ms)
+        {
+            p_test->m_time_us = now_ms * 1000;
+            this->step_http_posts(p_test, now_ms);
+            this->step_http_server(p_test, now_ms);
+            const uint32_t total_reserved = http_mem_budget_get_total_reserved();
+            if (total_reserved > this->max_total_reserved)
+            {
+                this->max_total_reserved = total_reserved;
+            }
+        }
+    }
+
+private:
+    void
+    update_heap(TestHttpMemBudget* const p_test)
+    {
+        p_test->m_free_heap_size = heap_size_total - this->heap_used;
+        if (p_test->m_free_heap_size < this->min_free_heap)
+        {
+            this->min_free_heap = p_test->m_free_heap_size;
+        }
+    }
+
+    void
+    step_http_posts(TestHttpMemBudget* const p_test, const int64_t now_ms)
+    {
+        for (auto& http_post : this->http_posts)
+        {
+            if (http_post.flag_in_progress)
+            {
+                if (now_ms >= http_post.finish_time_ms)
+                {
+                    http_post.flag_in_progress = false;
+                    http_post.cnt_completed += 1;
+                    this->heap_used -= heap_usage_http_post;
+                    this->update_heap(p_test);
+                    http_mem_budget_release(http_post.client);
+                }
+                continue;
+            }
+            if (now_ms < http_post.next_start_time_ms)
+            {
+                continue;
+            }
+            this->update_heap(p_test);
+            if (!http_mem_budget_reserve(http_post.client, HTTP_MEM_BUDGET_HTTP_POST))
+            {
+                http_post.cnt_postponed += 1;
+                continue;
+            }
+            http_post.flag_in_progress   = true;
+            http_post.finish_time_ms     = now_ms + http_post_duration_ms;
+            http_post.next_start_time_ms = now_ms + http_post_period_ms;
+            this->heap_used += heap_usage_http_post;
+            this->update_heap(p_test);
+        }
+    }
+
+    void
+    step_http_server(TestHttpMemBudget* const p_test, const int64_t now_ms)
+    {
+        if (this->flag_history_resp_in_progress && (now_ms >= this->history_resp_finish_time_ms))
+        {
+            // The HTTP server does not notify about the completion, the reservation is released by the lease timeout
+            this->flag_history_resp_in_progress = false;
+            this->heap_used -= heap_usage_history;
+            this->update_heap(p_test);
+        }
+        if (0 != (now_ms % history_period_ms))
+        {
+            return;
+        }
+        if (this->flag_history_resp_in_progress)
+        {
+            // The HTTP server handles the connections one by one, the next request waits in the TCP backlog
+            return;
+        }
+        this->update_heap(p_test);
+        if (!http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, mem_budget_history))
+        {
+            this->cnt_history_rejected += 1;
+            return;
+        }
+        this->cnt_history_served += 1;
+        this->flag_history_resp_in_progress = true;
+        this->history_resp_finish_time_ms   = now_ms + history_resp_duration_ms;
+        this->heap_used += heap_usage_history;
+        this->update_heap(p_test);
+    }
+};
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestHttpMemBudget, test_single_reservation_is_always_admitted) // NOLINT
+{
+    http_mem_budget_set_restricted_mode(true);
+    this->m_free_heap_size = 1024;
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, HTTP_MEM_BUDGET_LIMIT_RESTRICTED + 1));
+    ASSERT_EQ(HTTP_MEM_BUDGET_LIMIT_RESTRICTED + 1, http_mem_budget_get_total_reserved());
+
+    // The reservation of the same client is replaced
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, HTTP_MEM_BUDGET_HTTP_POST));
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_POST, http_mem_budget_get_total_reserved());
+
+    http_mem_budget_release(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN);
+    ASSERT_EQ(0, http_mem_budget_get_total_reserved());
+
+    http_mem_budget_stat_t stat = {};
+    http_mem_budget_get_stat(&stat);
+    ASSERT_EQ(2, stat.cnt_admitted[HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN]);
+    ASSERT_EQ(0, stat.cnt_rejected[HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN]);
+    ASSERT_EQ(HTTP_MEM_BUDGET_LIMIT_RESTRICTED + 1, stat.max_reserved);
+}
+
+TEST_F(TestHttpMemBudget, test_restricted_mode) // NOLINT
+{
+    http_mem_budget_set_restricted_mode(true);
+    this->m_free_heap_size = 200U * 1024U;
+
+    const uint32_t history_mem_size = HTTP_MEM_BUDGET_LIMIT_RESTRICTED - HTTP_MEM_BUDGET_HTTP_POST;
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, HTTP_MEM_BUDGET_HTTP_POST));
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, history_mem_size));
+    ASSERT_FALSE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM, HTTP_MEM_BUDGET_HTTP_POST));
+
+    http_mem_budget_release(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN);
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM, HTTP_MEM_BUDGET_HTTP_POST));
+    ASSERT_FALSE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, HTTP_MEM_BUDGET_HTTP_POST));
+
+    // In the unrestricted mode only the amount of free heap is checked
+    http_mem_budget_set_restricted_mode(false);
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, HTTP_MEM_BUDGET_HTTP_POST));
+
+    http_mem_budget_stat_t stat = {};
+    http_mem_budget_get_stat(&stat);
+    ASSERT_EQ(2, stat.cnt_admitted[HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN]);
+    ASSERT_EQ(1, stat.cnt_rejected[HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN]);
+    ASSERT_EQ(1, stat.cnt_admitted[HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM]);
+    ASSERT_EQ(1, stat.cnt_rejected[HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM]);
+    ASSERT_EQ(1, stat.cnt_admitted[HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP]);
+    ASSERT_EQ(2 * HTTP_MEM_BUDGET_HTTP_POST + history_mem_size, stat.max_reserved);
+}
+
+TEST_F(TestHttpMemBudget, test_mqtt_publish_in_restricted_mode) // NOLINT
+{
+    http_mem_budget_set_restricted_mode(true);
+    this->m_free_heap_size = 200U * 1024U;
+
+    // One outgoing post, the response of the HTTP server and MQTT publishing fit the restricted budget
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, HTTP_MEM_BUDGET_HTTP_POST));
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, HTTP_MEM_BUDGET_HTTP_SERVER_RESP));
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH, HTTP_MEM_BUDGET_MQTT_PUBLISH));
+    ASSERT_FALSE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM, HTTP_MEM_BUDGET_HTTP_POST));
+
+    // MQTT publishing is postponed while two posts are in progress
+    http_mem_budget_release(HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH);
+    http_mem_budget_release(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP);
+    http_mem_budget_set_restricted_mode(false);
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_CUSTOM, HTTP_MEM_BUDGET_HTTP_POST));
+    http_mem_budget_set_restricted_mode(true);
+    ASSERT_FALSE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH, HTTP_MEM_BUDGET_MQTT_PUBLISH));
+
+    http_mem_budget_stat_t stat = {};
+    http_mem_budget_get_stat(&stat);
+    ASSERT_EQ(1, stat.cnt_admitted[HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH]);
+    ASSERT_EQ(1, stat.cnt_rejected[HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH]);
+    ASSERT_STREQ("mqtt_publish", http_mem_budget_get_client_name(HTTP_MEM_BUDGET_CLIENT_MQTT_PUBLISH));
+}
+
+TEST_F(TestHttpMemBudget, test_free_heap) // NOLINT
+{
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, HTTP_MEM_BUDGET_HTTP_POST));
+
+    this->m_free_heap_size = HTTP_MEM_BUDGET_HTTP_SERVER_RESP + HTTP_MEM_BUDGET_MIN_FREE_HEAP - 1;
+    ASSERT_FALSE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, HTTP_MEM_BUDGET_HTTP_SERVER_RESP));
+
+    this->m_free_heap_size = HTTP_MEM_BUDGET_HTTP_SERVER_RESP + HTTP_MEM_BUDGET_MIN_FREE_HEAP;
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, HTTP_MEM_BUDGET_HTTP_SERVER_RESP));
+}
+
+TEST_F(TestHttpMemBudget, test_http_server_resp_lease) // NOLINT
+{
+    this->m_free_heap_size = 200U * 1024U;
+    this->m_time_us        = 1000 * 1000;
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, HTTP_MEM_BUDGET_HTTP_SERVER_RESP));
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, HTTP_MEM_BUDGET_HTTP_POST));
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_POST + HTTP_MEM_BUDGET_HTTP_SERVER_RESP, http_mem_budget_get_total_reserved());
+
+    this->m_time_us += (HTTP_MEM_BUDGET_HTTP_SERVER_RESP_LEASE_MS - 1) * 1000;
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_POST + HTTP_MEM_BUDGET_HTTP_SERVER_RESP, http_mem_budget_get_total_reserved());
+
+    this->m_time_us += 1000;
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_POST, http_mem_budget_get_total_reserved());
+}
+
+TEST_F(TestHttpMemBudget, test_http_server_resp_hold) // NOLINT
+{
+    this->m_free_heap_size = 200U * 1024U;
+    this->m_time_us        = 1000 * 1000;
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, HTTP_MEM_BUDGET_HTTP_SERVER_RESP));
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_POST_MAIN, HTTP_MEM_BUDGET_HTTP_POST));
+    http_mem_budget_hold(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP);
+
+    // The response which is still being generated keeps its reservation after the lease
+    this->m_time_us += (HTTP_MEM_BUDGET_HTTP_SERVER_RESP_LEASE_MS * 2) * 1000;
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_POST + HTTP_MEM_BUDGET_HTTP_SERVER_RESP, http_mem_budget_get_total_reserved());
+
+    http_mem_budget_release(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP);
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_POST, http_mem_budget_get_total_reserved());
+
+    // The next request gets the lease again
+    ASSERT_TRUE(http_mem_budget_reserve(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP, HTTP_MEM_BUDGET_HTTP_SERVER_RESP));
+    this->m_time_us += HTTP_MEM_BUDGET_HTTP_SERVER_RESP_LEASE_MS * 1000;
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_POST, http_mem_budget_get_total_reserved());
+}
+
+TEST_F(TestHttpMemBudget, test_simulation_history_polling_with_http_posts) // NOLINT
+{
+    HttpMemBudgetSimulator sim;
+    sim.run(this, 60 * 1000);
+
+    // The incoming requests and the outgoing posts are handled concurrently
+    ASSERT_EQ(60 * 1000 / HttpMemBudgetSimulator::history_period_ms, sim.cnt_history_served);
+    ASSERT_EQ(0, sim.cnt_history_rejected);
+    for (const auto& http_post : sim.http_posts)
+    {
+        ASSERT_GE(http_post.cnt_completed, HttpMemBudgetSimulator::max_num_http_posts(60 * 1000));
+        ASSERT_EQ(0, http_post.cnt_postponed);
+    }
+    ASSERT_GE(sim.min_free_heap, HTTP_MEM_BUDGET_MIN_FREE_HEAP);
+    ASSERT_EQ(2 * HTTP_MEM_BUDGET_HTTP_POST + HttpMemBudgetSimulator::mem_budget_history, sim.max_total_reserved);
+}
+
+TEST_F(TestHttpMemBudget, test_simulation_history_polling_with_http_posts_in_restricted_mode) // NOLINT
+{
+    http_mem_budget_set_restricted_mode(true);
+
+    HttpMemBudgetSimulator sim;
+    sim.run(this, 60 * 1000);
+
+    // /history is never blocked by the outgoing posts, the posts are serialized by the budget
+    ASSERT_EQ(0, sim.cnt_history_rejected);
+    ASSERT_GT(sim.cnt_history_served, 0);
+    uint32_t cnt_completed_total = 0;
+    for (const auto& http_post : sim.http_posts)
+    {
+        ASSERT_GT(http_post.cnt_completed, 0);
+        cnt_completed_total += http_post.cnt_completed;
+    }
+    ASSERT_GE(cnt_completed_total, HttpMemBudgetSimulator::max_num_http_posts(60 * 1000));
+    ASSERT_LE(sim.max_total_reserved, HTTP_MEM_BUDGET_LIMIT_RESTRICTED);
+    ASSERT_GE(sim.min_free_heap, HTTP_MEM_BUDGET_MIN_FREE_HEAP);
+}
@@ -18,6 +18,9 @@
 #include "flashfatfs.h"
 #include "metrics.h"
 #include "adv_table.h"
+#include "adv_report_pool.h"
+#include "adv_live_stream.h"
+#include "adv_log_ring.h"
 #include "str_buf.h"
 #include "ruuvi_device_id.h"
 #include "os_malloc.h"
@@ -33,6 +36,8 @@
 #include "http.h"
 #include "http_server_resp.h"
 #include "ruuvi_gateway.h"
+#include "boot_timeline.h"
+#include "http_mem_budget.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -465,6 +470,13 @@ protected:
         this->m_http_check_with_auth_arr_of_urls = nullptr;
         this->m_firmware_update_resp             = str_buf_init_null();
         this->m_fw_updating_reason               = FW_UPDATE_REASON_NONE;
+        this->m_live_stream_client_id            = ADV_LIVE_STREAM_CLIENT_ID_INVALID;
+        this->m_live_stream_committed_ticket     = ADV_TABLE_TICKET_NONE;
+        this->m_live_stream_rolled_back_ticket   = ADV_TABLE_TICKET_NONE;
+        this->m_http_mem_budget_reserve_res      = true;
+        this->m_http_mem_budget_reserved_size    = 0;
+        this->m_http_mem_budget_flag_held        = false;
+        this->m_http_mem_budget_flag_released    = false;
     }
 
     void
@@ -500,6 +512,13 @@ public:
     const char**          m_http_check_with_auth_arr_of_urls;
     size_t                m_http_check_with_auth_num_of_urls;
     fw_updating_reason_e  m_fw_updating_reason;
+    uint32_t              m_live_stream_client_id;
+    adv_table_ticket_t    m_live_stream_committed_ticket;
+    adv_table_ticket_t    m_live_stream_rolled_back_ticket;
+    bool                  m_http_mem_budget_reserve_res;
+    uint32_t              m_http_mem_budget_reserved_size;
+    bool                  m_http_mem_budget_flag_held;
+    bool                  m_http_mem_budget_flag_released;
 };
 
 TestHttpServerCb::TestHttpServerCb()
@@ -511,6 +530,9 @@ TestHttpServerCb::TestHttpServerCb()
     , m_is_fatfs_mounted(false)
     , m_is_fatfs_mount_fail(false)
     , m_fd(-1)
+    , m_live_stream_client_id(ADV_LIVE_STREAM_CLIENT_ID_INVALID)
+    , m_live_stream_committed_ticket(ADV_TABLE_TICKET_NONE)
+    , m_live_stream_rolled_back_ticket(ADV_TABLE_TICKET_NONE)
     , Test()
 {
 }
@@ -643,6 +665,19 @@ wifi_manager_is_ap_active(void)
     return g_pTestClass->m_flag_is_ap_active;
 }
 
+void
+boot_timeline_get(boot_timeline_t* const p_timeline)
+{
+    memset(p_timeline, 0, sizeof(*p_timeline));
+}
+
+const char*
+boot_timeline_get_stage_name(const boot_timeline_stage_e stage)
+{
+    (void)stage;
+    return "stage";
+}
+
 char*
 metrics_generate(void)
 {
@@ -655,6 +690,18 @@ metrics_generate(void)
     return p_buf;
 }
 
+char*
+adv_log_ring_generate_text(void)
+{
+    const char* p_text = "adv_log_text";
+    char*       p_buf  = static_cast<char*>(os_malloc(strlen(p_text) + 1));
+    if (nullptr != p_buf)
+    {
+        strcpy(p_buf, p_text);
+    }
+    return p_buf;
+}
+
 time_t
 http_server_get_cur_time(void)
 {
@@ -711,6 +758,70 @@ adv_table_history_read(
     }
 }
 
+adv_report_table_t*
+adv_report_pool_checkout(void)
+{
+    // The pool itself is tested in test_adv_report_pool, here the buffers are taken from the heap to trace them
+    return static_cast<adv_report_table_t*>(os_calloc(1, sizeof(adv_report_table_t)));
+}
+
+void
+adv_report_pool_return(adv_report_table_t* p_reports)
+{
+    if (nullptr != p_reports)
+    {
+        os_free(p_reports);
+    }
+}
+
+adv_live_stream_client_id_t
+adv_live_stream_subscribe(const adv_live_stream_time_ms_t now)
+{
+    (void)now;
+    return g_pTestClass->m_live_stream_client_id;
+}
+
+bool
+adv_live_stream_read_begin(
+    const adv_live_stream_client_id_t client_id,
+    const adv_live_stream_time_ms_t   now,
+    adv_report_table_t* const         p_reports,
+    adv_table_ticket_t* const         p_ticket)
+{
+    (void)now;
+    p_reports->num_of_advs = 0;
+    *p_ticket              = ADV_TABLE_TICKET_NONE;
+    if ((ADV_LIVE_STREAM_CLIENT_ID_INVALID == client_id) || (client_id != g_pTestClass->m_live_stream_client_id))
+    {
+        return false;
+    }
+    *p_ticket = 1;
+    return true;
+}
+
+void
+adv_live_stream_read_commit(const adv_live_stream_client_id_t client_id, const adv_table_ticket_t ticket)
+{
+    (void)client_id;
+    g_pTestClass->m_live_stream_committed_ticket = ticket;
+}
+
+void
+adv_live_stream_read_rollback(const adv_live_stream_client_id_t client_id, const adv_table_ticket_t ticket)
+{
+    (void)client_id;
+    g_pTestClass->m_live_stream_rolled_back_ticket = ticket;
+}
+
+void
+adv_live_stream_unsubscribe(const adv_live_stream_client_id_t client_id)
+{
+    if (client_id == g_pTestClass->m_live_stream_client_id)
+    {
+        g_pTestClass->m_live_stream_client_id = ADV_LIVE_STREAM_CLIENT_ID_INVALID;
+    }
+}
+
 void
 settings_save_to_flash(const gw_cfg_t* const p_gw_cfg)
 {
@@ -768,6 +879,24 @@ flashfatfs_get_file_size(const flash_fat_fs_t* p_ffs, const char* file_path, siz
     return false;
 }
 
+FILE*
+flashfatfs_fopen(const flash_fat_fs_t* p_ffs, const char* file_path, const bool flag_use_binary_mode)
+{
+    assert(p_ffs == &g_pTestClass->m_fatfs);
+    for (auto& file : g_pTestClass->m_files)
+    {
+        if (0 == strcmp(file_path, file.fileName.c_str()))
+        {
+            if (file.flag_fail_to_open)
+            {
+                return nullptr;
+            }
+            return fmemopen((void*)file.content.c_str(), file.content.size(), flag_use_binary_mode ? "rb" : "r");
+        }
+    }
+    return nullptr;
+}
+
 file_descriptor_t
 flashfatfs_open(const flash_fat_fs_t* p_ffs, const char* file_path)
 {
@@ -854,6 +983,31 @@ esp_transport_ssl_clear_saved_session_tickets(void)
 {
 }
 
+bool
+http_mem_budget_reserve(const http_mem_budget_client_e client, const uint32_t mem_size)
+{
+    assert(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP == client);
+    if (g_pTestClass->m_http_mem_budget_reserve_res)
+    {
+        g_pTestClass->m_http_mem_budget_reserved_size = mem_size;
+    }
+    return g_pTestClass->m_http_mem_budget_reserve_res;
+}
+
+void
+http_mem_budget_release(const http_mem_budget_client_e client)
+{
+    assert(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP == client);
+    g_pTestClass->m_http_mem_budget_flag_released = true;
+}
+
+void
+http_mem_budget_hold(const http_mem_budget_client_e client)
+{
+    assert(HTTP_MEM_BUDGET_CLIENT_HTTP_SERVER_RESP == client);
+    g_pTestClass->m_http_mem_budget_flag_held = true;
+}
+
 } // extern "C"
 
 TestHttpServerCb::~TestHttpServerCb() = default;
@@ -868,6 +1022,41 @@ TestHttpServerCb::~TestHttpServerCb() = default;
 
 #define TEST_CHECK_LOG_RECORD_TEST(level_, msg_) ESP_LOG_WRAPPER_TEST_CHECK_LOG_RECORD("test", level_, msg_)
 
+static string
+http_resp_json_gen_to_str(json_stream_gen_t* const p_gen)
+{
+    string json_str("");
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if ((nullptr == p_chunk) || ('\0' == p_chunk[0]))
+        {
+            break;
+        }
+        json_str += string(p_chunk);
+    }
+    return json_str;
+}
+
+static string
+cjson_str_to_formatted(const string& json_str)
+{
+    cJSON* const p_json = cJSON_Parse(json_str.c_str());
+    if (nullptr == p_json)
+    {
+        return string("");
+    }
+    char* const p_str = cJSON_Print(p_json);
+    cJSON_Delete(p_json);
+    if (nullptr == p_str)
+    {
+        return string("");
+    }
+    const string res(p_str);
+    cJSON_free(p_str);
+    return res;
+}
+
 static gw_cfg_t
 get_gateway_config_default()
 {
@@ -950,6 +1139,7 @@ TEST_F(TestHttpServerCb, resp_json_ruuvi_ok) // NOLINT
           "\t\"mqtt_disable_retained_messages\":\tfalse,\n"
           "\t\"mqtt_transport\":\t\"TCP\",\n"
           "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+          "\t\"mqtt_qos\":\t0,\n"
           "\t\"mqtt_server\":\t\"test.mosquitto.org\",\n"
           "\t\"mqtt_port\":\t1883,\n"
           "\t\"mqtt_sending_interval\":\t0,\n"
@@ -1035,15 +1225,15 @@ TEST_F(TestHttpServerCb, resp_json_ruuvi_ok) // NOLINT
     const http_server_resp_t resp = http_server_resp_json_ruuvi();
 
     ASSERT_EQ(HTTP_RESP_CODE_200, resp.http_resp_code);
-    ASSERT_EQ(HTTP_CONTENT_LOCATION_HEAP, resp.content_location);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_JSON_GENERATOR, resp.content_location);
     ASSERT_TRUE(resp.flag_no_cache);
     ASSERT_EQ(HTTP_CONTENT_TYPE_APPLICATION_JSON, resp.content_type);
     ASSERT_EQ(nullptr, resp.p_content_type_param);
-    ASSERT_EQ(string(expected_json), string(reinterpret_cast<const char*>(resp.select_location.memory.p_buf)));
-    ASSERT_EQ(strlen(expected_json), resp.content_len);
     ASSERT_EQ(HTTP_CONTENT_ENCODING_NONE, resp.content_encoding);
-    ASSERT_NE(nullptr, resp.select_location.memory.p_buf);
-    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_INFO, string("ruuvi.json: ") + string(expected_json));
+    ASSERT_NE(nullptr, resp.select_location.json_generator.p_json_gen);
+    const string json_str = http_resp_json_gen_to_str(resp.select_location.json_generator.p_json_gen);
+    ASSERT_EQ(json_str.size(), resp.content_len);
+    ASSERT_EQ(string(expected_json), cjson_str_to_formatted(json_str));
     TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_INFO, string("Activate cfg_mode"));
     ASSERT_TRUE(esp_log_wrapper_is_empty());
 }
@@ -1114,7 +1304,7 @@ TEST_F(TestHttpServerCb, resp_json_ruuvi_malloc_failed_2) // NOLINT
     gw_cfg_update_ruuvi_cfg(&gw_cfg.ruuvi_cfg);
 
     g_pTestClass->m_malloc_cnt         = 0;
-    g_pTestClass->m_malloc_fail_on_cnt = 2;
+    g_pTestClass->m_malloc_fail_on_cnt = 1;
 
     esp_log_wrapper_clear();
     const http_server_resp_t resp = http_server_resp_json_ruuvi();
@@ -1127,7 +1317,7 @@ TEST_F(TestHttpServerCb, resp_json_ruuvi_malloc_failed_2) // NOLINT
     ASSERT_EQ(0, resp.content_len);
     ASSERT_EQ(HTTP_CONTENT_ENCODING_NONE, resp.content_encoding);
     ASSERT_EQ(nullptr, resp.select_location.memory.p_buf);
-    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_ERROR, string("Can't add json item: fw_ver"));
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_ERROR, string("Not enough memory"));
     ASSERT_TRUE(esp_log_wrapper_is_empty());
 }
 
@@ -1176,6 +1366,7 @@ TEST_F(TestHttpServerCb, resp_json_ok) // NOLINT
           "\t\"mqtt_disable_retained_messages\":\tfalse,\n"
           "\t\"mqtt_transport\":\t\"TCP\",\n"
           "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+          "\t\"mqtt_qos\":\t0,\n"
           "\t\"mqtt_server\":\t\"test.mosquitto.org\",\n"
           "\t\"mqtt_port\":\t1883,\n"
           "\t\"mqtt_sending_interval\":\t0,\n"
@@ -1263,15 +1454,15 @@ TEST_F(TestHttpServerCb, resp_json_ok) // NOLINT
     const http_server_resp_t resp = http_server_resp_json("ruuvi.json", false);
 
     ASSERT_EQ(HTTP_RESP_CODE_200, resp.http_resp_code);
-    ASSERT_EQ(HTTP_CONTENT_LOCATION_HEAP, resp.content_location);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_JSON_GENERATOR, resp.content_location);
     ASSERT_TRUE(resp.flag_no_cache);
     ASSERT_EQ(HTTP_CONTENT_TYPE_APPLICATION_JSON, resp.content_type);
     ASSERT_EQ(nullptr, resp.p_content_type_param);
-    ASSERT_EQ(string(expected_json), string(reinterpret_cast<const char*>(resp.select_location.memory.p_buf)));
-    ASSERT_EQ(strlen(expected_json), resp.content_len);
     ASSERT_EQ(HTTP_CONTENT_ENCODING_NONE, resp.content_encoding);
-    ASSERT_NE(nullptr, resp.select_location.memory.p_buf);
-    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_INFO, string("ruuvi.json: ") + string(expected_json));
+    ASSERT_NE(nullptr, resp.select_location.json_generator.p_json_gen);
+    const string json_str = http_resp_json_gen_to_str(resp.select_location.json_generator.p_json_gen);
+    ASSERT_EQ(json_str.size(), resp.content_len);
+    ASSERT_EQ(string(expected_json), cjson_str_to_formatted(json_str));
     TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_INFO, string("Activate cfg_mode"));
     ASSERT_TRUE(esp_log_wrapper_is_empty());
 }
@@ -1328,6 +1519,35 @@ TEST_F(TestHttpServerCb, resp_metrics_malloc_failed) // NOLINT
     ASSERT_TRUE(esp_log_wrapper_is_empty());
 }
 
+TEST_F(TestHttpServerCb, resp_adv_log_ok) // NOLINT
+{
+    const char*              expected_resp = "adv_log_text";
+    const http_server_resp_t resp          = http_server_resp_adv_log();
+
+    ASSERT_EQ(HTTP_RESP_CODE_200, resp.http_resp_code);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_HEAP, resp.content_location);
+    ASSERT_TRUE(resp.flag_no_cache);
+    ASSERT_EQ(HTTP_CONTENT_TYPE_TEXT_PLAIN, resp.content_type);
+    ASSERT_EQ(nullptr, resp.p_content_type_param);
+    ASSERT_EQ(strlen(expected_resp), resp.content_len);
+    ASSERT_EQ(HTTP_CONTENT_ENCODING_NONE, resp.content_encoding);
+    ASSERT_NE(nullptr, resp.select_location.memory.p_buf);
+    ASSERT_EQ(string(expected_resp), string(reinterpret_cast<const char*>(resp.select_location.memory.p_buf)));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestHttpServerCb, resp_adv_log_malloc_failed) // NOLINT
+{
+    g_pTestClass->m_malloc_fail_on_cnt = 1;
+    const http_server_resp_t resp      = http_server_resp_adv_log();
+
+    ASSERT_EQ(HTTP_RESP_CODE_503, resp.http_resp_code);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_NO_CONTENT, resp.content_location);
+    ASSERT_EQ(nullptr, resp.select_location.memory.p_buf);
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_ERROR, string("Not enough memory"));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
 TEST_F(TestHttpServerCb, http_get_content_type_by_ext) // NOLINT
 {
     ASSERT_EQ(HTTP_CONTENT_TYPE_TEXT_HTML, http_get_content_type_by_ext(".html"));
@@ -1434,6 +1654,40 @@ TEST_F(TestHttpServerCb, resp_file_index_html_gzipped) // NOLINT
     ASSERT_TRUE(esp_log_wrapper_is_empty());
 }
 
+TEST_F(TestHttpServerCb, resp_file_index_html_gzipped_with_manifest) // NOLINT
+{
+    const char*             expected_resp = "index_html_content";
+    const file_descriptor_t fd            = 2;
+    this->m_files.emplace_back(FileInfo(
+        "gwui_manifest.txt",
+        "index.html.gz 18 0\n"
+        "index.3f2a9c1b.js.gz 20 1\n"));
+    this->m_files.emplace_back(FileInfo("index.html.gz", expected_resp));
+    this->m_files.emplace_back(FileInfo("index.3f2a9c1b.js.gz", "index_js_content_gz_"));
+    ASSERT_TRUE(http_server_cb_init(GW_GWUI_PARTITION));
+    this->m_fd = fd;
+
+    const http_server_resp_t resp = http_server_resp_file("index.html", HTTP_RESP_CODE_200);
+    ASSERT_EQ(HTTP_RESP_CODE_200, resp.http_resp_code);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_FATFS, resp.content_location);
+    ASSERT_TRUE(resp.flag_no_cache);
+    ASSERT_EQ(HTTP_CONTENT_TYPE_TEXT_HTML, resp.content_type);
+    ASSERT_EQ(strlen(expected_resp), resp.content_len);
+    ASSERT_EQ(HTTP_CONTENT_ENCODING_GZIP, resp.content_encoding);
+    ASSERT_EQ(fd, resp.select_location.fatfs.fd);
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("Try to find file: index.html"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, "File index.html.gz was opened successfully, fd=2");
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+
+    const http_server_resp_t resp_js = http_server_resp_file("index.3f2a9c1b.js", HTTP_RESP_CODE_200);
+    ASSERT_EQ(HTTP_RESP_CODE_200, resp_js.http_resp_code);
+    ASSERT_FALSE(resp_js.flag_no_cache);
+    ASSERT_EQ(HTTP_CONTENT_TYPE_TEXT_JAVASCRIPT, resp_js.content_type);
+    ASSERT_EQ(20, resp_js.content_len);
+    ASSERT_EQ(HTTP_CONTENT_ENCODING_GZIP, resp_js.content_encoding);
+    esp_log_wrapper_clear();
+}
+
 TEST_F(TestHttpServerCb, resp_file_app_js_gzipped) // NOLINT
 {
     const char*             expected_resp = "app_js_gzipped";
@@ -1653,6 +1907,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_get_ruuvi_json) // NOLINT
           "\t\"mqtt_disable_retained_messages\":\tfalse,\n"
           "\t\"mqtt_transport\":\t\"TCP\",\n"
           "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+          "\t\"mqtt_qos\":\t0,\n"
           "\t\"mqtt_server\":\t\"test.mosquitto.org\",\n"
           "\t\"mqtt_port\":\t1883,\n"
           "\t\"mqtt_sending_interval\":\t0,\n"
@@ -1736,16 +1991,16 @@ TEST_F(TestHttpServerCb, http_server_cb_on_get_ruuvi_json) // NOLINT
     const http_server_resp_t resp = http_server_cb_on_get("ruuvi.json", nullptr, false, nullptr);
 
     ASSERT_EQ(HTTP_RESP_CODE_200, resp.http_resp_code);
-    ASSERT_EQ(HTTP_CONTENT_LOCATION_HEAP, resp.content_location);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_JSON_GENERATOR, resp.content_location);
     ASSERT_TRUE(resp.flag_no_cache);
     ASSERT_EQ(HTTP_CONTENT_TYPE_APPLICATION_JSON, resp.content_type);
     ASSERT_EQ(nullptr, resp.p_content_type_param);
-    ASSERT_EQ(string(expected_json), string(reinterpret_cast<const char*>(resp.select_location.memory.p_buf)));
-    ASSERT_EQ(strlen(expected_json), resp.content_len);
     ASSERT_EQ(HTTP_CONTENT_ENCODING_NONE, resp.content_encoding);
-    ASSERT_NE(nullptr, resp.select_location.memory.p_buf);
+    ASSERT_NE(nullptr, resp.select_location.json_generator.p_json_gen);
+    const string json_str = http_resp_json_gen_to_str(resp.select_location.json_generator.p_json_gen);
+    ASSERT_EQ(json_str.size(), resp.content_len);
+    ASSERT_EQ(string(expected_json), cjson_str_to_formatted(json_str));
     TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("http_server_cb_on_get /ruuvi.json"));
-    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_INFO, string("ruuvi.json: ") + string(expected_json));
     TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_INFO, string("Activate cfg_mode"));
     ASSERT_TRUE(esp_log_wrapper_is_empty());
 }
@@ -1805,6 +2060,10 @@ TEST_F(TestHttpServerCb, http_server_cb_on_get_history) // NOLINT
     ASSERT_EQ(HTTP_CONTENT_TYPE_APPLICATION_JSON, resp.content_type);
     ASSERT_EQ(nullptr, resp.p_content_type_param);
     ASSERT_EQ(HTTP_CONTENT_ENCODING_NONE, resp.content_encoding);
+    // The memory budget is held while the response is being generated
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_SERVER_RESP + sizeof(adv_report_table_t), this->m_http_mem_budget_reserved_size);
+    ASSERT_TRUE(this->m_http_mem_budget_flag_held);
+    ASSERT_FALSE(this->m_http_mem_budget_flag_released);
 
     ASSERT_NE(nullptr, resp.select_location.json_generator.p_json_gen);
     string json_str("");
@@ -1823,6 +2082,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_get_history) // NOLINT
         json_str += string(p_chunk);
     }
     ASSERT_EQ(string(expected_resp), json_str);
+    ASSERT_TRUE(this->m_http_mem_budget_flag_released);
 
     ASSERT_EQ(strlen(expected_resp), resp.content_len);
     TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("http_server_cb_on_get /history"));
@@ -2022,6 +2282,81 @@ TEST_F(TestHttpServerCb, http_server_cb_on_get_history_without_timestamps_with_f
     ASSERT_TRUE(esp_log_wrapper_is_empty());
 }
 
+TEST_F(TestHttpServerCb, http_server_cb_on_get_live_subscribe) // NOLINT
+{
+    g_pTestClass->m_live_stream_client_id = 7;
+    const char*              expected_resp = "{\"client\": 7}";
+    const http_server_resp_t resp          = http_server_cb_on_get("live", nullptr, false, nullptr);
+
+    ASSERT_EQ(HTTP_RESP_CODE_200, resp.http_resp_code);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_HEAP, resp.content_location);
+    ASSERT_TRUE(resp.flag_no_cache);
+    ASSERT_EQ(HTTP_CONTENT_TYPE_APPLICATION_JSON, resp.content_type);
+    ASSERT_EQ(strlen(expected_resp), resp.content_len);
+    ASSERT_NE(nullptr, resp.select_location.memory.p_buf);
+    ASSERT_EQ(string(expected_resp), string(reinterpret_cast<const char*>(resp.select_location.memory.p_buf)));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("http_server_cb_on_get /live"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_INFO, string("Requested /live: new client 7"));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestHttpServerCb, http_server_cb_on_get_live_no_free_slots) // NOLINT
+{
+    const http_server_resp_t resp = http_server_cb_on_get("live", nullptr, false, nullptr);
+
+    ASSERT_EQ(HTTP_RESP_CODE_503, resp.http_resp_code);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_NO_CONTENT, resp.content_location);
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("http_server_cb_on_get /live"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_WARN, string("Requested /live: all 4 slots for clients are in use"));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestHttpServerCb, http_server_cb_on_get_live_unknown_client) // NOLINT
+{
+    g_pTestClass->m_live_stream_client_id = 7;
+    const http_server_resp_t resp         = http_server_cb_on_get("live", "client=8", false, nullptr);
+
+    ASSERT_EQ(HTTP_RESP_CODE_404, resp.http_resp_code);
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("http_server_cb_on_get /live?client=8"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("HTTP params: client=8"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("Can't find key 'unsubscribe=' in URL params"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_INFO, string("Requested /live: unknown client 8"));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestHttpServerCb, http_server_cb_on_get_live_read) // NOLINT
+{
+    g_pTestClass->m_live_stream_client_id = 7;
+    const http_server_resp_t resp         = http_server_cb_on_get("live", "client=7", false, nullptr);
+
+    ASSERT_EQ(HTTP_RESP_CODE_200, resp.http_resp_code);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_JSON_GENERATOR, resp.content_location);
+    ASSERT_NE(nullptr, resp.select_location.json_generator.p_json_gen);
+    // The read is committed only after the response generator is created
+    ASSERT_EQ(1, g_pTestClass->m_live_stream_committed_ticket);
+    ASSERT_EQ(ADV_TABLE_TICKET_NONE, g_pTestClass->m_live_stream_rolled_back_ticket);
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("http_server_cb_on_get /live?client=7"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("HTTP params: client=7"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("Can't find key 'unsubscribe=' in URL params"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("Requested /live: client 7, num_advs=0"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("Can't find key 'decode=' in URL params"));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestHttpServerCb, http_server_cb_on_get_live_unsubscribe) // NOLINT
+{
+    g_pTestClass->m_live_stream_client_id = 7;
+    const http_server_resp_t resp = http_server_cb_on_get("live", "client=7&unsubscribe=true", false, nullptr);
+
+    ASSERT_EQ(HTTP_RESP_CODE_200, resp.http_resp_code);
+    ASSERT_EQ(ADV_LIVE_STREAM_CLIENT_ID_INVALID, g_pTestClass->m_live_stream_client_id);
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("http_server_cb_on_get /live?client=7&unsubscribe=true"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("HTTP params: client=7"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("HTTP params: unsubscribe=true"));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_INFO, string("Requested /live: unsubscribe client 7"));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
 TEST_F(TestHttpServerCb, http_server_cb_on_post_network_cfg) // NOLINT
 {
     const bool flag_access_from_lan = false;
@@ -2134,6 +2469,8 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_network_cfg_from_lan) // NOLINT
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_WARN, "Can't find key 'mqtt_transport' in config-json");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_data_format: not found");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_WARN, "Can't find key 'mqtt_data_format' in config-json");
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_qos: not found or invalid");
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_WARN, "Can't find key 'mqtt_qos' in config-json");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_server: not found");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_WARN, "Can't find key 'mqtt_server' in config-json");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_port: not found or invalid");
@@ -2222,6 +2559,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_network_cfg_from_lan) // NOLINT
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -2296,6 +2634,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_ok_mqtt_tcp) // NOLINT
                  "\"mqtt_disable_retained_messages\":false,"
                  "\"mqtt_transport\":\"TCP\","
                  "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+                 "\t\"mqtt_qos\":\t0,\n"
                  "\"mqtt_server\":\"test.mosquitto.org\","
                  "\"mqtt_port\":1883,"
                  "\"mqtt_sending_interval\":0,"
@@ -2349,6 +2688,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_ok_mqtt_tcp) // NOLINT
                "\"mqtt_disable_retained_messages\":false,"
                "\"mqtt_transport\":\"TCP\","
                "\t\"mqtt_data_format\":\t\"ruuvi_raw\","
+               "\n\"mqtt_qos\":0,"
                "\n\"mqtt_server\":\"test.mosquitto.org\","
                "\"mqtt_port\":1883,"
                "\"mqtt_sending_interval\":0,"
@@ -2379,6 +2719,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_ok_mqtt_tcp) // NOLINT
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_disable_retained_messages: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_transport: TCP");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_data_format: ruuvi_raw");
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_qos: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_server: test.mosquitto.org");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_port: 1883");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_sending_interval: 0");
@@ -2454,6 +2795,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_ok_mqtt_tcp) // NOLINT
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -2766,6 +3108,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_save_prev_lan_auth
         "\"mqtt_disable_retained_messages\":false,"
         "\"mqtt_transport\":\"TCP\","
         "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+        "\t\"mqtt_qos\":\t0,\n"
         "\"mqtt_server\":\"test.mosquitto.org\","
         "\"mqtt_port\":1883,"
         "\"mqtt_sending_interval\":0,"
@@ -2823,6 +3166,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_save_prev_lan_auth
                "\"mqtt_disable_retained_messages\":false,"
                "\"mqtt_transport\":\"TCP\","
                "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+               "\t\"mqtt_qos\":\t0,\n"
                "\"mqtt_server\":\"test.mosquitto.org\","
                "\"mqtt_port\":1883,\"mqtt_sending_interval\":0,"
                "\"mqtt_prefix\":\"ruuvi/30:AE:A4:02:84:A4\","
@@ -2853,6 +3197,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_save_prev_lan_auth
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_disable_retained_messages: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_transport: TCP");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_data_format: ruuvi_raw");
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_qos: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_server: test.mosquitto.org");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_port: 1883");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_sending_interval: 0");
@@ -2925,6 +3270,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_save_prev_lan_auth
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -3016,6 +3362,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_overwrite_lan_auth
         "\"mqtt_disable_retained_messages\":false,"
         "\"mqtt_transport\":\"TCP\","
         "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+        "\t\"mqtt_qos\":\t0,\n"
         "\"mqtt_server\":\"test.mosquitto.org\","
         "\"mqtt_port\":1883,"
         "\"mqtt_sending_interval\":0,"
@@ -3077,6 +3424,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_overwrite_lan_auth
                "\"mqtt_disable_retained_messages\":false,"
                "\"mqtt_transport\":\"TCP\","
                "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+               "\t\"mqtt_qos\":\t0,\n"
                "\"mqtt_server\":\"test.mosquitto.org\","
                "\"mqtt_port\":1883,"
                "\"mqtt_sending_interval\":0,"
@@ -3112,6 +3460,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_overwrite_lan_auth
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_disable_retained_messages: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_transport: TCP");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_data_format: ruuvi_raw");
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_qos: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_server: test.mosquitto.org");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_port: 1883");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_sending_interval: 0");
@@ -3180,6 +3529,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_overwrite_lan_auth
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -3257,6 +3607,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok) // NOLINT
                  "\"mqtt_disable_retained_messages\":false,"
                  "\"mqtt_transport\":\"TCP\","
                  "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+                 "\t\"mqtt_qos\":\t0,\n"
                  "\"mqtt_server\":\"test.mosquitto.org\","
                  "\"mqtt_port\":1883,"
                  "\"mqtt_sending_interval\":0,"
@@ -3313,6 +3664,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok) // NOLINT
                "\"mqtt_disable_retained_messages\":false,"
                "\"mqtt_transport\":\"TCP\","
                "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+               "\t\"mqtt_qos\":\t0,\n"
                "\"mqtt_server\":\"test.mosquitto.org\","
                "\"mqtt_port\":1883,"
                "\"mqtt_sending_interval\":0,"
@@ -3344,6 +3696,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok) // NOLINT
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_disable_retained_messages: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_transport: TCP");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_data_format: ruuvi_raw");
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_qos: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_server: test.mosquitto.org");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_port: 1883");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_sending_interval: 0");
@@ -3419,6 +3772,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok) // NOLINT
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -3493,6 +3847,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_wifi_ap_active) //
                  "\"mqtt_disable_retained_messages\":false,"
                  "\"mqtt_transport\":\"TCP\","
                  "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+                 "\t\"mqtt_qos\":\t0,\n"
                  "\"mqtt_server\":\"test.mosquitto.org\","
                  "\"mqtt_port\":1883,"
                  "\"mqtt_sending_interval\":0,"
@@ -3549,6 +3904,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_wifi_ap_active) //
                "\"mqtt_disable_retained_messages\":false,"
                "\"mqtt_transport\":\"TCP\","
                "\t\"mqtt_data_format\":\t\"ruuvi_raw\",\n"
+               "\t\"mqtt_qos\":\t0,\n"
                "\"mqtt_server\":\"test.mosquitto.org\","
                "\"mqtt_port\":1883,"
                "\"mqtt_sending_interval\":0,"
@@ -3580,6 +3936,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_wifi_ap_active) //
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_disable_retained_messages: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_transport: TCP");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_data_format: ruuvi_raw");
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_qos: 0");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_server: test.mosquitto.org");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_port: 1883");
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_DEBUG, "mqtt_sending_interval: 0");
@@ -3655,6 +4012,7 @@ TEST_F(TestHttpServerCb, http_server_cb_on_post_ruuvi_json_ok_wifi_ap_active) //
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt disable retained messages: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt transport: TCP"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt data format: ruuvi_raw"));
+    TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt QoS: 0"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt server: test.mosquitto.org"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt port: 1883"));
     TEST_CHECK_LOG_RECORD_GW_CFG(ESP_LOG_INFO, string("config: mqtt sending interval: 0"));
@@ -3760,6 +4118,48 @@ TEST_F(TestHttpServerCb, http_server_cb_on_delete) // NOLINT
     ASSERT_TRUE(esp_log_wrapper_is_empty());
 }
 
+TEST_F(TestHttpServerCb, http_server_cb_on_post_no_mem_budget) // NOLINT
+{
+    this->m_http_mem_budget_reserve_res = false;
+
+    const http_server_resp_t resp = http_server_cb_on_post("ruuvi.json", nullptr, "{}", false);
+
+    ASSERT_FALSE(this->m_flag_settings_saved_to_flash);
+    ASSERT_EQ(HTTP_RESP_CODE_503, resp.http_resp_code);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_NO_CONTENT, resp.content_location);
+    ASSERT_TRUE(resp.flag_no_cache);
+    ASSERT_EQ(HTTP_CONTENT_TYPE_TEXT_HTML, resp.content_type);
+    ASSERT_EQ(nullptr, resp.p_content_type_param);
+    ASSERT_EQ(0, resp.content_len);
+    ASSERT_EQ(HTTP_CONTENT_ENCODING_NONE, resp.content_encoding);
+    ASSERT_EQ(nullptr, resp.select_location.memory.p_buf);
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(ESP_LOG_DEBUG, string("http_server_cb_on_post /ruuvi.json, params="));
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(
+        ESP_LOG_WARN,
+        string("Not enough memory budget to handle POST /ruuvi.json, try again later"));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
+TEST_F(TestHttpServerCb, http_server_cb_on_delete_no_mem_budget) // NOLINT
+{
+    this->m_http_mem_budget_reserve_res = false;
+
+    const http_server_resp_t resp = http_server_cb_on_delete("ssl_cert", "file=mqtt_cli_cert", false, nullptr);
+
+    ASSERT_EQ(HTTP_RESP_CODE_503, resp.http_resp_code);
+    ASSERT_EQ(HTTP_CONTENT_LOCATION_NO_CONTENT, resp.content_location);
+    ASSERT_TRUE(resp.flag_no_cache);
+    ASSERT_EQ(HTTP_CONTENT_TYPE_TEXT_HTML, resp.content_type);
+    ASSERT_EQ(nullptr, resp.p_content_type_param);
+    ASSERT_EQ(0, resp.content_len);
+    ASSERT_EQ(HTTP_CONTENT_ENCODING_NONE, resp.content_encoding);
+    ASSERT_EQ(nullptr, resp.select_location.memory.p_buf);
+    TEST_CHECK_LOG_RECORD_HTTP_SERVER(
+        ESP_LOG_WARN,
+        string("Not enough memory budget to handle DELETE /ssl_cert, try again later"));
+    ASSERT_TRUE(esp_log_wrapper_is_empty());
+}
+
 TEST_F(TestHttpServerCb, test_http_download_is_url_valid) // NOLINT
 {
     ASSERT_FALSE(http_download_is_url_valid(""));
@@ -3808,6 +4208,8 @@ TEST_F(
         = "validate_type=check_fw_update_url&url=https://network.ruuvi.com/firmwareupdate&auth_type=none";
 
     const http_server_resp_t resp = http_server_cb_on_get("validate_url", p_uri_params, true, nullptr);
+    // The outgoing connection is opened while handling the request
+    ASSERT_EQ(HTTP_MEM_BUDGET_HTTP_SERVER_RESP + HTTP_MEM_BUDGET_HTTP_POST, this->m_http_mem_budget_reserved_size);
 
     ASSERT_EQ(HTTP_RESP_CODE_200, resp.http_resp_code);
     ASSERT_EQ(HTTP_CONTENT_LOCATION_HEAP, resp.content_location);
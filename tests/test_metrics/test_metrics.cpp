@@ -21,6 +21,16 @@
 #include "esp_log_wrapper.hpp"
 #include "lwip/ip4_addr.h"
 #include "event_mgr.h"
+#include "mqtt.h"
+#include "boot_timeline.h"
+#include "adv_post_sched.h"
+#include "http_async_gov.h"
+#include "http_mem_budget.h"
+#include "runtime_stat.h"
+#include "heap_prof.h"
+#include "adv_report_pool.h"
+#include "adv_log_ring.h"
+#include "adv_live_stream.h"
 #include "gw_cfg_default.h"
 #include "cJSON.h"
 
@@ -259,6 +269,190 @@ event_mgr_notify(const event_mgr_ev_e event)
 {
 }
 
+void
+event_mgr_get_stat(const event_mgr_ev_e event, event_mgr_ev_stat_t* const p_stat)
+{
+    p_stat->cnt_notify    = (uint32_t)event;
+    p_stat->cnt_sent      = (EVENT_MGR_EV_RECV_ADV == event) ? 30 : (uint32_t)event;
+    p_stat->cnt_coalesced = (EVENT_MGR_EV_RECV_ADV == event) ? 10 : 0;
+}
+
+const char*
+event_mgr_get_ev_name(const event_mgr_ev_e event)
+{
+    static char name_buf[16];
+    snprintf(name_buf, sizeof(name_buf), "ev%d", (int)event);
+    return name_buf;
+}
+
+void
+mqtt_get_stat(mqtt_stat_t* const p_stat)
+{
+    p_stat->qos                          = 1;
+    p_stat->outbox_size                  = 1536;
+    p_stat->in_flight.num_in_flight      = 3;
+    p_stat->in_flight.cnt_published      = 20;
+    p_stat->in_flight.cnt_acked          = 16;
+    p_stat->in_flight.cnt_lost           = 1;
+    p_stat->in_flight.ack_latency_ms_sum = 800;
+    p_stat->in_flight.ack_latency_ms_max = 120;
+    p_stat->cnt_topic_cache_hits         = 20;
+    p_stat->cnt_topic_cache_rebuilds     = 1;
+    p_stat->topic_bytes_total            = 500;
+    p_stat->topic_cache_saved_bytes      = 300;
+}
+
+void
+boot_timeline_get(boot_timeline_t* const p_timeline)
+{
+    memset(p_timeline, 0, sizeof(*p_timeline));
+    p_timeline->stages[BOOT_TIMELINE_STAGE_APP_MAIN]          = 312000;
+    p_timeline->stages[BOOT_TIMELINE_STAGE_NETWORK_CONNECTED] = 2450000;
+}
+
+const char*
+boot_timeline_get_stage_name(const boot_timeline_stage_e stage)
+{
+    static char name_buf[16];
+    snprintf(name_buf, sizeof(name_buf), "stage%d", (int)stage);
+    return name_buf;
+}
+
+void
+adv_post_sched_get_stat(const adv_post_sched_target_e target, adv_post_sched_stat_t* const p_stat)
+{
+    memset(p_stat, 0, sizeof(*p_stat));
+    p_stat->cnt_started           = 10 + (uint32_t)target;
+    p_stat->cnt_failed            = 2;
+    p_stat->cnt_deadline_missed   = 1;
+    p_stat->cnt_rate_limited      = 3;
+    p_stat->cnt_skipped_backoff   = 4;
+    p_stat->cnt_aged_out          = 0;
+    p_stat->queueing_delay_ms_sum = 5000000000ULL;
+    p_stat->queueing_delay_ms_max = 700;
+}
+
+const char*
+adv_post_sched_get_target_name(const adv_post_sched_target_e target)
+{
+    static char name_buf[16];
+    snprintf(name_buf, sizeof(name_buf), "target%d", (int)target);
+    return name_buf;
+}
+
+void
+http_async_gov_get_stat(http_async_gov_stat_t* const p_stat)
+{
+    p_stat->cnt_concurrent_admitted = 5;
+    p_stat->cnt_serial_fallback     = 2;
+    p_stat->cnt_mem_budget_exceeded = 1;
+    p_stat->max_mem_usage_per_req   = 43210;
+}
+
+void
+http_mem_budget_get_stat(http_mem_budget_stat_t* const p_stat)
+{
+    for (uint32_t i = 0; i < HTTP_MEM_BUDGET_CLIENT_NUM; ++i)
+    {
+        p_stat->cnt_admitted[i] = 100 + i;
+        p_stat->cnt_rejected[i] = i;
+    }
+    p_stat->max_reserved = 98304;
+}
+
+const char*
+http_mem_budget_get_client_name(const http_mem_budget_client_e client)
+{
+    static char name_buf[16];
+    snprintf(name_buf, sizeof(name_buf), "client%d", (int)client);
+    return name_buf;
+}
+
+uint32_t
+runtime_stat_get_tasks_metrics(runtime_stat_task_metrics_t* const p_arr_of_tasks, const uint32_t max_num_tasks)
+{
+    (void)max_num_tasks;
+    snprintf(p_arr_of_tasks[0].task_name, sizeof(p_arr_of_tasks[0].task_name), "%s", "main");
+    p_arr_of_tasks[0].task_number         = 5;
+    p_arr_of_tasks[0].p_state             = "Rdy";
+    p_arr_of_tasks[0].cpu_usage_percent   = 12;
+    p_arr_of_tasks[0].stack_size          = 8192;
+    p_arr_of_tasks[0].min_free_stack_size = 1024;
+    snprintf(p_arr_of_tasks[1].task_name, sizeof(p_arr_of_tasks[1].task_name), "%s", "http_server");
+    p_arr_of_tasks[1].task_number         = 12;
+    p_arr_of_tasks[1].p_state             = "Blk";
+    p_arr_of_tasks[1].cpu_usage_percent   = RUNTIME_STAT_CPU_USAGE_UNKNOWN;
+    p_arr_of_tasks[1].stack_size          = 4096;
+    p_arr_of_tasks[1].min_free_stack_size = 512;
+    // On dual-core targets each core has its own "IDLE" task
+    snprintf(p_arr_of_tasks[2].task_name, sizeof(p_arr_of_tasks[2].task_name), "%s", "IDLE");
+    p_arr_of_tasks[2].task_number         = 1;
+    p_arr_of_tasks[2].p_state             = "Rdy";
+    p_arr_of_tasks[2].cpu_usage_percent   = 80;
+    p_arr_of_tasks[2].stack_size          = 1536;
+    p_arr_of_tasks[2].min_free_stack_size = 600;
+    snprintf(p_arr_of_tasks[3].task_name, sizeof(p_arr_of_tasks[3].task_name), "%s", "IDLE");
+    p_arr_of_tasks[3].task_number         = 2;
+    p_arr_of_tasks[3].p_state             = "Rdy";
+    p_arr_of_tasks[3].cpu_usage_percent   = 95;
+    p_arr_of_tasks[3].stack_size          = 1536;
+    p_arr_of_tasks[3].min_free_stack_size = 610;
+    return 4;
+}
+
+void
+heap_prof_get_stat(heap_prof_stat_t* const p_stat)
+{
+    p_stat->flag_enabled = true;
+    for (uint32_t i = 0; i < HEAP_PROF_TAG_NUM; ++i)
+    {
+        p_stat->tags[i].live_bytes       = 1000 + i;
+        p_stat->tags[i].peak_bytes       = 2000 + i;
+        p_stat->tags[i].cnt_alloc        = 30 + i;
+        p_stat->tags[i].cnt_alloc_failed = i;
+    }
+    p_stat->largest_free_blk_cur   = 40000;
+    p_stat->largest_free_blk_min   = 35000;
+    p_stat->largest_free_blk_trend = -1500;
+}
+
+const char*
+heap_prof_get_tag_name(const heap_prof_tag_e tag)
+{
+    static char name_buf[16];
+    snprintf(name_buf, sizeof(name_buf), "tag%d", (int)tag);
+    return name_buf;
+}
+
+void
+adv_report_pool_get_stat(adv_report_pool_stat_t* const p_stat)
+{
+    p_stat->cnt_checkout  = 120;
+    p_stat->cnt_exhausted = 2;
+    p_stat->num_in_use    = 1;
+    p_stat->max_in_use    = 3;
+}
+
+void
+adv_live_stream_get_stat(adv_live_stream_stat_t* const p_stat)
+{
+    p_stat->num_clients       = 1;
+    p_stat->cnt_subscribed    = 5;
+    p_stat->cnt_rejected      = 1;
+    p_stat->cnt_expired       = 2;
+    p_stat->cnt_polls         = 300;
+    p_stat->cnt_advs          = 4500;
+    p_stat->max_advs_per_poll = 40;
+}
+
+void
+adv_log_ring_get_stat(adv_log_ring_stat_t* const p_stat)
+{
+    p_stat->cnt_put         = 2500;
+    p_stat->cnt_overwritten = 2372;
+    p_stat->cnt_dropped     = 7;
+}
+
 int64_t
 esp_timer_get_time()
 {
@@ -371,6 +565,152 @@ gw_cfg_storage_check_file(const char* const p_file_name)
 
 #define TEST_CHECK_LOG_RECORD(level_, msg_) ESP_LOG_WRAPPER_TEST_CHECK_LOG_RECORD("metrics", level_, msg_)
 
+static string
+exp_event_mgr_metrics()
+{
+    string res;
+    for (int i = EVENT_MGR_EV_NONE + 1; i < EVENT_MGR_EV_LAST; ++i)
+    {
+        res += string("ruuvigw_event_notify_total{event=\"ev") + std::to_string(i) + "\"} " + std::to_string(i) + "\n";
+    }
+    const string recv_adv_name = std::to_string((int)EVENT_MGR_EV_RECV_ADV);
+    res += string("ruuvigw_event_signals_sent_total{event=\"ev") + recv_adv_name + "\"} 30\n";
+    res += string("ruuvigw_event_signals_coalesced_total{event=\"ev") + recv_adv_name + "\"} 10\n";
+    res += string("ruuvigw_event_signals_coalesce_ratio{event=\"ev") + recv_adv_name + "\"} 0.250\n";
+    return res;
+}
+
+static string
+exp_mqtt_metrics()
+{
+    return string(
+        "ruuvigw_mqtt_qos 1\n"
+        "ruuvigw_mqtt_outbox_size_bytes 1536\n"
+        "ruuvigw_mqtt_in_flight_msgs 3\n"
+        "ruuvigw_mqtt_published_msgs_total{qos=\"1+\"} 20\n"
+        "ruuvigw_mqtt_lost_msgs_total{qos=\"1+\"} 1\n"
+        "ruuvigw_mqtt_puback_latency_ms_sum 800\n"
+        "ruuvigw_mqtt_puback_latency_ms_count 16\n"
+        "ruuvigw_mqtt_puback_latency_ms_max 120\n"
+        "ruuvigw_mqtt_topic_cache_hits_total 20\n"
+        "ruuvigw_mqtt_topic_cache_rebuilds_total 1\n"
+        "ruuvigw_mqtt_topic_bytes_total 500\n"
+        "ruuvigw_mqtt_topic_cache_saved_bytes_total 300\n");
+}
+
+static string
+exp_adv_post_sched_metrics()
+{
+    string res;
+    for (int i = 0; i < ADV_POST_SCHED_TARGET_LAST; ++i)
+    {
+        const string label = string("{target=\"target") + std::to_string(i) + "\"} ";
+        res += string("ruuvigw_adv_post_started_total") + label + std::to_string(10 + i) + "\n";
+        res += string("ruuvigw_adv_post_failed_total") + label + "2\n";
+        res += string("ruuvigw_adv_post_deadline_missed_total") + label + "1\n";
+        res += string("ruuvigw_adv_post_rate_limited_total") + label + "3\n";
+        res += string("ruuvigw_adv_post_skipped_backoff_total") + label + "4\n";
+        res += string("ruuvigw_adv_post_aged_out_total") + label + "0\n";
+        res += string("ruuvigw_adv_post_queueing_delay_ms_sum") + label + "5000000000\n";
+        res += string("ruuvigw_adv_post_queueing_delay_ms_max") + label + "700\n";
+    }
+    return res;
+}
+
+static string
+exp_http_async_gov_metrics()
+{
+    return string(
+        "ruuvigw_http_async_concurrent_admitted_total 5\n"
+        "ruuvigw_http_async_serial_fallback_total 2\n"
+        "ruuvigw_http_async_mem_budget_exceeded_total 1\n"
+        "ruuvigw_http_async_max_mem_usage_per_req_bytes 43210\n");
+}
+
+static string
+exp_http_mem_budget_metrics()
+{
+    string res;
+    for (int i = 0; i < HTTP_MEM_BUDGET_CLIENT_NUM; ++i)
+    {
+        const string label = string("{client=\"client") + std::to_string(i) + "\"} ";
+        res += string("ruuvigw_http_mem_budget_admitted_total") + label + std::to_string(100 + i) + "\n";
+        res += string("ruuvigw_http_mem_budget_rejected_total") + label + std::to_string(i) + "\n";
+    }
+    res += string("ruuvigw_http_mem_budget_max_reserved_bytes 98304\n");
+    return res;
+}
+
+static string
+exp_runtime_stat_metrics()
+{
+    return string(
+        "ruuvigw_task_cpu_usage_percent{task=\"main\",task_num=\"5\"} 12\n"
+        "ruuvigw_task_stack_size_bytes{task=\"main\",task_num=\"5\"} 8192\n"
+        "ruuvigw_task_stack_free_min_bytes{task=\"main\",task_num=\"5\"} 1024\n"
+        "ruuvigw_task_state{task=\"main\",task_num=\"5\",state=\"Rdy\"} 1\n"
+        "ruuvigw_task_stack_size_bytes{task=\"http_server\",task_num=\"12\"} 4096\n"
+        "ruuvigw_task_stack_free_min_bytes{task=\"http_server\",task_num=\"12\"} 512\n"
+        "ruuvigw_task_state{task=\"http_server\",task_num=\"12\",state=\"Blk\"} 1\n"
+        "ruuvigw_task_cpu_usage_percent{task=\"IDLE\",task_num=\"1\"} 80\n"
+        "ruuvigw_task_stack_size_bytes{task=\"IDLE\",task_num=\"1\"} 1536\n"
+        "ruuvigw_task_stack_free_min_bytes{task=\"IDLE\",task_num=\"1\"} 600\n"
+        "ruuvigw_task_state{task=\"IDLE\",task_num=\"1\",state=\"Rdy\"} 1\n"
+        "ruuvigw_task_cpu_usage_percent{task=\"IDLE\",task_num=\"2\"} 95\n"
+        "ruuvigw_task_stack_size_bytes{task=\"IDLE\",task_num=\"2\"} 1536\n"
+        "ruuvigw_task_stack_free_min_bytes{task=\"IDLE\",task_num=\"2\"} 610\n"
+        "ruuvigw_task_state{task=\"IDLE\",task_num=\"2\",state=\"Rdy\"} 1\n");
+}
+
+static string
+exp_heap_prof_metrics()
+{
+    string res = string(
+        "ruuvigw_heap_largest_free_block_min_bytes 35000\n"
+        "ruuvigw_heap_largest_free_block_trend_bytes -1500\n");
+    for (int i = 0; i < HEAP_PROF_TAG_NUM; ++i)
+    {
+        const string label = string("{tag=\"tag") + std::to_string(i) + "\"} ";
+        res += string("ruuvigw_heap_prof_live_bytes") + label + std::to_string(1000 + i) + "\n";
+        res += string("ruuvigw_heap_prof_peak_bytes") + label + std::to_string(2000 + i) + "\n";
+        res += string("ruuvigw_heap_prof_alloc_total") + label + std::to_string(30 + i) + "\n";
+        res += string("ruuvigw_heap_prof_alloc_failed_total") + label + std::to_string(i) + "\n";
+    }
+    return res;
+}
+
+static string
+exp_adv_report_pool_metrics()
+{
+    return string(
+        "ruuvigw_adv_report_pool_checkout_total 120\n"
+        "ruuvigw_adv_report_pool_exhausted_total 2\n"
+        "ruuvigw_adv_report_pool_in_use 1\n"
+        "ruuvigw_adv_report_pool_max_in_use 3\n");
+}
+
+static string
+exp_adv_live_stream_metrics()
+{
+    return string(
+        "ruuvigw_live_stream_clients 1\n"
+        "ruuvigw_live_stream_subscribed_total 5\n"
+        "ruuvigw_live_stream_rejected_total 1\n"
+        "ruuvigw_live_stream_expired_total 2\n"
+        "ruuvigw_live_stream_polls_total 300\n"
+        "ruuvigw_live_stream_advs_total 4500\n"
+        "ruuvigw_live_stream_max_advs_per_poll 40\n");
+}
+
+static string
+exp_adv_log_ring_metrics()
+{
+    return string(
+        "ruuvigw_adv_log_records_total 2500\n"
+        "ruuvigw_adv_log_overwritten_total 2372\n"
+        "ruuvigw_adv_log_dropped_total 7\n");
+}
+
 /*** Unit-Tests
  * *******************************************************************************************************/
 
@@ -398,6 +738,8 @@ TEST_F(TestMetrics, test_metrics_generate) // NOLINT
                "ruuvigw_received_ext_advertisements 0\n"
                "ruuvigw_received_coded_advertisements 0\n"
                "ruuvigw_uptime_us 15317668796\n"
+               "ruuvigw_boot_stage_timestamp_us{stage=\"stage0\"} 312000\n"
+               "ruuvigw_boot_stage_timestamp_us{stage=\"stage9\"} 2450000\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_EXEC\"} 194796\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_32BIT\"} 201116\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_8BIT\"} 134284\n"
@@ -426,7 +768,11 @@ TEST_F(TestMetrics, test_metrics_generate) // NOLINT
                "ruuvigw_heap_largest_free_block_bytes{capability=\"MALLOC_CAP_DEFAULT\"} 65548\n"
                "ruuvigw_info{mac=\"AA:BB:CC:DD:EE:FF\",esp_fw=\"v1.10.0\",nrf_fw=\"v0.7.2\"} 1\n"
                "ruuvigw_gw_cfg_crc32 2864434397\n"
-               "ruuvigw_ruuvi_json_crc32 2864434397\n"),
+               "ruuvigw_ruuvi_json_crc32 2864434397\n")
+            + exp_event_mgr_metrics() + exp_mqtt_metrics() + exp_adv_post_sched_metrics()
+            + exp_http_async_gov_metrics() + exp_http_mem_budget_metrics() + exp_runtime_stat_metrics()
+            + exp_heap_prof_metrics() + exp_adv_report_pool_metrics() + exp_adv_live_stream_metrics()
+            + exp_adv_log_ring_metrics(),
         string(p_metrics_str));
     os_free(p_metrics_str);
 
@@ -439,6 +785,8 @@ TEST_F(TestMetrics, test_metrics_generate) // NOLINT
                "ruuvigw_received_ext_advertisements 0\n"
                "ruuvigw_received_coded_advertisements 0\n"
                "ruuvigw_uptime_us 15317668797\n"
+               "ruuvigw_boot_stage_timestamp_us{stage=\"stage0\"} 312000\n"
+               "ruuvigw_boot_stage_timestamp_us{stage=\"stage9\"} 2450000\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_EXEC\"} 194796\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_32BIT\"} 201116\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_8BIT\"} 134284\n"
@@ -467,7 +815,11 @@ TEST_F(TestMetrics, test_metrics_generate) // NOLINT
                "ruuvigw_heap_largest_free_block_bytes{capability=\"MALLOC_CAP_DEFAULT\"} 65548\n"
                "ruuvigw_info{mac=\"AA:BB:CC:DD:EE:FF\",esp_fw=\"v1.10.0\",nrf_fw=\"v0.7.2\"} 1\n"
                "ruuvigw_gw_cfg_crc32 2864434397\n"
-               "ruuvigw_ruuvi_json_crc32 2864434397\n"),
+               "ruuvigw_ruuvi_json_crc32 2864434397\n")
+            + exp_event_mgr_metrics() + exp_mqtt_metrics() + exp_adv_post_sched_metrics()
+            + exp_http_async_gov_metrics() + exp_http_mem_budget_metrics() + exp_runtime_stat_metrics()
+            + exp_heap_prof_metrics() + exp_adv_report_pool_metrics() + exp_adv_live_stream_metrics()
+            + exp_adv_log_ring_metrics(),
         string(p_metrics_str));
     os_free(p_metrics_str);
     ASSERT_TRUE(esp_log_wrapper_is_empty());
@@ -480,6 +832,8 @@ TEST_F(TestMetrics, test_metrics_generate) // NOLINT
                "ruuvigw_received_ext_advertisements 1\n"
                "ruuvigw_received_coded_advertisements 0\n"
                "ruuvigw_uptime_us 15317668797\n"
+               "ruuvigw_boot_stage_timestamp_us{stage=\"stage0\"} 312000\n"
+               "ruuvigw_boot_stage_timestamp_us{stage=\"stage9\"} 2450000\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_EXEC\"} 194796\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_32BIT\"} 201116\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_8BIT\"} 134284\n"
@@ -508,7 +862,11 @@ TEST_F(TestMetrics, test_metrics_generate) // NOLINT
                "ruuvigw_heap_largest_free_block_bytes{capability=\"MALLOC_CAP_DEFAULT\"} 65548\n"
                "ruuvigw_info{mac=\"AA:BB:CC:DD:EE:FF\",esp_fw=\"v1.10.0\",nrf_fw=\"v0.7.2\"} 1\n"
                "ruuvigw_gw_cfg_crc32 2864434397\n"
-               "ruuvigw_ruuvi_json_crc32 2864434397\n"),
+               "ruuvigw_ruuvi_json_crc32 2864434397\n")
+            + exp_event_mgr_metrics() + exp_mqtt_metrics() + exp_adv_post_sched_metrics()
+            + exp_http_async_gov_metrics() + exp_http_mem_budget_metrics() + exp_runtime_stat_metrics()
+            + exp_heap_prof_metrics() + exp_adv_report_pool_metrics() + exp_adv_live_stream_metrics()
+            + exp_adv_log_ring_metrics(),
         string(p_metrics_str));
     os_free(p_metrics_str);
     ASSERT_TRUE(esp_log_wrapper_is_empty());
@@ -521,6 +879,8 @@ TEST_F(TestMetrics, test_metrics_generate) // NOLINT
                "ruuvigw_received_ext_advertisements 1\n"
                "ruuvigw_received_coded_advertisements 1\n"
                "ruuvigw_uptime_us 15317668797\n"
+               "ruuvigw_boot_stage_timestamp_us{stage=\"stage0\"} 312000\n"
+               "ruuvigw_boot_stage_timestamp_us{stage=\"stage9\"} 2450000\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_EXEC\"} 194796\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_32BIT\"} 201116\n"
                "ruuvigw_heap_free_bytes{capability=\"MALLOC_CAP_8BIT\"} 134284\n"
@@ -549,7 +909,11 @@ TEST_F(TestMetrics, test_metrics_generate) // NOLINT
                "ruuvigw_heap_largest_free_block_bytes{capability=\"MALLOC_CAP_DEFAULT\"} 65548\n"
                "ruuvigw_info{mac=\"AA:BB:CC:DD:EE:FF\",esp_fw=\"v1.10.0\",nrf_fw=\"v0.7.2\"} 1\n"
                "ruuvigw_gw_cfg_crc32 2864434397\n"
-               "ruuvigw_ruuvi_json_crc32 2864434397\n"),
+               "ruuvigw_ruuvi_json_crc32 2864434397\n")
+            + exp_event_mgr_metrics() + exp_mqtt_metrics() + exp_adv_post_sched_metrics()
+            + exp_http_async_gov_metrics() + exp_http_mem_budget_metrics() + exp_runtime_stat_metrics()
+            + exp_heap_prof_metrics() + exp_adv_report_pool_metrics() + exp_adv_live_stream_metrics()
+            + exp_adv_log_ring_metrics(),
         string(p_metrics_str));
     os_free(p_metrics_str);
     ASSERT_TRUE(esp_log_wrapper_is_empty());
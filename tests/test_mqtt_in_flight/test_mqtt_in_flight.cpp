@@ -0,0 +1,172 @@
+/**
+ * @file test_mqtt_in_flight.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "mqtt_in_flight.h"
+#include "gtest/gtest.h"
+#include "os_mutex.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestMqttInFlight : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        mqtt_in_flight_init();
+    }
+
+    void
+    TearDown() override
+    {
+        mqtt_in_flight_deinit();
+    }
+
+public:
+    TestMqttInFlight();
+
+    ~TestMqttInFlight() override;
+};
+
+TestMqttInFlight::TestMqttInFlight()
+    : Test()
+{
+}
+
+TestMqttInFlight::~TestMqttInFlight() = default;
+
+extern "C" {
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    return reinterpret_cast<os_mutex_t>(p_mutex_static);
+}
+
+void
+os_mutex_delete(os_mutex_t* const ph_mutex)
+{
+    *ph_mutex = nullptr;
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    (void)h_mutex;
+}
+
+} // extern "C"
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestMqttInFlight, test_publish_and_ack) // NOLINT
+{
+    mqtt_in_flight_stat_t stat = {};
+    mqtt_in_flight_get_stat(&stat, 1000);
+    ASSERT_EQ(0, stat.num_in_flight);
+    ASSERT_EQ(0, stat.cnt_published);
+
+    mqtt_in_flight_on_publish(0, 1000); // QoS 0 - not tracked
+    mqtt_in_flight_on_publish(-1, 1000);
+    mqtt_in_flight_on_publish(11, 1000);
+    mqtt_in_flight_on_publish(12, 1010);
+    mqtt_in_flight_get_stat(&stat, 1010);
+    ASSERT_EQ(2, stat.num_in_flight);
+    ASSERT_EQ(2, stat.cnt_published);
+
+    ASSERT_TRUE(mqtt_in_flight_on_ack(12, 1030));
+    ASSERT_FALSE(mqtt_in_flight_on_ack(12, 1031));
+    ASSERT_FALSE(mqtt_in_flight_on_ack(13, 1031));
+    ASSERT_TRUE(mqtt_in_flight_on_ack(11, 1100));
+
+    mqtt_in_flight_get_stat(&stat, 1100);
+    ASSERT_EQ(0, stat.num_in_flight);
+    ASSERT_EQ(2, stat.cnt_published);
+    ASSERT_EQ(2, stat.cnt_acked);
+    ASSERT_EQ(0, stat.cnt_lost);
+    ASSERT_EQ(20 + 100, stat.ack_latency_ms_sum);
+    ASSERT_EQ(100, stat.ack_latency_ms_max);
+}
+
+TEST_F(TestMqttInFlight, test_expired) // NOLINT
+{
+    mqtt_in_flight_on_publish(1, UINT32_MAX - 10);
+    mqtt_in_flight_on_publish(2, UINT32_MAX - 5);
+
+    mqtt_in_flight_stat_t stat = {};
+    mqtt_in_flight_get_stat(&stat, MQTT_IN_FLIGHT_EXPIRATION_MS - 12);
+    ASSERT_EQ(2, stat.num_in_flight);
+    ASSERT_EQ(0, stat.cnt_lost);
+
+    mqtt_in_flight_get_stat(&stat, MQTT_IN_FLIGHT_EXPIRATION_MS - 11);
+    ASSERT_EQ(1, stat.num_in_flight);
+    ASSERT_EQ(1, stat.cnt_lost);
+
+    ASSERT_FALSE(mqtt_in_flight_on_ack(1, MQTT_IN_FLIGHT_EXPIRATION_MS - 10));
+    ASSERT_TRUE(mqtt_in_flight_on_ack(2, MQTT_IN_FLIGHT_EXPIRATION_MS - 10));
+    mqtt_in_flight_get_stat(&stat, MQTT_IN_FLIGHT_EXPIRATION_MS - 10);
+    ASSERT_EQ(0, stat.num_in_flight);
+    ASSERT_EQ(1, stat.cnt_acked);
+    ASSERT_EQ(1, stat.cnt_lost);
+    ASSERT_EQ(MQTT_IN_FLIGHT_EXPIRATION_MS - 4, stat.ack_latency_ms_sum);
+}
+
+TEST_F(TestMqttInFlight, test_overflow_and_clear) // NOLINT
+{
+    for (uint32_t i = 0; i < MQTT_IN_FLIGHT_MAX_NUM_MSGS; ++i)
+    {
+        mqtt_in_flight_on_publish((mqtt_in_flight_msg_id_t)(i + 1), 100 + i);
+    }
+    mqtt_in_flight_stat_t stat = {};
+    mqtt_in_flight_get_stat(&stat, 200);
+    ASSERT_EQ(MQTT_IN_FLIGHT_MAX_NUM_MSGS, stat.num_in_flight);
+    ASSERT_EQ(0, stat.cnt_lost);
+
+    // The oldest message is dropped
+    mqtt_in_flight_on_publish(1000, 200);
+    mqtt_in_flight_get_stat(&stat, 200);
+    ASSERT_EQ(MQTT_IN_FLIGHT_MAX_NUM_MSGS, stat.num_in_flight);
+    ASSERT_EQ(MQTT_IN_FLIGHT_MAX_NUM_MSGS + 1, stat.cnt_published);
+    ASSERT_EQ(1, stat.cnt_lost);
+    ASSERT_FALSE(mqtt_in_flight_on_ack(1, 210));
+    ASSERT_TRUE(mqtt_in_flight_on_ack(2, 210));
+    ASSERT_TRUE(mqtt_in_flight_on_ack(1000, 210));
+
+    mqtt_in_flight_clear();
+    mqtt_in_flight_get_stat(&stat, 220);
+    ASSERT_EQ(0, stat.num_in_flight);
+    ASSERT_EQ(2, stat.cnt_acked);
+    ASSERT_EQ(1 + MQTT_IN_FLIGHT_MAX_NUM_MSGS - 2, stat.cnt_lost);
+}
+
+TEST_F(TestMqttInFlight, test_init_on_restart) // NOLINT
+{
+    mqtt_in_flight_on_publish(1, 100);
+    mqtt_in_flight_on_publish(2, 100);
+    ASSERT_TRUE(mqtt_in_flight_on_ack(1, 110));
+
+    // The MQTT client is restarted - the message which was not acknowledged is not tracked anymore
+    mqtt_in_flight_init();
+    mqtt_in_flight_stat_t stat = {};
+    mqtt_in_flight_get_stat(&stat, 120);
+    ASSERT_EQ(0, stat.num_in_flight);
+    ASSERT_EQ(0, stat.cnt_published);
+    ASSERT_EQ(0, stat.cnt_acked);
+    ASSERT_EQ(0, stat.cnt_lost);
+    ASSERT_FALSE(mqtt_in_flight_on_ack(2, 130));
+}
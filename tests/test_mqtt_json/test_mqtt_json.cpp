@@ -481,3 +481,72 @@ TEST_F(TestMqttJson, test_decoded_df6) // NOLINT
     ASSERT_EQ(2, this->m_malloc_cnt);
     ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
 }
+
+TEST_F(TestMqttJson, test_reusable_gen) // NOLINT
+{
+    const time_t                 timestamp     = 1612358920;
+    const mac_address_str_t      gw_mac_addr   = { .str_buf = "AA:CC:EE:00:11:22" };
+    const char*                  p_coordinates = "";
+    const std::array<uint8_t, 1> data          = { 0xAAU };
+
+    adv_report_t adv_report = {
+        .timestamp = 1612358929,
+        .tag_mac   = { 0xaa, 0xbb, 0xcc, 0x01, 0x02, 0x03 },
+        .rssi      = -70,
+        .data_len  = data.size(),
+    };
+    memcpy(adv_report.data_buf, data.data(), data.size());
+
+    mqtt_json_gen_t json_gen = {};
+    size_t          json_len = 0;
+
+    const char* p_json = mqtt_json_gen_generate(
+        &json_gen,
+        &adv_report,
+        false,
+        timestamp,
+        &gw_mac_addr,
+        p_coordinates,
+        GW_CFG_MQTT_DATA_FORMAT_RUUVI_RAW,
+        &json_len);
+    ASSERT_NE(nullptr, p_json);
+    const string exp_json1 = string("{"
+                                    "\"gw_mac\":\"AA:CC:EE:00:11:22\","
+                                    "\"rssi\":-70,"
+                                    "\"aoa\":[],"
+                                    "\"cnt\":1612358929,"
+                                    "\"data\":\"AA\","
+                                    "\"coords\":\"\""
+                                    "}");
+    ASSERT_EQ(exp_json1, string(p_json));
+    ASSERT_EQ(exp_json1.length(), json_len);
+    ASSERT_EQ(1, this->m_malloc_cnt);
+
+    // The second message is generated by the same generator without allocating memory
+    adv_report.rssi = -60;
+    p_json          = mqtt_json_gen_generate(
+        &json_gen,
+        &adv_report,
+        false,
+        timestamp,
+        &gw_mac_addr,
+        p_coordinates,
+        GW_CFG_MQTT_DATA_FORMAT_RUUVI_RAW,
+        &json_len);
+    ASSERT_NE(nullptr, p_json);
+    const string exp_json2 = string("{"
+                                    "\"gw_mac\":\"AA:CC:EE:00:11:22\","
+                                    "\"rssi\":-60,"
+                                    "\"aoa\":[],"
+                                    "\"cnt\":1612358929,"
+                                    "\"data\":\"AA\","
+                                    "\"coords\":\"\""
+                                    "}");
+    ASSERT_EQ(exp_json2, string(p_json));
+    ASSERT_EQ(exp_json2.length(), json_len);
+    ASSERT_EQ(1, this->m_malloc_cnt);
+
+    mqtt_json_gen_deinit(&json_gen);
+    ASSERT_EQ(nullptr, json_gen.p_gen);
+    ASSERT_TRUE(this->m_mem_alloc_trace.is_empty());
+}
@@ -0,0 +1,170 @@
+/**
+ * @file test_uart_capture.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "uart_capture.h"
+#include <cstring>
+#include "gtest/gtest.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestUartCapture : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+    }
+
+    void
+    TearDown() override
+    {
+    }
+
+public:
+    TestUartCapture();
+
+    ~TestUartCapture() override;
+};
+
+TestUartCapture::TestUartCapture()
+    : Test()
+{
+}
+
+TestUartCapture::~TestUartCapture() = default;
+
+static re_ca_uart_payload_t
+test_make_adv_msg(const uint8_t adv_len)
+{
+    re_ca_uart_payload_t msg = {};
+    msg.cmd                  = RE_CA_UART_ADV_RPRT2;
+
+    re_ca_uart_ble_adv_t* const p_adv = &msg.params.adv;
+    const uint8_t               mac[] = { 0xAA, 0xBB, 0xCC, 0x01, 0x02, 0x03 };
+    memcpy(p_adv->mac, mac, sizeof(mac));
+    p_adv->rssi_db       = -70;
+    p_adv->primary_phy   = RE_CA_UART_BLE_PHY_1MBPS;
+    p_adv->secondary_phy = RE_CA_UART_BLE_PHY_2MBPS;
+    p_adv->ch_index      = 37;
+    p_adv->is_coded_phy  = false;
+    p_adv->tx_power      = -4;
+    p_adv->adv_len       = adv_len;
+    for (uint32_t i = 0; i < adv_len; ++i)
+    {
+        p_adv->adv[i] = (uint8_t)(i + 1);
+    }
+    return msg;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+TEST_F(TestUartCapture, test_serialize_deserialize) // NOLINT
+{
+    const re_ca_uart_payload_t msg                             = test_make_adv_msg(24);
+    uint8_t                    buf[UART_CAPTURE_REC_MAX_SIZE] = {};
+    ASSERT_EQ(UART_CAPTURE_REC_HDR_SIZE + 24, uart_capture_serialize(&msg, 0x12345678U, buf, sizeof(buf)));
+
+    // The time is saved in little-endian order at the beginning of the record
+    ASSERT_EQ(0x78, buf[0]);
+    ASSERT_EQ(0x56, buf[1]);
+    ASSERT_EQ(0x34, buf[2]);
+    ASSERT_EQ(0x12, buf[3]);
+    ASSERT_EQ(24, buf[UART_CAPTURE_REC_HDR_SIZE - 1]);
+
+    uint32_t             time_ms = 0;
+    re_ca_uart_payload_t msg2    = {};
+    ASSERT_EQ(UART_CAPTURE_REC_HDR_SIZE + 24, uart_capture_deserialize(buf, sizeof(buf), &time_ms, &msg2));
+    ASSERT_EQ(0x12345678U, time_ms);
+    ASSERT_EQ(msg.cmd, msg2.cmd);
+    ASSERT_EQ(0, memcmp(msg.params.adv.mac, msg2.params.adv.mac, sizeof(msg.params.adv.mac)));
+    ASSERT_EQ(msg.params.adv.rssi_db, msg2.params.adv.rssi_db);
+    ASSERT_EQ(msg.params.adv.primary_phy, msg2.params.adv.primary_phy);
+    ASSERT_EQ(msg.params.adv.secondary_phy, msg2.params.adv.secondary_phy);
+    ASSERT_EQ(msg.params.adv.ch_index, msg2.params.adv.ch_index);
+    ASSERT_EQ(msg.params.adv.is_coded_phy, msg2.params.adv.is_coded_phy);
+    ASSERT_EQ(msg.params.adv.tx_power, msg2.params.adv.tx_power);
+    ASSERT_EQ(msg.params.adv.adv_len, msg2.params.adv.adv_len);
+    ASSERT_EQ(0, memcmp(msg.params.adv.adv, msg2.params.adv.adv, msg.params.adv.adv_len));
+}
+
+TEST_F(TestUartCapture, test_serialize_sequence_of_records) // NOLINT
+{
+    uint8_t buf[2 * UART_CAPTURE_REC_MAX_SIZE] = {};
+    size_t  len                                = 0;
+    for (uint8_t adv_len = 10; adv_len <= 11; ++adv_len)
+    {
+        const re_ca_uart_payload_t msg = test_make_adv_msg(adv_len);
+        len += uart_capture_serialize(&msg, adv_len, &buf[len], sizeof(buf) - len);
+    }
+    ASSERT_EQ(2 * UART_CAPTURE_REC_HDR_SIZE + 10 + 11, len);
+
+    size_t offset = 0;
+    for (uint8_t adv_len = 10; adv_len <= 11; ++adv_len)
+    {
+        uint32_t             time_ms  = 0;
+        re_ca_uart_payload_t msg      = {};
+        const size_t         rec_size = uart_capture_deserialize(&buf[offset], len - offset, &time_ms, &msg);
+        ASSERT_EQ(UART_CAPTURE_REC_HDR_SIZE + adv_len, rec_size);
+        ASSERT_EQ(adv_len, time_ms);
+        ASSERT_EQ(adv_len, msg.params.adv.adv_len);
+        offset += rec_size;
+    }
+    ASSERT_EQ(len, offset);
+}
+
+TEST_F(TestUartCapture, test_serialize_buffer_too_small) // NOLINT
+{
+    const re_ca_uart_payload_t msg                             = test_make_adv_msg(24);
+    uint8_t                    buf[UART_CAPTURE_REC_MAX_SIZE] = {};
+    ASSERT_EQ(0, uart_capture_serialize(&msg, 0, buf, UART_CAPTURE_REC_HDR_SIZE + 23));
+    ASSERT_EQ(UART_CAPTURE_REC_HDR_SIZE + 24, uart_capture_serialize(&msg, 0, buf, UART_CAPTURE_REC_HDR_SIZE + 24));
+}
+
+TEST_F(TestUartCapture, test_serialize_not_adv) // NOLINT
+{
+    re_ca_uart_payload_t msg                             = test_make_adv_msg(24);
+    uint8_t              buf[UART_CAPTURE_REC_MAX_SIZE] = {};
+    msg.cmd                                             = RE_CA_UART_DEVICE_ID;
+    ASSERT_EQ(0, uart_capture_serialize(&msg, 0, buf, sizeof(buf)));
+}
+
+TEST_F(TestUartCapture, test_deserialize_incomplete_record) // NOLINT
+{
+    const re_ca_uart_payload_t msg                             = test_make_adv_msg(24);
+    uint8_t                    buf[UART_CAPTURE_REC_MAX_SIZE] = {};
+    const size_t               rec_size = uart_capture_serialize(&msg, 0, buf, sizeof(buf));
+    ASSERT_NE(0, rec_size);
+
+    uint32_t             time_ms = 0;
+    re_ca_uart_payload_t msg2    = {};
+    ASSERT_EQ(0, uart_capture_deserialize(buf, UART_CAPTURE_REC_HDR_SIZE - 1, &time_ms, &msg2));
+    ASSERT_EQ(0, uart_capture_deserialize(buf, rec_size - 1, &time_ms, &msg2));
+    ASSERT_EQ(rec_size, uart_capture_deserialize(buf, rec_size, &time_ms, &msg2));
+}
+
+TEST_F(TestUartCapture, test_deserialize_invalid_record) // NOLINT
+{
+    const re_ca_uart_payload_t msg                             = test_make_adv_msg(24);
+    uint8_t                    buf[UART_CAPTURE_REC_MAX_SIZE] = {};
+    ASSERT_NE(0, uart_capture_serialize(&msg, 0, buf, sizeof(buf)));
+
+    uint32_t             time_ms = 0;
+    re_ca_uart_payload_t msg2    = {};
+
+    uint8_t buf2[UART_CAPTURE_REC_MAX_SIZE + 1] = {};
+    memcpy(buf2, buf, sizeof(buf));
+    buf2[UART_CAPTURE_REC_HDR_SIZE - 1] = (uint8_t)(UART_CAPTURE_ADV_MAX_LEN + 1);
+    ASSERT_EQ(0, uart_capture_deserialize(buf2, sizeof(buf2), &time_ms, &msg2));
+
+    buf[4] = (uint8_t)RE_CA_UART_DEVICE_ID;
+    ASSERT_EQ(0, uart_capture_deserialize(buf, sizeof(buf), &time_ms, &msg2));
+}
@@ -0,0 +1,572 @@
+/**
+ * @file uart_replay.cpp
+ * @author TheSomeMan
+ * @date 2026-10-18
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ *
+ * @brief Load harness which replays the advertisements captured by scripts/ruuvi_gw_uart_capture.py
+ *        into adv_post_send_report (the real adv_post.c, adv_post_cfg_cache.c and adv_table.c are used)
+ *        and prints the ingest statistics, the lock wait times and the heap high-water mark.
+ *
+ * Usage: ruuvi_gateway_esp-uart_replay <capture_file> [--speed=1|10|max] [--drain-period-ms=10000]
+ *                                      [--scan-filter-allow=MAC,...] [--scan-filter-deny=MAC,...]
+ *
+ * The records are fed from the "UART" thread with the original intervals divided by the speed factor,
+ * the "poster" thread reads the retransmission list of adv_table every drain period (of the capture time)
+ * like adv_post_async_comm does, so the contention on the adv_table mutex is close to the real one.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include "adv_post.h"
+#include "adv_post_cfg_cache.h"
+#include "adv_table.h"
+#include "uart_capture.h"
+#include "api.h"
+#include "esp_log_wrapper.hpp"
+#include "os_mutex.h"
+#include "os_malloc.h"
+#include "os_task.h"
+#include "event_mgr.h"
+#include "metrics.h"
+#include "ruuvi_device_id.h"
+#include "adv_log_ring.h"
+#include "adv_post_green_led.h"
+#include "adv_post_signals.h"
+#include "adv_post_task.h"
+#include "adv_post_timers.h"
+#include "gw_cfg.h"
+#include "ruuvi_gateway.h"
+#include "time_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+using namespace std;
+
+typedef struct replay_mutex_t
+{
+    pthread_mutex_t mutex;
+    const char*     p_name;
+    uint64_t        cnt_lock;
+    uint64_t        cnt_contended;
+    uint64_t        cnt_try_lock_failed;
+    uint64_t        wait_ns_total;
+    uint64_t        wait_ns_max;
+} replay_mutex_t;
+
+typedef struct replay_heap_hdr_t
+{
+    size_t size;
+    size_t reserved; //!< Keep the alignment of the returned block
+} replay_heap_hdr_t;
+
+static vector<replay_mutex_t*> g_replay_mutexes;
+static const char*             g_p_replay_next_mutex_name = "unknown";
+static adv_callbacks_fn_t*     g_p_replay_adv_callbacks;
+static atomic<uint64_t>        g_replay_heap_cur_size { 0 };
+static atomic<uint64_t>        g_replay_heap_max_size { 0 };
+static atomic<uint64_t>        g_replay_heap_cnt_alloc { 0 };
+static atomic<uint64_t>        g_replay_cnt_metrics_received_advs { 0 };
+static atomic<uint64_t>        g_replay_cnt_event_recv_adv { 0 };
+static atomic<uint32_t>        g_replay_capture_time_ms { 0 };
+static atomic<bool>            g_replay_flag_finished { false };
+static adv_report_table_t      g_replay_reports;
+
+static uint64_t
+replay_get_time_ns(void)
+{
+    const auto time_since_epoch = chrono::steady_clock::now().time_since_epoch();
+    return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(time_since_epoch).count();
+}
+
+extern "C" {
+
+void*
+os_malloc(const size_t size)
+{
+    replay_heap_hdr_t* const p_hdr = static_cast<replay_heap_hdr_t*>(malloc(sizeof(replay_heap_hdr_t) + size));
+    if (nullptr == p_hdr)
+    {
+        return nullptr;
+    }
+    p_hdr->size              = size;
+    const uint64_t heap_size = g_replay_heap_cur_size.fetch_add(size) + size;
+    uint64_t       heap_max  = g_replay_heap_max_size.load();
+    while ((heap_size > heap_max) && !g_replay_heap_max_size.compare_exchange_weak(heap_max, heap_size))
+    {
+    }
+    g_replay_heap_cnt_alloc += 1;
+    return p_hdr + 1;
+}
+
+void*
+os_calloc(const size_t nmemb, const size_t size)
+{
+    void* const p_mem = os_malloc(nmemb * size);
+    if (nullptr != p_mem)
+    {
+        memset(p_mem, 0, nmemb * size);
+    }
+    return p_mem;
+}
+
+void
+os_free_internal(void* p_mem)
+{
+    if (nullptr == p_mem)
+    {
+        return;
+    }
+    replay_heap_hdr_t* const p_hdr = static_cast<replay_heap_hdr_t*>(p_mem) - 1;
+    g_replay_heap_cur_size -= p_hdr->size;
+    free(p_hdr);
+}
+
+os_mutex_t
+os_mutex_create_static(os_mutex_static_t* const p_mutex_static)
+{
+    (void)p_mutex_static;
+    replay_mutex_t* const p_mutex = new replay_mutex_t {};
+    pthread_mutex_init(&p_mutex->mutex, nullptr);
+    p_mutex->p_name = g_p_replay_next_mutex_name;
+    g_replay_mutexes.push_back(p_mutex);
+    return reinterpret_cast<os_mutex_t>(p_mutex);
+}
+
+void
+os_mutex_delete(os_mutex_t* const ph_mutex)
+{
+    *ph_mutex = nullptr;
+}
+
+void
+os_mutex_lock(os_mutex_t const h_mutex)
+{
+    replay_mutex_t* const p_mutex = reinterpret_cast<replay_mutex_t*>(h_mutex);
+    if (0 != pthread_mutex_trylock(&p_mutex->mutex))
+    {
+        const uint64_t time_beg = replay_get_time_ns();
+        pthread_mutex_lock(&p_mutex->mutex);
+        const uint64_t wait_ns = replay_get_time_ns() - time_beg;
+        p_mutex->cnt_contended += 1;
+        p_mutex->wait_ns_total += wait_ns;
+        if (wait_ns > p_mutex->wait_ns_max)
+        {
+            p_mutex->wait_ns_max = wait_ns;
+        }
+    }
+    p_mutex->cnt_lock += 1;
+}
+
+bool
+os_mutex_try_lock(os_mutex_t const h_mutex)
+{
+    replay_mutex_t* const p_mutex = reinterpret_cast<replay_mutex_t*>(h_mutex);
+    if (0 != pthread_mutex_trylock(&p_mutex->mutex))
+    {
+        // The counter is updated without the lock, so it's approximate
+        p_mutex->cnt_try_lock_failed += 1;
+        return false;
+    }
+    p_mutex->cnt_lock += 1;
+    return true;
+}
+
+void
+os_mutex_unlock(os_mutex_t const h_mutex)
+{
+    replay_mutex_t* const p_mutex = reinterpret_cast<replay_mutex_t*>(h_mutex);
+    pthread_mutex_unlock(&p_mutex->mutex);
+}
+
+bool
+os_task_create_finite_without_param(
+    os_task_func_without_param_t p_func,
+    const char* const            p_name,
+    const uint32_t               stack_depth,
+    const os_task_priority_t     priority)
+{
+    // adv_post_task is not needed for the ingest path, the "poster" thread of the harness is used instead
+    (void)p_func;
+    (void)p_name;
+    (void)stack_depth;
+    (void)priority;
+    return true;
+}
+
+void
+vTaskDelay(const TickType_t xTicksToDelay)
+{
+    (void)xTicksToDelay;
+}
+
+void
+adv_post_task(void)
+{
+}
+
+bool
+adv_post_signals_is_thread_registered(void)
+{
+    return true;
+}
+
+void
+adv_post_signals_send_sig(const adv_post_sig_e adv_post_sig)
+{
+    (void)adv_post_sig;
+}
+
+void
+api_callbacks_reg(void* p_callback)
+{
+    g_p_replay_adv_callbacks = static_cast<adv_callbacks_fn_t*>(p_callback);
+}
+
+void
+adv_post_green_led_init(void)
+{
+}
+
+void
+adv_post_on_green_led_update(const adv_post_green_led_cmd_e cmd)
+{
+    (void)cmd;
+}
+
+void
+adv_post_async_comm_init(void)
+{
+}
+
+void
+adv_post_statistics_init(void)
+{
+}
+
+void
+adv_post_timers_relaunch_timer_sig_recv_adv_timeout(void)
+{
+}
+
+void
+ruuvi_send_nrf_settings_from_gw_cfg(void)
+{
+}
+
+void
+ruuvi_device_id_set(const nrf52_device_id_t* const p_nrf52_device_id, const mac_address_bin_t* const p_nrf52_mac_addr)
+{
+    (void)p_nrf52_device_id;
+    (void)p_nrf52_mac_addr;
+}
+
+bool
+gw_cfg_is_initialized(void)
+{
+    return true;
+}
+
+bool
+time_is_synchronized(void)
+{
+    return true;
+}
+
+void
+metrics_received_advs_increment(const re_ca_uart_ble_phy_e secondary_phy)
+{
+    (void)secondary_phy;
+    g_replay_cnt_metrics_received_advs += 1;
+}
+
+uint64_t
+metrics_received_advs_get(void)
+{
+    return g_replay_cnt_metrics_received_advs;
+}
+
+void
+event_mgr_notify(const event_mgr_ev_e event)
+{
+    if (EVENT_MGR_EV_RECV_ADV == event)
+    {
+        g_replay_cnt_event_recv_adv += 1;
+    }
+}
+
+int64_t
+esp_timer_get_time(void)
+{
+    // The uptime follows the time of the capture, so adv_aggr downsamples the advs as they were received
+    return (int64_t)g_replay_capture_time_ms * 1000;
+}
+
+void
+adv_log_ring_put(
+    const adv_log_ring_cb_print_t p_cb_print,
+    const char* const             p_str,
+    const uint32_t                param,
+    const time_t                  timestamp,
+    const adv_report_t* const     p_adv)
+{
+    (void)p_cb_print;
+    (void)p_str;
+    (void)param;
+    (void)timestamp;
+    (void)p_adv;
+}
+
+} // extern "C"
+
+typedef struct replay_args_t
+{
+    string                    capture_file;
+    uint32_t                  speed; //!< 0 - as fast as possible
+    uint32_t                  drain_period_ms;
+    bool                      scan_filter_allow_listed;
+    vector<mac_address_bin_t> scan_filter;
+} replay_args_t;
+
+static bool
+replay_parse_mac_list(const string& str, vector<mac_address_bin_t>& macs)
+{
+    size_t pos = 0;
+    while (pos < str.size())
+    {
+        const size_t      pos_end = str.find(',', pos);
+        const string      mac_str = str.substr(pos, (string::npos == pos_end) ? string::npos : (pos_end - pos));
+        mac_address_bin_t mac     = {};
+        unsigned int      b[MAC_ADDRESS_NUM_BYTES] = {};
+        if (MAC_ADDRESS_NUM_BYTES
+            != sscanf(mac_str.c_str(), "%02x:%02x:%02x:%02x:%02x:%02x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]))
+        {
+            fprintf(stderr, "Invalid MAC address: %s\n", mac_str.c_str());
+            return false;
+        }
+        for (uint32_t i = 0; i < MAC_ADDRESS_NUM_BYTES; ++i)
+        {
+            mac.mac[i] = (uint8_t)b[i];
+        }
+        macs.push_back(mac);
+        pos = (string::npos == pos_end) ? str.size() : (pos_end + 1);
+    }
+    return true;
+}
+
+static bool
+replay_parse_args(const int argc, char** argv, replay_args_t& args)
+{
+    args.speed           = 1;
+    args.drain_period_ms = 10000;
+    for (int i = 1; i < argc; ++i)
+    {
+        const string arg(argv[i]);
+        if (0 == arg.find("--speed="))
+        {
+            const string val = arg.substr(strlen("--speed="));
+            args.speed       = ("max" == val) ? 0 : (uint32_t)strtoul(val.c_str(), nullptr, 10);
+        }
+        else if (0 == arg.find("--drain-period-ms="))
+        {
+            args.drain_period_ms = (uint32_t)strtoul(arg.substr(strlen("--drain-period-ms=")).c_str(), nullptr, 10);
+        }
+        else if (0 == arg.find("--scan-filter-allow="))
+        {
+            args.scan_filter_allow_listed = true;
+            if (!replay_parse_mac_list(arg.substr(strlen("--scan-filter-allow=")), args.scan_filter))
+            {
+                return false;
+            }
+        }
+        else if (0 == arg.find("--scan-filter-deny="))
+        {
+            args.scan_filter_allow_listed = false;
+            if (!replay_parse_mac_list(arg.substr(strlen("--scan-filter-deny=")), args.scan_filter))
+            {
+                return false;
+            }
+        }
+        else if (args.capture_file.empty() && (0 != arg.find("--")))
+        {
+            args.capture_file = arg;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return (!args.capture_file.empty()) && (0 != args.drain_period_ms);
+}
+
+static bool
+replay_load_capture(const string& file_name, vector<uint8_t>& data)
+{
+    ifstream file(file_name, ios::binary);
+    if (!file)
+    {
+        fprintf(stderr, "Can't open file: %s\n", file_name.c_str());
+        return false;
+    }
+    data.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+    if ((data.size() < UART_CAPTURE_FILE_SIGNATURE_LEN)
+        || (0 != memcmp(data.data(), UART_CAPTURE_FILE_SIGNATURE, UART_CAPTURE_FILE_SIGNATURE_LEN)))
+    {
+        fprintf(stderr, "Invalid signature of the capture file: %s\n", file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+static void
+replay_poster_thread(const uint32_t drain_period_ms, uint64_t* const p_cnt_drained)
+{
+    uint32_t next_drain_time_ms = drain_period_ms;
+    for (;;)
+    {
+        const bool flag_finished = g_replay_flag_finished;
+        if (flag_finished || (g_replay_capture_time_ms >= next_drain_time_ms))
+        {
+            adv_table_read_retransmission_list1_and_clear(&g_replay_reports);
+            *p_cnt_drained += g_replay_reports.num_of_advs;
+            next_drain_time_ms += drain_period_ms;
+        }
+        if (flag_finished)
+        {
+            break;
+        }
+        this_thread::sleep_for(chrono::microseconds(100));
+    }
+}
+
+static void
+replay_print_report(const uint32_t num_recs, const uint64_t duration_ns, const uint64_t cnt_drained)
+{
+    adv_post_ingest_stat_t stat = {};
+    adv_post_get_ingest_stat(&stat);
+
+    printf(
+        "Replayed %" PRIu32 " records in %.3f s (%.0f records/s)\n",
+        num_recs,
+        (double)duration_ns / 1e9,
+        (0 != duration_ns) ? ((double)num_recs * 1e9 / (double)duration_ns) : 0.0);
+    printf("Ingest:\n");
+    printf("  received:              %" PRIu32 "\n", stat.cnt_recv);
+    printf("  accepted:              %" PRIu32 "\n", stat.cnt_accepted);
+    printf("  triggered:             %" PRIu32 "\n", stat.cnt_triggered);
+    printf("  dropped (downsampled): %" PRIu32 "\n", stat.cnt_dropped_aggr);
+    printf("  dropped (duplicate):   %" PRIu32 "\n", stat.cnt_dropped_duplicate);
+    printf("  dropped (not ready):   %" PRIu32 "\n", stat.cnt_dropped_not_ready);
+    printf("  dropped (not synced):  %" PRIu32 "\n", stat.cnt_dropped_not_synced);
+    printf("  dropped (parse error): %" PRIu32 "\n", stat.cnt_parse_failed);
+    printf("  filtered:              %" PRIu32 "\n", stat.cnt_filtered);
+    printf("  EVENT_MGR_EV_RECV_ADV: %" PRIu64 "\n", g_replay_cnt_event_recv_adv.load());
+    printf("  read by poster:        %" PRIu64 "\n", cnt_drained);
+    printf("Locks:\n");
+    for (const replay_mutex_t* const p_mutex : g_replay_mutexes)
+    {
+        printf(
+            "  %-20s locked %" PRIu64 ", contended %" PRIu64 ", try_lock failed %" PRIu64
+            ", wait total %.3f ms, wait max %.3f ms\n",
+            p_mutex->p_name,
+            p_mutex->cnt_lock,
+            p_mutex->cnt_contended,
+            p_mutex->cnt_try_lock_failed,
+            (double)p_mutex->wait_ns_total / 1e6,
+            (double)p_mutex->wait_ns_max / 1e6);
+    }
+    printf("Heap:\n");
+    printf("  allocations:           %" PRIu64 "\n", g_replay_heap_cnt_alloc.load());
+    printf("  high-water mark:       %" PRIu64 " bytes\n", g_replay_heap_max_size.load());
+    printf("  in use at the end:     %" PRIu64 " bytes\n", g_replay_heap_cur_size.load());
+}
+
+int
+main(int argc, char** argv)
+{
+    replay_args_t args = {};
+    if (!replay_parse_args(argc, argv, args))
+    {
+        fprintf(
+            stderr,
+            "Usage: %s <capture_file> [--speed=1|10|max] [--drain-period-ms=10000] "
+            "[--scan-filter-allow=MAC,...] [--scan-filter-deny=MAC,...]\n",
+            argv[0]);
+        return EXIT_FAILURE;
+    }
+    vector<uint8_t> data;
+    if (!replay_load_capture(args.capture_file, data))
+    {
+        return EXIT_FAILURE;
+    }
+    esp_log_wrapper_init();
+
+    g_p_replay_next_mutex_name            = "adv_post_cfg_cache";
+    adv_post_cfg_cache_t* p_cfg_cache     = adv_post_cfg_cache_mutex_lock();
+    p_cfg_cache->flag_use_ntp             = false;
+    p_cfg_cache->scan_filter_allow_listed = args.scan_filter_allow_listed;
+    p_cfg_cache->scan_filter_length       = (uint32_t)args.scan_filter.size();
+    p_cfg_cache->p_arr_of_scan_filter_mac = args.scan_filter.data();
+    adv_post_cfg_cache_mutex_unlock(&p_cfg_cache);
+
+    g_p_replay_next_mutex_name = "adv_table";
+    adv_post_init();
+    g_p_replay_next_mutex_name = "unknown";
+    if (nullptr == g_p_replay_adv_callbacks)
+    {
+        fprintf(stderr, "adv_post_init has not registered the callbacks\n");
+        return EXIT_FAILURE;
+    }
+
+    uint64_t cnt_drained = 0;
+    thread   poster(&replay_poster_thread, args.drain_period_ms, &cnt_drained);
+
+    uint32_t       num_recs      = 0;
+    size_t         offset        = UART_CAPTURE_FILE_SIGNATURE_LEN;
+    uint32_t       first_time_ms = 0;
+    const uint64_t time_start_ns = replay_get_time_ns();
+    const auto     time_start    = chrono::steady_clock::now();
+    while (offset < data.size())
+    {
+        uint32_t             time_ms  = 0;
+        re_ca_uart_payload_t msg      = {};
+        const size_t         rec_size = uart_capture_deserialize(&data[offset], data.size() - offset, &time_ms, &msg);
+        if (0 == rec_size)
+        {
+            fprintf(stderr, "Invalid record at offset %zu, the rest of the file is ignored\n", offset);
+            break;
+        }
+        offset += rec_size;
+        if (0 == num_recs)
+        {
+            first_time_ms = time_ms;
+        }
+        const uint32_t capture_time_ms = time_ms - first_time_ms;
+        if (0 != args.speed)
+        {
+            this_thread::sleep_until(
+                time_start + chrono::microseconds((uint64_t)capture_time_ms * 1000U / args.speed));
+        }
+        g_replay_capture_time_ms = capture_time_ms;
+        g_p_replay_adv_callbacks->AdvReportCallback(&msg);
+        num_recs += 1;
+    }
+    const uint64_t duration_ns = replay_get_time_ns() - time_start_ns;
+
+    g_replay_flag_finished = true;
+    poster.join();
+
+    replay_print_report(num_recs, duration_ns, cnt_drained);
+    esp_log_wrapper_deinit();
+    return EXIT_SUCCESS;
+}